@@ -0,0 +1,189 @@
+#! /bin/bash -e
+# -----------------------------------------------------------------------------
+# CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+#
+# CppAD is distributed under the terms of the
+#              Eclipse Public License Version 2.0.
+#
+# This Source Code may also be made available under the following
+# Secondary License when the conditions for such availability set forth
+# in the Eclipse Public License, Version 2.0 are satisfied:
+#       GNU General Public License, Version 2.0 or later.
+# -----------------------------------------------------------------------------
+name=`echo $0 | sed -e 's|^bug/||' -e 's|\.sh$||'`
+error='none'
+if [ "$0" != "bug/$name.sh" ]
+then
+    echo "program name is not bug/$name.sh"
+    ok='no'
+fi
+compiler="$1"
+if [ "$compiler" != 'g++' ] && [ "$compiler" != 'clang++' ]
+then
+    if [ "$compiler" != '' ]
+    then
+        echo 'complier is not g++ or clang++'
+    fi
+    ok='no'
+fi
+debug="$2"
+if [ "$debug" != 'yes' ] && [ "$debug" != 'no' ]
+then
+    if [ "$debug" != '' ]
+    then
+        echo 'debug is not yes or no'
+    fi
+    ok='no'
+fi
+opt_level="$3"
+if [[ "$opt_level" =~ "[^0-3]" ]]
+then
+    if [ "$opt_level" != '' ]
+    then
+        echo 'opt_leve is not 0, 1, 2, or 3'
+    fi
+    ok='no'
+fi
+if [ "$ok" == 'no' ]
+then
+    echo
+    echo "usage: bug/$name.sh compiler debug opt_level"
+    echo 'complier is:  g++ or clang++'
+    echo 'debug is:     yes or no'
+    echo 'opt_level is: 0, 1, 2, or 3.'
+    exit 1
+fi
+# -----------------------------------------------------------------------------
+if [ -e build/bug ]
+then
+    rm -r build/bug
+fi
+mkdir -p build/bug
+cd build/bug
+# cmake ../..
+# -----------------------------------------------------------------------------
+cat << EOF
+This is speed test (not a bug report) for the overhead of calling an atomic
+function from a tape. The atomic function computes y = x * x, so the time
+is dominated by the cost of dispatching each of the atomic function calls.
+Each call uses the result of the previous call, so the zero order forward
+calls cannot be combined into a batch.
+EOF
+cat << EOF > $name.cpp
+# include <cppad/cppad.hpp>
+# include <cppad/utility/time_test.hpp>
+namespace {
+    // ----------------------------------------------------------------------
+    // atomic_square: y = x * x
+    class atomic_square : public CppAD::atomic_four<double> {
+    public:
+        atomic_square(void) : CppAD::atomic_four<double>("square")
+        { }
+    private:
+        bool for_type(
+            size_t                                     call_id     ,
+            const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+            CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   type_y[0] = type_x[0];
+            return true;
+        }
+        bool forward(
+            size_t                              call_id     ,
+            const CppAD::vector<bool>&          select_y    ,
+            size_t                              order_low   ,
+            size_t                              order_up    ,
+            const CppAD::vector<double>&        taylor_x    ,
+            CppAD::vector<double>&              taylor_y    ) override
+        {   if( order_up > 1 )
+                return false;
+            if( order_low == 0 )
+                taylor_y[0] = taylor_x[0] * taylor_x[0];
+            if( order_up == 1 )
+                taylor_y[1] = 2.0 * taylor_x[0] * taylor_x[1];
+            return true;
+        }
+        bool reverse(
+            size_t                              call_id     ,
+            const CppAD::vector<bool>&          select_x    ,
+            size_t                              order_up    ,
+            const CppAD::vector<double>&        taylor_x    ,
+            const CppAD::vector<double>&        taylor_y    ,
+            CppAD::vector<double>&              partial_x   ,
+            const CppAD::vector<double>&        partial_y   ) override
+        {   if( order_up > 0 )
+                return false;
+            partial_x[0] = 2.0 * taylor_x[0] * partial_y[0];
+            return true;
+        }
+    };
+    // ----------------------------------------------------------------------
+    // declared here so setup is not included in the timing
+    CppAD::ADFun<double>   fun;
+    CppAD::vector<double>  x(1), w(1), y, dw;
+    //
+    void forward_zero(size_t size, size_t repeat)
+    {   while( repeat-- )
+            y = fun.Forward(0, x);
+    }
+    void reverse_one(size_t size, size_t repeat)
+    {   while( repeat-- )
+            dw = fun.Reverse(1, w);
+    }
+}
+int main(void)
+{   bool ok = true;
+    using CppAD::time_test;
+    using std::cout;
+    //
+    size_t n_call   = 1000000; // number of atomic function calls in tape
+    double time_min = 1.0;     // minimum time in seconds for each test
+    size_t repeat;             // output by time_test function
+    //
+    // fun
+    atomic_square afun;
+    CppAD::vector< CppAD::AD<double> > ax(1), ay(1);
+    ax[0] = 1.0;
+    CppAD::Independent(ax);
+    for(size_t k = 0; k < n_call; ++k)
+    {   afun(ax, ay);
+        ax = ay;
+    }
+    fun.Dependent(ay);
+    //
+    // x, w
+    x[0] = 1.0;
+    w[0] = 1.0;
+    // -----------------------------------------------------------------------
+    double forward_sec = time_test(forward_zero, time_min, n_call, repeat);
+    ok &= y[0] == 1.0;
+    cout << "forward_zero_sec=" << forward_sec << ", repeat=" << repeat << "\n";
+    cout << "nanosec_per_call=" << 1e9 * forward_sec / double(n_call) << "\n";
+    //
+    double reverse_sec = time_test(reverse_one, time_min, n_call, repeat);
+    cout << "reverse_one_sec=" << reverse_sec << ", repeat=" << repeat << "\n";
+    cout << "nanosec_per_call=" << 1e9 * reverse_sec / double(n_call);
+    // -----------------------------------------------------------------------
+    if( ok )
+        return 0;
+    return 1;
+}
+EOF
+cxx_flags="-Wall -std=c++11 -Wshadow -Wconversion -O$opt_level"
+if [ "$debug" == 'no' ]
+then
+    cxx_flags="$cxx_flags -DNDEBUG"
+fi
+echo "$compiler -I../../include $cxx_flags $name.cpp -o $name"
+$compiler -I../../include $cxx_flags $name.cpp -o $name
+#
+echo "build/bug/$name"
+if ! ./$name
+then
+    echo
+    echo "build/bug/$name: Error"
+    exit 1
+fi
+echo
+# -----------------------------------------------------------------------------
+echo "bug/$name.sh: OK"
+exit 0
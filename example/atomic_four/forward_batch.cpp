@@ -0,0 +1,178 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_forward_batch.cpp$$
+
+$section Atomic Functions and Batched Forward Mode: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using one
+$cref/forward_batch/atomic_four_forward_batch/$$ callback
+to evaluate many calls to a small atomic function.
+
+$head Function$$
+For this example, the atomic function
+$latex g : \B{R}^2 \rightarrow \B{R}$$ is defined by
+$latex g(x) = x_0 * x_1$$.
+
+$head Define Atomic Function$$
+$srcthisfile%0
+    %// BEGIN_DEFINE_ATOMIC_FUNCTION%// END_DEFINE_ATOMIC_FUNCTION%
+1%$$
+
+$head Use Atomic Function$$
+$srcthisfile%0
+    %// BEGIN_USE_ATOMIC_FUNCTION%// END_USE_ATOMIC_FUNCTION%
+1%$$
+
+$end
+*/
+# include <cppad/cppad.hpp>
+
+// BEGIN_DEFINE_ATOMIC_FUNCTION
+// empty namespace
+namespace {
+    //
+    class atomic_forward_batch : public CppAD::atomic_four<double> {
+    public:
+        // number of forward and forward_batch callbacks
+        size_t n_forward;
+        size_t n_forward_batch;
+        //
+        atomic_forward_batch(const std::string& name) :
+        CppAD::atomic_four<double>(name)
+        ,n_forward(0)
+        ,n_forward_batch(0)
+        { }
+    private:
+        // for_type
+        bool for_type(
+            size_t                                     call_id     ,
+            const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+            CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   assert( type_x.size() == 2 ); // n
+            assert( type_y.size() == 1 ); // m
+            type_y[0] = std::max(type_x[0], type_x[1]);
+            return true;
+        }
+        // forward
+        bool forward(
+            size_t                                    call_id      ,
+            const CppAD::vector<bool>&                select_y     ,
+            size_t                                    order_low    ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            CppAD::vector<double>&                    ty           ) override
+        {   // this example only implements zero order forward mode
+            if( order_up != 0 )
+                return false;
+            ++n_forward;
+            ty[0] = tx[0] * tx[1];
+            return true;
+        }
+        // forward_batch
+        bool forward_batch(
+            size_t                                    call_id      ,
+            size_t                                    n_call       ,
+            const CppAD::vector<bool>&                select_y     ,
+            size_t                                    order_low    ,
+            size_t                                    order_up     ,
+            const CppAD::vector<double>&              tx           ,
+            CppAD::vector<double>&                    ty           ) override
+        {   // this example only implements zero order forward mode
+            if( order_up != 0 )
+                return false;
+            ++n_forward_batch;
+            assert( tx.size() == 2 * n_call );
+            assert( ty.size() == n_call );
+            for(size_t c = 0; c < n_call; ++c)
+                ty[c] = tx[2 * c + 0] * tx[2 * c + 1];
+            return true;
+        }
+    };
+}
+// END_DEFINE_ATOMIC_FUNCTION
+
+// BEGIN_USE_ATOMIC_FUNCTION
+bool forward_batch(void)
+{   // ok, eps
+    bool ok = true;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+    //
+    // AD, NearEqual
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    //
+    // afun
+    atomic_forward_batch afun("atomic_forward_batch");
+    //
+    // n, au
+    // independent variables
+    size_t n = 10;
+    CPPAD_TESTVECTOR( AD<double> ) au(n);
+    for(size_t j = 0; j < n; ++j)
+        au[j] = double(j + 1);
+    CppAD::Independent(au);
+    //
+    // m, av
+    // av[j] = u[j] * u[j+1] for j < n-1, these calls do not depend on
+    // each other so they can be evaluated by one forward_batch callback
+    size_t m = n - 1;
+    CPPAD_TESTVECTOR( AD<double> ) av(m), ax(2), ay(1);
+    for(size_t j = 0; j < m; ++j)
+    {   ax[0] = au[j];
+        ax[1] = au[j+1];
+        afun(ax, ay);
+        av[j] = ay[0];
+    }
+    //
+    // aw
+    // aw = v[0] * v[1] * ... * v[m-1], each call depends on the previous call
+    AD<double> aw = av[0];
+    for(size_t j = 1; j < m; ++j)
+    {   ax[0] = aw;
+        ax[1] = av[j];
+        afun(ax, ay);
+        aw    = ay[0];
+    }
+    //
+    // f
+    CPPAD_TESTVECTOR( AD<double> ) az(m + 1);
+    for(size_t j = 0; j < m; ++j)
+        az[j] = av[j];
+    az[m] = aw;
+    CppAD::ADFun<double> f(au, az);
+    //
+    // z
+    CPPAD_TESTVECTOR(double) u(n), z(m + 1);
+    for(size_t j = 0; j < n; ++j)
+        u[j] = 1.0 + double(j) / double(n);
+    afun.n_forward       = 0;
+    afun.n_forward_batch = 0;
+    z = f.Forward(0, u);
+    //
+    // check function values
+    double check = 1.0;
+    for(size_t j = 0; j < m; ++j)
+    {   ok    &= NearEqual(z[j], u[j] * u[j+1], eps, eps);
+        check *= u[j] * u[j+1];
+    }
+    ok &= NearEqual(z[m], check, eps, eps);
+    //
+    // check number of callbacks:
+    // one batch for the av calls and one batch for each of the aw calls
+    ok &= afun.n_forward       == 0;
+    ok &= afun.n_forward_batch == 1 + (m - 1);
+    //
+    return ok;
+}
+// END_USE_ATOMIC_FUNCTION
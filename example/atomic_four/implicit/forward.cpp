@@ -0,0 +1,134 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_forward.cpp$$
+$spell
+$$
+
+$section Atomic Implicit Function Forward Mode: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using forward mode with
+the $cref atomic_four_implicit$$ class.
+
+$head F(x, p)$$
+For this example $latex F : \B{R}^2 \times \B{R}^2 \rightarrow \B{R}^2$$
+is defined by
+$latex \[
+F(x, p) = \left( \begin{array}{c}
+    x_0 x_1 - p_0 \\
+    x_0 - x_1 - p_1
+\end{array} \right)
+\] $$
+
+$head x(p)$$
+The solution of $latex F[ x(p), p ] = 0$$ with $latex x_1 > 0$$ is
+$latex \[
+\begin{array}{rcl}
+x_1 (p) & = & \left( - p_1 + \sqrt{ p_1^2 + 4 p_0 } \right) / 2
+\\
+x_0 (p) & = & x_1 (p) + p_1
+\end{array}
+\] $$
+This is used to check the results computed by the atomic function.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+bool forward(void)
+{   // ok, eps99
+    bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // fun
+    // F(x, p) with x and p in R^2
+    CPPAD_TESTVECTOR( AD<double> ) axp(4), aF(2);
+    for(size_t j = 0; j < 4; ++j)
+        axp[j] = 1.0;
+    CppAD::Independent(axp);
+    aF[0] = axp[0] * axp[1] - axp[2];
+    aF[1] = axp[0] - axp[1] - axp[3];
+    CppAD::ADFun<double> fun(axp, aF);
+    //
+    // implicit
+    CppAD::vector<double> x_start(2);
+    x_start[0] = 1.0;
+    x_start[1] = 1.0;
+    double tolerance = eps99;
+    size_t max_itr   = 20;
+    CppAD::atomic_implicit<double> implicit(
+        "implicit", fun, x_start, tolerance, max_itr
+    );
+    //
+    // f
+    // f(p) = x(p) computed using the atomic function
+    CPPAD_TESTVECTOR( AD<double> ) ap(2), ax(2);
+    ap[0] = 2.0;
+    ap[1] = 1.0;
+    CppAD::Independent(ap);
+    implicit(ap, ax);
+    CppAD::ADFun<double> f(ap, ax);
+    //
+    // g
+    // g(p) = x(p) computed using the formula for the solution
+    CppAD::Independent(ap);
+    ax[1] = ( - ap[1] + sqrt( ap[1] * ap[1] + 4.0 * ap[0] ) ) / 2.0;
+    ax[0] = ax[1] + ap[1];
+    CppAD::ADFun<double> g(ap, ax);
+    //
+    // p, p1, p2
+    CPPAD_TESTVECTOR(double) p(2), p1(2), p2(2);
+    p[0]  = 3.0;
+    p[1]  = 0.5;
+    p1[0] = 1.0;
+    p1[1] = -2.0;
+    p2[0] = 0.5;
+    p2[1] = 0.25;
+    //
+    // check zero, first, and second order forward mode
+    CPPAD_TESTVECTOR(double) fx(2), gx(2);
+    fx = f.Forward(0, p);
+    gx = g.Forward(0, p);
+    for(size_t i = 0; i < 2; ++i)
+        ok &= NearEqual(fx[i], gx[i], eps99, eps99);
+    fx = f.Forward(1, p1);
+    gx = g.Forward(1, p1);
+    for(size_t i = 0; i < 2; ++i)
+        ok &= NearEqual(fx[i], gx[i], eps99, eps99);
+    fx = f.Forward(2, p2);
+    gx = g.Forward(2, p2);
+    for(size_t i = 0; i < 2; ++i)
+        ok &= NearEqual(fx[i], gx[i], eps99, eps99);
+    //
+    // check computing orders zero through two with one call
+    CPPAD_TESTVECTOR(double) p012(6), fx012(6), gx012(6);
+    for(size_t j = 0; j < 2; ++j)
+    {   p012[j * 3 + 0] = p[j];
+        p012[j * 3 + 1] = p1[j];
+        p012[j * 3 + 2] = p2[j];
+    }
+    fx012 = f.Forward(2, p012);
+    gx012 = g.Forward(2, p012);
+    for(size_t i = 0; i < 6; ++i)
+        ok &= NearEqual(fx012[i], gx012[i], eps99, eps99);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,151 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_reverse.cpp$$
+$spell
+$$
+
+$section Atomic Implicit Function Reverse Mode: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using reverse mode with
+the $cref atomic_four_implicit$$ class.
+
+$head F(x, p)$$
+For this example $latex F : \B{R}^2 \times \B{R}^3 \rightarrow \B{R}^2$$
+is defined by
+$latex \[
+F(x, p) = \left( \begin{array}{c}
+    x_0^2 + x_1^2 - p_0 \\
+    x_0 - p_1 x_1 - p_2
+\end{array} \right)
+\] $$
+
+$head x(p)$$
+The solution of $latex F[ x(p), p ] = 0$$ with $latex x_1 > 0$$ is
+$latex \[
+\begin{array}{rcl}
+x_1 (p) & = & \left(
+    - p_1 p_2 + \sqrt{ p_1^2 p_2^2 - ( 1 + p_1^2 ) ( p_2^2 - p_0 ) }
+\right) / ( 1 + p_1^2 )
+\\
+x_0 (p) & = & p_1 x_1 (p) + p_2
+\end{array}
+\] $$
+This is used to check the results computed by the atomic function.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+bool reverse(void)
+{   // ok, eps99
+    bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // fun
+    // F(x, p) with x in R^2 and p in R^3
+    CPPAD_TESTVECTOR( AD<double> ) axp(5), aF(2);
+    for(size_t j = 0; j < 5; ++j)
+        axp[j] = 1.0;
+    CppAD::Independent(axp);
+    aF[0] = axp[0] * axp[0] + axp[1] * axp[1] - axp[2];
+    aF[1] = axp[0] - axp[3] * axp[1] - axp[4];
+    CppAD::ADFun<double> fun(axp, aF);
+    //
+    // implicit
+    CppAD::vector<double> x_start(2);
+    x_start[0] = 1.0;
+    x_start[1] = 1.0;
+    double tolerance = eps99;
+    size_t max_itr   = 20;
+    CppAD::atomic_implicit<double> implicit(
+        "implicit", fun, x_start, tolerance, max_itr
+    );
+    //
+    // f
+    // f(p) = x(p) computed using the atomic function
+    CPPAD_TESTVECTOR( AD<double> ) ap(3), ax(2);
+    ap[0] = 2.0;
+    ap[1] = 1.0;
+    ap[2] = 0.0;
+    CppAD::Independent(ap);
+    implicit(ap, ax);
+    CppAD::ADFun<double> f(ap, ax);
+    //
+    // g
+    // g(p) = x(p) computed using the formula for the solution
+    CppAD::Independent(ap);
+    AD<double> a = 1.0 + ap[1] * ap[1];
+    AD<double> b = ap[1] * ap[2];
+    AD<double> c = ap[2] * ap[2] - ap[0];
+    ax[1] = ( - b + sqrt( b * b - a * c ) ) / a;
+    ax[0] = ap[1] * ax[1] + ap[2];
+    CppAD::ADFun<double> g(ap, ax);
+    //
+    // p, p1, p2
+    CPPAD_TESTVECTOR(double) p(3), p1(3), p2(3);
+    p[0]  = 5.0;
+    p[1]  = 0.5;
+    p[2]  = 0.25;
+    p1[0] = 1.0;
+    p1[1] = -2.0;
+    p1[2] = 0.5;
+    p2[0] = 0.5;
+    p2[1] = 0.25;
+    p2[2] = -1.0;
+    //
+    // check first order reverse
+    f.Forward(0, p);
+    g.Forward(0, p);
+    CPPAD_TESTVECTOR(double) w(2), fw(3), gw(3);
+    w[0] = 1.0;
+    w[1] = -2.0;
+    fw   = f.Reverse(1, w);
+    gw   = g.Reverse(1, w);
+    for(size_t j = 0; j < 3; ++j)
+        ok &= NearEqual(fw[j], gw[j], eps99, eps99);
+    //
+    // check second order reverse
+    f.Forward(1, p1);
+    g.Forward(1, p1);
+    CPPAD_TESTVECTOR(double) w2(4), fw2(6), gw2(6);
+    w2[0 * 2 + 0] = 1.0;
+    w2[0 * 2 + 1] = 0.5;
+    w2[1 * 2 + 0] = -2.0;
+    w2[1 * 2 + 1] = 3.0;
+    fw2 = f.Reverse(2, w2);
+    gw2 = g.Reverse(2, w2);
+    for(size_t j = 0; j < 6; ++j)
+        ok &= NearEqual(fw2[j], gw2[j], eps99, eps99);
+    //
+    // check third order reverse
+    f.Forward(2, p2);
+    g.Forward(2, p2);
+    CPPAD_TESTVECTOR(double) w3(6), fw3(9), gw3(9);
+    for(size_t i = 0; i < 6; ++i)
+        w3[i] = double(i) - 2.0;
+    fw3 = f.Reverse(3, w3);
+    gw3 = g.Reverse(3, w3);
+    for(size_t j = 0; j < 9; ++j)
+        ok &= NearEqual(fw3[j], gw3[j], eps99, eps99);
+    //
+    return ok;
+}
+// END C++
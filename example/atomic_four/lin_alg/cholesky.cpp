@@ -0,0 +1,157 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_cholesky.cpp$$
+$spell
+    alg
+    Cholesky
+$$
+
+$section Atomic Cholesky Factorization: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using the $code cholesky$$ operator of
+the $cref atomic_four_lin_alg$$ class.
+
+$head f(x)$$
+For this example, the function $latex f(x)$$ is the
+lower triangular matrix $latex L$$ such that $latex L L^\R{T} = A$$
+where $latex x$$ contains the symmetric matrix $latex A$$
+in row major order.
+
+$head g(x)$$
+The function $latex g(x)$$ is the same as $latex f(x)$$
+but it is recorded using scalar operations.
+The derivatives are checked by comparing
+$latex f(x)$$ with $latex g(x)$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+//
+// ad_vector
+typedef CPPAD_TESTVECTOR( CppAD::AD<double> ) ad_vector;
+//
+// scalar_cholesky
+void scalar_cholesky(size_t n, const ad_vector& ax, ad_vector& ay)
+{   for(size_t i = 0; i < n; ++i)
+    {   for(size_t j = 0; j <= i; ++j)
+        {   CppAD::AD<double> sum = ax[i * n + j];
+            for(size_t k = 0; k < j; ++k)
+                sum -= ay[i * n + k] * ay[j * n + k];
+            if( i == j )
+                ay[i * n + j] = sqrt(sum);
+            else
+                ay[i * n + j] = sum / ay[j * n + j];
+        }
+        for(size_t j = i + 1; j < n; ++j)
+            ay[i * n + j] = 0.0;
+    }
+}
+} // END_EMPTY_NAMESPACE
+//
+// cholesky
+bool cholesky(void)
+{   // ok
+    bool ok = true;
+    //
+    // AD, NearEqual, eps99
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // lin_alg
+    typedef CppAD::atomic_lin_alg<double> lin_alg_t;
+    lin_alg_t lin_alg("lin_alg");
+    //
+    // op, n, nx, ny
+    lin_alg_t::op_enum_t op = lin_alg_t::cholesky_enum;
+    size_t n  = 4;
+    size_t nx = lin_alg_t::size_x(op, n, 0);
+    size_t ny = lin_alg_t::size_y(op, n, 0);
+    //
+    // x
+    // A is diagonally dominant and hence positive definite
+    CPPAD_TESTVECTOR(double) x(nx);
+    for(size_t i = 0; i < n; ++i)
+    {   for(size_t j = 0; j < n; ++j)
+            x[i * n + j] = 1.0 / double(i + j + 1);
+        x[i * n + i] = double(n);
+    }
+    //
+    // f
+    ad_vector ax(nx), ay(ny);
+    for(size_t j = 0; j < nx; ++j)
+        ax[j] = x[j];
+    CppAD::Independent(ax);
+    size_t call_id = lin_alg.set(op, n, 0);
+    lin_alg(call_id, ax, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g
+    CppAD::Independent(ax);
+    scalar_cholesky(n, ax, ay);
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // y
+    // zero order forward mode
+    CPPAD_TESTVECTOR(double) y(ny);
+    y = f.Forward(0, x);
+    //
+    // L * L^T = A
+    for(size_t i = 0; i < n; ++i)
+    {   for(size_t j = 0; j <= i; ++j)
+        {   double sum = 0.0;
+            for(size_t k = 0; k <= j; ++k)
+                sum += y[i * n + k] * y[j * n + k];
+            ok &= NearEqual(sum, x[i * n + j], eps99, eps99);
+        }
+        for(size_t j = i + 1; j < n; ++j)
+            ok &= y[i * n + j] == 0.0;
+    }
+    //
+    // y1
+    // first order forward mode
+    CPPAD_TESTVECTOR(double) x1(nx), check(ny);
+    for(size_t j = 0; j < nx; ++j)
+        x1[j] = double(j % 3) + 1.0;
+    g.Forward(0, x);
+    y     = f.Forward(1, x1);
+    check = g.Forward(1, x1);
+    for(size_t i = 0; i < ny; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+    //
+    // dw
+    // second order reverse mode
+    CPPAD_TESTVECTOR(double) w(ny * 2), dw(nx * 2), check_dw(nx * 2);
+    for(size_t k = 0; k < ny * 2; ++k)
+        w[k] = double(k % 5) + 1.0;
+    dw       = f.Reverse(2, w);
+    check_dw = g.Reverse(2, w);
+    for(size_t k = 0; k < nx * 2; ++k)
+        ok &= NearEqual(dw[k], check_dw[k], eps99, eps99);
+    //
+    // upper triangle of A is not used
+    for(size_t i = 0; i < n; ++i)
+    {   for(size_t j = i + 1; j < n; ++j)
+            ok &= dw[ (i * n + j) * 2 + 0 ] == 0.0;
+    }
+    //
+    return ok;
+}
+// END C++
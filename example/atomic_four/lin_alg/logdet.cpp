@@ -0,0 +1,131 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_logdet.cpp$$
+$spell
+    alg
+    logdet
+    det
+$$
+
+$section Atomic Log-Determinant: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using the $code logdet$$ operator of
+the $cref atomic_four_lin_alg$$ class.
+
+$head f(x)$$
+For this example, the function $latex f(x)$$ is
+$latex \[
+f(x) = \log \det \left( \begin{array}{cc}
+x_0 & x_2  \\
+x_2 & x_3
+\end{array} \right)
+= \log ( x_0 x_3 - x_2^2 )
+\] $$
+The component $latex x_1$$ corresponds to the upper triangle and
+is not used.
+
+$head Jacobian of f(x)$$
+The Jacobian of $latex f(x)$$ is
+$latex \[
+f^{(1)} (x) = \left( \begin{array}{cccc}
+x_3 / d & 0 & - 2 x_2 / d & x_0 / d
+\end{array} \right)
+\] $$
+where $latex d = x_0 x_3 - x_2^2$$.
+
+$head Hessian$$
+The Hessian of $latex f(x)$$ is
+$latex f^{(2)} (x) = - f^{(1)} (x)^\R{T} f^{(1)} (x) + D / d$$
+where the only non-zero elements of $latex D$$ are
+$latex D_{0,3} = D_{3,0} = 1$$ and $latex D_{2,2} = -2$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+bool logdet(void)
+{   // ok
+    bool ok = true;
+    //
+    // AD, NearEqual, eps99
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // lin_alg
+    typedef CppAD::atomic_lin_alg<double> lin_alg_t;
+    lin_alg_t lin_alg("lin_alg");
+    //
+    // op, n, nx, ny
+    lin_alg_t::op_enum_t op = lin_alg_t::logdet_enum;
+    size_t n  = 2;
+    size_t nx = lin_alg_t::size_x(op, n, 0);
+    size_t ny = lin_alg_t::size_y(op, n, 0);
+    ok       &= nx == 4;
+    ok       &= ny == 1;
+    //
+    // f
+    CPPAD_TESTVECTOR( AD<double> ) ax(nx), ay(ny);
+    for(size_t j = 0; j < nx; ++j)
+        ax[j] = 1.0;
+    CppAD::Independent(ax);
+    size_t call_id = lin_alg.set(op, n, 0);
+    lin_alg(call_id, ax, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // x, d
+    CPPAD_TESTVECTOR(double) x(nx);
+    x[0] = 3.0;
+    x[1] = 5.0; // not used
+    x[2] = 1.0;
+    x[3] = 2.0;
+    double d = x[0] * x[3] - x[2] * x[2];
+    //
+    // y
+    CPPAD_TESTVECTOR(double) y(ny);
+    y   = f.Forward(0, x);
+    ok &= NearEqual(y[0], std::log(d), eps99, eps99);
+    //
+    // J
+    CPPAD_TESTVECTOR(double) J(nx);
+    J = f.Jacobian(x);
+    //
+    // check_J
+    double check_J[] = { x[3] / d, 0.0, - 2.0 * x[2] / d, x[0] / d };
+    for(size_t j = 0; j < nx; ++j)
+        ok &= NearEqual(J[j], check_J[j], eps99, eps99);
+    //
+    // H
+    CPPAD_TESTVECTOR(double) H(nx * nx);
+    H = f.Hessian(x, 0);
+    //
+    // check_H
+    for(size_t i = 0; i < nx; ++i)
+    {   for(size_t j = 0; j < nx; ++j)
+        {   double check_H = - check_J[i] * check_J[j];
+            if( (i == 0 && j == 3) || (i == 3 && j == 0) )
+                check_H += 1.0 / d;
+            if( i == 2 && j == 2 )
+                check_H -= 2.0 / d;
+            ok &= NearEqual(H[i * nx + j], check_H, eps99, eps99);
+        }
+    }
+    //
+    return ok;
+}
+// END C++
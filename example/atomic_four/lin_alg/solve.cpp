@@ -0,0 +1,201 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_solve.cpp$$
+$spell
+    alg
+$$
+
+$section Atomic Triangular Solve: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using the
+$code solve_lower$$ and $code solve_trans$$ operators of
+the $cref atomic_four_lin_alg$$ class.
+
+$head f(x)$$
+For this example, the function $latex f(x)$$ is
+$latex X = L^{-1} B$$ or $latex X = L^{-\R{T}} B$$ where
+$latex L$$ is $icode n$$ by $icode n$$ lower triangular,
+$latex B$$ is $icode n$$ by $icode m$$,
+and $latex x$$ contains $latex L$$ and $latex B$$ in row major order.
+
+$head g(x)$$
+The function $latex g(x)$$ is the same as $latex f(x)$$
+but it is recorded using a scalar back substitution.
+The results, and their derivatives, are checked by comparing
+$latex f(x)$$ with $latex g(x)$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+//
+// ad_vector
+typedef CPPAD_TESTVECTOR( CppAD::AD<double> ) ad_vector;
+//
+// scalar_solve
+void scalar_solve(
+    bool trans, size_t n, size_t m, const ad_vector& ax, ad_vector& ay
+)
+{   for(size_t ell = 0; ell < n; ++ell)
+    {   size_t i = ell;
+        if( trans )
+            i = n - ell - 1;
+        for(size_t j = 0; j < m; ++j)
+        {   CppAD::AD<double> sum = ax[n * n + i * m + j];
+            if( trans )
+            {   for(size_t k = i + 1; k < n; ++k)
+                    sum -= ax[k * n + i] * ay[k * m + j];
+            }
+            else
+            {   for(size_t k = 0; k < i; ++k)
+                    sum -= ax[i * n + k] * ay[k * m + j];
+            }
+            ay[i * m + j] = sum / ax[i * n + i];
+        }
+    }
+}
+//
+// check_solve
+bool check_solve(bool trans)
+{   // ok
+    bool ok = true;
+    //
+    // AD, NearEqual, eps99
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // lin_alg
+    typedef CppAD::atomic_lin_alg<double> lin_alg_t;
+    lin_alg_t lin_alg("lin_alg");
+    //
+    // op, n, m
+    lin_alg_t::op_enum_t op = lin_alg_t::solve_lower_enum;
+    if( trans )
+        op = lin_alg_t::solve_trans_enum;
+    size_t n = 3, m = 2;
+    //
+    // nx, ny
+    size_t nx = lin_alg_t::size_x(op, n, m);
+    size_t ny = lin_alg_t::size_y(op, n, m);
+    //
+    // x
+    CPPAD_TESTVECTOR(double) x(nx);
+    for(size_t j = 0; j < nx; ++j)
+        x[j] = double(j + 1) / double(nx);
+    for(size_t i = 0; i < n; ++i)
+        x[i * n + i] = double(n + i);
+    //
+    // f
+    ad_vector ax(nx), ay(ny);
+    for(size_t j = 0; j < nx; ++j)
+        ax[j] = x[j];
+    CppAD::Independent(ax);
+    size_t call_id = lin_alg.set(op, n, m);
+    lin_alg(call_id, ax, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g
+    CppAD::Independent(ax);
+    scalar_solve(trans, n, m, ax, ay);
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // y
+    // zero order forward mode
+    CPPAD_TESTVECTOR(double) y(ny), check(ny);
+    y     = f.Forward(0, x);
+    check = g.Forward(0, x);
+    for(size_t i = 0; i < ny; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+    //
+    // op(L) * X = B
+    for(size_t i = 0; i < n; ++i)
+    {   for(size_t j = 0; j < m; ++j)
+        {   double sum = 0.0;
+            for(size_t k = 0; k < n; ++k)
+            {   double L_ik = 0.0;
+                if( trans && i <= k )
+                    L_ik = x[k * n + i];
+                if( (! trans) && k <= i )
+                    L_ik = x[i * n + k];
+                sum += L_ik * y[k * m + j];
+            }
+            ok &= NearEqual(sum, x[n * n + i * m + j], eps99, eps99);
+        }
+    }
+    //
+    // y1, y2
+    // first and second order forward mode
+    CPPAD_TESTVECTOR(double) x1(nx), x2(nx);
+    for(size_t j = 0; j < nx; ++j)
+    {   x1[j] = double(j % 3) + 1.0;
+        x2[j] = double(j % 2);
+    }
+    y     = f.Forward(1, x1);
+    check = g.Forward(1, x1);
+    for(size_t i = 0; i < ny; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+    y     = f.Forward(2, x2);
+    check = g.Forward(2, x2);
+    for(size_t i = 0; i < ny; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+    //
+    // dw
+    // third order reverse mode
+    CPPAD_TESTVECTOR(double) w(ny * 3), dw(nx * 3), check_dw(nx * 3);
+    for(size_t k = 0; k < ny * 3; ++k)
+        w[k] = double(k % 4) + 1.0;
+    dw       = f.Reverse(3, w);
+    check_dw = g.Reverse(3, w);
+    for(size_t k = 0; k < nx * 3; ++k)
+        ok &= NearEqual(dw[k], check_dw[k], eps99, eps99);
+    //
+    // af
+    // use base2ad to compute the derivative of f using AD<double> operations
+    CppAD::ADFun< AD<double>, double> af = f.base2ad();
+    CppAD::Independent(ax);
+    af.Forward(0, ax);
+    ad_vector aw(ny), adw(nx);
+    for(size_t i = 0; i < ny; ++i)
+        aw[i] = w[i];
+    adw = af.Reverse(1, aw);
+    CppAD::ADFun<double> h(ax, adw);
+    //
+    // check h(x) = w^T f'(x)
+    CPPAD_TESTVECTOR(double) w1(ny);
+    for(size_t i = 0; i < ny; ++i)
+        w1[i] = w[i];
+    g.Forward(0, x);
+    check_dw = g.Reverse(1, w1);
+    dw       = h.Forward(0, x);
+    for(size_t j = 0; j < nx; ++j)
+        ok &= NearEqual(dw[j], check_dw[j], eps99, eps99);
+    //
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+//
+// solve
+bool solve(void)
+{   bool ok = true;
+    ok     &= check_solve(false);
+    ok     &= check_solve(true);
+    return ok;
+}
+// END C++
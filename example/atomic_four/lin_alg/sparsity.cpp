@@ -0,0 +1,174 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_sparsity.cpp$$
+$spell
+    alg
+    Jacobian
+$$
+
+$section Atomic Linear Algebra Sparsity Patterns: Example and Test$$
+
+$head Purpose$$
+This example demonstrates computing sparsity patterns with
+the $cref atomic_four_lin_alg$$ class.
+
+$head f(x)$$
+For this example, the function $latex f(x)$$ is
+$latex \[
+f(x) =
+\left( \begin{array}{cc}
+x_0 & 0  \\
+x_2 & x_3
+\end{array} \right)^{-1}
+\left( \begin{array}{c}
+x_4  \\
+x_5
+\end{array} \right)
+=
+\left( \begin{array}{c}
+x_4 / x_0  \\
+( x_5 - x_2 x_4 / x_0 ) / x_3
+\end{array} \right)
+\] $$
+The component $latex x_1$$ corresponds to the upper triangle and
+is not used.
+
+$head Jacobian Sparsity$$
+The Jacobian sparsity pattern for $latex f(x)$$ is
+$latex \[
+\left( \begin{array}{cccccc}
+1 & 0 & 0 & 0 & 1 & 0 \\
+1 & 0 & 1 & 1 & 1 & 1
+\end{array} \right)
+\] $$
+
+$head Hessian Sparsity$$
+The sparsity pattern for the Hessian of $latex f_0 (x) + f_1 (x)$$
+contains all the pairs of the components
+$latex \{ 0, 2, 3, 4, 5 \}$$
+except for the pairs where both components are in $latex \{ 4, 5 \}$$
+(because $latex f(x)$$ is linear w.r.t. the right hand side).
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+bool sparsity(void)
+{   // ok
+    bool ok = true;
+    //
+    // AD
+    using CppAD::AD;
+    //
+    // sparsity_pattern
+    typedef CppAD::sparse_rc< CPPAD_TESTVECTOR(size_t) > sparsity_pattern;
+    //
+    // lin_alg
+    typedef CppAD::atomic_lin_alg<double> lin_alg_t;
+    lin_alg_t lin_alg("lin_alg");
+    //
+    // op, n, m, nx, ny
+    lin_alg_t::op_enum_t op = lin_alg_t::solve_lower_enum;
+    size_t n  = 2, m = 1;
+    size_t nx = lin_alg_t::size_x(op, n, m);
+    size_t ny = lin_alg_t::size_y(op, n, m);
+    ok       &= nx == 6;
+    ok       &= ny == 2;
+    //
+    // f
+    CPPAD_TESTVECTOR( AD<double> ) ax(nx), ay(ny);
+    for(size_t j = 0; j < nx; ++j)
+        ax[j] = AD<double>(j + 1);
+    CppAD::Independent(ax);
+    size_t call_id = lin_alg.set(op, n, m);
+    lin_alg(call_id, ax, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    // -----------------------------------------------------------------------
+    // Jacobian sparsity
+    // -----------------------------------------------------------------------
+    //
+    // pattern_in
+    sparsity_pattern pattern_in(nx, nx, nx);
+    for(size_t j = 0; j < nx; ++j)
+        pattern_in.set(j, j, j);
+    //
+    // check_J
+    bool check_J[] = {
+        true, false, false, false, true, false,
+        true, false, true,  true,  true, true
+    };
+    //
+    for(size_t dependency = 0; dependency < 2; ++dependency)
+    {   //
+        // pattern_out
+        sparsity_pattern pattern_out;
+        bool transpose     = false;
+        bool internal_bool = false;
+        f.for_jac_sparsity(
+            pattern_in, transpose, bool(dependency), internal_bool, pattern_out
+        );
+        //
+        // J
+        CPPAD_TESTVECTOR(bool) J(ny * nx);
+        for(size_t ij = 0; ij < ny * nx; ++ij)
+            J[ij] = false;
+        for(size_t k = 0; k < pattern_out.nnz(); ++k)
+        {   size_t i = pattern_out.row()[k];
+            size_t j = pattern_out.col()[k];
+            J[i * nx + j] = true;
+        }
+        for(size_t ij = 0; ij < ny * nx; ++ij)
+            ok &= J[ij] == check_J[ij];
+    }
+    // -----------------------------------------------------------------------
+    // Hessian sparsity
+    // -----------------------------------------------------------------------
+    //
+    // select_x, select_y
+    CPPAD_TESTVECTOR(bool) select_x(nx), select_y(ny);
+    for(size_t j = 0; j < nx; ++j)
+        select_x[j] = true;
+    for(size_t i = 0; i < ny; ++i)
+        select_y[i] = true;
+    //
+    // pattern_out
+    sparsity_pattern pattern_out;
+    bool internal_bool = false;
+    f.for_hes_sparsity(select_x, select_y, internal_bool, pattern_out);
+    //
+    // H
+    CPPAD_TESTVECTOR(bool) H(nx * nx);
+    for(size_t ij = 0; ij < nx * nx; ++ij)
+        H[ij] = false;
+    for(size_t k = 0; k < pattern_out.nnz(); ++k)
+    {   size_t i = pattern_out.row()[k];
+        size_t j = pattern_out.col()[k];
+        H[i * nx + j] = true;
+    }
+    //
+    // check H
+    for(size_t i = 0; i < nx; ++i)
+    {   for(size_t j = 0; j < nx; ++j)
+        {   bool check = i != 1 && j != 1;
+            check     &= i < 4 || j < 4;
+            ok        &= H[i * nx + j] == check;
+        }
+    }
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,129 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_ode_forward.cpp$$
+$spell
+$$
+
+$section Atomic ODE Forward Mode: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using forward mode with
+the $cref atomic_four_ode$$ class.
+
+$head G(z, p)$$
+For this example $latex G : \B{R}^2 \times \B{R}^1 \rightarrow \B{R}^2$$
+is defined by
+$latex \[
+G(z, p) = \left( \begin{array}{c}
+    z_1 \\
+    - p_0 z_0
+\end{array} \right)
+\] $$
+
+$head z(r)$$
+Let $latex \omega = \sqrt{ p_0 }$$.
+The solution of $latex z_t (t) = G[ z(t) , p ]$$ is
+$latex \[
+z(r) = \left( \begin{array}{c}
+    z_0 (0) \cos( \omega r ) + z_1 (0) \sin( \omega r ) / \omega
+    \\
+    - z_0 (0) \omega \sin( \omega r ) + z_1 (0) \cos( \omega r )
+\end{array} \right)
+\] $$
+This is used to check the results computed by the atomic function.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/ode/ode.hpp>
+
+bool forward(void)
+{   // ok, eps
+    bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 1e-7;
+    //
+    // fun
+    // G(z, p) with z in R^2 and p in R^1
+    CPPAD_TESTVECTOR( AD<double> ) azp(3), aG(2);
+    for(size_t j = 0; j < 3; ++j)
+        azp[j] = 1.0;
+    CppAD::Independent(azp);
+    aG[0] = azp[1];
+    aG[1] = - azp[2] * azp[0];
+    CppAD::ADFun<double> fun(azp, aG);
+    //
+    // ode
+    double r         = 3.0;
+    double tolerance = 1e-10;
+    CppAD::atomic_ode<double> ode("ode", fun, r, tolerance);
+    //
+    // f
+    // f(x) = z(r) computed using the atomic function
+    CPPAD_TESTVECTOR( AD<double> ) ax(3), ay(2);
+    for(size_t j = 0; j < 3; ++j)
+        ax[j] = 1.0;
+    CppAD::Independent(ax);
+    ode(ax, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // ok
+    // the recording does not depend on the number of steps
+    ok &= 1 < ode.n_step();
+    ok &= f.size_var() == 1 + ax.size() + ay.size();
+    //
+    // g
+    // g(x) = z(r) computed using the formula for the solution
+    CppAD::Independent(ax);
+    AD<double> omega = sqrt( ax[2] );
+    AD<double> c     = cos( omega * r );
+    AD<double> s     = sin( omega * r );
+    ay[0] = ax[0] * c + ax[1] * s / omega;
+    ay[1] = - ax[0] * omega * s + ax[1] * c;
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // x, x1
+    CPPAD_TESTVECTOR(double) x(3), x1(3);
+    x[0]  = 1.0;
+    x[1]  = 0.5;
+    x[2]  = 4.0;
+    x1[0] = 0.5;
+    x1[1] = -1.0;
+    x1[2] = 2.0;
+    //
+    // check zero and first order forward mode
+    CPPAD_TESTVECTOR(double) fy(2), gy(2);
+    fy = f.Forward(0, x);
+    gy = g.Forward(0, x);
+    for(size_t i = 0; i < 2; ++i)
+        ok &= NearEqual(fy[i], gy[i], eps, eps);
+    fy = f.Forward(1, x1);
+    gy = g.Forward(1, x1);
+    for(size_t i = 0; i < 2; ++i)
+        ok &= NearEqual(fy[i], gy[i], eps, eps);
+    //
+    // check the Jacobian
+    CPPAD_TESTVECTOR(double) fjac(6), gjac(6);
+    fjac = f.Jacobian(x);
+    gjac = g.Jacobian(x);
+    for(size_t k = 0; k < 6; ++k)
+        ok &= NearEqual(fjac[k], gjac[k], eps, eps);
+    //
+    return ok;
+}
+// END C++
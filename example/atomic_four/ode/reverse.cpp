@@ -0,0 +1,106 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_ode_reverse.cpp$$
+$spell
+$$
+
+$section Atomic ODE Reverse Mode: Example and Test$$
+
+$head Purpose$$
+This example demonstrates using reverse mode with
+the $cref atomic_four_ode$$ class.
+
+$head G(z, p)$$
+For this example $latex G : \B{R}^1 \times \B{R}^2 \rightarrow \B{R}^1$$
+is the logistic equation
+$latex \[
+    G(z, p) = p_0 z_0 ( 1 - z_0 / p_1 )
+\] $$
+
+$head z(r)$$
+The solution of $latex z_t (t) = G[ z(t) , p ]$$ is
+$latex \[
+    z_0 (r) = \frac{ p_1 }{
+        1 + [ p_1 / z_0 (0) - 1 ] \exp( - p_0 r )
+    }
+\] $$
+This is used to check the results computed by the atomic function.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/ode/ode.hpp>
+
+bool reverse(void)
+{   // ok, eps
+    bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 1e-7;
+    //
+    // fun
+    // G(z, p) with z in R^1 and p in R^2
+    CPPAD_TESTVECTOR( AD<double> ) azp(3), aG(1);
+    for(size_t j = 0; j < 3; ++j)
+        azp[j] = 1.0;
+    CppAD::Independent(azp);
+    aG[0] = azp[1] * azp[0] * ( 1.0 - azp[0] / azp[2] );
+    CppAD::ADFun<double> fun(azp, aG);
+    //
+    // ode
+    double r         = 5.0;
+    double tolerance = 1e-10;
+    CppAD::atomic_ode<double> ode("ode", fun, r, tolerance);
+    //
+    // f
+    // f(x) = z(r) computed using the atomic function
+    CPPAD_TESTVECTOR( AD<double> ) ax(3), ay(1);
+    for(size_t j = 0; j < 3; ++j)
+        ax[j] = 1.0;
+    CppAD::Independent(ax);
+    ode(ax, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g
+    // g(x) = z(r) computed using the formula for the solution
+    CppAD::Independent(ax);
+    ay[0] = ax[2] / ( 1.0 + ( ax[2] / ax[0] - 1.0 ) * exp( - ax[1] * r ) );
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // x
+    CPPAD_TESTVECTOR(double) x(3);
+    x[0]  = 0.1;
+    x[1]  = 1.5;
+    x[2]  = 2.0;
+    //
+    // check zero order forward
+    CPPAD_TESTVECTOR(double) fy(1), gy(1);
+    fy = f.Forward(0, x);
+    gy = g.Forward(0, x);
+    ok &= NearEqual(fy[0], gy[0], eps, eps);
+    //
+    // check first order reverse
+    CPPAD_TESTVECTOR(double) w(1), fdw(3), gdw(3);
+    w[0] = 2.0;
+    fdw  = f.Reverse(1, w);
+    gdw  = g.Reverse(1, w);
+    for(size_t j = 0; j < 3; ++j)
+        ok &= NearEqual(fdw[j], gdw[j], eps, eps);
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,196 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_vector_exp.cpp$$
+
+$section Atomic Vector Exponential Example$$
+
+$head f(u, v)$$
+For this example,
+$latex f : \B{R}^{2m} \rightarrow \B{R}^m$$
+is defined by $latex f_i (u, v) = \exp( u_i v_i )$$.
+where $icode u$$ and $icode v$$ are in $latex \B{R}^m$$.
+
+$head g(u, v)$$
+For this example $latex g : \B{R}^{2m} \rightarrow \B{R}^m$$
+is defined by $latex g_i (u, v) = \partial_{u[i]}  f_i (u, v)$$
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/vector/vector.hpp>
+bool exp(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    using CppAD::AD;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // vec_op
+    // atomic vector_op object
+    CppAD::atomic_vector<double> vec_op("atomic_vector");
+    //
+    // m
+    // size of u, v
+    size_t m = 5;
+    //
+    // mul_op, exp_op
+    typedef CppAD::atomic_vector<double>::op_enum_t op_enum_t;
+    op_enum_t mul_op = CppAD::atomic_vector<double>::mul_enum;
+    op_enum_t exp_op = CppAD::atomic_vector<double>::exp_enum;
+    // -----------------------------------------------------------------------
+    // Record f(u, v) = exp(u * v)
+    // -----------------------------------------------------------------------
+    // Independent variable vector
+    CPPAD_TESTVECTOR( CppAD::AD<double> ) auv(2 * m);
+    for(size_t j = 0; j < 2 * m; ++j)
+        auv[j] = AD<double>(1 + j);
+    CppAD::Independent(auv);
+    //
+    // ay = u * v
+    CPPAD_TESTVECTOR( CppAD::AD<double> ) ay(m);
+    vec_op(mul_op, auv, ay);
+    //
+    // az = exp(ay)
+    CPPAD_TESTVECTOR( CppAD::AD<double> ) az(m);
+    vec_op(exp_op, ay, az);
+    //
+    // f
+    CppAD::ADFun<double> f(auv, az);
+    // -----------------------------------------------------------------------
+    // check forward mode on f
+    // -----------------------------------------------------------------------
+    //
+    // uv, duv
+    CPPAD_TESTVECTOR(double) uv(2 * m), duv(2 * m), dduv(2 * m);
+    for(size_t j = 0; j < 2 * m; ++j)
+    {   uv[j]   = double(1 + j) / double(4 * m);
+        duv[j]  = double(j);
+        dduv[j] = 0.0;
+    }
+    //
+    // z, dz, ddz
+    CPPAD_TESTVECTOR(double) z(m), dz(m), ddz(m);
+    z   = f.Forward(0, uv);
+    dz  = f.Forward(1, duv);
+    ddz = f.Forward(2, dduv);
+    //
+    // ok
+    for(size_t i = 0; i < m; ++i)
+    {   double u        = uv[0 * m + i];
+        double v        = uv[1 * m + i];
+        double du       = duv[0 * m + i];
+        double dv       = duv[1 * m + i];
+        double y        = u * v;
+        double dy       = du * v + u * dv;
+        double ddy      = du * dv;
+        double check_z  = std::exp(y);
+        ok             &= NearEqual( z[i] ,  check_z,  eps99, eps99);
+        double check_dz = check_z * dy;
+        ok             &= NearEqual( dz[i] ,  check_dz,  eps99, eps99);
+        double check_ddz = ( check_dz * dy + 2.0 * check_z * ddy ) / 2.0;
+        ok             &= NearEqual( ddz[i] ,  check_ddz,  eps99, eps99);
+    }
+    // -----------------------------------------------------------------------
+    // check reverse mode on f
+    // -----------------------------------------------------------------------
+    //
+    // w, dw
+    // derivative of sum_i dz[i] w.r.t (uv, duv)
+    CPPAD_TESTVECTOR(double) w(2 * m), dw(4 * m);
+    for(size_t i = 0; i < m; ++i)
+    {   w[i * 2 + 0] = 0.0;
+        w[i * 2 + 1] = 1.0;
+    }
+    f.Forward(1, duv);
+    dw = f.Reverse(2, w);
+    for(size_t i = 0; i < m; ++i)
+    {   double u        = uv[0 * m + i];
+        double v        = uv[1 * m + i];
+        double du       = duv[0 * m + i];
+        double dv       = duv[1 * m + i];
+        double ez       = std::exp(u * v);
+        double dy       = du * v + u * dv;
+        // dz = ez * dy
+        double check    = ez * v * dy + ez * dv;
+        ok &= NearEqual( dw[(0 * m + i) * 2 + 0], check, eps99, eps99);
+        check           = ez * u * dy + ez * du;
+        ok &= NearEqual( dw[(1 * m + i) * 2 + 0], check, eps99, eps99);
+        check           = ez * v;
+        ok &= NearEqual( dw[(0 * m + i) * 2 + 1], check, eps99, eps99);
+        check           = ez * u;
+        ok &= NearEqual( dw[(1 * m + i) * 2 + 1], check, eps99, eps99);
+    }
+    // -----------------------------------------------------------------------
+    // Record g_i (u, v) = \partial d/du[i] f_i (u , v)
+    // -----------------------------------------------------------------------
+    //
+    // af
+    CppAD::ADFun< AD<double>, double > af = f.base2ad();
+    //
+    // auv
+    CppAD::Independent(auv);
+    //
+    // aduv
+    CPPAD_TESTVECTOR( AD<double> ) aduv(2 * m);
+    for(size_t i = 0; i < m; ++i)
+    {   aduv[0 * m + i]  = 1.0; // du[i]
+        aduv[1 * m + i]  = 0.0; // dv[i]
+    }
+    //
+    // az
+    // use the fact that d_u[i] f_k (u, v) is zero when i != k
+    af.Forward(0, auv);
+    az = af.Forward(1, aduv);
+    CppAD::ADFun<double> g(auv, az);
+    // -----------------------------------------------------------------------
+    // check forward mode on g
+    // -----------------------------------------------------------------------
+    //
+    // z
+    z = g.Forward(0, uv);
+    //
+    // ok
+    for(size_t i = 0; i < m; ++i)
+    {   double u        = uv[0 * m + i];
+        double v        = uv[1 * m + i];
+        double check_z  = std::exp(u * v) * v;
+        ok             &= NearEqual( z[i] ,  check_z,  eps99, eps99);
+    }
+    // -----------------------------------------------------------------------
+    // check reverse mode on g
+    // -----------------------------------------------------------------------
+    //
+    // the AD<double> version of reverse_exp is used when recording h
+    CPPAD_TESTVECTOR( AD<double> ) aw(m), adw(2 * m);
+    for(size_t i = 0; i < m; ++i)
+        aw[i] = 1.0;
+    CppAD::Independent(auv);
+    af.Forward(0, auv);
+    adw = af.Reverse(1, aw);
+    CppAD::ADFun<double> h(auv, adw);
+    //
+    // duv
+    duv = h.Forward(0, uv);
+    for(size_t i = 0; i < m; ++i)
+    {   double u        = uv[0 * m + i];
+        double v        = uv[1 * m + i];
+        double ez       = std::exp(u * v);
+        ok             &= NearEqual( duv[0 * m + i], ez * v, eps99, eps99);
+        ok             &= NearEqual( duv[1 * m + i], ez * u, eps99, eps99);
+    }
+    return ok;
+}
+// END C++
@@ -0,0 +1,227 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_vector_math.cpp$$
+$spell
+    erf
+    tanh
+    sqrt
+$$
+
+$section Atomic Vector Math Functions Example$$
+
+$head f(x)$$
+For each of the operators
+$code cos$$, $code erf$$, $code log$$, $code pow$$, $code sin$$,
+$code sqrt$$, $code tanh$$,
+this example records $latex f(x)$$ using one atomic vector operation.
+
+$head g(x)$$
+The function $latex g(x)$$ is the same as $latex f(x)$$
+except that it is recorded using one $codei%AD<double>%$$ operation
+for each component of the result.
+
+$head Checks$$
+This example checks that $latex f$$ and $latex g$$ have the same
+forward mode and reverse mode derivatives (up to order two),
+the same Hessian sparsity pattern, and that the derivatives of
+$codei%base2ad(%f%)%$$ agree with the derivatives of $latex g$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/vector/vector.hpp>
+
+namespace {
+    typedef CppAD::atomic_vector<double>::op_enum_t op_enum_t;
+    //
+    // scalar_op
+    // compute y = op(u) or y = pow(u, v) using AD<double> operations
+    CppAD::AD<double> scalar_op(
+        op_enum_t                op ,
+        const CppAD::AD<double>& u  ,
+        const CppAD::AD<double>& v  )
+    {   typedef CppAD::atomic_vector<double> vec_op_t;
+        switch(op)
+        {   case vec_op_t::cos_enum:
+            return cos(u);
+
+            case vec_op_t::erf_enum:
+            return erf(u);
+
+            case vec_op_t::log_enum:
+            return log(u);
+
+            case vec_op_t::pow_enum:
+            return pow(u, v);
+
+            case vec_op_t::sin_enum:
+            return sin(u);
+
+            case vec_op_t::sqrt_enum:
+            return sqrt(u);
+
+            case vec_op_t::tanh_enum:
+            return tanh(u);
+
+            default:
+            assert(false);
+        }
+        return CppAD::AD<double>( CppAD::nan(0.0) );
+    }
+    //
+    // check_op
+    bool check_op(CppAD::atomic_vector<double>& vec_op, op_enum_t op)
+    {   bool ok = true;
+        using CppAD::NearEqual;
+        using CppAD::AD;
+        double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+        //
+        // m, n
+        size_t m = 4;
+        size_t n = m;
+        if( op == CppAD::atomic_vector<double>::pow_enum )
+            n = 2 * m;
+        //
+        // f, g
+        CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 1.0;
+        CppAD::Independent(ax);
+        vec_op(op, ax, ay);
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        CppAD::Independent(ax);
+        for(size_t i = 0; i < m; ++i)
+            ay[i] = scalar_op(op, ax[i], ax[ (n - m) + i ] );
+        CppAD::ADFun<double> g(ax, ay);
+        //
+        // x, dx, ddx
+        // (must be positive for log, pow, and sqrt)
+        CPPAD_TESTVECTOR(double) x(n), dx(n), ddx(n);
+        for(size_t j = 0; j < n; ++j)
+        {   x[j]   = 0.5 + double(j + 1) / double(n);
+            dx[j]  = double(j) / double(n);
+            ddx[j] = double(n - j) / double(n);
+        }
+        //
+        // forward mode through order two
+        CPPAD_TESTVECTOR(double) yf(m), yg(m);
+        yf = f.Forward(0, x);
+        yg = g.Forward(0, x);
+        for(size_t i = 0; i < m; ++i)
+            ok &= NearEqual( yf[i], yg[i], eps99, eps99);
+        yf = f.Forward(1, dx);
+        yg = g.Forward(1, dx);
+        for(size_t i = 0; i < m; ++i)
+            ok &= NearEqual( yf[i], yg[i], eps99, eps99);
+        yf = f.Forward(2, ddx);
+        yg = g.Forward(2, ddx);
+        for(size_t i = 0; i < m; ++i)
+            ok &= NearEqual( yf[i], yg[i], eps99, eps99);
+        //
+        // reverse mode through order three
+        CPPAD_TESTVECTOR(double) w(m * 3), dwf(n * 3), dwg(n * 3);
+        for(size_t i = 0; i < m * 3; ++i)
+            w[i] = double(i + 1) / double(m);
+        dwf = f.Reverse(3, w);
+        dwg = g.Reverse(3, w);
+        for(size_t j = 0; j < n * 3; ++j)
+            ok &= NearEqual( dwf[j], dwg[j], eps99, eps99);
+        //
+        // Hessian sparsity
+        CPPAD_TESTVECTOR(bool) select_domain(n), select_range(m);
+        for(size_t j = 0; j < n; ++j)
+            select_domain[j] = true;
+        for(size_t i = 0; i < m; ++i)
+            select_range[i] = true;
+        CppAD::sparse_rc< CPPAD_TESTVECTOR(size_t) > pattern_f, pattern_g;
+        bool internal_bool = false;
+        f.for_hes_sparsity(
+            select_domain, select_range, internal_bool, pattern_f
+        );
+        g.for_hes_sparsity(
+            select_domain, select_range, internal_bool, pattern_g
+        );
+        ok &= pattern_f.nnz() == pattern_g.nnz();
+        CPPAD_TESTVECTOR(size_t) row_major_f = pattern_f.row_major();
+        CPPAD_TESTVECTOR(size_t) row_major_g = pattern_g.row_major();
+        for(size_t k = 0; k < pattern_f.nnz() && ok; ++k)
+        {   size_t kf = row_major_f[k];
+            size_t kg = row_major_g[k];
+            ok &= pattern_f.row()[kf] == pattern_g.row()[kg];
+            ok &= pattern_f.col()[kf] == pattern_g.col()[kg];
+        }
+        //
+        // af
+        CppAD::ADFun< AD<double>, double > af = f.base2ad();
+        //
+        // h(x) = first order forward for f in the direction dx
+        CPPAD_TESTVECTOR( AD<double> ) adx(n);
+        for(size_t j = 0; j < n; ++j)
+            adx[j] = dx[j];
+        CppAD::Independent(ax);
+        af.Forward(0, ax);
+        ay = af.Forward(1, adx);
+        CppAD::ADFun<double> h(ax, ay);
+        //
+        yf = h.Forward(0, x);
+        g.Forward(0, x);
+        yg = g.Forward(1, dx);
+        for(size_t i = 0; i < m; ++i)
+            ok &= NearEqual( yf[i], yg[i], eps99, eps99);
+        //
+        // k(x) = first order reverse for f with weights w
+        CPPAD_TESTVECTOR( AD<double> ) aw(m), adw(n);
+        for(size_t i = 0; i < m; ++i)
+            aw[i] = w[i];
+        CppAD::Independent(ax);
+        af.Forward(0, ax);
+        adw = af.Reverse(1, aw);
+        CppAD::ADFun<double> k(ax, adw);
+        //
+        CPPAD_TESTVECTOR(double) dw(n), wg(m);
+        for(size_t i = 0; i < m; ++i)
+            wg[i] = w[i];
+        dw  = k.Forward(0, x);
+        g.Forward(0, x);
+        dwg = g.Reverse(1, wg);
+        for(size_t j = 0; j < n; ++j)
+            ok &= NearEqual( dw[j], dwg[j], eps99, eps99);
+        //
+        return ok;
+    }
+}
+bool math(void)
+{   bool ok = true;
+    //
+    // vec_op
+    // atomic vector_op object
+    CppAD::atomic_vector<double> vec_op("atomic_vector");
+    //
+    // ok
+    typedef CppAD::atomic_vector<double> vec_op_t;
+    ok &= check_op(vec_op, vec_op_t::cos_enum);
+    ok &= check_op(vec_op, vec_op_t::erf_enum);
+    ok &= check_op(vec_op, vec_op_t::log_enum);
+    ok &= check_op(vec_op, vec_op_t::pow_enum);
+    ok &= check_op(vec_op, vec_op_t::sin_enum);
+    ok &= check_op(vec_op, vec_op_t::sqrt_enum);
+    ok &= check_op(vec_op, vec_op_t::tanh_enum);
+    //
+    return ok;
+}
+// END C++
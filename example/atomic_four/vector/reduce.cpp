@@ -0,0 +1,216 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_vector_reduce.cpp$$
+$spell
+    sq
+$$
+
+$section Atomic Vector Reduction Example$$
+
+$head f(x)$$
+For each of the operators $code dot$$, $code norm_sq$$, and $code sum$$,
+this example records $latex f(x)$$ using one
+$cref/atomic_vector_reduce/atomic_four_vector_reduce.hpp/$$ operation.
+
+$head g(x)$$
+The function $latex g(x)$$ is the same as $latex f(x)$$
+except that it is recorded using $codei%AD<double>%$$ operations.
+
+$head Checks$$
+This example checks that $latex f$$ and $latex g$$ have the same
+forward mode and reverse mode derivatives (up to order two),
+the same Jacobian and Hessian sparsity patterns,
+and that the derivatives of
+$codei%base2ad(%f%)%$$ agree with the derivatives of $latex g$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/vector/reduce.hpp>
+
+namespace {
+    typedef CppAD::atomic_vector_reduce<double>    reduce_op_t;
+    typedef reduce_op_t::reduce_enum_t             reduce_enum_t;
+    typedef CppAD::sparse_rc< CPPAD_TESTVECTOR(size_t) > sparsity_t;
+    //
+    // same_pattern
+    bool same_pattern(const sparsity_t& pattern_f, const sparsity_t& pattern_g)
+    {   bool ok = pattern_f.nnz() == pattern_g.nnz();
+        CPPAD_TESTVECTOR(size_t) row_major_f = pattern_f.row_major();
+        CPPAD_TESTVECTOR(size_t) row_major_g = pattern_g.row_major();
+        for(size_t k = 0; k < pattern_f.nnz() && ok; ++k)
+        {   size_t kf = row_major_f[k];
+            size_t kg = row_major_g[k];
+            ok &= pattern_f.row()[kf] == pattern_g.row()[kg];
+            ok &= pattern_f.col()[kf] == pattern_g.col()[kg];
+        }
+        return ok;
+    }
+    //
+    // check_op
+    bool check_op(reduce_op_t& reduce_op, reduce_enum_t op)
+    {   bool ok = true;
+        using CppAD::NearEqual;
+        using CppAD::AD;
+        double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+        //
+        // m, n
+        size_t m = 4;
+        size_t n = m;
+        if( op == reduce_op_t::dot_enum )
+            n = 2 * m;
+        //
+        // f
+        CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = 1.0;
+        CppAD::Independent(ax);
+        reduce_op(op, ax, ay);
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        // g
+        CppAD::Independent(ax);
+        ay[0] = 0.0;
+        for(size_t i = 0; i < m; ++i)
+        {   switch(op)
+            {   case reduce_op_t::dot_enum:
+                ay[0] += ax[i] * ax[m + i];
+                break;
+
+                case reduce_op_t::norm_sq_enum:
+                ay[0] += ax[i] * ax[i];
+                break;
+
+                default:
+                ay[0] += ax[i];
+                break;
+            }
+        }
+        CppAD::ADFun<double> g(ax, ay);
+        //
+        // x, dx, ddx
+        CPPAD_TESTVECTOR(double) x(n), dx(n), ddx(n);
+        for(size_t j = 0; j < n; ++j)
+        {   x[j]   = 0.5 + double(j + 1) / double(n);
+            dx[j]  = double(j) / double(n);
+            ddx[j] = double(n - j) / double(n);
+        }
+        //
+        // forward mode through order two
+        CPPAD_TESTVECTOR(double) yf(1), yg(1);
+        yf = f.Forward(0, x);
+        yg = g.Forward(0, x);
+        ok &= NearEqual( yf[0], yg[0], eps99, eps99);
+        yf = f.Forward(1, dx);
+        yg = g.Forward(1, dx);
+        ok &= NearEqual( yf[0], yg[0], eps99, eps99);
+        yf = f.Forward(2, ddx);
+        yg = g.Forward(2, ddx);
+        ok &= NearEqual( yf[0], yg[0], eps99, eps99);
+        //
+        // reverse mode through order three
+        CPPAD_TESTVECTOR(double) w(3), dwf(n * 3), dwg(n * 3);
+        for(size_t k = 0; k < 3; ++k)
+            w[k] = double(k + 2);
+        dwf = f.Reverse(3, w);
+        dwg = g.Reverse(3, w);
+        for(size_t j = 0; j < n * 3; ++j)
+            ok &= NearEqual( dwf[j], dwg[j], eps99, eps99);
+        //
+        // Jacobian sparsity
+        sparsity_t pattern_in(n, n, n), pattern_f, pattern_g;
+        for(size_t k = 0; k < n; ++k)
+            pattern_in.set(k, k, k);
+        bool transpose     = false;
+        bool dependency    = false;
+        bool internal_bool = false;
+        f.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, pattern_f
+        );
+        g.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, pattern_g
+        );
+        ok &= same_pattern(pattern_f, pattern_g);
+        //
+        // Hessian sparsity
+        CPPAD_TESTVECTOR(bool) select_domain(n), select_range(1);
+        for(size_t j = 0; j < n; ++j)
+            select_domain[j] = true;
+        select_range[0] = true;
+        f.for_hes_sparsity(
+            select_domain, select_range, internal_bool, pattern_f
+        );
+        g.for_hes_sparsity(
+            select_domain, select_range, internal_bool, pattern_g
+        );
+        ok &= same_pattern(pattern_f, pattern_g);
+        //
+        // af
+        CppAD::ADFun< AD<double>, double > af = f.base2ad();
+        //
+        // h(x) = first order forward for f in the direction dx
+        CPPAD_TESTVECTOR( AD<double> ) adx(n);
+        for(size_t j = 0; j < n; ++j)
+            adx[j] = dx[j];
+        CppAD::Independent(ax);
+        af.Forward(0, ax);
+        ay = af.Forward(1, adx);
+        CppAD::ADFun<double> h(ax, ay);
+        //
+        yf = h.Forward(0, x);
+        g.Forward(0, x);
+        yg = g.Forward(1, dx);
+        ok &= NearEqual( yf[0], yg[0], eps99, eps99);
+        //
+        // k(x) = second order reverse for f with weights w
+        CPPAD_TESTVECTOR( AD<double> ) aw(2), adw(n * 2);
+        for(size_t k = 0; k < 2; ++k)
+            aw[k] = w[k];
+        CppAD::Independent(ax);
+        af.Forward(0, ax);
+        af.Forward(1, adx);
+        adw = af.Reverse(2, aw);
+        CppAD::ADFun<double> k(ax, adw);
+        //
+        CPPAD_TESTVECTOR(double) dw(n * 2), wg(2);
+        for(size_t ell = 0; ell < 2; ++ell)
+            wg[ell] = w[ell];
+        dw  = k.Forward(0, x);
+        g.Forward(0, x);
+        g.Forward(1, dx);
+        dwg = g.Reverse(2, wg);
+        for(size_t j = 0; j < n * 2; ++j)
+            ok &= NearEqual( dw[j], dwg[j], eps99, eps99);
+        //
+        return ok;
+    }
+}
+bool reduce(void)
+{   bool ok = true;
+    //
+    // reduce_op
+    // atomic vector reduction object
+    reduce_op_t reduce_op("atomic_vector_reduce");
+    //
+    // ok
+    ok &= check_op(reduce_op, reduce_op_t::dot_enum);
+    ok &= check_op(reduce_op, reduce_op_t::norm_sq_enum);
+    ok &= check_op(reduce_op, reduce_op_t::sum_enum);
+    //
+    return ok;
+}
+// END C++
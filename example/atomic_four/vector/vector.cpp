@@ -28,10 +28,13 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 // BEGIN_SORT_THIS_LINE_PLUS_1
 extern bool add(void);
 extern bool div(void);
+extern bool exp(void);
 extern bool hes_sparsity(void);
 extern bool jac_sparsity(void);
+extern bool math(void);
 extern bool mul(void);
 extern bool neg(void);
+extern bool reduce(void);
 extern bool rev_depend(void);
 extern bool sub(void);
 // END_SORT_THIS_LINE_MINUS_1
@@ -47,10 +50,13 @@ int main(void)
     // BEGIN_SORT_THIS_LINE_PLUS_1
     Run( add,                 "add"            );
     Run( div,                 "div"            );
+    Run( exp,                 "exp"            );
     Run( hes_sparsity,        "hes_sparsity"   );
     Run( jac_sparsity,        "jac_sparsity"   );
+    Run( math,                "math"           );
     Run( mul,                 "mul"            );
     Run( neg,                 "neg"            );
+    Run( reduce,              "reduce"         );
     Run( rev_depend,          "rev_depend"     );
     Run( sub,                 "sub"            );
     // END_SORT_THIS_LINE_MINUS_1
@@ -30,7 +30,9 @@ extern bool base2ad(void);
 extern bool compare(void);
 extern bool dynamic(void);
 extern bool get_started(void);
+extern bool hes_vec(void);
 extern bool ode(void);
+extern bool revolve(void);
 
 // main program that runs all the tests
 int main(void)
@@ -45,7 +47,9 @@ int main(void)
     Run( compare,             "compare"        );
     Run( dynamic,             "dynamic"        );
     Run( get_started,         "get_started"    );
+    Run( hes_vec,             "hes_vec"        );
     Run( ode,                 "ode"            );
+    Run( revolve,             "revolve"        );
     //
     // check for memory leak
     bool memory_ok = CppAD::thread_alloc::free_all();
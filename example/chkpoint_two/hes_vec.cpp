@@ -0,0 +1,162 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin chkpoint_two_hes_vec.cpp$$
+$spell
+    chk
+    vec
+$$
+
+$section Hessian Times a Vector for a Checkpoint Function: Example and Test$$
+
+$head Purpose$$
+This example computes the Hessian of
+$latex W(x) = w^\R{T} g(x)$$, one column at a time, using
+$cref chkpoint_two_hes_vec$$.
+It then checks that second order reverse mode, through a recording
+that uses the checkpoint function, gets the same result.
+
+$head g$$
+The function $latex g : \B{R}^3 \rightarrow \B{R}^2$$
+is defined by
+$latex \[
+    g(x) = \left( \begin{array}{c}
+        x_0 x_1 x_2
+        \\
+        x_1^2 \exp( x_0 )
+    \end{array} \right)
+\] $$
+
+$head Hessian$$
+The Hessian of $latex W(x) = w_0 g_0 (x) + w_1 g_1 (x)$$ is
+$latex \[
+W^{(2)} (x) = \left( \begin{array}{ccc}
+    w_1 x_1^2 \exp( x_0 )  & w_0 x_2 + 2 w_1 x_1 \exp( x_0 ) & w_0 x_1
+    \\
+    w_0 x_2 + 2 w_1 x_1 \exp( x_0 ) & 2 w_1 \exp( x_0 ) & w_0 x_0
+    \\
+    w_0 x_1 & w_0 x_0 & 0
+\end{array} \right)
+\] $$
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool hes_vec(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    typedef CPPAD_TESTVECTOR(double)       Vector;
+    typedef CPPAD_TESTVECTOR( AD<double> ) ADVector;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // g_fun
+    size_t n = 3, m = 2;
+    ADVector ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1] * ax[2];
+    ay[1] = ax[1] * ax[1] * exp( ax[0] );
+    CppAD::ADFun<double> g_fun(ax, ay);
+    //
+    // g_chk
+    bool internal_bool    = false;
+    bool use_hes_sparsity = false;
+    bool use_base2ad      = false;
+    bool use_in_parallel  = false;
+    CppAD::chkpoint_two<double> g_chk( g_fun, "g_chk",
+        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+    );
+    //
+    // x, w
+    Vector x(n), w(m);
+    x[0] = 0.5;
+    x[1] = 1.5;
+    x[2] = 2.5;
+    w[0] = 2.0;
+    w[1] = 3.0;
+    //
+    // hessian
+    double e0 = exp( x[0] );
+    Vector hessian(n * n);
+    hessian[0 * n + 0] = w[1] * x[1] * x[1] * e0;
+    hessian[0 * n + 1] = w[0] * x[2] + 2.0 * w[1] * x[1] * e0;
+    hessian[0 * n + 2] = w[0] * x[1];
+    hessian[1 * n + 1] = 2.0 * w[1] * e0;
+    hessian[1 * n + 2] = w[0] * x[0];
+    hessian[2 * n + 2] = 0.0;
+    for(size_t i = 0; i < n; ++i)
+        for(size_t j = 0; j < i; ++j)
+            hessian[i * n + j] = hessian[j * n + i];
+    //
+    // gradient
+    Vector gradient(n);
+    gradient[0] = w[0] * x[1] * x[2] + w[1] * x[1] * x[1] * e0;
+    gradient[1] = w[0] * x[0] * x[2] + 2.0 * w[1] * x[1] * e0;
+    gradient[2] = w[0] * x[0] * x[1];
+    //
+    // check hes_vec
+    // (the zero order forward sweep for g is only done for the first column)
+    Vector v(n), dw(n), hv(n);
+    for(size_t k = 0; k < n; ++k)
+    {   for(size_t j = 0; j < n; ++j)
+            v[j] = 0.0;
+        v[k] = 1.0;
+        g_chk.hes_vec(x, w, v, dw, hv);
+        for(size_t j = 0; j < n; ++j)
+        {   ok &= NearEqual(dw[j], gradient[j], eps99, eps99);
+            ok &= NearEqual(hv[j], hessian[j * n + k], eps99, eps99);
+        }
+    }
+    //
+    // f_fun
+    // a recording that uses g_chk
+    CppAD::Independent(ax);
+    g_chk(ax, ay);
+    CppAD::ADFun<double> f_fun(ax, ay);
+    //
+    // check second order reverse through g_chk
+    // (g_chk does not repeat its forward sweeps before its reverse sweep)
+    f_fun.Forward(0, x);
+    for(size_t k = 0; k < n; ++k)
+    {   for(size_t j = 0; j < n; ++j)
+            v[j] = 0.0;
+        v[k] = 1.0;
+        f_fun.Forward(1, v);
+        Vector ddw = f_fun.Reverse(2, w);
+        for(size_t j = 0; j < n; ++j)
+        {   ok &= NearEqual(ddw[j * 2 + 0], gradient[j], eps99, eps99);
+            ok &= NearEqual(ddw[j * 2 + 1], hessian[j * n + k], eps99, eps99);
+        }
+    }
+    //
+    // check that a change in x is detected by hes_vec
+    x[0] = 1.0;
+    e0   = exp( x[0] );
+    v[0] = 0.0;
+    v[1] = 1.0;
+    v[2] = 0.0;
+    g_chk.hes_vec(x, w, v, dw, hv);
+    ok &= NearEqual(hv[0], w[0] * x[2] + 2.0 * w[1] * x[1] * e0, eps99, eps99);
+    ok &= NearEqual(hv[1], 2.0 * w[1] * e0, eps99, eps99);
+    ok &= NearEqual(hv[2], w[0] * x[0], eps99, eps99);
+    //
+    return ok;
+}
+// END C++
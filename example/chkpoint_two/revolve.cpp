@@ -0,0 +1,126 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin chkpoint_two_revolve.cpp$$
+$spell
+    chkpoint
+$$
+
+$section Reverse Mode Through Many Time Steps: Example and Test$$
+
+$head Purpose$$
+This example uses $cref chkpoint_two_revolve$$ to compute the
+derivative of the final state of a pendulum simulation
+with respect to its initial state.
+
+$head Step$$
+The function $latex g : \B{R}^2 \rightarrow \B{R}^2$$
+is one step of Euler's method for the pendulum equation
+$latex \[
+    g(x) = \left( \begin{array}{c}
+        x_0 + h x_1
+        \\
+        x_1 - h \sin( x_0 )
+    \end{array} \right)
+\] $$
+
+$head Check$$
+The derivative is checked by storing every state
+and using $latex T$$ reverse mode steps.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool revolve(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * CppAD::numeric_limits<double>::epsilon();
+    //
+    // g_fun
+    double h = 0.01;
+    CPPAD_TESTVECTOR( AD<double> ) ax(2), ay(2);
+    ax[0] = 0.0;
+    ax[1] = 0.0;
+    CppAD::Independent(ax);
+    ay[0] = ax[0] + h * ax[1];
+    ay[1] = ax[1] - h * sin( ax[0] );
+    CppAD::ADFun<double> g_fun(ax, ay);
+    //
+    // chk_fun
+    bool internal_bool    = false;
+    bool use_hes_sparsity = false;
+    bool use_base2ad      = false;
+    bool use_in_parallel  = false;
+    CppAD::chkpoint_two<double> chk_fun(g_fun, "pendulum_step",
+        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+    );
+    //
+    // n_step, x, w
+    size_t n_step = 1000;
+    CPPAD_TESTVECTOR(double) x(2), w(2);
+    x[0] = 1.0;
+    x[1] = 0.0;
+    w[0] = 1.0;
+    w[1] = 2.0;
+    //
+    // check_y, check_dw
+    // store every state and reverse one step at a time
+    CPPAD_TESTVECTOR(double) check_y(2), check_dw(2);
+    std::vector< CPPAD_TESTVECTOR(double) > state(n_step + 1);
+    state[0] = x;
+    for(size_t k = 0; k < n_step; ++k)
+        state[k+1] = g_fun.Forward(0, state[k]);
+    check_y  = state[n_step];
+    check_dw = w;
+    for(size_t k = n_step; k > 0; --k)
+    {   g_fun.Forward(0, state[k-1]);
+        check_dw = g_fun.Reverse(1, check_dw);
+    }
+    //
+    // n_snapshot
+    for(size_t n_snapshot = 2; n_snapshot < 30; n_snapshot += 9)
+    {   //
+        // y, dw, n_forward
+        CPPAD_TESTVECTOR(double) y(2), dw(2);
+        size_t n_forward = chk_fun.revolve(
+            n_step, n_snapshot, x, w, y, dw
+        );
+        //
+        // n_repeat
+        // number of times a step may be repeated with n_snapshot states
+        size_t n_repeat = 0;
+        double n_reverse = 1.0;
+        while( n_reverse < double(n_step) )
+        {   ++n_repeat;
+            n_reverse = 1.0;
+            for(size_t i = 1; i <= n_snapshot; ++i)
+                n_reverse = n_reverse * double(n_repeat + i) / double(i);
+        }
+        ok &= n_step <= n_forward;
+        ok &= n_forward <= (n_repeat + 1) * n_step;
+        //
+        // check y, dw
+        for(size_t j = 0; j < 2; ++j)
+        {   ok &= NearEqual(y[j], check_y[j], eps99, eps99);
+            ok &= NearEqual(dw[j], check_dw[j], eps99, eps99);
+        }
+    }
+    return ok;
+}
+// END C++
@@ -0,0 +1,146 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_level.cpp$$
+$spell
+    Taylor
+$$
+
+$section Forward Mode by Dependency Levels: Example and Test$$
+
+$head Runner$$
+This example uses a runner that executes the tasks in reverse order
+using the calling thread.
+This demonstrates that the results do not depend on the order in which
+the tasks are executed.
+See $cref team_level.cpp$$ for an example that executes the tasks
+using a team of threads.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    // reverse_runner
+    class reverse_runner : public CppAD::level_runner {
+    public:
+        // number of times run has been called
+        size_t n_run;
+        //
+        reverse_runner(void) : n_run(0)
+        { }
+        void run(size_t n_task, const CppAD::level_task& task) override
+        {   ++n_run;
+            for(size_t k = n_task; k > 0; --k)
+                task(k - 1);
+        }
+    };
+}
+
+bool forward_level(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variable vector
+    size_t n = 16;
+    CppAD::vector< AD<double> > ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1) / double(n);
+    Independent(ax);
+
+    // one chain of operations for each independent variable
+    // (the operators in the same step of the chains have the same level)
+    size_t n_step = 10;
+    CppAD::vector< AD<double> > ay(n);
+    for(size_t j = 0; j < n; ++j)
+    {   AD<double> az = ax[j];
+        for(size_t k = 0; k < n_step; ++k)
+            az = sin(az) * ax[ (j + 1) % n ] + cos(az) / double(k + 1);
+        ay[j] = az;
+    }
+
+    // create function objects f, g : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+    CppAD::ADFun<double> g;
+    g = f;
+
+    // the level schedule has not been computed yet
+    ok &= f.size_level() == 0;
+
+    // runner, min_width
+    reverse_runner runner;
+    size_t min_width = 4;
+
+    // zero order: compare with Forward
+    CppAD::vector<double> x(n), y(n), check(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 0.5 + double(j) / double(n);
+    y     = f.forward_level(0, x, runner, min_width);
+    check = g.Forward(0, x);
+    for(size_t i = 0; i < n; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+
+    // the runner was used and there is enough parallelism
+    ok &= 0 < runner.n_run;
+    ok &= 0 < f.size_level();
+    ok &= min_width * f.size_level() <= f.size_var();
+
+    // first order: compare with Forward
+    CppAD::vector<double> x1(n), y1(n);
+    for(size_t j = 0; j < n; ++j)
+        x1[j] = double(j % 3) + 1.0;
+    y1    = f.forward_level(1, x1, runner, min_width);
+    check = g.Forward(1, x1);
+    for(size_t i = 0; i < n; ++i)
+        ok &= NearEqual(y1[i], check[i], eps99, eps99);
+
+    // Reverse mode uses the Taylor coefficients computed by forward_level
+    CppAD::vector<double> w(n), dw(n), check_dw(n);
+    for(size_t i = 0; i < n; ++i)
+        w[i] = double(i + 1);
+    dw       = f.Reverse(1, w);
+    check_dw = g.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check_dw[j], eps99, eps99);
+
+    // orders zero and one at the same time
+    CppAD::vector<double> xq(n * 2), yq(n * 2);
+    for(size_t j = 0; j < n; ++j)
+    {   xq[2 * j + 0] = x[j];
+        xq[2 * j + 1] = x1[j];
+    }
+    yq = f.forward_level(1, xq, runner, min_width);
+    for(size_t i = 0; i < n; ++i)
+        ok &= NearEqual(yq[2 * i + 1], y1[i], eps99, eps99);
+
+    // sequential fallback when there is not enough parallelism
+    runner.n_run = 0;
+    y = f.forward_level(0, x, runner, f.size_var());
+    ok &= runner.n_run == 0;
+    check = g.Forward(0, x);
+    for(size_t i = 0; i < n; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+
+    // free the memory used for the level schedule
+    f.clear_level();
+    ok &= f.size_level() == 0;
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,104 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_live.cpp$$
+$spell
+    Taylor
+$$
+
+$section Zero Order Forward Reusing Variable Memory: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool forward_live(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variable vector
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 2.0;
+    Independent(ax);
+
+    // a long chain of operations where each intermediate result
+    // is only used by the next operation
+    size_t n_step = 100;
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < n_step; ++k)
+    {   AD<double> at = sin( ax[0] * double(k) ) + ax[1];
+        asum         += at * at;
+    }
+    // a comparison operator
+    // (only the branch taken during the recording is in the tape)
+    CppAD::vector< AD<double> > ay(2);
+    ay[0] = asum;
+    if( ax[0] < ax[1] )
+        ay[1] = ax[0] / ax[1];
+    else
+        ay[1] = ax[1] / ax[0];
+
+    // create function object f : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+
+    // compute the value using zero order forward mode
+    CppAD::vector<double> x(n), y(2), y_live(2);
+    x[0] = 0.25;
+    x[1] = 3.0;
+    y    = f.Forward(0, x);
+
+    // the liveness analysis has not been done yet
+    ok &= f.size_live() == 0;
+
+    // compute the same value reusing variable memory
+    y_live = f.forward_live(x);
+    ok    &= NearEqual(y_live[0], y[0], eps99, eps99);
+    ok    &= NearEqual(y_live[1], y[1], eps99, eps99);
+
+    // far fewer values are needed than the number of variables
+    ok &= 0 < f.size_live();
+    ok &= 10 * f.size_live() < f.size_var();
+
+    // there are no Taylor coefficients stored after forward_live
+    ok &= f.size_order() == 0;
+
+    // check a different argument value
+    x[0]   = 4.0;
+    x[1]   = 1.0;
+    y_live = f.forward_live(x);
+    double check = 0.0;
+    for(size_t k = 0; k < n_step; ++k)
+    {   double t = std::sin( x[0] * double(k) ) + x[1];
+        check   += t * t;
+    }
+    ok &= NearEqual(y_live[0], check, eps99, eps99);
+    ok &= NearEqual(y_live[1], x[0] / x[1], eps99, eps99);
+
+    // the comparison result is different from when f was recorded
+    f.compare_change_count(1);
+    y_live = f.forward_live(x);
+    ok    &= f.compare_change_number() == 1;
+
+    // free the memory used for the liveness analysis
+    f.clear_live();
+    ok &= f.size_live() == 0;
+
+    return ok;
+}
+// END C++
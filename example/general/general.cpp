@@ -125,6 +125,8 @@ extern bool exp(void);
 extern bool expm1(void);
 extern bool fabs(void);
 extern bool forward_dir(void);
+extern bool forward_level(void);
+extern bool forward_live(void);
 extern bool forward_order(void);
 extern bool fun_assign(void);
 extern bool fun_property(void);
@@ -135,6 +137,7 @@ extern bool log(void);
 extern bool log10(void);
 extern bool log1p(void);
 extern bool lu_vec_ad_ok(void);
+extern bool memo_pure(void);
 extern bool mul_level(void);
 extern bool mul_level_adolc(void);
 extern bool mul_level_adolc_ode(void);
@@ -146,12 +149,19 @@ extern bool opt_val_hes(void);
 extern bool pow(void);
 extern bool pow_nan(void);
 extern bool print_for(void);
+extern bool record_reserve(void);
 extern bool rev_checkpoint(void);
+extern bool reverse_level(void);
+extern bool reverse_live(void);
 extern bool reverse_one(void);
 extern bool reverse_three(void);
 extern bool reverse_two(void);
+extern bool share_recording(void);
 extern bool sign(void);
+extern bool slice(void);
+extern bool tape_slot(void);
 extern bool taylor_ode(void);
+extern bool var_level(void);
 extern bool vec_ad(void);
 // END_SORT_THIS_LINE_MINUS_1
 
@@ -240,6 +250,8 @@ int main(void)
     Run( expm1,             "expm1"            );
     Run( fabs,              "fabs"             );
     Run( forward_dir,       "forward_dir"      );
+    Run( forward_level,     "forward_level"    );
+    Run( forward_live,      "forward_live"     );
     Run( forward_order,     "forward_order"    );
     Run( fun_assign,        "fun_assign"       );
     Run( fun_property,      "fun_property"     );
@@ -250,6 +262,7 @@ int main(void)
     Run( log10,             "log10"            );
     Run( log1p,             "log1p"            );
     Run( lu_vec_ad_ok,      "lu_vec_ad_ok"     );
+    Run( memo_pure,         "memo_pure"        );
     Run( mul_level,         "mul_level"        );
     Run( mul_level_ode,     "mul_level_ode"    );
     Run( new_dynamic,       "new_dynamic"      );
@@ -258,12 +271,19 @@ int main(void)
     Run( opt_val_hes,       "opt_val_hes"      );
     Run( pow,               "pow"              );
     Run( pow_nan,           "pow_nan"          );
+    Run( record_reserve,    "record_reserve"   );
     Run( rev_checkpoint,    "rev_checkpoint"   );
+    Run( reverse_level,     "reverse_level"    );
+    Run( reverse_live,      "reverse_live"     );
     Run( reverse_one,       "reverse_one"      );
     Run( reverse_three,     "reverse_three"    );
     Run( reverse_two,       "reverse_two"      );
+    Run( share_recording,   "share_recording"  );
     Run( sign,              "sign"             );
+    Run( slice,             "slice"            );
+    Run( tape_slot,         "tape_slot"        );
     Run( taylor_ode,        "ode_taylor"       );
+    Run( var_level,         "var_level"        );
     Run( vec_ad,            "vec_ad"           );
     // END_SORT_THIS_LINE_MINUS_1
 # ifndef CPPAD_DEBUG_AND_RELEASE
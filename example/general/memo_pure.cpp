@@ -0,0 +1,155 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin memo_pure.cpp$$
+$spell
+    memo
+$$
+
+$section Memoize Discrete and Atomic Function Values: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    // number of times each of the functions below has been evaluated
+    size_t n_table_eval = 0;
+    size_t n_recip_eval = 0;
+    //
+    // table_lookup
+    // a discrete function that is expensive to evaluate
+    double table_lookup(const double& x)
+    {   ++n_table_eval;
+        if( x < 0.0 )
+            return 0.0;
+        if( x < 1.0 )
+            return 1.0;
+        return 2.0;
+    }
+    CPPAD_DISCRETE_FUNCTION(double, table_lookup)
+    //
+    // atomic_recip
+    // an atomic function that is expensive to evaluate
+    class atomic_recip : public CppAD::atomic_four<double> {
+    public:
+        atomic_recip(const std::string& name) :
+        CppAD::atomic_four<double>(name)
+        { }
+    private:
+        bool for_type(
+            size_t                                     call_id     ,
+            const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+            CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+        {   type_y[0] = type_x[0];
+            return true;
+        }
+        bool forward(
+            size_t                              call_id      ,
+            const CppAD::vector<bool>&          select_y     ,
+            size_t                              order_low    ,
+            size_t                              order_up     ,
+            const CppAD::vector<double>&        taylor_x     ,
+            CppAD::vector<double>&              taylor_y     ) override
+        {   if( order_up != 0 )
+                return false;
+            ++n_recip_eval;
+            taylor_y[0] = 1.0 / taylor_x[0];
+            return true;
+        }
+    };
+}
+
+bool memo_pure(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+    //
+    // afun
+    atomic_recip afun("atomic_recip");
+    //
+    // f(x) = ( table_lookup(x_0) , 1 / x_1 , 1 / x_2 )
+    size_t n = 3, m = 3;
+    CPPAD_TESTVECTOR( AD<double> ) ax(n), ay(m), au(1), av(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.5;
+    CppAD::Independent(ax);
+    ay[0] = table_lookup( ax[0] );
+    au[0] = ax[1];
+    afun(au, av);
+    ay[1] = av[0];
+    au[0] = ax[2];
+    afun(au, av);
+    ay[2] = av[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // memoization is off by default
+    ok &= ! f.memo_pure();
+    f.memo_pure(true);
+    ok &= f.memo_pure();
+    ok &= f.memo_pure_hit() == 0;
+    ok &= f.memo_pure_miss() == 0;
+    //
+    // first evaluation: every call site is a miss
+    n_table_eval = 0;
+    n_recip_eval = 0;
+    CPPAD_TESTVECTOR(double) x(n), y(m);
+    x[0] = 0.5;
+    x[1] = 2.0;
+    x[2] = 4.0;
+    y    = f.Forward(0, x);
+    ok &= y[0] == 1.0;
+    ok &= NearEqual(y[1], 1.0 / x[1], eps, eps);
+    ok &= NearEqual(y[2], 1.0 / x[2], eps, eps);
+    ok &= n_table_eval == 1;
+    ok &= n_recip_eval == 2;
+    ok &= f.memo_pure_hit()  == 0;
+    ok &= f.memo_pure_miss() == 3;
+    //
+    // only x_2 changes: only the second atomic call is evaluated
+    x[2] = 8.0;
+    y    = f.Forward(0, x);
+    ok &= y[0] == 1.0;
+    ok &= NearEqual(y[1], 1.0 / x[1], eps, eps);
+    ok &= NearEqual(y[2], 1.0 / x[2], eps, eps);
+    ok &= n_table_eval == 1;
+    ok &= n_recip_eval == 3;
+    ok &= f.memo_pure_hit()  == 2;
+    ok &= f.memo_pure_miss() == 4;
+    //
+    // only x_0 changes: only the discrete function is evaluated
+    x[0] = 1.5;
+    y    = f.Forward(0, x);
+    ok &= y[0] == 2.0;
+    ok &= NearEqual(y[1], 1.0 / x[1], eps, eps);
+    ok &= NearEqual(y[2], 1.0 / x[2], eps, eps);
+    ok &= n_table_eval == 2;
+    ok &= n_recip_eval == 3;
+    ok &= f.memo_pure_hit()  == 4;
+    ok &= f.memo_pure_miss() == 5;
+    //
+    // turning memoization off zeros the counts
+    f.memo_pure(false);
+    ok &= f.memo_pure_hit()  == 0;
+    ok &= f.memo_pure_miss() == 0;
+    y    = f.Forward(0, x);
+    ok &= n_table_eval == 3;
+    ok &= n_recip_eval == 5;
+    //
+    return ok;
+}
+// END C++
@@ -0,0 +1,84 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin record_reserve.cpp$$
+$spell
+$$
+
+$section Reserve Memory for a Recording: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    // one time step of an explicit Euler method for y' = - y * y
+    CppAD::ADFun<double> time_step(
+        double dt, size_t n_op, size_t n_arg, size_t n_par
+    )
+    {   using CppAD::AD;
+        size_t n = 10;
+        CPPAD_TESTVECTOR(AD<double>) ax(n), ay(n);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1);
+        CppAD::Independent(ax);
+        //
+        // reserve memory for the rest of this recording
+        AD<double>::record_reserve(n_op, n_arg, n_par);
+        //
+        for(size_t j = 0; j < n; ++j)
+            ay[j] = ax[j] - dt * ax[j] * ax[j];
+        //
+        return CppAD::ADFun<double>(ax, ay);
+    }
+}
+
+bool record_reserve(void)
+{   bool ok = true;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+    //
+    // first time step, no information about the size of the recording
+    double dt = 0.1;
+    CppAD::ADFun<double> f = time_step(dt, 0, 0, 0);
+    //
+    // the other time steps use the size of the previous recording
+    for(size_t k = 1; k < 3; ++k)
+    {   dt = dt / 2.0;
+        size_t n_op  = f.size_op();
+        size_t n_arg = f.size_op_arg();
+        size_t n_par = f.size_par();
+        f = time_step(dt, n_op, n_arg, n_par);
+        //
+        // the operation sequence is the same, except for the value of dt
+        ok &= f.size_op()     == n_op;
+        ok &= f.size_op_arg() == n_arg;
+        ok &= f.size_par()    == n_par;
+    }
+    //
+    // check the last recording
+    size_t n = f.Domain();
+    CPPAD_TESTVECTOR(double) x(n), y(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j) / double(n);
+    y = f.Forward(0, x);
+    for(size_t j = 0; j < n; ++j)
+        ok &= CppAD::NearEqual(y[j], x[j] - dt * x[j] * x[j], eps, eps);
+    //
+    return ok;
+}
+// END C++
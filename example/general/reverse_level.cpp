@@ -0,0 +1,124 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin reverse_level.cpp$$
+$spell
+$$
+
+$section Reverse Mode by Dependency Levels: Example and Test$$
+
+$head Function$$
+This example computes the gradient of the sum of squares
+$latex \[
+    S(x) = \sum_{i=0}^{m-1} ( x_0 + x_1 t_i + x_2 t_i^2 - d_i )^2
+\] $$
+The function $latex f(x)$$ has one range component for each term in the sum.
+The operators for the different terms are in the same levels
+but they all use the same independent variables.
+
+$head Runner$$
+This example uses a runner that executes the tasks in reverse order
+using the calling thread.
+See $cref team_reverse.cpp$$ for an example that executes the tasks
+using a team of threads.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    // reverse_runner
+    class reverse_runner : public CppAD::level_runner {
+    public:
+        // maximum number of tasks in one call to run
+        size_t max_task;
+        //
+        reverse_runner(void) : max_task(0)
+        { }
+        void run(size_t n_task, const CppAD::level_task& task) override
+        {   max_task = std::max(max_task, n_task);
+            for(size_t k = n_task; k > 0; --k)
+                task(k - 1);
+        }
+    };
+}
+
+bool reverse_level(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // f(x)
+    size_t n = 3, m = 40;
+    CppAD::vector< AD<double> > ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.0;
+    Independent(ax);
+    for(size_t i = 0; i < m; ++i)
+    {   double t       = double(i) / double(m);
+        double d       = std::exp(t);
+        AD<double> res = ax[0] + ax[1] * t + ax[2] * t * t - d;
+        ay[i]          = res * res;
+    }
+    CppAD::ADFun<double> f(ax, ay);
+
+    // x
+    CppAD::vector<double> x(n);
+    x[0] = 1.0;
+    x[1] = 1.0;
+    x[2] = 0.5;
+
+    // runner, min_width, n_part
+    reverse_runner runner;
+    size_t min_width = 4;
+    size_t n_part    = 4;
+
+    // gradient of S(x)
+    CppAD::vector<double> w(m), grad(n);
+    for(size_t i = 0; i < m; ++i)
+        w[i] = 1.0;
+    f.Forward(0, x);
+    grad = f.reverse_level(1, w, runner, min_width, n_part);
+
+    // the runner was used and the number of tasks is at most n_part
+    ok &= 0 < runner.max_task && runner.max_task <= n_part;
+
+    // check
+    for(size_t j = 0; j < n; ++j)
+    {   double check = 0.0;
+        for(size_t i = 0; i < m; ++i)
+        {   double t   = double(i) / double(m);
+            double res = x[0] + x[1] * t + x[2] * t * t - std::exp(t);
+            check     += 2.0 * res * std::pow(t, double(j));
+        }
+        ok &= NearEqual(grad[j], check, eps99, eps99);
+    }
+
+    // second order: Hessian of S(x) times the direction x1
+    CppAD::vector<double> x1(n), dw(n * 2), check_dw(n * 2);
+    for(size_t j = 0; j < n; ++j)
+        x1[j] = double(j + 1);
+    f.Forward(1, x1);
+    dw       = f.reverse_level(2, w, runner, min_width, n_part);
+    check_dw = f.Reverse(2, w);
+    for(size_t k = 0; k < n * 2; ++k)
+        ok &= NearEqual(dw[k], check_dw[k], eps99, eps99);
+
+    return ok;
+}
+// END C++
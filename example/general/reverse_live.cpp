@@ -0,0 +1,93 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin reverse_live.cpp$$
+$spell
+    Taylor
+$$
+
+$section First Order Reverse Reusing Variable Memory: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool reverse_live(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variable vector
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 2.0;
+    Independent(ax);
+
+    // a long chain of operations where each intermediate result
+    // is only used by the next few operations
+    size_t n_step = 200;
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < n_step; ++k)
+    {   AD<double> at = sin( ax[0] * double(k) ) + ax[1];
+        asum         += at * at;
+    }
+    CppAD::vector< AD<double> > ay(2);
+    ay[0] = asum;
+    ay[1] = ax[0] / ax[1];
+
+    // create function object f : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+
+    // derivative of w^T f(x) using forward and reverse mode
+    CppAD::vector<double> x(n), w(2), dw(n), dw_live(n);
+    x[0] = 0.25;
+    x[1] = 3.0;
+    w[0] = 2.0;
+    w[1] = -1.0;
+    f.Forward(0, x);
+    dw = f.Reverse(1, w);
+
+    // the same derivative reusing variable memory
+    dw_live = f.reverse_live(x, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw_live[j], dw[j], eps99, eps99);
+
+    // the number of slots is much less than the number of variables
+    ok &= 0 < f.size_live();
+    ok &= 10 * f.size_live() < f.size_var();
+
+    // there are no Taylor coefficients stored after reverse_live
+    ok &= f.size_order() == 0;
+
+    // check a different argument value
+    x[0]    = 4.0;
+    x[1]    = 1.0;
+    dw_live = f.reverse_live(x, w);
+    double check_0 = w[1] / x[1];
+    double check_1 = - w[1] * x[0] / (x[1] * x[1]);
+    for(size_t k = 0; k < n_step; ++k)
+    {   double t = std::sin( x[0] * double(k) ) + x[1];
+        double c = std::cos( x[0] * double(k) ) * double(k);
+        check_0 += w[0] * 2.0 * t * c;
+        check_1 += w[0] * 2.0 * t;
+    }
+    ok &= NearEqual(dw_live[0], check_0, eps99, eps99);
+    ok &= NearEqual(dw_live[1], check_1, eps99, eps99);
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,95 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin share_recording.cpp$$
+
+$section Sharing an Operation Sequence: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool share_recording(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // f(x) = [ x_0 * x_1 , exp(x_0) ]
+    size_t n = 2, m = 2;
+    vector< AD<double> > ax(n), ay(m);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = exp( ax[0] );
+    CppAD::ADFun<double> f(ax, ay);
+    ok &= f.size_order() == 1;
+
+    // two evaluation contexts that share the operation sequence in f
+    // (for example, one for each thread)
+    CppAD::ADFun<double> g, h;
+    g.share_recording(f);
+    h.share_recording(f);
+    ok &= g.size_var()   == f.size_var();
+    ok &= g.size_order() == 0;
+    ok &= h.size_order() == 0;
+
+    // zero order forward using each context at different points
+    vector<double> x(n), u(n), y(m), v(m);
+    x[0] = 3.0;
+    x[1] = 4.0;
+    u[0] = 5.0;
+    u[1] = 6.0;
+    y    = g.Forward(0, x);
+    v    = h.Forward(0, u);
+    ok  &= NearEqual(y[0], x[0] * x[1],       eps99, eps99);
+    ok  &= NearEqual(y[1], std::exp(x[0]),    eps99, eps99);
+    ok  &= NearEqual(v[0], u[0] * u[1],       eps99, eps99);
+    ok  &= NearEqual(v[1], std::exp(u[0]),    eps99, eps99);
+
+    // reverse mode in each context uses its own Taylor coefficients
+    vector<double> w(m), dw(n);
+    w[0] = 1.0;
+    w[1] = 0.0;
+    dw   = g.Reverse(1, w);
+    ok  &= NearEqual(dw[0], x[1], eps99, eps99);
+    ok  &= NearEqual(dw[1], x[0], eps99, eps99);
+    dw   = h.Reverse(1, w);
+    ok  &= NearEqual(dw[0], u[1], eps99, eps99);
+    ok  &= NearEqual(dw[1], u[0], eps99, eps99);
+
+    // sparsity pattern for the Jacobian using one of the contexts
+    size_t nr = n, nc = n, nnz = n;
+    CppAD::sparse_rc< vector<size_t> > pattern_in(nr, nc, nnz);
+    for(size_t k = 0; k < nnz; ++k)
+        pattern_in.set(k, k, k);
+    bool transpose     = false;
+    bool dependency    = false;
+    bool internal_bool = false;
+    CppAD::sparse_rc< vector<size_t> > pattern_out;
+    g.for_jac_sparsity(
+        pattern_in, transpose, dependency, internal_bool, pattern_out
+    );
+    ok &= pattern_out.nnz() == 3;
+
+    // f has not changed
+    ok &= f.size_order() == 1;
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,98 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin slice.cpp$$
+
+$section Slice an ADFun Object: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool slice(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variables
+    size_t n = 4;
+    vector< AD<double> > ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+
+    // f(x) = [ x_0 * x_1 , sin(x_2) + x_3 * x_0 , exp(x_3) ]
+    size_t m = 3;
+    vector< AD<double> > ay(m);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = sin( ax[2] ) + ax[3] * ax[0];
+    ay[2] = exp( ax[3] );
+    CppAD::ADFun<double> f(ax, ay);
+
+    // select f_1 as a function of x_0 and x_2
+    vector<bool> select_domain(n), select_range(m);
+    select_domain[0] = true;
+    select_domain[1] = false;
+    select_domain[2] = true;
+    select_domain[3] = false;
+    select_range[0]  = false;
+    select_range[1]  = true;
+    select_range[2]  = false;
+    vector<double> x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 1);
+
+    // g(u) = sin(u_1) + x_3 * u_0 where x_3 is a dynamic parameter
+    bool other_dynamic = true;
+    CppAD::ADFun<double> g = f.slice(
+        select_domain, select_range, x, other_dynamic
+    );
+    ok &= g.Domain() == 2;
+    ok &= g.Range()  == 1;
+    ok &= g.size_var() < f.size_var();
+    //
+    // the dynamic parameters in g are x_1 and x_3
+    ok &= g.size_dyn_ind() == 2;
+    vector<double> p(2), u(2), v(1);
+    p[0] = 5.0;
+    p[1] = 6.0;
+    g.new_dynamic(p);
+    u[0] = 7.0;
+    u[1] = 8.0;
+    v    = g.Forward(0, u);
+    ok  &= NearEqual(v[0], std::sin(u[1]) + p[1] * u[0], eps99, eps99);
+    //
+    // derivative of g
+    vector<double> dv(2), w(1);
+    w[0] = 1.0;
+    dv   = g.Reverse(1, w);
+    ok  &= NearEqual(dv[0], p[1],            eps99, eps99);
+    ok  &= NearEqual(dv[1], std::cos(u[1]),  eps99, eps99);
+
+    // h(u) = sin(u_1) + x_3 * u_0 where x_3 is the constant 4
+    other_dynamic = false;
+    CppAD::ADFun<double> h = f.slice(
+        select_domain, select_range, x, other_dynamic
+    );
+    ok &= h.size_dyn_ind() == 0;
+    v   = h.Forward(0, u);
+    ok &= NearEqual(v[0], std::sin(u[1]) + x[3] * u[0], eps99, eps99);
+
+    return ok;
+}
+// END C++
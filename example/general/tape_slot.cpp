@@ -0,0 +1,94 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin tape_slot.cpp$$
+
+$section Binding Tapes to Tasks: Example and Test$$
+
+$head Discussion$$
+This example uses a global variable to identify the current task.
+It switches between two tasks, that are recording at the same time,
+without using multiple threads.
+One of the tasks uses a tape slot that is greater than
+$code CPPAD_MAX_NUM_THREADS$$.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    // the current task
+    size_t current_task_ = 0;
+    size_t current_task(void)
+    {   return current_task_; }
+}
+
+bool tape_slot(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    using CppAD::tape_slot;
+
+    // use current_task to determine the tape slot
+    size_t num_slot = CPPAD_MAX_NUM_THREADS + 10;
+    tape_slot::setup(num_slot, current_task);
+    ok &= tape_slot::num_slot() == num_slot;
+
+    // two tasks
+    size_t task_f = CPPAD_MAX_NUM_THREADS + 5;
+    size_t task_g = 1;
+
+    // start recording for task_f
+    current_task_ = task_f;
+    ok &= tape_slot::current() == task_f;
+    vector< AD<double> > ax(1), ay(1);
+    ax[0] = 1.0;
+    CppAD::Independent(ax);
+
+    // start recording for task_g
+    current_task_ = task_g;
+    vector< AD<double> > au(1), av(1);
+    au[0] = 2.0;
+    CppAD::Independent(au);
+    ok &= CppAD::Variable(ax[0]);
+    ok &= CppAD::Variable(au[0]);
+
+    // finish task_f: f(x) = x * x
+    current_task_ = task_f;
+    ay[0] = ax[0] * ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+
+    // finish task_g: g(u) = u + u
+    current_task_ = task_g;
+    av[0] = au[0] + au[0];
+    CppAD::ADFun<double> g(au, av);
+
+    // evaluate the functions
+    vector<double> x(1), y(1);
+    x[0] = 3.0;
+    y    = f.Forward(0, x);
+    ok  &= y[0] == x[0] * x[0];
+    y    = g.Forward(0, x);
+    ok  &= y[0] == x[0] + x[0];
+
+    // restore the default tape slots
+    current_task_ = 0;
+    tape_slot::setup(CPPAD_MAX_NUM_THREADS, nullptr);
+    ok &= tape_slot::current() == CppAD::thread_alloc::thread_num();
+
+    return ok;
+}
+// END C++
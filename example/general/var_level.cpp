@@ -0,0 +1,83 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin var_level.cpp$$
+
+$section Dependency Levels for Variables: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+bool var_level(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+
+    // number of independent variables
+    size_t n = 10;
+
+    // f(x) = [ exp(x_0) * x_0 , ... , exp(x_{n-1}) * x_{n-1} ]
+    // is wide: the terms can be computed at the same time
+    vector< AD<double> > ax(n), ay(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    for(size_t j = 0; j < n; ++j)
+        ay[j] = exp( ax[j] ) * ax[j];
+    CppAD::ADFun<double> f(ax, ay);
+
+    // g(x) = ( ... ( (x_0 * x_1) * x_2 ) ... ) * x_{n-1}
+    // is a chain: each product depends on the previous one
+    CppAD::Independent(ax);
+    vector< AD<double> > az(1);
+    az[0] = ax[0];
+    for(size_t j = 1; j < n; ++j)
+        az[0] = az[0] * ax[j];
+    CppAD::ADFun<double> g(ax, az);
+
+    // levels for f
+    // (the phantom variable and the independent variables have level 0,
+    // the exp results have level 1, and the products have level 2)
+    vector<size_t> level;
+    size_t num_level = f.var_level(level);
+    ok &= num_level == 3;
+    ok &= level.size() == f.size_var();
+    //
+    // width[ell] = number of variables with level ell
+    vector<size_t> width(num_level);
+    for(size_t ell = 0; ell < num_level; ++ell)
+        width[ell] = 0;
+    for(size_t i = 0; i < level.size(); ++i)
+        ++width[ level[i] ];
+    ok &= width[0] == n + 1;
+    ok &= width[2] == n;
+    //
+    // average parallelism for f is large
+    double parallel_f = double( f.size_var() ) / double( num_level );
+    ok &= parallel_f > double(n);
+
+    // levels for g
+    num_level = g.var_level(level);
+    ok &= num_level == n;
+    //
+    // average parallelism for g is small
+    double parallel_g = double( g.size_var() ) / double( num_level );
+    ok &= parallel_g < 3.0;
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,164 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin async_eval.cpp$$
+$spell
+    async
+    CppAD
+    std
+    Jacobian
+    eval
+    jac
+$$
+
+$section Asynchronous Function and Derivative Evaluation: Example and Test$$
+
+$head Purpose$$
+This example shows how to use
+$cref/forward_async/async_eval/$$ and
+$cref/sparse_jac_rev_async/async_eval/sparse_jac_rev_async/$$
+to evaluate an $code ADFun$$ object, and its derivatives, asynchronously;
+i.e., a request returns a $code std::future$$ right away
+and the caller can do other work while the result is computed
+by the pool of threads that is managed by the $code ADFun$$ object.
+
+$head Thread$$
+This example does not use the team of threads.
+The requests are made by the master thread
+and the threads in the pool use their default $cref thread_alloc$$
+thread numbers.
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <future>
+# include <vector>
+# include "async_eval.hpp"
+# define NUMBER_THREADS  4
+
+// This test routine is only called by the master thread (thread_num = 0).
+bool async_eval(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::vector;
+    typedef CppAD::sparse_rc< vector<size_t> >          sparsity;
+    typedef CppAD::sparse_rcv< vector<size_t>, vector<double> > sparse_matrix;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // f(x) = [ p * x_0 * x_1 , sin(x_1) + cos(x_2) ]
+    size_t n = 3, m = 2;
+    vector< AD<double> > ax(n), ay(m), ap(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 1.0;
+    ap[0] = 2.0;
+    CppAD::Independent(ax, ap);
+    ay[0] = ap[0] * ax[0] * ax[1];
+    ay[1] = sin( ax[1] ) + cos( ax[2] );
+    CppAD::ADFun<double> f(ax, ay);
+
+    // number of threads in the pool
+    f.async_threads(NUMBER_THREADS);
+    ok &= f.size_async() == 0;
+
+    // subset, pattern, work for the sparse Jacobian
+    sparsity pattern(m, n, 4);
+    pattern.set(0, 0, 0);
+    pattern.set(1, 0, 1);
+    pattern.set(2, 1, 1);
+    pattern.set(3, 1, 2);
+    sparse_matrix subset( pattern );
+    CppAD::sparse_jac_work work;
+    vector<double> x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = 1.0;
+    f.sparse_jac_rev(x, subset, pattern, "cppad", work);
+
+    // requests (std::future cannot be copied, so use std::vector)
+    size_t num_request = 20;
+    std::vector< std::future< vector<double> > >  y_future(num_request);
+    std::vector< std::future< vector<double> > >  y1_future(num_request);
+    std::vector< std::future< sparse_matrix > >   jac_future(num_request);
+    for(size_t k = 0; k < num_request; ++k)
+    {   // zero order
+        for(size_t j = 0; j < n; ++j)
+            x[j] = double(k + j) / double(num_request);
+        y_future[k] = f.forward_async(0, x);
+        //
+        // orders zero and one in the direction e_1
+        vector<double> xq(n * 2);
+        for(size_t j = 0; j < n; ++j)
+        {   xq[2 * j + 0] = x[j];
+            xq[2 * j + 1] = 0.0;
+        }
+        xq[2 * 1 + 1] = 1.0;
+        y1_future[k] = f.forward_async(1, xq);
+        //
+        // sparse Jacobian using the coloring in work
+        jac_future[k] = f.sparse_jac_rev_async(
+            x, subset, pattern, "cppad", work
+        );
+    }
+    // the pool was started by the first request
+    ok &= f.size_async() == NUMBER_THREADS;
+
+    // check the results
+    double p = 2.0;
+    for(size_t k = 0; k < num_request; ++k)
+    {   for(size_t j = 0; j < n; ++j)
+            x[j] = double(k + j) / double(num_request);
+        vector<double> y      = y_future[k].get();
+        vector<double> y1     = y1_future[k].get();
+        sparse_matrix  jac    = jac_future[k].get();
+        //
+        ok &= y.size() == m;
+        ok &= NearEqual(y[0], p * x[0] * x[1], eps99, eps99);
+        ok &= NearEqual(y[1], std::sin(x[1]) + std::cos(x[2]), eps99, eps99);
+        //
+        ok &= y1.size() == m * 2;
+        ok &= NearEqual(y1[2 * 0 + 0], y[0], eps99, eps99);
+        ok &= NearEqual(y1[2 * 0 + 1], p * x[0], eps99, eps99);
+        ok &= NearEqual(y1[2 * 1 + 1], std::cos(x[1]), eps99, eps99);
+        //
+        const vector<double>& val = jac.val();
+        ok &= jac.nnz() == 4;
+        ok &= NearEqual(val[0], p * x[1], eps99, eps99);
+        ok &= NearEqual(val[1], p * x[0], eps99, eps99);
+        ok &= NearEqual(val[2], std::cos(x[1]), eps99, eps99);
+        ok &= NearEqual(val[3], - std::sin(x[2]), eps99, eps99);
+    }
+
+    // changing the dynamic parameter clears the pool
+    vector<double> dynamic(1);
+    p          = 3.0;
+    dynamic[0] = p;
+    f.new_dynamic(dynamic);
+    ok &= f.size_async() == 0;
+    //
+    // the next request starts the pool using the new parameter value
+    std::future< vector<double> > y_p = f.forward_async(0, x);
+    vector<double> y = y_p.get();
+    ok &= NearEqual(y[0], p * x[0] * x[1], eps99, eps99);
+    ok &= f.size_async() == NUMBER_THREADS;
+
+    // wait for requests and terminate the threads in the pool
+    f.clear_async();
+    ok &= f.size_async() == 0;
+
+    return ok;
+}
+// END C++
@@ -0,0 +1,17 @@
+# ifndef CPPAD_EXAMPLE_MULTI_THREAD_ASYNC_EVAL_HPP
+# define CPPAD_EXAMPLE_MULTI_THREAD_ASYNC_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+extern bool async_eval(void);
+
+# endif
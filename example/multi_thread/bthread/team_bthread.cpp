@@ -19,12 +19,18 @@ $$
 $section Boost Thread Implementation of a Team of AD Threads$$
 See $cref team_thread.hpp$$ for this routines specifications.
 
+$head Work Queue$$
+The $code team_tasks$$ routine uses a work queue that is shared by
+all the threads; i.e., an atomic counter that each thread increments
+to get the index of its next task.
+
 $srcthisfile%0%// BEGIN C++%// END C++%1%$$
 
 $end
 */
 // BEGIN C++
 # include <boost/thread.hpp>
+# include <atomic>
 # include <cppad/cppad.hpp>
 # include "../team_thread.hpp"
 # define MAX_NUMBER_THREADS 48
@@ -71,6 +77,24 @@ namespace {
     // pointer to function that does the work for one thread
     void (* worker_)(void) = nullptr;
 
+    // number of tasks in the work queue for the current call to team_tasks
+    size_t num_tasks_ = 0;
+
+    // pointer to function that does one task
+    void (* task_)(size_t task_index) = nullptr;
+
+    // index of the next task in the work queue
+    std::atomic<size_t> next_task_(0);
+
+    // worker that does tasks until the work queue is empty
+    void task_worker(void)
+    {   size_t task_index = next_task_.fetch_add(1);
+        while( task_index < num_tasks_ )
+        {   task_(task_index);
+            task_index = next_task_.fetch_add(1);
+        }
+    }
+
     // ---------------------------------------------------------------------
     // in_parallel()
     bool in_parallel(void)
@@ -212,6 +236,20 @@ bool team_work(void worker(void))
     return ok;
 }
 
+bool team_tasks(size_t num_tasks, void task(size_t task_index))
+{   bool ok = sequential_execution_;
+    ok     &= thread_number() == 0;
+
+    // initialize the work queue
+    num_tasks_ = num_tasks;
+    task_      = task;
+    next_task_.store(0);
+
+    // each thread does tasks until the queue is empty
+    ok &= team_work(task_worker);
+    return ok;
+}
+
 bool team_destroy(void)
 {   // Current state is other threads are at wait_for_job_.
     // This master thread (thread zero) has not completed wait_for_job_
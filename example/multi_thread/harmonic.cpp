@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -26,6 +26,11 @@ $latex \[
     1 + 1/2 + 1/3 + ... + 1/n
 \] $$
 
+$head Tasks$$
+The summation is split into $code TASKS_PER_THREAD$$ tasks per thread.
+The tasks are balanced between the threads by
+$cref/team_tasks/team_thread.hpp/team_tasks/$$.
+
 $head Source$$
 $srcthisfile%0
     %// BEGIN COMMON C++%// END COMMON C++%
@@ -41,6 +46,7 @@ $end
 # include "harmonic.hpp"
 # include "team_thread.hpp"
 # define MAX_NUMBER_THREADS 48
+# define TASKS_PER_THREAD   16
 
 namespace {
     using CppAD::thread_alloc; // fast multi-threadeding memory allocator
@@ -52,25 +58,28 @@ namespace {
     // value of mega_sum, set by previous call to harmonic_time.
     size_t mega_sum_;
 
-    // structure with information for one thread
+    // structure with information for one task
     typedef struct {
-        // index to start summation at (worker input)
+        // index to start summation at (task input)
         // set by previous call to harmonic_setup
         size_t start;
-        // index to end summation at (worker input)
+        // index to end summation at (task input)
         // set by previous call to harmonic_setup
         size_t stop;
-        // summation for this thread
-        // set by worker
+        // summation for this task
+        // set by harmonic_task
         double sum;
         // false if an error occurs, true otherwise
-        // set by worker
+        // set by harmonic_task
         bool   ok;
-    } work_one_t;
+    } task_one_t;
+
+    // number of tasks, set by previous call to harmonic_setup
+    size_t num_tasks_ = 0;
 
-    // vector with information for all threads
-    // (use pointers instead of values to avoid false sharing)
-    work_one_t* work_all_[MAX_NUMBER_THREADS];
+    // vector with information for all tasks
+    // (allocated by harmonic_setup and freed by harmonic_takedown)
+    task_one_t* task_all_ = nullptr;
 }
 // END COMMON C++
 /*
@@ -93,7 +102,7 @@ the summation that defines the harmonic series
 $latex \[
     1 + 1/2 + 1/3 + ... + 1/n
 \] $$
-into separate parts for each thread.
+into separate tasks.
 
 $head Thread$$
 It is assumed that this function is called by thread zero,
@@ -122,24 +131,27 @@ bool harmonic_setup(size_t num_sum)
     ok                 &= thread_alloc::thread_num() == 0;
     ok                 &= num_sum >= num_threads;
     //
-    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
-    {   // allocate separate memory for this thread to avoid false sharing
-        size_t min_bytes(sizeof(work_one_t)), cap_bytes;
-        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
-        work_all_[thread_num] = static_cast<work_one_t*>(v_ptr);
-        //
-        // in case this thread's worker does not get called
-        work_all_[thread_num]->ok = false;
-        // parameters that define the work for this and previous thread
-        if( thread_num == 0 )
-            work_all_[0]->start = 1;
+    // number of tasks
+    num_tasks_ = std::min(num_sum, TASKS_PER_THREAD * num_threads);
+    //
+    // allocate memory for all the tasks
+    size_t min_bytes(num_tasks_ * sizeof(task_one_t)), cap_bytes;
+    void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+    task_all_   = static_cast<task_one_t*>(v_ptr);
+    //
+    for(size_t task_index = 0; task_index < num_tasks_; task_index++)
+    {   // in case this task does not get called
+        task_all_[task_index].ok = false;
+        // parameters that define the work for this and previous task
+        if( task_index == 0 )
+            task_all_[0].start = 1;
         else
-        {   size_t index  = (num_sum * thread_num) / num_threads;
-            work_all_[thread_num-1]->stop = index;
-            work_all_[thread_num]->start  = index;
+        {   size_t index  = (num_sum * task_index) / num_tasks_;
+            task_all_[task_index-1].stop = index;
+            task_all_[task_index].start  = index;
         }
     }
-    work_all_[num_threads-1]->stop = num_sum + 1;
+    task_all_[num_tasks_-1].stop = num_sum + 1;
     return ok;
 }
 }
@@ -152,11 +164,11 @@ $spell
     num
 $$
 
-$section Do One Thread's Work for Sum of 1/i$$
+$section Do One Task for Sum of 1/i$$
 
 
 $head Syntax$$
-$codei%harmonic_worker()
+$codei%harmonic_task(%task_index%)
 %$$
 
 $head Purpose$$
@@ -169,18 +181,19 @@ $codei%
 $head start$$
 This is the value of the $cref harmonic_common$$ information
 $codei%
-    %start% = work_all_[%thread_num%]->start
+    %start% = task_all_[%task_index%].start
 %$$
 
 $head end$$
 This is the value of the $cref harmonic_common$$ information
 $codei%
-    %end% = work_all_[%thread_num%]->end
+    %end% = task_all_[%task_index%].end
 %$$
 
-$head thread_num$$
-This is the number for the current thread; see
-$cref/thread_num/ta_thread_num/$$.
+$head task_index$$
+This is the index of the task that is being done.
+Which thread does the task is determined by
+$cref/team_tasks/team_thread.hpp/team_tasks/$$.
 
 $head Source$$
 $srcthisfile%0
@@ -191,13 +204,14 @@ $end
 */
 // BEGIN WORKER C++
 namespace {
-void harmonic_worker(void)
+void harmonic_task(size_t task_index)
 {   // sum =  1/(stop-1) + 1/(stop-2) + ... + 1/start
     size_t thread_num  = thread_alloc::thread_num();
     size_t num_threads = std::max(num_threads_, size_t(1));
     bool   ok          = thread_num < num_threads;
-    size_t start       = work_all_[thread_num]->start;
-    size_t stop        = work_all_[thread_num]->stop;
+    ok                &= task_index < num_tasks_;
+    size_t start       = task_all_[task_index].start;
+    size_t stop        = task_all_[task_index].stop;
     double sum         = 0.;
 
     ok &= stop > start;
@@ -207,8 +221,8 @@ void harmonic_worker(void)
         sum += 1. / double(i);
     }
 
-    work_all_[thread_num]->sum = sum;
-    work_all_[thread_num]->ok  = ok;
+    task_all_[task_index].sum = sum;
+    task_all_[task_index].ok  = ok;
 }
 }
 // END WORKER C++
@@ -232,7 +246,7 @@ the summation that defines the harmonic series
 $latex \[
     s = 1 + 1/2 + 1/3 + ... + 1/n
 \] $$
-into separate parts for each thread; see $cref harmonic_setup$$.
+into separate tasks; see $cref harmonic_setup$$.
 
 $head Thread$$
 It is assumed that this function is called by thread zero,
@@ -262,20 +276,26 @@ bool harmonic_takedown(double& sum)
     size_t num_threads = std::max(num_threads_, size_t(1));
     sum                = 0.;
     //
+    // add the tasks in order so the result does not depend on which
+    // thread did each task
+    for(size_t task_index = 0; task_index < num_tasks_; task_index++)
+    {   // check that this task was ok with the work it did
+        ok  &= task_all_[task_index].ok;
+        //
+        // add this tasks contribution to the sum
+        sum += task_all_[task_index].sum;
+    }
+    //
+    // delete problem specific information
+    void* v_ptr = static_cast<void*>( task_all_ );
+    thread_alloc::return_memory( v_ptr );
+    task_all_   = nullptr;
+    num_tasks_  = 0;
+    //
     // go down so that free memory for other threads before memory for master
     size_t thread_num = num_threads;
     while(thread_num--)
-    {   // check that this tread was ok with the work it did
-        ok  &= work_all_[thread_num]->ok;
-        //
-        // add this threads contribution to the sum
-        sum += work_all_[thread_num]->sum;
-        //
-        // delete problem specific information
-        void* v_ptr = static_cast<void*>( work_all_[thread_num] );
-        thread_alloc::return_memory( v_ptr );
-        //
-        // check that there is no longer any memory inuse by this thread
+    {   // check that there is no longer any memory inuse by this thread
         // (for general applications, the master might still be using memory)
         ok &= thread_alloc::inuse(thread_num) == 0;
         //
@@ -350,13 +370,15 @@ bool harmonic_sum(double& sum, size_t num_sum)
     // setup the work for multi-threading
     ok &= harmonic_setup(num_sum);
 
-    // now do the work for each thread
+    // now do the tasks using the team of threads
     if( num_threads_ > 0 )
-        team_work( harmonic_worker );
+        ok &= team_tasks(num_tasks_, harmonic_task);
     else
-        harmonic_worker();
+    {   for(size_t task_index = 0; task_index < num_tasks_; task_index++)
+            harmonic_task(task_index);
+    }
 
-    // combine the result for each thread and takedown the multi-threading.
+    // combine the result for each task and takedown the multi-threading.
     ok &= harmonic_takedown(sum);
 
     return ok;
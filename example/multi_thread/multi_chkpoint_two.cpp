@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -600,8 +600,10 @@ bool multi_chkpoint_two_time(
         bool use_hes_sparsity = false;
         bool use_base2ad      = false;
         bool use_in_parallel  = true;
+        bool use_optimize     = true;
         a_square_root_ = new CppAD::chkpoint_two<double>( fun, name,
-            internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+            internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel,
+            use_optimize
         );
     }
 
@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -19,6 +19,12 @@ This source code defined the common
 include files, defines, and variables that are used by the
 multi-newton method.
 
+$head Tasks$$
+There is one task for each sub-interval.
+The number of Newton iterations can be different for each sub-interval,
+so the tasks are balanced between the threads by
+$cref/team_tasks/team_thread.hpp/team_tasks/$$.
+
 $head Source$$
 $srcthisfile%
     0%// BEGIN COMMON C++%// END COMMON C++%
@@ -35,7 +41,6 @@ $end
 # include <cstring>
 # include "multi_newton.hpp"
 # include "team_thread.hpp"
-# define USE_THREAD_ALLOC_FOR_WORK_ALL 1
 
 namespace {
     using CppAD::thread_alloc; // fast multi-threadeding memory allocator
@@ -53,30 +58,30 @@ namespace {
     // maximum number of iterations, set by  multi_newton_setup
     size_t max_itr_ = 0;
 
+    // beginning of entire interval, set by multi_newton_setup
+    double xlow_ = 0.;
+
+    // end of entire interval, set by multi_newton_setup
+    double xup_ = 0.;
+
     // length for all sub-intervals
     double sub_length_ = 0.;
 
-    // structure with information for one thread
+    // structure with information for one sub-interval
     typedef struct {
-        // number of sub intervals (worker input)
-        size_t num_sub;
-        // beginning of interval (worker input)
-        double xlow;
-        // end of interval (worker input)
-        double xup;
-        // vector of zero candidates (worker output)
-        // after call to multi_newton_setup:    x.size() == 0
-        // after call to multi_newton_work:     x.size() is number of zeros
-        // after call to multi_newton_takedown: x.size() == 0
-        vector<double> x;
-        // false if an error occurs, true otherwise (worker output)
+        // true if a zero was found in this sub-interval (task output)
+        bool   found;
+        // zero candidate for this sub-interval (task output)
+        double x;
+        // value of the function at x (task output)
+        double f;
+        // false if an error occurs, true otherwise (task output)
         bool   ok;
-    } work_one_t;
-    // vector with information for all threads
-    // after call to multi_newton_setup:    work_all.size() == num_threads
-    // after call to multi_newton_takedown: work_all.size() == 0
-    // (use pointers instead of values to avoid false sharing)
-    vector<work_one_t*> work_all_;
+    } sub_one_t;
+    // vector with information for all sub-intervals
+    // after call to multi_newton_setup:    sub_all.size() == num_sub
+    // after call to multi_newton_takedown: sub_all.size() == 0
+    vector<sub_one_t> sub_all_;
 }
 // END COMMON C++
 /*
@@ -100,7 +105,7 @@ $icode%ok% = multi_newton_setup(
 
 $head Purpose$$
 These routine does the setup for splitting finding all the zeros in an
-interval into separate sub-intervals, one for each thread.
+interval into separate sub-intervals, one task for each sub-interval.
 
 $head Thread$$
 It is assumed that this function is called by thread zero,
@@ -146,66 +151,23 @@ bool multi_newton_setup(
     bool ok      = num_threads == thread_alloc::num_threads();
     ok          &= thread_alloc::thread_num() == 0;
 
-    // inputs that are same for all threads
+    // inputs that are same for all tasks
     epsilon_ = epsilon;
     max_itr_ = max_itr;
-
-    // resize the work vector to accomidate the number of threads
-    ok &= work_all_.size() == 0;
-    work_all_.resize(num_threads);
+    xlow_    = xlow;
+    xup_     = xup;
 
     // length of each sub interval
     sub_length_ = (xup - xlow) / double(num_sub);
 
-    // determine values that are specific to each thread
-    size_t num_min   = num_sub / num_threads; // minimum num_sub
-    size_t num_more  = num_sub % num_threads; // number that have one more
-    size_t sum_num   = 0;  // sum with respect to thread of num_sub
-    size_t thread_num, num_sub_thread;
-    for(thread_num = 0; thread_num < num_threads; thread_num++)
-    {
-# if  USE_THREAD_ALLOC_FOR_WORK_ALL
-        // allocate separate memory for this thread to avoid false sharing
-        size_t min_bytes(sizeof(work_one_t)), cap_bytes;
-        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
-        work_all_[thread_num] = static_cast<work_one_t*>(v_ptr);
-
-        // thread_alloc is a raw memory allocator; i.e., it does not call
-        // the constructor for the objects it creates. The vector
-        // class requires it's constructor to be called so we do it here
-        new(& (work_all_[thread_num]->x) ) vector<double>();
-# else
-        work_all_[thread_num] = new work_one_t;
-# endif
-
-        // number of sub-intervalse for this thread
-        if( thread_num < num_more  )
-            num_sub_thread = num_min + 1;
-        else
-            num_sub_thread = num_min;
-
-        // when thread_num == 0, xlow_thread == xlow
-        double xlow_thread = xlow + double(sum_num) * sub_length_;
-
-        // when thread_num == num_threads - 1, xup_thread = xup
-        double xup_thread =
-            xlow + double(sum_num + num_sub_thread) * sub_length_;
-        if( thread_num == num_threads - 1 )
-            xup_thread = xup;
-
-        // update sum_num for next time through loop
-        sum_num += num_sub_thread;
-
-        // input information specific to this thread
-        work_all_[thread_num]->num_sub = num_sub_thread;
-        work_all_[thread_num]->xlow    = xlow_thread;
-        work_all_[thread_num]->xup     = xup_thread;
-        ok &= work_all_[thread_num]->x.size() == 0;
-
-        // in case this thread does not get called
-        work_all_[thread_num]->ok = false;
+    // resize the sub-interval vector to accomidate the number of tasks
+    ok &= sub_all_.size() == 0;
+    sub_all_.resize(num_sub);
+    for(size_t i = 0; i < num_sub; i++)
+    {   // in case this task does not get called
+        sub_all_[i].found = false;
+        sub_all_[i].ok    = false;
     }
-    ok &= sum_num == num_sub;
     return ok;
 }
 }
@@ -220,30 +182,33 @@ $spell
     xout
 $$
 
-$section Do One Thread's Work for Multi-Threaded Newton Method$$
+$section Do One Task for Multi-Threaded Newton Method$$
 
 $head Syntax$$
-$codei%multi_newton_worker()%$$
+$codei%multi_newton_task(%task_index%)%$$
 
 
 $head Purpose$$
-This function finds all the zeros in the interval $codei%[ %low% , %up% ]%$$.
+This function looks for a zero in the interval $codei%[ %low% , %up% ]%$$.
+
+$head task_index$$
+This is the index of the sub-interval; i.e., $latex i$$ in
+$cref/multi_newton_run/multi_newton_run/Method/$$.
+Which thread does the task is determined by
+$cref/team_tasks/team_thread.hpp/team_tasks/$$.
 
 $head low$$
-This is the value of the $cref multi_newton_common$$ information
+This is the lower limit of the sub-interval
 $codei%
-    %low% = work_all_[%thread_num%]->xlow
+    %low% = xlow_ + %task_index% * sub_length_
 %$$
 
 $head up$$
-This is the value of the $cref multi_newton_common$$ information
+This is the upper limit of the sub-interval
 $codei%
-    %up% = work_all_[%thread_num%]->xup
+    %up% = xlow_ + (%task_index% + 1) * sub_length_
 %$$
-
-$head thread_num$$
-This is the number for the current thread; see
-$cref/thread_num/ta_thread_num/$$.
+(exactly $code xup_$$ for the last sub-interval).
 
 $head Source$$
 $srcthisfile%0
@@ -253,87 +218,63 @@ $end
 */
 // BEGIN WORKER C++
 namespace {
-void multi_newton_worker(void)
+void multi_newton_task(size_t task_index)
 {
-    // Split [xlow, xup] into num_sub intervales and
-    // look for one zero in each sub-interval.
+    // look for one zero in the sub-interval with this index
     size_t thread_num    = thread_alloc::thread_num();
     size_t num_threads   = std::max(num_threads_, size_t(1));
+    size_t num_sub       = sub_all_.size();
     bool   ok            = thread_num < num_threads;
-    size_t num_sub       = work_all_[thread_num]->num_sub;
-    double xlow          = work_all_[thread_num]->xlow;
-    double xup           = work_all_[thread_num]->xup;
-    vector<double>& x    = work_all_[thread_num]->x;
+    ok                  &= task_index < num_sub;
+    if( ! ok )
+        return;
 
     // check arguments
     ok &= max_itr_ > 0;
-    ok &= num_sub > 0;
-    ok &= xlow < xup;
-    ok &= x.size() == 0;
-
-    // check for special case where there is nothing for this thread to do
-    if( num_sub == 0 )
-    {   work_all_[thread_num]->ok = ok;
-        return;
-    }
-
-    // check for a zero on each sub-interval
-    size_t i;
-    double xlast = xlow - 2.0 * sub_length_; // over sub_length_ away from x_low
-    double flast = 2.0 * epsilon_;           // any value > epsilon_ would do
-    for(i = 0; i < num_sub; i++)
-    {
-        // note that when i == 0, xlow_i == xlow (exactly)
-        double xlow_i = xlow + double(i) * sub_length_;
-
-        // note that when i == num_sub - 1, xup_i = xup (exactly)
-        double xup_i  = xup  - double(num_sub - i - 1) * sub_length_;
-
-        // initial point for Newton iterations
-        double xcur = (xup_i + xlow_i) / 2.;
-
-        // Newton iterations
-        bool more_itr = true;
-        size_t itr    = 0;
-        // initialize these values to avoid MSC C++ warning
-        double fcur=0.0, dfcur=0.0;
-        while( more_itr )
-        {   fun_(xcur, fcur, dfcur);
-
-            // check end of iterations
-            if( fabs(fcur) <= epsilon_ )
-                more_itr = false;
-            if( (xcur == xlow_i ) & (fcur * dfcur > 0.) )
-                more_itr = false;
-            if( (xcur == xup_i)   & (fcur * dfcur < 0.) )
-                more_itr = false;
-
-            // next Newton iterate
-            if( more_itr )
-            {   xcur = xcur - fcur / dfcur;
-                // keep in bounds
-                xcur = std::max(xcur, xlow_i);
-                xcur = std::min(xcur, xup_i);
-
-                more_itr = ++itr < max_itr_;
-            }
-        }
-        if( fabs( fcur ) <= epsilon_ )
-        {   // check for case where xcur is lower bound for this
-            // sub-interval and upper bound for previous sub-interval
-            if( fabs(xcur - xlast) >= sub_length_ )
-            {   x.push_back( xcur );
-                xlast = xcur;
-                flast = fcur;
-            }
-            else if( fabs(fcur) < fabs(flast) )
-            {   x[ x.size() - 1] = xcur;
-                xlast            = xcur;
-                flast            = fcur;
-            }
+    ok &= xlow_ < xup_;
+
+    // note that when task_index == 0, xlow_i == xlow_ (exactly)
+    size_t i      = task_index;
+    double xlow_i = xlow_ + double(i) * sub_length_;
+
+    // note that when i == num_sub - 1, xup_i = xup_ (exactly)
+    double xup_i  = xlow_ + double(i + 1) * sub_length_;
+    if( i == num_sub - 1 )
+        xup_i = xup_;
+
+    // initial point for Newton iterations
+    double xcur = (xup_i + xlow_i) / 2.;
+
+    // Newton iterations
+    bool more_itr = true;
+    size_t itr    = 0;
+    // initialize these values to avoid MSC C++ warning
+    double fcur=0.0, dfcur=0.0;
+    while( more_itr )
+    {   fun_(xcur, fcur, dfcur);
+
+        // check end of iterations
+        if( fabs(fcur) <= epsilon_ )
+            more_itr = false;
+        if( (xcur == xlow_i ) & (fcur * dfcur > 0.) )
+            more_itr = false;
+        if( (xcur == xup_i)   & (fcur * dfcur < 0.) )
+            more_itr = false;
+
+        // next Newton iterate
+        if( more_itr )
+        {   xcur = xcur - fcur / dfcur;
+            // keep in bounds
+            xcur = std::max(xcur, xlow_i);
+            xcur = std::min(xcur, xup_i);
+
+            more_itr = ++itr < max_itr_;
         }
     }
-    work_all_[thread_num]->ok = ok;
+    sub_all_[i].found = fabs( fcur ) <= epsilon_;
+    sub_all_[i].x     = xcur;
+    sub_all_[i].f     = fcur;
+    sub_all_[i].ok    = ok;
 }
 }
 // END WORKER C++
@@ -379,47 +320,38 @@ bool multi_newton_takedown(vector<double>& xout)
     bool   ok = true;
     ok       &= thread_alloc::thread_num() == 0;
 
-    // initialize as more that sub_length_ / 2 from any possible solution
-    double xlast = - sub_length_;
-    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
-    {   vector<double>& x = work_all_[thread_num]->x;
-
-        size_t i;
-        for(i = 0; i < x.size(); i++)
-        {   // check for case where this point is lower limit for this
-            // thread and upper limit for previous thread
-            if( fabs(x[i] - xlast) >= sub_length_ )
-            {   xout.push_back( x[i] );
-                xlast = x[i];
+    // initialize as more that sub_length_ from any possible solution
+    double xlast = xlow_ - 2.0 * sub_length_;
+    double flast = 2.0 * epsilon_;           // any value > epsilon_ would do
+    for(size_t i = 0; i < sub_all_.size(); i++)
+    {   // check that this task was ok with the work it did
+        ok &= sub_all_[i].ok;
+        if( sub_all_[i].found )
+        {   double xcur = sub_all_[i].x;
+            double fcur = sub_all_[i].f;
+            // check for case where xcur is lower bound for this
+            // sub-interval and upper bound for previous sub-interval
+            if( fabs(xcur - xlast) >= sub_length_ )
+            {   xout.push_back( xcur );
+                xlast = xcur;
+                flast = fcur;
             }
-            else
-            {   double fcur, flast, df;
-                fun_(x[i],   fcur, df);
-                fun_(xlast, flast, df);
-                if( fabs(fcur) < fabs(flast) )
-                {   xout[ xout.size() - 1] = x[i];
-                    xlast                  = x[i];
-                }
+            else if( fabs(fcur) < fabs(flast) )
+            {   xout[ xout.size() - 1] = xcur;
+                xlast                  = xcur;
+                flast                  = fcur;
             }
         }
-        // check that this thread was ok with the work it did
-        ok &= work_all_[thread_num]->ok;
     }
 
+    // now we are done with the sub_all_ vector so free its memory
+    // (because it is a static variable)
+    sub_all_.clear();
+
     // go down so free memory for other threads before memory for master
     size_t thread_num = num_threads;
     while(thread_num--)
-    {
-# if USE_THREAD_ALLOC_FOR_WORK_ALL
-        // call the destructor for vector destructor
-        work_all_[thread_num]->x.~vector<double>();
-        // delete the raw memory allocation
-        void* v_ptr = static_cast<void*>( work_all_[thread_num] );
-        thread_alloc::return_memory( v_ptr );
-# else
-        delete work_all_[thread_num];
-# endif
-        // Note that xout corresponds to memroy that is inuse by master
+    {   // Note that xout corresponds to memroy that is inuse by master
         // (so we can only chech have freed all their memory).
         if( thread_num > 0 )
         {   // check that there is no longer any memory inuse by this thread
@@ -428,10 +360,6 @@ bool multi_newton_takedown(vector<double>& xout)
             thread_alloc::free_available(thread_num);
         }
     }
-    // now we are done with the work_all_ vector so free its memory
-    // (because it is a static variable)
-    work_all_.clear();
-
     return ok;
 }
 }
@@ -595,18 +523,20 @@ bool multi_newton_run(
     bool ok = true;
     ok     &= thread_alloc::thread_num() == 0;
 
-    // setup the work for num_threads threads
+    // setup the tasks for num_threads threads
     ok &= multi_newton_setup(
         num_sub, xlow, xup, epsilon, max_itr, num_threads
     );
 
-    // now do the work for each thread
+    // now do the tasks using the team of threads
     if( num_threads > 0 )
-        team_work( multi_newton_worker );
+        ok &= team_tasks(num_sub, multi_newton_task);
     else
-        multi_newton_worker();
+    {   for(size_t task_index = 0; task_index < num_sub; task_index++)
+            multi_newton_task(task_index);
+    }
 
-    // now combine the results for all the threads
+    // now combine the results for all the sub-intervals
     ok &= multi_newton_takedown(xout);
 
     return ok;
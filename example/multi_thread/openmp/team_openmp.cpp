@@ -19,6 +19,11 @@ $$
 $section OpenMP Implementation of a Team of AD Threads$$
 See $cref team_thread.hpp$$ for this routines specifications.
 
+$head Dynamic Schedule$$
+The $code team_tasks$$ routine uses an OpenMP loop with a dynamic schedule;
+i.e., each thread gets the index of its next task from
+a work queue that is shared by all the threads.
+
 $srcthisfile%0%// BEGIN C++%// END C++%1%$$
 
 $end
@@ -81,6 +86,21 @@ bool team_work(void worker(void))
     return ok;
 }
 
+bool team_tasks(size_t num_tasks, void task(size_t task_index))
+{   bool ok = ! in_parallel();
+    ok     &= thread_num() == 0;;
+    ok     &= num_threads_ > 0;
+
+    int number_tasks = int(num_tasks);
+    int task_index;
+# pragma omp parallel for schedule(dynamic)
+    for(task_index = 0; task_index < number_tasks; task_index++)
+        task( size_t(task_index) );
+// end omp parallel for
+
+    return ok;
+}
+
 bool team_destroy(void)
 {   bool ok = ! in_parallel();
     ok     &= thread_num() == 0;;
@@ -0,0 +1,98 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin a11c_sthread.cpp$$
+$spell
+    sthread
+    std
+    CppAD
+$$
+
+$section A Simple Parallel Standard Thread Example and Test$$
+
+$head Purpose$$
+This example just demonstrates $code std::thread$$
+and does not use CppAD at all.
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+----------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <thread>
+# include <limits>
+# include <cmath>
+// for size_t
+# include <cstddef>
+
+# define NUMBER_THREADS 4
+
+namespace {
+    // Beginning of Example A.1.1.1c of OpenMP 2.5 standard document ---------
+    void a1(int n, float *a, float *b)
+    {   int i;
+        for(i = 1; i < n; i++)
+            b[i] = (a[i] + a[i-1]) / 2.0f;
+        return;
+    }
+    // End of Example A.1.1.1c of OpenMP 2.5 standard document ---------------
+}
+
+bool a11c(void)
+{   bool ok = true;
+
+    // Test setup
+    int i, j, n_total = 10;
+    float *a = new float[size_t(n_total)];
+    float *b = new float[size_t(n_total)];
+    for(i = 0; i < n_total; i++)
+        a[i] = float(i);
+
+    // number of threads
+    int n_thread = NUMBER_THREADS;
+    // the threads
+    std::thread thread[NUMBER_THREADS];
+    //
+    // Break the work up into sub work for each thread
+    int n = n_total / n_thread;
+    int   n_j[NUMBER_THREADS];
+    float* a_j[NUMBER_THREADS];
+    float* b_j[NUMBER_THREADS];
+    n_j[0] = n;
+    a_j[0] = a;
+    b_j[0] = b;
+    for(j = 1; j < n_thread; j++)
+    {   n_j[j] = n + 1;
+        a_j[j] = a_j[j-1] + n - 1;
+        b_j[j] = b_j[j-1] + n - 1;
+        if( j == (n_thread - 1) )
+            n_j[j] = n_total - j * n + 1;
+    }
+    for(j = 0; j < n_thread; j++)
+    {   // inform each thread of which block it is working on
+        thread[j] = std::thread(a1, n_j[j], a_j[j], b_j[j]);
+    }
+    for(j = 0; j < n_thread; j++)
+        thread[j].join();
+
+    // check the result
+    float eps = 100.0f * std::numeric_limits<float>::epsilon();
+    for(i = 1; i < n ; i++)
+        ok &= std::fabs( (2. * b[i] - a[i] - a[i-1]) / b[i] ) <= eps;
+
+    delete [] a;
+    delete [] b;
+
+    return ok;
+}
+// END C++
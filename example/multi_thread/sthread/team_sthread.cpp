@@ -0,0 +1,352 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin team_sthread.cpp$$
+$spell
+    sthread
+    std
+$$
+
+
+$section Standard Thread Implementation of a Team of AD Threads$$
+See $cref team_thread.hpp$$ for this routines specifications.
+
+$head Method$$
+This implementation only uses the C++11 standard library;
+i.e., $code std::thread$$, $code std::mutex$$, and
+$code std::condition_variable$$.
+The thread number is stored in a $code thread_local$$ variable.
+Instead of two barriers, the master thread uses a job counter
+to release the other threads and a done counter to wait for them.
+The other threads sleep on a condition variable while they are waiting;
+i.e., they do not use processor time between calls to $code team_work$$.
+
+$head Work Stealing$$
+The $code team_tasks$$ routine starts by giving each thread
+a contiguous range of the task indices.
+A thread does the tasks at the front of its own range.
+When its range is empty,
+it steals the back half of the range for another thread
+and continues with the tasks it stole.
+Each range is protected by its own mutex, so the threads only contend
+when one of them is stealing.
+The routine returns when all of the ranges are empty.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+# include <cppad/cppad.hpp>
+# include "../team_thread.hpp"
+# define MAX_NUMBER_THREADS 48
+
+namespace {
+    using CppAD::thread_alloc;
+
+    // number of threads in the team
+    size_t num_threads_ = 1;
+
+    // CppAD thread number for the current thread
+    thread_local size_t thread_num_ = 0;
+
+    // type of the job currently being done by each thread
+    enum thread_job_t { init_enum, work_enum, join_enum } thread_job_;
+
+    // mutex that protects job_count_, num_done_, and thread_job_
+    std::mutex mutex_;
+
+    // used by master thread to signal that job_count_ has changed
+    std::condition_variable job_ready_;
+
+    // used by other threads to signal that num_done_ has changed
+    std::condition_variable work_done_;
+
+    // number of jobs that have been started by the master thread
+    size_t job_count_ = 0;
+
+    // number of other threads that have completed the current job
+    size_t num_done_ = 0;
+
+    // Are we in sequential mode; i.e., other threads are waiting for
+    // master thread to set up next job ?
+    bool sequential_execution_ = true;
+
+    // structure with information for one thread
+    typedef struct {
+        // The thread (not used for the master thread)
+        std::thread          sthread;
+        // true if no error for this thread, false otherwise.
+        bool                 ok;
+    } thread_one_t;
+
+    // vector with information for all threads
+    thread_one_t thread_all_[MAX_NUMBER_THREADS];
+
+    // pointer to function that does the work for one thread
+    void (* worker_)(void) = nullptr;
+
+    // range of task indices [begin, end) that belong to one thread
+    // (aligned to avoid false sharing between the threads)
+    struct alignas(64) task_range_t {
+        // protects begin and end
+        std::mutex mutex;
+        // next task that this thread will do
+        size_t     begin;
+        // end of the tasks that belong to this thread
+        size_t     end;
+    };
+
+    // task range for all threads
+    task_range_t task_range_[MAX_NUMBER_THREADS];
+
+    // pointer to function that does one task
+    void (* task_)(size_t task_index) = nullptr;
+
+    // ---------------------------------------------------------------------
+    // in_parallel()
+    bool in_parallel(void)
+    {   return ! sequential_execution_; }
+
+    // ---------------------------------------------------------------------
+    // thread_number()
+    size_t thread_number(void)
+    {   return thread_num_; }
+    // --------------------------------------------------------------------
+    // function that gets called by std::thread constructor
+    void thread_work(size_t thread_num)
+    {   bool ok = thread_num != 0;
+
+        // thread specific storage of thread number for this thread
+        thread_num_ = thread_num;
+
+        // number of jobs this thread has started
+        size_t job_count = 0;
+        while( true )
+        {   // wait for the master thread to start the next job
+            thread_job_t thread_job;
+            {   std::unique_lock<std::mutex> lock(mutex_);
+                job_ready_.wait(lock, [&job_count]
+                    { return job_count != job_count_; }
+                );
+                job_count  = job_count_;
+                thread_job = thread_job_;
+            }
+
+            // case where we are terminating this thread (no more work)
+            if( thread_job == join_enum)
+                break;
+
+            // only other case once a job has started (so far)
+            ok &= thread_job == work_enum;
+            worker_();
+
+            // inform master that our work is done and that this thread
+            // will not use global information until the next job starts
+            {   std::lock_guard<std::mutex> lock(mutex_);
+                if( ++num_done_ == num_threads_ - 1 )
+                    work_done_.notify_one();
+            }
+        }
+        thread_all_[thread_num].ok &= ok;
+        return;
+    }
+    // --------------------------------------------------------------------
+    // start a job in the other threads and wait for them to finish it
+    // (master thread does its part of the job in between)
+    void start_job(thread_job_t thread_job)
+    {   {   std::lock_guard<std::mutex> lock(mutex_);
+            thread_job_ = thread_job;
+            num_done_   = 0;
+            ++job_count_;
+        }
+        job_ready_.notify_all();
+    }
+    void wait_job(void)
+    {   std::unique_lock<std::mutex> lock(mutex_);
+        work_done_.wait(lock, []
+            { return num_done_ == num_threads_ - 1; }
+        );
+    }
+    // --------------------------------------------------------------------
+    // get the next task for this thread (false if there are no more tasks)
+    bool next_task(size_t thread_num, size_t& task_index)
+    {   // take a task from the front of this thread's range
+        task_range_t& own = task_range_[thread_num];
+        {   std::lock_guard<std::mutex> lock(own.mutex);
+            if( own.begin < own.end )
+            {   task_index = own.begin++;
+                return true;
+            }
+        }
+        // steal the back half of the range for another thread
+        for(size_t i = 1; i < num_threads_; ++i)
+        {   task_range_t& other = task_range_[(thread_num + i) % num_threads_];
+            size_t begin, end;
+            {   std::lock_guard<std::mutex> lock(other.mutex);
+                if( other.begin >= other.end )
+                    continue;
+                end        = other.end;
+                begin      = end - (end - other.begin + 1) / 2;
+                other.end  = begin;
+            }
+            // do the first stolen task now and the rest of them later
+            task_index = begin;
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = begin + 1;
+            own.end   = end;
+            return true;
+        }
+        return false;
+    }
+    // --------------------------------------------------------------------
+    // worker that does tasks until there are none left
+    void task_worker(void)
+    {   size_t thread_num = thread_num_;
+        size_t task_index;
+        while( next_task(thread_num, task_index) )
+            task_(task_index);
+    }
+}
+
+bool team_create(size_t num_threads)
+{   bool ok = true;
+
+    if( num_threads > MAX_NUMBER_THREADS )
+    {   std::cerr << "team_create: num_threads greater than ";
+        std::cerr << MAX_NUMBER_THREADS << std::endl;
+        exit(1);
+    }
+    // check that we currently do not have multiple threads running
+    ok  = num_threads_ == 1;
+    ok &= sequential_execution_;
+
+    size_t thread_num;
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+        thread_all_[thread_num].ok = true;
+
+    // Finish setup of thread_all_ for this thread
+    thread_num_ = 0;
+
+    // Now that thread_number() has necessary information for the case
+    // num_threads_ == 1, and while still in sequential mode,
+    // call setup for using CppAD::AD<double> in parallel mode.
+    thread_alloc::parallel_setup(num_threads, in_parallel, thread_number);
+    thread_alloc::hold_memory(true);
+    CppAD::parallel_ad<double>();
+
+    // now change num_threads_ to its final value.
+    num_threads_ = num_threads;
+
+    // initial job for the threads
+    thread_job_ = init_enum;
+    job_count_  = 0;
+    num_done_   = 0;
+
+    // This master thread is already running, we need to create
+    // num_threads - 1 more threads
+    for(thread_num = 1; thread_num < num_threads; thread_num++)
+    {   // Create the thread with thread number equal to thread_num
+        try
+        {   thread_all_[thread_num].sthread =
+                std::thread(thread_work, thread_num);
+        }
+        catch( const std::system_error& )
+        {   std::cerr << "team_create: cannot create thread ";
+            std::cerr << thread_num << std::endl;
+            exit(1);
+        }
+    }
+
+    // Current state is other threads are waiting for job_count_ to change.
+    return ok;
+}
+
+bool team_work(void worker(void))
+{
+    // Current state is other threads are waiting for job_count_ to change.
+    bool ok = sequential_execution_;
+    ok     &= thread_number() == 0;
+
+    // set global version of this work routine
+    worker_ = worker;
+
+    // Enter parallel execution and start the job for the other threads
+    if( num_threads_ > 1 )
+        sequential_execution_ = false;
+    start_job(work_enum);
+
+    // Now do the work in this thread and then wait for the other threads
+    worker();
+    wait_job();
+
+    // Current state is other threads are waiting for job_count_ to change.
+    sequential_execution_ = true;
+
+    size_t thread_num;
+    for(thread_num = 0; thread_num < num_threads_; thread_num++)
+        ok &= thread_all_[thread_num].ok;
+    return ok;
+}
+
+bool team_tasks(size_t num_tasks, void task(size_t task_index))
+{   bool ok = sequential_execution_;
+    ok     &= thread_number() == 0;
+
+    // initial split of the tasks between the threads
+    for(size_t thread_num = 0; thread_num < num_threads_; thread_num++)
+    {   task_range_t& range = task_range_[thread_num];
+        range.begin = (num_tasks * thread_num) / num_threads_;
+        range.end   = (num_tasks * (thread_num + 1) ) / num_threads_;
+    }
+
+    // set global version of this task routine
+    task_ = task;
+
+    // each thread does tasks until all of the ranges are empty
+    ok &= team_work(task_worker);
+    return ok;
+}
+
+bool team_destroy(void)
+{
+    // Current state is other threads are waiting for job_count_ to change.
+    bool ok = sequential_execution_;
+    ok     &= thread_number() == 0;
+
+    // inform the other threads that there is no more work
+    start_job(join_enum);
+
+    // now wait for the other threads to exit
+    size_t thread_num;
+    for(thread_num = 1; thread_num < num_threads_; thread_num++)
+        thread_all_[thread_num].sthread.join();
+
+    // check ok before changing num_threads_
+    for(thread_num = 0; thread_num < num_threads_; thread_num++)
+        ok &= thread_all_[thread_num].ok;
+
+    // now inform CppAD that there is only one thread
+    num_threads_ = 1;
+    thread_alloc::parallel_setup(num_threads_, nullptr, nullptr);
+    thread_alloc::hold_memory(false);
+    CppAD::parallel_ad<double>();
+
+    return ok;
+}
+
+const char* team_name(void)
+{   return "sthread"; }
+// END C++
@@ -0,0 +1,157 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin team_level.cpp$$
+$spell
+    CppAD
+$$
+
+$section Forward Mode by Levels Using a Team of Threads: Example and Test$$
+
+$head Purpose$$
+This example uses a $cref/team of threads/team_thread.hpp/$$
+to execute the tasks for each level in a
+$cref forward_level$$ calculation.
+
+$head Runner$$
+The $code team_runner$$ class below is derived from
+$code CppAD::level_runner$$.
+Its $code run$$ function stores the tasks in static variables and
+calls $code team_work$$.
+Each thread in the team executes the tasks with index
+$icode%k% = %thread_num%, %thread_num% + %num_threads%, %...%$$.
+The call to $code team_work$$ returns after all the threads have
+finished their work.
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include "team_thread.hpp"
+# define NUMBER_THREADS  4
+
+namespace {
+    using CppAD::thread_alloc;
+
+    // tasks for the current level (set by team_runner, used by worker)
+    const CppAD::level_task* task_  = nullptr;
+    size_t                   n_task_ = 0;
+
+    // function that does the work for one thread
+    void worker(void)
+    {   size_t thread_num  = thread_alloc::thread_num();
+        size_t num_threads = thread_alloc::num_threads();
+        for(size_t k = thread_num; k < n_task_; k += num_threads)
+            (*task_)(k);
+    }
+
+    // runner that executes the tasks using the team of threads
+    class team_runner : public CppAD::level_runner {
+    public:
+        // false if an error occurs, true otherwise
+        bool ok;
+        //
+        team_runner(void) : ok(true)
+        { }
+        void run(size_t n_task, const CppAD::level_task& task) override
+        {   task_   = &task;
+            n_task_ = n_task;
+            ok     &= team_work(worker);
+            task_   = nullptr;
+            n_task_ = 0;
+        }
+    };
+}
+
+// This test routine is only called by the master thread (thread_num = 0).
+bool team_level(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // Use std::vector for this thread's vectors so they do not hold
+    // thread_alloc memory when we check it at the end of this routine
+    typedef std::vector<double> d_vector;
+    typedef std::vector< AD<double> > ad_vector;
+    size_t num_threads = NUMBER_THREADS;
+
+    // Check that no memory is in use or available at start
+    // (using thread_alloc in sequential mode)
+    size_t thread_num;
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+    {   ok &= thread_alloc::inuse(thread_num) == 0;
+        ok &= thread_alloc::available(thread_num) == 0;
+    }
+
+    // f(x): one chain of operations for each independent variable
+    size_t n = 64, n_step = 20;
+    ad_vector ax(n), ay(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 1.0;
+    CppAD::Independent(ax);
+    for(size_t j = 0; j < n; ++j)
+    {   AD<double> az = ax[j];
+        for(size_t k = 0; k < n_step; ++k)
+            az = cos(az) * ax[ (j + 1) % n ] + az / double(k + 1);
+        ay[j] = az;
+    }
+    CppAD::ADFun<double>* f = new CppAD::ADFun<double>(ax, ay);
+    CppAD::ADFun<double>* g = new CppAD::ADFun<double>();
+    *g = *f;
+
+    // x, x1
+    d_vector x(n), x1(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j]  = double(j + 1) / double(n);
+        x1[j] = double(j % 5) + 1.0;
+    }
+
+    // use the team of threads to execute the tasks in each level
+    // (forward_level is called by the master thread in sequential mode)
+    team_runner runner;
+    size_t min_width = 8;
+    d_vector y(n), y1(n), check(n);
+    ok &= team_create(num_threads);
+    y  = f->forward_level(0, x, runner, min_width);
+    y1 = f->forward_level(1, x1, runner, min_width);
+    ok &= team_destroy();
+    ok &= runner.ok;
+    ok &= 0 < f->size_level();
+
+    // check using sequential forward mode
+    check = g->Forward(0, x);
+    for(size_t i = 0; i < n; ++i)
+        ok &= NearEqual(y[i], check[i], eps99, eps99);
+    check = g->Forward(1, x1);
+    for(size_t i = 0; i < n; ++i)
+        ok &= NearEqual(y1[i], check[i], eps99, eps99);
+
+    // free the function objects
+    delete f;
+    delete g;
+
+    // free memory for other threads before memory for master
+    thread_num = num_threads;
+    while(thread_num--)
+    {   // check that there is no longer any memory inuse by this thread
+        ok &= thread_alloc::inuse(thread_num) == 0;
+        // return all memory being held for future use by this thread
+        thread_alloc::free_available(thread_num);
+    }
+    return ok;
+}
+// END C++
@@ -0,0 +1,159 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin team_reverse.cpp$$
+$spell
+    CppAD
+$$
+
+$section Parallel Reverse Mode Using a Team of Threads: Example and Test$$
+
+$head Purpose$$
+This example computes the gradient of a sum of many independent terms
+(for example a likelihood that is a sum over samples) using a
+$cref/team of threads/team_thread.hpp/$$.
+
+$head Method$$
+The function $latex F : \B{R}^n \rightarrow \B{R}^m$$
+has one range component for each term in the sum.
+The gradient of
+$latex \[
+    S(x) = F_0 (x) + \cdots + F_{m-1} (x)
+\] $$
+is computed using $cref reverse_level$$ with all the weights equal to one.
+The $code team_runner$$ class below executes the tasks for each level
+using $code team_work$$.
+Each thread in the team executes the tasks with index
+$icode%k% = %thread_num%, %thread_num% + %num_threads%, %...%$$.
+The number of private copies of the partial derivatives
+is equal to the number of threads; i.e.,
+each thread adds to its own copy and
+$code reverse_level$$ adds the copies for each variable.
+
+$head Source Code$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include "team_thread.hpp"
+# define NUMBER_THREADS  4
+
+namespace {
+    using CppAD::thread_alloc;
+
+    // tasks for the current level (set by team_runner, used by worker)
+    const CppAD::level_task* task_  = nullptr;
+    size_t                   n_task_ = 0;
+
+    // function that does the work for one thread
+    void worker(void)
+    {   size_t thread_num  = thread_alloc::thread_num();
+        size_t num_threads = thread_alloc::num_threads();
+        for(size_t k = thread_num; k < n_task_; k += num_threads)
+            (*task_)(k);
+    }
+
+    // runner that executes the tasks using the team of threads
+    class team_runner : public CppAD::level_runner {
+    public:
+        // false if an error occurs, true otherwise
+        bool ok;
+        //
+        team_runner(void) : ok(true)
+        { }
+        void run(size_t n_task, const CppAD::level_task& task) override
+        {   task_   = &task;
+            n_task_ = n_task;
+            ok     &= team_work(worker);
+            task_   = nullptr;
+            n_task_ = 0;
+        }
+    };
+}
+
+// This test routine is only called by the master thread (thread_num = 0).
+bool team_reverse(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // Use std::vector for this thread's vectors so they do not hold
+    // thread_alloc memory when we check it at the end of this routine
+    typedef std::vector<double> d_vector;
+    typedef std::vector< AD<double> > ad_vector;
+    size_t num_threads = NUMBER_THREADS;
+
+    // Check that no memory is in use or available at start
+    // (using thread_alloc in sequential mode)
+    size_t thread_num;
+    for(thread_num = 0; thread_num < num_threads; thread_num++)
+    {   ok &= thread_alloc::inuse(thread_num) == 0;
+        ok &= thread_alloc::available(thread_num) == 0;
+    }
+
+    // F_i (x) = ( x_0 + x_1 * t_i + x_2 * t_i^2 - d_i )^2
+    // for the samples t_i = i / m, d_i = exp(t_i)
+    size_t n = 3, m = 100;
+    ad_vector ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.0;
+    CppAD::Independent(ax);
+    for(size_t i = 0; i < m; ++i)
+    {   double t       = double(i) / double(m);
+        double d       = std::exp(t);
+        AD<double> res = ax[0] + ax[1] * t + ax[2] * t * t - d;
+        ay[i]          = res * res;
+    }
+    CppAD::ADFun<double>* f = new CppAD::ADFun<double>(ax, ay);
+
+    // point at which to compute the gradient
+    d_vector x(n);
+    x[0] = 1.0;
+    x[1] = 1.0;
+    x[2] = 0.5;
+
+    // use the team of threads for the forward and reverse sweeps
+    // (forward_level and reverse_level are called by the master thread)
+    team_runner runner;
+    size_t min_width = 8;
+    d_vector w(m, 1.0), grad(n);
+    ok  &= team_create(num_threads);
+    f->forward_level(0, x, runner, min_width);
+    grad = f->reverse_level(1, w, runner, min_width, num_threads);
+    ok  &= team_destroy();
+    ok  &= runner.ok;
+
+    // check using one sequential reverse sweep
+    f->Forward(0, x);
+    d_vector dw(n);
+    dw = f->Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(grad[j], dw[j], eps99, eps99);
+
+    // free the function object
+    delete f;
+
+    // free memory for other threads before memory for master
+    thread_num = num_threads;
+    while(thread_num--)
+    {   // check that there is no longer any memory inuse by this thread
+        ok &= thread_alloc::inuse(thread_num) == 0;
+        // return all memory being held for future use by this thread
+        thread_alloc::free_available(thread_num);
+    }
+    return ok;
+}
+// END C++
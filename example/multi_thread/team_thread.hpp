@@ -1,7 +1,7 @@
 # ifndef CPPAD_EXAMPLE_MULTI_THREAD_TEAM_THREAD_HPP
 # define CPPAD_EXAMPLE_MULTI_THREAD_TEAM_THREAD_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -32,6 +32,7 @@ $head Syntax$$
 $codei%include "team_thread.hpp"
 %ok%   = team_create(%num_threads%)
 %ok%   = team_work(%worker%)
+%ok%   = team_tasks(%num_tasks%, %task%)
 %ok%   = team_destroy()
 %name% = team_name()
 %$$
@@ -40,12 +41,14 @@ $head Purpose$$
 These routines start, use, and stop a team of threads that can
 be used with the CppAD type $code AD<double>$$.
 For example,
-these could be OpenMP threads, pthreads, or Boost threads to name a few.
+these could be OpenMP threads, pthreads, Boost threads,
+or C++ standard library threads to name a few.
 
 $head Restrictions$$
 Calls to the routines
 $code team_create$$,
-$code team_work$$, and
+$code team_work$$,
+$code team_tasks$$, and
 $code team_destroy$$, must all be done by the master thread; i.e.,
 $cref/thread_num/ta_thread_num/$$ must be zero.
 In addition, they must all be done in sequential execution mode; i.e.,
@@ -73,6 +76,25 @@ $cref/thread_num/ta_thread_num/$$
 between zero and $icode%num_threads% - 1%$$ and
 different for each thread,
 
+$head team_tasks$$
+This routine may be called one or more times
+between the call to $code team_create$$ and $code team_destroy$$.
+The argument $icode num_tasks$$ has type $code size_t$$
+and the argument $icode task$$ has type
+$codei%void %task%(size_t %task_index%)%$$.
+Each call to $code team_tasks$$ calls $icode task$$ exactly once for each
+$icode%task_index% = 0 , %...% , %num_tasks%-1%$$.
+Which thread does each task is not specified; i.e.,
+the tasks are balanced dynamically between the threads.
+A thread that finishes its tasks draws more tasks
+from a work queue that is shared by the threads in the team
+(or steals them from the other threads).
+Thus the tasks may take different amounts of time and the
+threads will still finish at about the same time.
+The $cref/thread_num/ta_thread_num/$$ inside of $icode task$$
+identifies the thread that is doing the task and can be used to
+access memory that is private to that thread.
+
 $head team_destroy$$
 This routine terminates all the other threads except for
 thread number zero; i.e., it terminates the threads corresponding to
@@ -97,7 +119,8 @@ Otherwise it is $code true$$.
 $children%
     example/multi_thread/openmp/team_openmp.cpp%
     example/multi_thread/bthread/team_bthread.cpp%
-    example/multi_thread/pthread/team_pthread.cpp
+    example/multi_thread/pthread/team_pthread.cpp%
+    example/multi_thread/sthread/team_sthread.cpp
 %$$
 
 $head Example Use$$
@@ -110,6 +133,7 @@ $table
 $rref team_openmp.cpp$$
 $rref team_bthread.cpp$$
 $rref team_pthread.cpp$$
+$rref team_sthread.cpp$$
 $tend
 
 $head Speed Test of Implementation$$
@@ -126,6 +150,7 @@ $srccode%cpp% */
 
 extern bool team_create(size_t num_threads);
 extern bool team_work(void worker(void));
+extern bool team_tasks(size_t num_tasks, void task(size_t task_index));
 extern bool team_destroy(void);
 extern const char* team_name(void);
 /* %$$
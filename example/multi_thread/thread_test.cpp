@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -13,6 +13,8 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 /*
 $begin thread_test.cpp$$
 $spell
+    async
+    eval
     inv
     mega
     cpp
@@ -21,6 +23,8 @@ $spell
     pthreads
     openmp
     bthread
+    sthread
+    std
     chkpoint
 $$
 
@@ -36,9 +40,12 @@ command.
 
 $head threading$$
 If the $cref cmake$$ command output indicates that
-$code bthread$$, $code pthread$$, or $code openmp$$ is available,
+$code bthread$$, $code pthread$$, $code sthread$$, or $code openmp$$
+is available,
 you can run the program below with $icode threading$$ equal to
-$code bthread$$, $code pthread$$, or $code openmp$$ respectively.
+$code bthread$$, $code pthread$$, $code sthread$$, or $code openmp$$
+respectively.
+The $code sthread$$ case uses the C++ standard library $code std::thread$$.
 
 $head program$$
 We use the notation $icode program$$ for
@@ -62,6 +69,9 @@ $codei%.
 ./%program% a11c
 ./%program% simple_ad
 ./%program% team_example
+./%program% team_reverse
+./%program% team_level
+./%program% async_eval
 ./%program% harmonic     %test_time% %max_threads% %mega_sum%
 ./%program% atomic_two   %test_time% %max_threads% %num_solve%
 ./%program% atomic_three %test_time% %max_threads% %num_solve%
@@ -77,12 +87,17 @@ $children%
     example/multi_thread/openmp/a11c_openmp.cpp%
     example/multi_thread/bthread/a11c_bthread.cpp%
     example/multi_thread/pthread/a11c_pthread.cpp%
+    example/multi_thread/sthread/a11c_sthread.cpp%
 
     example/multi_thread/openmp/simple_ad_openmp.cpp%
     example/multi_thread/bthread/simple_ad_bthread.cpp%
     example/multi_thread/pthread/simple_ad_pthread.cpp%
+    example/multi_thread/sthread/simple_ad_sthread.cpp%
 
     example/multi_thread/team_example.cpp%
+    example/multi_thread/team_reverse.cpp%
+    example/multi_thread/team_level.cpp%
+    example/multi_thread/async_eval.cpp%
     example/multi_thread/harmonic.omh%
     example/multi_thread/multi_atomic_three.omh%
     example/multi_thread/multi_chkpoint_two.omh%
@@ -94,21 +109,23 @@ $children%
 $head a11c$$
 The $icode test_case$$ $code a11c$$ runs the examples
 $cref a11c_openmp.cpp$$,
-$cref a11c_bthread.cpp$$, and
-$cref a11c_pthread.cpp$$.
+$cref a11c_bthread.cpp$$,
+$cref a11c_pthread.cpp$$, and
+$cref a11c_sthread.cpp$$.
 These cases demonstrate simple multi-threading,
 without algorithmic differentiation, using
-OpenMP, boost threads and pthreads respectively.
+OpenMP, boost threads, pthreads, and standard threads respectively.
 
 $head simple_ad$$
 The $icode test_case$$ $code simple_ad$$ runs the examples
 $cref simple_ad_openmp.cpp$$,
 $cref simple_ad_bthread.cpp$$,
+$cref simple_ad_pthread.cpp$$,
 and
-$cref simple_ad_pthread.cpp$$.
+$cref simple_ad_sthread.cpp$$.
 These cases demonstrate simple multi-threading,
 with algorithmic differentiation, using
-OpenMP, boost threads and pthreads respectively.
+OpenMP, boost threads, pthreads, and standard threads respectively.
 
 $head team_example$$
 The $icode test_case$$ $code team_example$$ runs the
@@ -116,6 +133,26 @@ $cref team_example.cpp$$ example.
 This case demonstrates simple multi-threading with algorithmic differentiation
 and using a $cref/team of threads/team_thread.hpp/$$.
 
+$head team_reverse$$
+The $icode test_case$$ $code team_reverse$$ runs the
+$cref team_reverse.cpp$$ example.
+This case demonstrates computing a gradient in parallel using
+$cref reverse_level$$ and a team of threads.
+
+$head team_level$$
+The $icode test_case$$ $code team_level$$ runs the
+$cref team_level.cpp$$ example.
+This case demonstrates using a team of threads to evaluate the operators
+in each dependency level at the same time; see $cref forward_level$$.
+
+$head async_eval$$
+The $icode test_case$$ $code async_eval$$ runs the
+$cref async_eval.cpp$$ example.
+This case demonstrates evaluating a function and its derivatives
+asynchronously using the pool of threads managed by an $code ADFun$$ object;
+see $cref async_eval$$
+(it does not use the team of threads).
+
 $head test_time$$
 All of the other cases include the $icode test_time$$ argument.
 This is the minimum amount of wall clock time that the test should take.
@@ -141,6 +178,9 @@ The $icode test_case$$ $code harmonic$$ runs the
 $cref harmonic_time$$ example.
 This is a timing test for a multi-threading
 example without algorithmic differentiation using a team of threads.
+The summation is split into more tasks than threads and the tasks are
+balanced dynamically between the threads using
+$cref/team_tasks/team_thread.hpp/team_tasks/$$.
 
 $subhead mega_sum$$
 The command line argument $icode mega_sum$$
@@ -178,6 +218,11 @@ The $icode test_case$$ $code multi_newton$$  runs the
 $cref multi_newton.cpp$$ example.
 This preforms a timing test for a multi-threading
 example with algorithmic differentiation using a team of threads.
+There is one task for each sub-interval and the tasks are
+balanced dynamically between the threads using
+$cref/team_tasks/team_thread.hpp/team_tasks/$$;
+i.e., this test measures the scaling of the load balancing
+for tasks that take different amounts of time.
 
 $subhead num_zero$$
 The command line argument $icode num_zero$$
@@ -208,6 +253,7 @@ $table
 $rref team_openmp.cpp$$
 $rref team_bthread.cpp$$
 $rref team_pthread.cpp$$
+$rref team_sthread.cpp$$
 $tend
 
 $head Source$$
@@ -223,6 +269,9 @@ $end
 # include <ctime>
 # include "team_thread.hpp"
 # include "team_example.hpp"
+# include "team_reverse.hpp"
+# include "team_level.hpp"
+# include "async_eval.hpp"
 # include "harmonic.hpp"
 # include "multi_atomic_two.hpp"
 # include "multi_atomic_three.hpp"
@@ -269,6 +318,9 @@ int main(int argc, char *argv[])
     "./<program> a11c\n"
     "./<program> simple_ad\n"
     "./<program> team_example\n"
+    "./<program> team_reverse\n"
+    "./<program> team_level\n"
+    "./<program> async_eval\n"
     "./<program> harmonic     test_time max_threads mega_sum\n"
     "./<program> atomic_two   test_time max_threads num_solve\n"
     "./<program> atomic_three test_time max_threads num_solve\n"
@@ -277,7 +329,7 @@ int main(int argc, char *argv[])
     "./<program> multi_newton test_time max_threads \\\n"
     "   num_zero num_sub num_sum use_ad\\\n"
     "where <program> is example_multi_thread_<threading>\n"
-    "and <threading> is bthread, openmp, or pthread";
+    "and <threading> is bthread, openmp, pthread, or sthread";
 
     // command line argument values (assign values to avoid compiler warnings)
     size_t num_zero=0, num_sub=0, num_sum=0;
@@ -312,13 +364,19 @@ int main(int argc, char *argv[])
     bool run_a11c         = std::strcmp(test_name, "a11c")             == 0;
     bool run_simple_ad    = std::strcmp(test_name, "simple_ad")        == 0;
     bool run_team_example = std::strcmp(test_name, "team_example")     == 0;
+    bool run_team_reverse = std::strcmp(test_name, "team_reverse")     == 0;
+    bool run_team_level   = std::strcmp(test_name, "team_level")       == 0;
+    bool run_async_eval   = std::strcmp(test_name, "async_eval")       == 0;
     bool run_harmonic     = std::strcmp(test_name, "harmonic")         == 0;
     bool run_atomic_two   = std::strcmp(test_name, "atomic_two")       == 0;
     bool run_atomic_three = std::strcmp(test_name, "atomic_three")     == 0;
     bool run_chkpoint_one = std::strcmp(test_name, "chkpoint_one")     == 0;
     bool run_chkpoint_two = std::strcmp(test_name, "chkpoint_two")     == 0;
     bool run_multi_newton = std::strcmp(test_name, "multi_newton")     == 0;
-    if( run_a11c || run_simple_ad || run_team_example )
+    bool run_no_argument  = run_a11c || run_simple_ad ||
+        run_team_example || run_team_reverse || run_team_level ||
+        run_async_eval;
+    if( run_no_argument )
         ok = (argc == 2);
     else if( run_harmonic
     || run_atomic_two
@@ -334,13 +392,19 @@ int main(int argc, char *argv[])
         std::cerr << usage << endl;
         exit(1);
     }
-    if( run_a11c || run_simple_ad || run_team_example )
+    if( run_no_argument )
     {   if( run_a11c )
             ok        = a11c();
         else if( run_simple_ad )
             ok        = simple_ad();
-        else
+        else if( run_team_example )
             ok        = team_example();
+        else if( run_team_reverse )
+            ok        = team_reverse();
+        else if( run_team_level )
+            ok        = team_level();
+        else
+            ok        = async_eval();
         if( thread_alloc::free_all() )
             cout << "free_all      = true;"  << endl;
         else
@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -27,6 +27,7 @@ extern bool conditional_skip(void);
 extern bool cumulative_sum(void);
 extern bool forward_active(void);
 extern bool nest_conditional(void);
+extern bool optimize_stat(void);
 extern bool print_for(void);
 extern bool reverse_active(void);
 extern bool optimize_twice(void);
@@ -45,6 +46,7 @@ int main(void)
     Run( conditional_skip,    "conditional_skip"   );
     Run( forward_active,      "forward_active"     );
     Run( nest_conditional,    "nest_conditional"   );
+    Run( optimize_stat,       "optimize_stat"      );
     Run( print_for,           "print_for"          );
     Run( reverse_active,      "reverse_active"     );
     Run( optimize_twice,         "re_optimize"        );
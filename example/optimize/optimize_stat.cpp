@@ -0,0 +1,87 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin optimize_stat.cpp$$
+
+$section Optimizer Hash Table Statistics: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool optimize_stat(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+
+    // independent variable vector
+    size_t n = 2;
+    vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    Independent(ax);
+
+    // each of the n_repeat terms computes the same expression
+    // so all but the first are common sub-expressions
+    size_t n_repeat = 100;
+    vector< AD<double> > ay(1);
+    ay[0] = 0.0;
+    for(size_t k = 0; k < n_repeat; ++k)
+        ay[0] += sin( ax[0] * ax[1] ) + ax[1] / ax[0];
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f;
+    f.Dependent(ax, ay);
+
+    // f has not been optimized so all the statistics are zero
+    ok &= f.optimize_stat().n_lookup == 0;
+    ok &= f.optimize_stat().n_match  == 0;
+
+    // optimize f
+    size_t size_var_before = f.size_var();
+    f.optimize();
+    ok &= f.size_var() < size_var_before;
+
+    // statistics for the optimization
+    const CppAD::optimize_stat_t& stat( f.optimize_stat() );
+
+    // the number of hash codes grows with the size of the recording
+    ok &= f.size_op() <= stat.n_hash_code;
+
+    // the mul, sin, and div operators for each term are looked up
+    // (the additions are converted to a cumulative summation)
+    ok &= 3 * n_repeat <= stat.n_lookup;
+
+    // all but the first of the mul, sin, and div operators match
+    ok &= stat.n_match == 3 * (n_repeat - 1);
+
+    // the collision limit was not reached
+    ok &= stat.n_limit == 0;
+    ok &= stat.max_collision < 10;
+    ok &= f.exceed_collision_limit() == false;
+
+    // the time used by the optimizer
+    ok &= 0.0 <= stat.seconds;
+
+    // check the optimized function values
+    vector<double> x(n), y(1);
+    x[0] = 2.0;
+    x[1] = 3.0;
+    y    = f.Forward(0, x);
+    double check = double(n_repeat) * ( std::sin(x[0] * x[1]) + x[1] / x[0] );
+    ok  &= CppAD::NearEqual(y[0], check, 1e-10, 1e-10);
+
+    return ok;
+}
+// END C++
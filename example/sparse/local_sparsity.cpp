@@ -0,0 +1,168 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin local_sparsity.cpp$$
+$spell
+    Jacobian
+$$
+
+$section Sparsity Patterns Local to a Point: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    typedef CPPAD_TESTVECTOR(size_t)     SizeVector;
+    typedef CppAD::sparse_rc<SizeVector> sparsity;
+
+    // Jacobian sparsity pattern for f as a vector of bool
+    CPPAD_TESTVECTOR(bool) jac_pattern(CppAD::ADFun<double>& f)
+    {   size_t n = f.Domain();
+        size_t m = f.Range();
+        sparsity pattern_in(n, n, n);
+        for(size_t k = 0; k < n; ++k)
+            pattern_in.set(k, k, k);
+        bool transpose     = false;
+        bool dependency    = false;
+        bool internal_bool = false;
+        sparsity pattern_out;
+        f.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, pattern_out
+        );
+        CPPAD_TESTVECTOR(bool) result(m * n);
+        for(size_t k = 0; k < m * n; ++k)
+            result[k] = false;
+        for(size_t k = 0; k < pattern_out.nnz(); ++k)
+            result[ pattern_out.row()[k] * n + pattern_out.col()[k] ] = true;
+        return result;
+    }
+}
+
+bool local_sparsity(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // domain space vector
+    size_t n = 3;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.0;
+    //
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+    //
+    // range space vector
+    size_t m = 2;
+    AD<double> azero(0.0);
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    ay[0] = CppAD::CondExpLt(ax[0], azero, sin(ax[1]), cos(ax[2]) );
+    ay[1] = CppAD::CondExpGt(ax[1], ax[2], ax[0] * ax[1], ax[2] );
+    //
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // the default sparsity patterns include both branches
+    ok &= f.local_sparsity() == false;
+    CPPAD_TESTVECTOR(bool) check(m * n), pattern(m * n);
+    pattern  = jac_pattern(f);
+    check[0 * n + 0] = false;
+    check[0 * n + 1] = true;
+    check[0 * n + 2] = true;
+    check[1 * n + 0] = true;
+    check[1 * n + 1] = true;
+    check[1 * n + 2] = true;
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= pattern[k] == check[k];
+    //
+    // turn on local sparsity and choose the current point
+    f.local_sparsity(true);
+    CPPAD_TESTVECTOR(double) x(n);
+    x[0] = -1.0;
+    x[1] = 2.0;
+    x[2] = 1.0;
+    f.Forward(0, x);
+    //
+    // at this point, y[0] = sin(x[1]) and y[1] = x[0] * x[1]
+    pattern  = jac_pattern(f);
+    check[0 * n + 0] = false;
+    check[0 * n + 1] = true;
+    check[0 * n + 2] = false;
+    check[1 * n + 0] = true;
+    check[1 * n + 1] = true;
+    check[1 * n + 2] = false;
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= pattern[k] == check[k];
+    ok &= f.local_sparsity_valid();
+    //
+    // a point with the same branches, the local pattern is still valid
+    x[0] = -2.0;
+    x[1] = 3.0;
+    f.Forward(0, x);
+    ok &= f.local_sparsity_valid();
+    //
+    // a point where y[1] = x[2], the local pattern is no longer valid
+    x[1] = 0.5;
+    f.Forward(0, x);
+    ok &= ! f.local_sparsity_valid();
+    //
+    // recompute the local pattern
+    pattern  = jac_pattern(f);
+    check[1 * n + 0] = false;
+    check[1 * n + 1] = false;
+    check[1 * n + 2] = true;
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= pattern[k] == check[k];
+    ok &= f.local_sparsity_valid();
+    //
+    // local Hessian sparsity pattern for y[0] at this point; i.e.,
+    // the Hessian of sin(x[1])
+    CPPAD_TESTVECTOR(bool) select_domain(n), select_range(m);
+    for(size_t j = 0; j < n; ++j)
+        select_domain[j] = true;
+    select_range[0] = true;
+    select_range[1] = false;
+    bool internal_bool = false;
+    sparsity pattern_out;
+    f.for_hes_sparsity(
+        select_domain, select_range, internal_bool, pattern_out
+    );
+    ok &= pattern_out.nnz() == 1;
+    if( pattern_out.nnz() == 1 )
+    {   ok &= pattern_out.row()[0] == 1;
+        ok &= pattern_out.col()[0] == 1;
+    }
+    //
+    // turning off local sparsity restores the global patterns
+    f.local_sparsity(false);
+    ok &= f.local_sparsity_valid();
+    f.for_hes_sparsity(
+        select_domain, select_range, internal_bool, pattern_out
+    );
+    ok &= pattern_out.nnz() == 2;
+    //
+    // after optimization, zero order forward skips the operations that
+    // are only used by branches that are not selected
+    f.optimize();
+    f.local_sparsity(true);
+    f.Forward(0, x);
+    pattern  = jac_pattern(f);
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= pattern[k] == check[k];
+    //
+    return ok;
+}
+// END C++
@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -38,6 +38,7 @@ extern bool dependency(void);
 extern bool for_hes_sparsity(void);
 extern bool for_jac_sparsity(void);
 extern bool for_sparse_hes(void);
+extern bool local_sparsity(void);
 extern bool rc_sparsity(void);
 extern bool rev_hes_sparsity(void);
 extern bool rev_jac_sparsity(void);
@@ -74,6 +75,7 @@ int main(void)
     Run( for_hes_sparsity,          "for_hes_sparsity" );
     Run( for_jac_sparsity,          "for_jac_sparsity" );
     Run( for_sparse_hes,            "for_sparse_hes" );
+    Run( local_sparsity,            "local_sparsity" );
     Run( rc_sparsity,               "rc_sparsity" );
     Run( rev_hes_sparsity,          "rev_hes_sparsity" );
     Run( rev_jac_sparsity,          "rev_jac_sparsity" );
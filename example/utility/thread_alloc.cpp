@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -90,6 +90,53 @@ bool raw_allocate(void)
     return ok;
 }
 
+bool capacity_stat(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    size_t thread = thread_alloc::thread_num();
+
+    // check that no memory is initilaly inuse
+    ok &= thread_alloc::free_all();
+
+    // get and return memory twice
+    size_t min_bytes = 3 * sizeof(double);
+    size_t cap_bytes;
+    for(size_t i = 0; i < 2; ++i)
+    {   void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        thread_alloc::return_memory(v_ptr);
+    }
+
+    // statistics for each capacity
+    size_t num_cap   = thread_alloc::num_capacity();
+    size_t sum_held  = 0;
+    bool   found     = false;
+    for(size_t c_index = 0; c_index < num_cap; ++c_index)
+    {   size_t c_bytes, num_hit, num_miss, held_bytes;
+        thread_alloc::capacity_stat(
+            thread, c_index, c_bytes, num_hit, num_miss, held_bytes
+        );
+        sum_held += held_bytes;
+        if( c_bytes == cap_bytes )
+        {   // first request was a miss, second was a hit
+            found = true;
+            ok   &= num_miss   == 1;
+            ok   &= num_hit    == 1;
+            ok   &= held_bytes == cap_bytes;
+        }
+        else
+        {   ok &= num_miss + num_hit + held_bytes == 0;
+        }
+    }
+    ok &= found;
+    ok &= sum_held == thread_alloc::available(thread);
+
+    // return memory to system, this also resets the statistics
+    thread_alloc::free_available(thread);
+    ok &= thread_alloc::free_all();
+
+    return ok;
+}
+
 class my_char {
 public:
     char ch_ ;
@@ -229,6 +276,9 @@ bool thread_alloc(void)
     // check alignment
     ok &= check_alignment();
 
+    // check capacity statistics
+    ok &= capacity_stat();
+
     // return allocator to its default mode
     thread_alloc::hold_memory(false);
     return ok;
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_ABS_NORMAL_FUN_HPP
 # define CPPAD_CORE_ABS_NORMAL_FUN_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -919,6 +919,18 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
         g.play_.num_var_rec()  // n_var
     );
 
+    // free g.live_slot_
+    g.live_slot_.clear();
+
+    // free g.level_schedule_
+    g.level_schedule_.clear();
+
+    // free g.memo_table_ (memo_pure setting does not change)
+    g.memo_table_.clear();
+
+    // free g.cexp_select_
+    g.cexp_select_.clear();
+
     // ------------------------------------------------------------------------
     // Create the function a
     // ------------------------------------------------------------------------
@@ -259,6 +259,9 @@ public:
     // abort current AD<Base> recording
     static void        abort_recording(void);
 
+    // reserve memory for the current AD<Base> recording
+    static void        record_reserve(size_t n_op, size_t n_arg, size_t n_par);
+
     // set the maximum number of OpenMP threads (deprecated)
     static void        omp_max_thread(size_t number);
 
@@ -293,8 +296,8 @@ private:
     local::ADTape<Base>* tape_this(void) const;
     //
     // static
-    static tape_id_t*            tape_id_ptr(size_t thread);
-    static local::ADTape<Base>** tape_handle(size_t thread);
+    static tape_id_t*            tape_id_ptr(size_t slot);
+    static local::ADTape<Base>** tape_handle(size_t slot);
     static local::ADTape<Base>*         tape_manage(tape_manage_enum job);
     static local::ADTape<Base>*  tape_ptr(void);
     static local::ADTape<Base>*  tape_ptr(tape_id_t tape_id);
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_AD_FUN_HPP
 # define CPPAD_CORE_AD_FUN_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -42,13 +42,19 @@ $childtable%
     include/cppad/core/ad_fun.omh%
     include/cppad/core/optimize.hpp%
     include/cppad/core/fun_check.hpp%
-    include/cppad/core/check_for_nan.hpp
+    include/cppad/core/check_for_nan.hpp%
+    include/cppad/core/async_eval.hpp
 %$$
 
 $end
 */
 # include <cppad/core/graph/cpp_graph.hpp>
+# include <cppad/core/optimize_stat.hpp>
 # include <cppad/local/subgraph/info.hpp>
+# include <cppad/local/live_slot.hpp>
+# include <cppad/local/level_schedule.hpp>
+# include <cppad/local/memo_table.hpp>
+# include <cppad/local/async_pool.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -84,9 +90,16 @@ private:
     /// Has this ADFun object been optmized
     bool has_been_optimized_;
 
+    /// Hash table statistics for the previous optimization
+    optimize_stat_t optimize_stat_;
+
     /// Check for nan's and report message to user (default value is true).
     bool check_for_nan_;
 
+    /// Are sparsity patterns local to the current point
+    /// (default value is false).
+    bool local_sparsity_;
+
     /// If zero, ignoring comparison operators. Otherwise is the
     /// compare change count at which to store the operator index.
     size_t compare_change_count_;
@@ -126,6 +139,10 @@ private:
     /// Set during forward pass of order zero
     local::pod_vector<bool> cskip_op_;
 
+    /// conditional expression branch selection used by the previous
+    /// local sparsity calculation (empty if there was none)
+    local::pod_vector<unsigned char> cexp_select_;
+
     /// Variable on the tape corresponding to each vecad load operation
     /// (if zero, the operation corresponds to a parameter).
     local::pod_vector<addr_t> load_op2var_;
@@ -144,6 +161,18 @@ private:
     /// subgraph information for this object
     local::subgraph::subgraph_info subgraph_info_;
 
+    /// mapping from variables to reusable slots used by forward_live
+    local::live_slot live_slot_;
+
+    /// operators grouped by dependency level used by forward_level
+    local::level_schedule level_schedule_;
+
+    /// memo of discrete and atomic function values used by zero order forward
+    local::memo_table<Base> memo_table_;
+
+    /// pool of threads used by forward_async and sparse_jac_rev_async
+    local::async_pool<ADFun> async_pool_;
+
     /// Packed results of the forward mode Jacobian sparsity calculations.
     /// for_jac_sparse_pack_.n_set() != 0  implies other sparsity results
     /// are empty
@@ -162,6 +191,14 @@ private:
     template <class ADvector>
     void Dependent(local::ADTape<Base> *tape, const ADvector &y);
 
+    // conditional expression branch selection at the current point
+    // (doxygen in cppad/core/local_sparsity.hpp)
+    void cexp_select(local::pod_vector<unsigned char>& select) const;
+
+    // branch selection for sparsity calculations
+    // (doxygen in cppad/core/local_sparsity.hpp)
+    const local::pod_vector<unsigned char>* local_cexp_select(void);
+
     // vector of bool version of ForSparseJac
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -289,6 +326,10 @@ private:
               sparse_hessian_work&     work
     );
 
+    // implementation of assignment and share_recording
+    // (doxygen in cppad/core/fun_construct.hpp)
+    void assign(const ADFun& f, bool share_play);
+
 public:
     /// default constructor
     ADFun(void);
@@ -326,6 +367,21 @@ public:
     // (doxygen in cppad/core/base2ad.hpp)
     ADFun< AD<Base>, RecBase > base2ad(void) const;
 
+    // create ADFun for a subset of the domain and range of this ADFun
+    // (doxygen in cppad/core/slice.hpp)
+    template <class BoolVector, class BaseVector>
+    ADFun slice(
+        const BoolVector& select_domain ,
+        const BoolVector& select_range  ,
+        const BaseVector& x             ,
+        bool              other_dynamic
+    ) const;
+
+    // dependency level for each variable
+    // (doxygen in cppad/core/var_level.hpp)
+    template <class SizeVector>
+    size_t var_level(SizeVector& level) const;
+
     /// sequence constructor
     template <class ADvector>
     ADFun(const ADvector &x, const ADvector &y);
@@ -339,6 +395,27 @@ public:
     /// get check_for_nan
     bool check_for_nan(void) const;
 
+    /// set memo_pure
+    void memo_pure(bool value);
+
+    /// get memo_pure
+    bool memo_pure(void) const;
+
+    /// number of discrete and atomic function calls that used the memo
+    size_t memo_pure_hit(void) const;
+
+    /// number of discrete and atomic function calls that were evaluated
+    size_t memo_pure_miss(void) const;
+
+    /// set local_sparsity
+    void local_sparsity(bool value);
+
+    /// get local_sparsity
+    bool local_sparsity(void) const;
+
+    /// are previous local sparsity patterns valid at the current point
+    bool local_sparsity_valid(void) const;
+
     /// assign a new operation sequence
     template <class ADvector>
     void Dependent(const ADvector &x, const ADvector &y);
@@ -357,10 +434,43 @@ public:
         size_t q, const BaseVector& xq, std::ostream& s = std::cout
     );
 
+    /// zero order forward mode using reusable variable slots
+    template <class BaseVector>
+    BaseVector forward_live(
+        const BaseVector& x, std::ostream& s = std::cout
+    );
+
+    /// forward mode evaluating the operators in each level in parallel
+    template <class BaseVector>
+    BaseVector forward_level(
+        size_t            q         ,
+        const BaseVector& xq        ,
+        level_runner&     run       ,
+        size_t            min_width
+    );
+
+    /// forward mode evaluated by a pool of threads
+    template <class BaseVector>
+    std::future<BaseVector> forward_async(size_t q, const BaseVector& xq);
+
     /// reverse mode sweep
     template <class BaseVector>
     BaseVector Reverse(size_t p, const BaseVector &v);
 
+    /// reverse mode evaluating the operators in each level in parallel
+    template <class BaseVector>
+    BaseVector reverse_level(
+        size_t            q         ,
+        const BaseVector& w         ,
+        level_runner&     run       ,
+        size_t            min_width ,
+        size_t            n_part
+    );
+
+    /// first order reverse mode using reusable variable slots
+    template <class BaseVector>
+    BaseVector reverse_live(const BaseVector& x, const BaseVector& w);
+
     // forward Jacobian sparsity pattern
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -446,6 +556,17 @@ public:
         sparse_jac_work&                     work
     );
 
+    // compute sparse Jacobian using reverse mode and a pool of threads
+    // (doxygen in cppad/core/async_eval.hpp)
+    template <class SizeVector, class BaseVector>
+    std::future< sparse_rcv<SizeVector, BaseVector> > sparse_jac_rev_async(
+        const BaseVector&                          x        ,
+        const sparse_rcv<SizeVector, BaseVector>&  subset   ,
+        const sparse_rc<SizeVector>&               pattern  ,
+        const std::string&                         coloring ,
+        const sparse_jac_work&                     work
+    );
+
     // compute sparse Hessian
     // (doxygen in cppad/core/sparse_hes.hpp)
     template <class SizeVector, class BaseVector>
@@ -565,10 +686,18 @@ public:
     local::sparse::list_setvec&        s
     );
 
+    // assignment that shares the operation sequence in f
+    // (doxygen in cppad/core/fun_construct.hpp)
+    void share_recording(const ADFun& f);
+
     /// did previous optimization exceed the collision limit
     bool exceed_collision_limit(void) const
     {   return exceed_collision_limit_; }
 
+    /// hash table statistics for the previous optimization
+    const optimize_stat_t& optimize_stat(void) const
+    {   return optimize_stat_; }
+
     /// amount of memory used for boolean Jacobain sparsity pattern
     size_t size_forward_bool(void) const
     {   return for_jac_sparse_pack_.memory(); }
@@ -648,6 +777,19 @@ public:
     size_t size_VecAD(void) const
     {   return play_.num_var_vecad_ind_rec(); }
 
+    /// number of slots used by forward_live (zero if not yet computed)
+    size_t size_live(void) const
+    {   return live_slot_.n_slot(); }
+
+    /// number of levels used by forward_level and reverse_level
+    /// (zero if not yet computed)
+    size_t size_level(void) const
+    {   return level_schedule_.n_level(); }
+
+    /// number of threads running for forward_async and sparse_jac_rev_async
+    size_t size_async(void) const
+    {   return async_pool_.size(); }
+
     /// set number of orders currently allocated (user API)
     void capacity_order(size_t c);
 
@@ -800,6 +942,22 @@ public:
 
     // clear all subgraph information
     void clear_subgraph(void);
+
+    // free memory used by forward_live for its variable to slot mapping
+    void clear_live(void)
+    {   live_slot_.clear(); }
+
+    // free memory used by forward_level and reverse_level for level schedule
+    void clear_level(void)
+    {   level_schedule_.clear(); }
+
+    // set number of threads used by forward_async and sparse_jac_rev_async
+    void async_threads(size_t num_threads)
+    {   async_pool_.num_threads(num_threads); }
+
+    // wait for asynchronous requests and terminate the pool of threads
+    void clear_async(void)
+    {   async_pool_.clear(); }
     // ------------------- Deprecated -----------------------------
 
     /// deprecated: assign a new operation sequence
@@ -825,6 +983,9 @@ public:
         total         += play_.size_op_seq();
         total         += play_.size_random();
         total         += subgraph_info_.memory();
+        total         += live_slot_.memory();
+        total         += level_schedule_.memory();
+        total         += memo_table_.memory();
         return total;
     }
 
@@ -855,6 +1016,8 @@ public:
 # include <cppad/local/sweep/forward0.hpp>
 # include <cppad/local/sweep/forward1.hpp>
 # include <cppad/local/sweep/forward2.hpp>
+# include <cppad/local/sweep/forward_level.hpp>
+# include <cppad/local/sweep/reverse_level.hpp>
 # include <cppad/local/sweep/reverse.hpp>
 # include <cppad/local/sweep/for_jac.hpp>
 # include <cppad/local/sweep/rev_jac.hpp>
@@ -870,12 +1033,16 @@ public:
 # include <cppad/core/fun_construct.hpp>
 # include <cppad/core/base2ad.hpp>
 # include <cppad/core/abort_recording.hpp>
+# include <cppad/core/record_reserve.hpp>
 # include <cppad/core/fun_eval.hpp>
 # include <cppad/core/drivers.hpp>
 # include <cppad/core/fun_check.hpp>
 # include <cppad/core/omp_max_thread.hpp>
 # include <cppad/core/optimize.hpp>
 # include <cppad/core/abs_normal_fun.hpp>
+# include <cppad/core/slice.hpp>
+# include <cppad/core/var_level.hpp>
+# include <cppad/core/async_eval.hpp>
 # include <cppad/core/graph/from_json.hpp>
 # include <cppad/core/graph/to_json.hpp>
 
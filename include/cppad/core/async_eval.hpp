@@ -0,0 +1,387 @@
+# ifndef CPPAD_CORE_ASYNC_EVAL_HPP
+# define CPPAD_CORE_ASYNC_EVAL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin async_eval$$
+$spell
+    async
+    const
+    xq
+    yq
+    std
+    rcv
+    rc
+    jac
+    num
+    alloc
+    concurrency
+    Jacobian
+$$
+
+$section Asynchronous Evaluation Using a Pool of Threads$$
+
+$head Syntax$$
+$icode%yq_future% = %f%.forward_async(%q%, %xq%)
+%$$
+$icode%subset_future% = %f%.sparse_jac_rev_async(
+    %x%, %subset%, %pattern%, %coloring%, %work%
+)
+%$$
+$icode%f%.async_threads(%num_threads%)
+%$$
+$icode%num_running% = %f%.size_async()
+%$$
+$icode%f%.clear_async()
+%$$
+
+$head Purpose$$
+These routines start the evaluation of a function, or its derivative,
+and return a $code std::future$$ for the result right away.
+The calling thread can do other work, or make more requests,
+while the evaluation is done by a pool of threads that is managed by
+$icode f$$.
+This can be used to pipeline many small evaluations.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+
+$head Pool$$
+The first request after the pool is created, or cleared,
+starts the threads in the pool.
+Each thread uses $cref/share_recording/FunConstruct/share_recording/$$
+to create its own evaluation context for the operation sequence in $icode f$$
+(the operation sequence is not copied).
+The requests are put in a queue and the next thread that is waiting for
+work removes a request from the queue and evaluates it.
+The Taylor coefficients and sparsity patterns stored in $icode f$$
+are not affected by the requests.
+
+$head thread_alloc$$
+The threads in the pool use their
+$cref/default thread number/ta_parallel_setup/Default Thread Numbers/$$.
+Hence the memory that a thread uses for a request,
+(e.g., the Taylor coefficients in its evaluation context
+and the vector returned by the future)
+comes from that thread's $cref thread_alloc$$ pool.
+The memory for each request is obtained from the thread that
+makes the request and returned by the pool thread that evaluates it.
+For these reasons,
+$cref/parallel_setup/ta_parallel_setup/$$
+must not have been called with $icode%num_threads% > 1%$$
+when a request is made.
+
+$head q$$
+This argument has prototype
+$codei%
+    size_t %q%
+%$$
+and is the highest order for the forward mode computation.
+
+$head xq$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %xq%
+%$$
+Its size must be $icode%n%*(%q%+1)%$$ where $icode n$$ is the
+$cref/domain/fun_property/Domain/$$ size for $icode f$$;
+i.e., it contains all of the Taylor coefficient orders zero through $icode q$$
+and each request does not depend on any previous request.
+Its value has the same meaning as for
+$cref/forward_order/forward_order/xq/$$.
+
+$head yq_future$$
+The return value has prototype
+$codei%
+    std::future<%BaseVector%> %yq_future%
+%$$
+The value $icode%yq_future%.get()%$$ has size $icode%m%*(%q%+1)%$$
+and the same meaning as $cref/yq/forward_order/yq/$$ for
+$codei%
+    %yq% = %f%.Forward(%q%, %xq%)
+%$$
+where $icode m$$ is the $cref/range/fun_property/Range/$$ size for $icode f$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head sparse_jac_rev_async$$
+The arguments
+$icode x$$, $icode subset$$, $icode pattern$$, $icode coloring$$
+have the same meaning as in the corresponding call to
+$cref/sparse_jac_rev/sparse_jac/$$;
+$codei%
+    %f%.sparse_jac_rev(%x%, %subset%, %pattern%, %coloring%, %work%)
+%$$
+except that they are all $code const$$.
+The arguments are copied when the request is made.
+If $icode work$$ is empty, the coloring is computed by the request.
+Computing $icode work$$ once by a call to $code sparse_jac_rev$$,
+and then passing it to many requests, avoids repeating this calculation.
+
+$head subset_future$$
+The return value has prototype
+$codei%
+    std::future< sparse_rcv<%SizeVector%, %BaseVector%> > %subset_future%
+%$$
+The value $icode%subset_future%.get()%$$ is a copy of $icode subset$$
+with its value vector equal to the corresponding elements of the Jacobian.
+
+$head Exceptions$$
+If an evaluation throws an exception, for example when the
+$cref ErrorHandler$$ has been replaced by one that throws,
+the exception is stored in the corresponding future.
+
+$head num_threads$$
+The argument $icode num_threads$$ has prototype
+$codei%
+    size_t %num_threads%
+%$$
+This clears the pool and sets the number of threads that the pool will use
+the next time it starts.
+If it is zero (the default), $code std::thread::hardware_concurrency()$$
+threads are used.
+
+$head num_running$$
+The return value $icode num_running$$ has prototype
+$codei%
+    size_t %num_running%
+%$$
+It is the number of threads in the pool that are currently running
+(zero if the pool has not been started or has been cleared).
+
+$head clear_async$$
+This waits for all the pending requests to finish and then
+terminates the threads in the pool.
+The pool is also cleared (and hence waits for pending requests)
+when $icode f$$ is deleted,
+when its operation sequence changes
+(e.g. by $cref Dependent$$, $cref optimize$$, or assignment),
+and when $cref new_dynamic$$ changes its dynamic parameters.
+The next request will start the pool again.
+
+$head Restrictions$$
+The routines in this section must not be called
+at the same time by different threads.
+Other operations on $icode f$$ (by the thread that is making the requests)
+do not affect the pending requests.
+
+$head Example$$
+The file $cref async_eval.cpp$$
+contains an example and test of these operations.
+
+$end
+-----------------------------------------------------------------------------
+*/
+# include <future>
+# include <exception>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file async_eval.hpp
+Asynchronous evaluation of an ADFun object using a pool of threads.
+*/
+
+namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+Request that computes yq = g.Forward(q, xq).
+
+\tparam Fun
+is the ADFun type for the function that is evaluated.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+*/
+template <class Fun, class BaseVector>
+class async_forward : public async_request<Fun> {
+private:
+    /// highest order
+    const size_t             q_;
+    /// Taylor coefficients for the independent variables
+    const BaseVector         xq_;
+    /// result
+    std::promise<BaseVector> promise_;
+public:
+    /// constructor
+    async_forward(size_t q, const BaseVector& xq)
+    : q_(q), xq_(xq)
+    { }
+    /// future for the result
+    std::future<BaseVector> get_future(void)
+    {   return promise_.get_future(); }
+    /// evaluate this request
+    void run(Fun& g) override
+    {   try
+        {   promise_.set_value( g.Forward(q_, xq_) ); }
+        catch(...)
+        {   promise_.set_exception( std::current_exception() ); }
+    }
+};
+/*!
+Request that computes g.sparse_jac_rev(x, subset, pattern, coloring, work).
+
+\tparam Fun
+is the ADFun type for the function that is evaluated.
+
+\tparam SizeVector
+is a Simple Vector class with elements of type size_t.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+*/
+template <class Fun, class SizeVector, class BaseVector>
+class async_sparse_jac_rev : public async_request<Fun> {
+private:
+    /// argument at which to evaluate the Jacobian
+    const BaseVector                             x_;
+    /// subset of the Jacobian (and the result)
+    sparse_rcv<SizeVector, BaseVector>           subset_;
+    /// sparsity pattern for the Jacobian
+    const sparse_rc<SizeVector>                  pattern_;
+    /// coloring method
+    const std::string                            coloring_;
+    /// work for this request
+    sparse_jac_work                              work_;
+    /// result
+    std::promise< sparse_rcv<SizeVector, BaseVector> > promise_;
+public:
+    /// constructor
+    async_sparse_jac_rev(
+        const BaseVector&                          x        ,
+        const sparse_rcv<SizeVector, BaseVector>&  subset   ,
+        const sparse_rc<SizeVector>&               pattern  ,
+        const std::string&                         coloring ,
+        const sparse_jac_work&                     work     )
+    : x_(x), subset_(subset), pattern_(pattern), coloring_(coloring)
+    , work_(work)
+    { }
+    /// future for the result
+    std::future< sparse_rcv<SizeVector, BaseVector> > get_future(void)
+    {   return promise_.get_future(); }
+    /// evaluate this request
+    void run(Fun& g) override
+    {   try
+        {   g.sparse_jac_rev(x_, subset_, pattern_, coloring_, work_);
+            promise_.set_value( subset_ );
+        }
+        catch(...)
+        {   promise_.set_exception( std::current_exception() ); }
+    }
+};
+} // END_CPPAD_LOCAL_NAMESPACE
+
+/*!
+Forward mode evaluated by the pool of threads for this function.
+
+\tparam Base
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type AD<Base>.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param q
+is the highest order for this forward mode computation.
+
+\param xq
+is the Taylor coefficients for the independent variables
+for orders zero through q (see Forward(q, xq, s)).
+
+\return
+is a future for the Taylor coefficients for the dependent variables
+(see Forward(q, xq, s)).
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+std::future<BaseVector> ADFun<Base,RecBase>::forward_async(
+    size_t            q  ,
+    const BaseVector& xq )
+{   // check BaseVector is Simple Vector class with Base elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    CPPAD_ASSERT_KNOWN(
+        size_t( xq.size() ) == ind_taddr_.size() * (q + 1),
+        "f.forward_async(q, xq): xq.size() is not equal n * (q + 1)"
+    );
+    typedef local::async_forward<ADFun, BaseVector> request_t;
+    request_t* request = local::async_request_create( request_t(q, xq) );
+    std::future<BaseVector> result = request->get_future();
+    async_pool_.post(this, request);
+    return result;
+}
+/*!
+Sparse Jacobian evaluated by the pool of threads for this function.
+
+\tparam Base
+the base type for the recording that is stored in the ADFun object.
+
+\tparam SizeVector
+a simple vector class with elements of type size_t.
+
+\tparam BaseVector
+a simple vector class with elements of type Base.
+
+\param x
+the point at which to evaluate the Jacobian.
+
+\param subset
+the row and column indices for the elements of the Jacobian to compute.
+
+\param pattern
+a sparsity pattern for the Jacobian
+(not used when work is not empty).
+
+\param coloring
+the coloring method (see sparse_jac_rev).
+
+\param work
+a copy of work is used by the request.
+
+\return
+is a future for a copy of subset with its value vector set to
+the corresponding elements of the Jacobian.
+*/
+template <class Base, class RecBase>
+template <class SizeVector, class BaseVector>
+std::future< sparse_rcv<SizeVector, BaseVector> >
+ADFun<Base,RecBase>::sparse_jac_rev_async(
+    const BaseVector&                          x        ,
+    const sparse_rcv<SizeVector, BaseVector>&  subset   ,
+    const sparse_rc<SizeVector>&               pattern  ,
+    const std::string&                         coloring ,
+    const sparse_jac_work&                     work     )
+{   // check BaseVector is Simple Vector class with Base elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    CPPAD_ASSERT_KNOWN(
+        size_t( x.size() ) == ind_taddr_.size(),
+        "f.sparse_jac_rev_async: x.size() is not equal to domain size"
+    );
+    typedef local::async_sparse_jac_rev<ADFun, SizeVector, BaseVector>
+        request_t;
+    request_t* request = local::async_request_create(
+        request_t(x, subset, pattern, coloring, work)
+    );
+    std::future< sparse_rcv<SizeVector, BaseVector> > result =
+        request->get_future();
+    async_pool_.post(this, request);
+    return result;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
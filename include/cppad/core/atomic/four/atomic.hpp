@@ -53,6 +53,9 @@ $icode%ok% = %afun%.for_type( %call_id%,
 %ok% = %afun%.forward( %call_id%,
     %select_y%, %order_low%, %order_up%, %taylor_x%, %taylor_y%
 )
+%ok% = %afun%.forward_batch( %call_id%,
+    %n_call%, %select_y%, %order_low%, %order_up%, %taylor_x%, %taylor_y%
+)
 %ok% = %afun%.reverse( %call_id%,
     %select_x%, %order_up%, %taylor_x%, %taylor_y%, %partial_x%, %partial_y%
 )
@@ -115,6 +118,10 @@ $childtable%include/cppad/core/atomic/four/ctor.hpp
     %include/cppad/core/atomic/four/call.hpp
     %include/cppad/core/atomic/four/for_type.hpp
     %include/cppad/core/atomic/four/forward.hpp
+    %include/cppad/core/atomic/four/forward_batch.hpp
+    %include/cppad/core/atomic/four/view.hpp
+    %include/cppad/core/atomic/four/forward_view.hpp
+    %include/cppad/core/atomic/four/reverse_view.hpp
     %include/cppad/core/atomic/four/reverse.hpp
     %include/cppad/core/atomic/four/jac_sparsity.hpp
     %include/cppad/core/atomic/four/hes_sparsity.hpp
@@ -128,6 +135,7 @@ $end
 # include <set>
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/local/atomic_index.hpp>
+# include <cppad/core/atomic/four/view.hpp>
 
 // needed before one can use in_parallel
 # include <cppad/utility/thread_alloc.hpp>
@@ -222,6 +230,42 @@ public:
         const vector< AD<Base> >&    ataylor_x    ,
         vector< AD<Base> >&          ataylor_y
     );
+    virtual bool forward(
+        size_t                                 call_id     ,
+        const vector<bool>&                    select_y    ,
+        size_t                                 order_low   ,
+        size_t                                 order_up    ,
+        const atomic_view<const Base>&         taylor_x    ,
+        const atomic_view<Base>&               taylor_y
+    );
+    virtual bool forward(
+        size_t                                 call_id     ,
+        const vector<bool>&                    select_y    ,
+        size_t                                 order_low   ,
+        size_t                                 order_up    ,
+        const atomic_view< const AD<Base> >&   ataylor_x   ,
+        const atomic_view< AD<Base> >&         ataylor_y
+    );
+    // ------------------------------------------------------------------------
+    // forward_batch
+    virtual bool forward_batch(
+        size_t                       call_id     ,
+        size_t                       n_call      ,
+        const vector<bool>&          select_y    ,
+        size_t                       order_low   ,
+        size_t                       order_up    ,
+        const vector<Base>&          taylor_x    ,
+        vector<Base>&                taylor_y
+    );
+    virtual bool forward_batch(
+        size_t                       call_id     ,
+        size_t                       n_call      ,
+        const vector<bool>&          select_y    ,
+        size_t                       order_low   ,
+        size_t                       order_up    ,
+        const vector< AD<Base> >&    ataylor_x   ,
+        vector< AD<Base> >&          ataylor_y
+    );
     // ------------------------------------------------------------------------
     // reverse
     virtual bool reverse(
@@ -242,6 +286,24 @@ public:
         vector< AD<Base> >&          apartial_x  ,
         const vector< AD<Base> >&    apartial_y
     );
+    virtual bool reverse(
+        size_t                                 call_id     ,
+        const vector<bool>&                    select_x    ,
+        size_t                                 order_up    ,
+        const atomic_view<const Base>&         taylor_x    ,
+        const atomic_view<const Base>&         taylor_y    ,
+        const atomic_view<Base>&               partial_x   ,
+        const atomic_view<const Base>&         partial_y
+    );
+    virtual bool reverse(
+        size_t                                 call_id     ,
+        const vector<bool>&                    select_x    ,
+        size_t                                 order_up    ,
+        const atomic_view< const AD<Base> >&   ataylor_x   ,
+        const atomic_view< const AD<Base> >&   ataylor_y   ,
+        const atomic_view< AD<Base> >&         apartial_x  ,
+        const atomic_view< const AD<Base> >&   apartial_y
+    );
     // ------------------------------------------------------------
     // jac_sparsity
     virtual bool jac_sparsity(
@@ -402,6 +464,9 @@ public:
 # include <cppad/core/atomic/four/for_type.hpp>
 # include <cppad/core/atomic/four/rev_depend.hpp>
 # include <cppad/core/atomic/four/forward.hpp>
+# include <cppad/core/atomic/four/forward_batch.hpp>
+# include <cppad/core/atomic/four/forward_view.hpp>
+# include <cppad/core/atomic/four/reverse_view.hpp>
 # include <cppad/core/atomic/four/reverse.hpp>
 # include <cppad/core/atomic/four/jac_sparsity.hpp>
 # include <cppad/core/atomic/four/hes_sparsity.hpp>
@@ -77,8 +77,11 @@ $icode atomic_user$$ implementations.
 $head atomic_four$$
 
 $subhead Restrictions$$
-The $code atomic_four$$ constructor and destructor cannot be called in
-$cref/parallel/ta_in_parallel/$$ mode.
+The $code atomic_four$$ constructor and destructor can be called in
+$cref/parallel/ta_in_parallel/$$ mode and by threads that were not
+set up using $cref/parallel_setup/ta_parallel_setup/$$.
+The object must not be used by other threads while it is being
+constructed or destructed.
 
 $subhead Base$$
 The template parameter determines the
@@ -121,11 +124,7 @@ atomic_four<Base>::atomic_four(void)
 template <class Base>
 atomic_four<Base>::atomic_four(const std::string& name )
 // END_PROTOTYPE
-{   CPPAD_ASSERT_KNOWN(
-        ! thread_alloc::in_parallel() ,
-        "atomic_four: constructor cannot be called in parallel mode."
-    );
-    //
+{   //
     // index_
     bool        set_null  = false;
     size_t      index     = 0;
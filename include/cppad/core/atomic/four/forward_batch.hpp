@@ -0,0 +1,243 @@
+# ifndef CPPAD_CORE_ATOMIC_FOUR_FORWARD_BATCH_HPP
+# define CPPAD_CORE_ATOMIC_FOUR_FORWARD_BATCH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_forward_batch$$
+$spell
+    taylor
+    ataylor
+    afun
+    CppAD
+$$
+
+$section Atomic Function Forward Mode for a Batch of Calls$$
+
+$head Syntax$$
+
+$subhead Base$$
+$icode%ok% = %afun%.forward_batch(
+    %call_id%, %n_call%, %select_y%,
+    %order_low%, %order_up%, %taylor_x%, %taylor_y%
+)%$$
+
+$subhead AD<Base>$$
+$icode%ok% = %afun%.forward_batch(
+    %call_id%, %n_call%, %select_y%,
+    %order_low%, %order_up%, %ataylor_x%, %ataylor_y%
+)%$$
+
+$head Prototype$$
+
+$subhead Base$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_BASE%// END_PROTOTYPE_BASE%1
+%$$
+
+$subhead AD<Base>$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_AD_BASE%// END_PROTOTYPE_AD_BASE%1
+%$$
+
+$head Base$$
+see $cref/Base/atomic_four_call/Base/$$.
+
+$head vector$$
+is the $cref CppAD_vector$$ template class.
+
+$head Purpose$$
+If a recording contains many calls to the same small atomic function,
+the work to set up each $cref/forward/atomic_four_forward/$$ callback
+can be larger than the work done by the callback.
+This function computes the same values as $icode n_call$$ separate
+calls to $icode%afun%.forward%$$ using one virtual function call.
+
+$head Usage$$
+The zero order forward sweep,
+$codei%%f%.Forward(0, %x%)%$$,
+collects consecutive calls to $icode afun$$ that use the same
+$icode call_id$$ and do not use results of each other.
+It then uses one $code forward_batch$$ callback for the collection.
+The other sweeps call $code forward$$ once for each call.
+
+$head Implementation$$
+This function need not be defined by the
+$cref/atomic_user/atomic_four_ctor/atomic_user/$$ class.
+The default implementation calls $code forward$$ once for each call
+in the batch, in the order the calls were recorded.
+This is the same sequence of $code forward$$ calls that is made when
+the calls are not batched.
+
+$head call_id$$
+This is the $cref/call_id/atomic_four_call/call_id/$$
+for every call in the batch.
+
+$head n_call$$
+This is the number of calls in the batch.
+
+$head n$$
+We use $icode n$$ for the number of arguments to each call to
+$icode afun$$; i.e., the size of $cref/ax/atomic_four_call/ax/$$.
+
+$head m$$
+We use $icode m$$ for the number of results for each call to
+$icode afun$$; i.e., the size of $cref/ay/atomic_four_call/ay/$$.
+
+$head q$$
+We use the notation $icode%q% = %order_up% + 1%$$.
+
+$head select_y$$
+This argument has size $icode%n_call% * %m%$$.
+For $icode%c% = 0 , %...%, %n_call%-1%$$,
+$codei%
+    %select_y%[ %c% * %m% + %i% ]
+%$$
+is the value of
+$cref/select_y/atomic_four_forward/select_y/$$ for the
+$th c$$ call in the batch.
+
+$head order_low$$
+This is the lowest order Taylor coefficient that we are computing; see
+$cref/order_low/atomic_four_forward/order_low/$$.
+
+$head order_up$$
+This is the highest order Taylor coefficient that we are computing; see
+$cref/order_up/atomic_four_forward/order_up/$$.
+
+$head taylor_x$$
+This argument has size $icode%n_call% * %n% * %q%$$.
+For $icode%c% = 0 , %...%, %n_call%-1%$$,
+$codei%
+    %taylor_x%[ ( %c% * %n% + %j% ) * %q% + %k% ]
+%$$
+is the value of
+$codei%%taylor_x%[ %j% * %q% + %k% ]%$$ in
+$cref/taylor_x/atomic_four_forward/taylor_x/$$ for the
+$th c$$ call in the batch.
+
+$head ataylor_x$$
+The specifications for $icode ataylor_x$$ is the same as for $icode taylor_x$$
+(only the type of $icode ataylor_x$$ is different).
+
+$head taylor_y$$
+This argument has size $icode%n_call% * %m% * %q%$$.
+For $icode%c% = 0 , %...%, %n_call%-1%$$,
+$codei%
+    %taylor_y%[ ( %c% * %m% + %i% ) * %q% + %k% ]
+%$$
+corresponds to
+$codei%%taylor_y%[ %i% * %q% + %k% ]%$$ in
+$cref/taylor_y/atomic_four_forward/taylor_y/$$ for the
+$th c$$ call in the batch.
+
+$head ataylor_y$$
+The specifications for $icode ataylor_y$$ is the same as for $icode taylor_y$$
+(only the type of $icode ataylor_y$$ is different).
+
+$head ok$$
+If this calculation succeeded, $icode ok$$ is true.
+Otherwise, it is false.
+
+$children%
+    example/atomic_four/forward_batch.cpp
+%$$
+$head Example$$
+The file $cref atomic_four_forward_batch.cpp$$ contains an example and test
+that defines this callback.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+namespace local {
+/*!
+Default forward_batch, calls forward once for each call in the batch.
+
+\tparam Vector
+is vector<Base> or vector< AD<Base> >.
+*/
+template <class Base, class Vector>
+bool atomic_four_forward_batch(
+    atomic_four<Base>*           afun        ,
+    size_t                       call_id     ,
+    size_t                       n_call      ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const Vector&                taylor_x    ,
+    Vector&                      taylor_y    )
+{   CPPAD_ASSERT_UNKNOWN( 0 < n_call );
+    size_t nq = taylor_x.size() / n_call;
+    size_t mq = taylor_y.size() / n_call;
+    size_t m  = select_y.size() / n_call;
+    CPPAD_ASSERT_UNKNOWN( mq == m * (order_up + 1) );
+    //
+    // one call (no need to copy to and from work space)
+    if( n_call == 1 )
+        return afun->forward(
+            call_id, select_y, order_low, order_up, taylor_x, taylor_y
+        );
+    //
+    // one call at a time
+    Vector       tx(nq), ty(mq);
+    vector<bool> sy(m);
+    bool ok = true;
+    for(size_t c = 0; c < n_call; ++c)
+    {   for(size_t j = 0; j < nq; ++j)
+            tx[j] = taylor_x[c * nq + j];
+        for(size_t i = 0; i < mq; ++i)
+            ty[i] = taylor_y[c * mq + i];
+        for(size_t i = 0; i < m; ++i)
+            sy[i] = select_y[c * m + i];
+        //
+        ok &= afun->forward(call_id, sy, order_low, order_up, tx, ty);
+        //
+        for(size_t i = 0; i < mq; ++i)
+            taylor_y[c * mq + i] = ty[i];
+    }
+    return ok;
+}
+} // END_LOCAL_NAMESPACE
+
+// BEGIN_PROTOTYPE_BASE
+template <class Base>
+bool atomic_four<Base>::forward_batch(
+    size_t                       call_id     ,
+    size_t                       n_call      ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+// END_PROTOTYPE_BASE
+{   return local::atomic_four_forward_batch(
+        this, call_id, n_call, select_y, order_low, order_up, taylor_x, taylor_y
+    );
+}
+
+// BEGIN_PROTOTYPE_AD_BASE
+template <class Base>
+bool atomic_four<Base>::forward_batch(
+    size_t                       call_id     ,
+    size_t                       n_call      ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const vector< AD<Base> >&    ataylor_x   ,
+    vector< AD<Base> >&          ataylor_y   )
+// END_PROTOTYPE_AD_BASE
+{   return local::atomic_four_forward_batch(
+        this, call_id, n_call, select_y, order_low, order_up, ataylor_x, ataylor_y
+    );
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,131 @@
+# ifndef CPPAD_CORE_ATOMIC_FOUR_FORWARD_VIEW_HPP
+# define CPPAD_CORE_ATOMIC_FOUR_FORWARD_VIEW_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_forward_view$$
+$spell
+    taylor
+    ataylor
+    afun
+    CppAD
+    const
+$$
+
+$section Atomic Function Forward Mode Using Views$$
+
+$head Syntax$$
+
+$subhead Base$$
+$icode%ok% = %afun%.forward(
+    %call_id%, %select_y%,
+    %order_low%, %order_up%, %taylor_x%, %taylor_y%
+)%$$
+
+$subhead AD<Base>$$
+$icode%ok% = %afun%.forward(
+    %call_id%, %select_y%,
+    %order_low%, %order_up%, %ataylor_x%, %ataylor_y%
+)%$$
+
+$head Prototype$$
+
+$subhead Base$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_BASE%// END_PROTOTYPE_BASE%1
+%$$
+
+$subhead AD<Base>$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_AD_BASE%// END_PROTOTYPE_AD_BASE%1
+%$$
+
+$head Purpose$$
+This is the same as the vector version of
+$cref/forward/atomic_four_forward/$$ except that
+$icode taylor_x$$ and $icode taylor_y$$ are
+$cref/views/atomic_four_view/$$.
+The views point directly to the Taylor coefficients for the
+corresponding variables; i.e.,
+they are not copied to and from vectors for each call.
+
+$head Usage$$
+When $icode order_up$$ is greater than zero,
+the forward mode sweep first uses the view version of $code forward$$.
+If it returns false, it uses the vector version of $code forward$$.
+Zero order forward mode uses the vector version and
+$cref/forward_batch/atomic_four_forward_batch/$$.
+
+$head Implementation$$
+This function need not be defined by the
+$cref/atomic_user/atomic_four_ctor/atomic_user/$$ class.
+The default implementation returns false.
+
+$head taylor_x$$
+For $icode%j% = 0, %...%, %n%-1%$$ and $icode%k% = 0, %...%, %q%-1%$$,
+$codei%%taylor_x%(%j%, %k%)%$$ is the value of
+$codei%%taylor_x%[ %j% * %q% + %k% ]%$$ in the vector version.
+
+$head taylor_y$$
+For $icode%i% = 0, %...%, %m%-1%$$ and $icode%k% = 0, %...%, %q%-1%$$,
+$codei%%taylor_y%(%i%, %k%)%$$ corresponds to
+$codei%%taylor_y%[ %i% * %q% + %k% ]%$$ in the vector version.
+If $icode%select_y%[%i%]%$$ is false, the $th i$$ component
+of $icode taylor_y$$ may point to temporary memory.
+
+$head ataylor_x$$
+The specifications for $icode ataylor_x$$ is the same as for $icode taylor_x$$
+(only the type of $icode ataylor_x$$ is different).
+
+$head ataylor_y$$
+The specifications for $icode ataylor_y$$ is the same as for $icode taylor_y$$
+(only the type of $icode ataylor_y$$ is different).
+
+$head ok$$
+If this calculation succeeded, $icode ok$$ is true.
+Otherwise, it is false and the vector version of $code forward$$
+is used for this calculation.
+
+$head Example$$
+The $cref/mat_mul/atomic_four_mat_mul_forward.hpp/$$ example defines
+the $icode Base$$ version of this callback.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+// BEGIN_PROTOTYPE_BASE
+template <class Base>
+bool atomic_four<Base>::forward(
+    size_t                           call_id     ,
+    const vector<bool>&              select_y    ,
+    size_t                           order_low   ,
+    size_t                           order_up    ,
+    const atomic_view<const Base>&   taylor_x    ,
+    const atomic_view<Base>&         taylor_y    )
+// END_PROTOTYPE_BASE
+{   return false; }
+
+// BEGIN_PROTOTYPE_AD_BASE
+template <class Base>
+bool atomic_four<Base>::forward(
+    size_t                                 call_id     ,
+    const vector<bool>&                    select_y    ,
+    size_t                                 order_low   ,
+    size_t                                 order_up    ,
+    const atomic_view< const AD<Base> >&   ataylor_x   ,
+    const atomic_view< AD<Base> >&         ataylor_y   )
+// END_PROTOTYPE_AD_BASE
+{   return false; }
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,137 @@
+# ifndef CPPAD_CORE_ATOMIC_FOUR_REVERSE_VIEW_HPP
+# define CPPAD_CORE_ATOMIC_FOUR_REVERSE_VIEW_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_reverse_view$$
+$spell
+    taylor
+    ataylor
+    apartial
+    afun
+    CppAD
+    const
+$$
+
+$section Atomic Function Reverse Mode Using Views$$
+
+$head Syntax$$
+
+$subhead Base$$
+$icode%ok% = %afun%.reverse(
+    %call_id%, %select_x%,
+    %order_up%, %taylor_x%, %taylor_y%, %partial_x%, %partial_y%
+)
+%$$
+
+$subhead AD<Base>$$
+$icode%ok% = %afun%.reverse(
+    %call_id%, %select_x%,
+    %order_up%, %ataylor_x%, %ataylor_y%, %apartial_x%, %apartial_y%
+)
+%$$
+
+$head Prototype$$
+
+$subhead Base$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_BASE%// END_PROTOTYPE_BASE%1
+%$$
+
+$subhead AD<Base>$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_AD_BASE%// END_PROTOTYPE_AD_BASE%1
+%$$
+
+$head Purpose$$
+This is the same as the vector version of
+$cref/reverse/atomic_four_reverse/$$ except that
+the arguments $icode taylor_x$$, $icode taylor_y$$,
+$icode partial_x$$, and $icode partial_y$$ are
+$cref/views/atomic_four_view/$$
+and the partials are added to $icode partial_x$$.
+The views point directly to the Taylor coefficients and partials for the
+corresponding variables; i.e.,
+they are not copied to and from vectors for each call.
+
+$head Usage$$
+The reverse mode sweep first uses the view version of $code reverse$$.
+If it returns false, it uses the vector version of $code reverse$$.
+
+$head Implementation$$
+This function need not be defined by the
+$cref/atomic_user/atomic_four_ctor/atomic_user/$$ class.
+The default implementation returns false.
+
+$head taylor_x, taylor_y, partial_y$$
+For each component $icode j$$ and order $icode k$$,
+$codei%%taylor_x%(%j%, %k%)%$$ is the value of
+$codei%%taylor_x%[ %j% * %q% + %k% ]%$$ in the vector version.
+The same holds for $icode taylor_y$$ and $icode partial_y$$.
+
+$head partial_x$$
+For $icode%j% = 0, %...%, %n%-1%$$ and $icode%k% = 0, %...%, %q%-1%$$,
+if $icode%select_x%[%j%]%$$ is true,
+the value of
+$codei%%partial_x%[ %j% * %q% + %k% ]%$$, in the vector version,
+must be added to $codei%%partial_x%(%j%, %k%)%$$.
+Note that two components of $icode partial_x$$ may point to the
+same memory; e.g., if the same variable is used for two arguments.
+If $icode%select_x%[%j%]%$$ is false, the $th j$$ component
+of $icode partial_x$$ may point to temporary memory.
+
+$head ataylor_x, ataylor_y, apartial_x, apartial_y$$
+The specifications for these views are the same as for
+$icode taylor_x$$, $icode taylor_y$$, $icode partial_x$$, $icode partial_y$$
+(only their types are different).
+
+$head ok$$
+If this calculation succeeded, $icode ok$$ is true.
+Otherwise, it is false, $icode partial_x$$ must not have been changed,
+and the vector version of $code reverse$$ is used for this calculation.
+
+$head Example$$
+The $cref/mat_mul/atomic_four_mat_mul_reverse.hpp/$$ example defines
+the $icode Base$$ version of this callback.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+// BEGIN_PROTOTYPE_BASE
+template <class Base>
+bool atomic_four<Base>::reverse(
+    size_t                           call_id     ,
+    const vector<bool>&              select_x    ,
+    size_t                           order_up    ,
+    const atomic_view<const Base>&   taylor_x    ,
+    const atomic_view<const Base>&   taylor_y    ,
+    const atomic_view<Base>&         partial_x   ,
+    const atomic_view<const Base>&   partial_y   )
+// END_PROTOTYPE_BASE
+{   return false; }
+
+// BEGIN_PROTOTYPE_AD_BASE
+template <class Base>
+bool atomic_four<Base>::reverse(
+    size_t                                 call_id     ,
+    const vector<bool>&                    select_x    ,
+    size_t                                 order_up    ,
+    const atomic_view< const AD<Base> >&   ataylor_x   ,
+    const atomic_view< const AD<Base> >&   ataylor_y   ,
+    const atomic_view< AD<Base> >&         apartial_x  ,
+    const atomic_view< const AD<Base> >&   apartial_y  )
+// END_PROTOTYPE_AD_BASE
+{   return false; }
+
+} // END_CPPAD_NAMESPACE
+# endif
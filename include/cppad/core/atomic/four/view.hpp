@@ -0,0 +1,137 @@
+# ifndef CPPAD_CORE_ATOMIC_FOUR_VIEW_HPP
+# define CPPAD_CORE_ATOMIC_FOUR_VIEW_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_view$$
+$spell
+    const
+    CppAD
+    ptr
+$$
+
+$section Atomic Function Views of Taylor Coefficients and Partials$$
+
+$head Syntax$$
+$codei%CppAD::atomic_view<%Type%> %view%(%row%, %n%, %q%)
+%$$
+$icode%s% = %view%.size()
+%$$
+$icode%n% = %view%.n_row()
+%$$
+$icode%q% = %view%.n_order()
+%$$
+$icode%ptr% = %view%.row(%j%)
+%$$
+$icode%element% = %view%(%j%, %k%)
+%$$
+
+$head Purpose$$
+The $cref/forward/atomic_four_forward_view/$$ and
+$cref/reverse/atomic_four_reverse_view/$$ callbacks can
+use views in place of $cref/vectors/CppAD_vector/$$.
+In this case the values are read and written directly in the memory
+used by the $cref ADFun$$ object and not copied to and from vectors.
+
+$head Type$$
+This is the type of the elements of the view.
+If $icode Type$$ is $codei%const %Base%$$,
+the elements of the view can be read but not changed.
+
+$head row$$
+This argument has prototype
+$codei%
+    %Type%* const* %row%
+%$$
+For $icode%j% = 0 , %...%, %n%-1%$$,
+$icode%row%[%j%]%$$ points to the first of $icode q$$ contiguous elements
+for the $th j$$ component.
+The view does not copy these pointers and $icode row$$ must
+exist for as long as the view is used.
+Two components may point to the same memory;
+e.g., if the same variable is used for two arguments to an atomic function.
+
+$head n$$
+This is the number of components in the view.
+
+$head q$$
+This is the number of orders (Taylor coefficients) for each component.
+
+$head size$$
+The return value $icode s$$ is equal to $icode%n% * %q%$$; i.e.,
+the size of the corresponding vector.
+
+$head n_row$$
+The return value is $icode n$$.
+
+$head n_order$$
+The return value is $icode q$$.
+
+$head row(j)$$
+The return value $icode ptr$$ has prototype
+$codei%
+    %Type%* %ptr%
+%$$
+and is equal to $icode%row%[%j%]%$$.
+
+$head Element Access$$
+The return value $icode element$$ has prototype
+$codei%
+    %Type%& %element%
+%$$
+and is a reference to $icode%row%[%j%][%k%]%$$.
+This corresponds to the element with index $icode%j% * %q% + %k%$$
+in the vector version of the view.
+
+$end
+*/
+# include <cppad/core/cppad_assert.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+
+template <class Type>
+class atomic_view {
+private:
+    /// pointer to the first element for each component
+    Type* const* row_;
+    /// number of components
+    size_t       n_;
+    /// number of orders for each component
+    size_t       q_;
+public:
+    /// constructor
+    atomic_view(Type* const* row, size_t n, size_t q)
+    : row_(row), n_(n), q_(q)
+    { }
+    /// number of elements in the corresponding vector
+    size_t size(void) const
+    {   return n_ * q_; }
+    /// number of components
+    size_t n_row(void) const
+    {   return n_; }
+    /// number of orders for each component
+    size_t n_order(void) const
+    {   return q_; }
+    /// pointer to the first element for component j
+    Type* row(size_t j) const
+    {   CPPAD_ASSERT_UNKNOWN( j < n_ );
+        return row_[j];
+    }
+    /// element for component j and order k
+    Type& operator()(size_t j, size_t k) const
+    {   CPPAD_ASSERT_UNKNOWN( j < n_ && k < q_ );
+        return row_[j][k];
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -77,8 +77,11 @@ $icode atomic_user$$ implementations.
 $head atomic_three$$
 
 $subhead Restrictions$$
-The $code atomic_three$$ constructor and destructor cannot be called in
-$cref/parallel/ta_in_parallel/$$ mode.
+The $code atomic_three$$ constructor and destructor can be called in
+$cref/parallel/ta_in_parallel/$$ mode and by threads that were not
+set up using $cref/parallel_setup/ta_parallel_setup/$$.
+The object must not be used by other threads while it is being
+constructed or destructed.
 
 $subhead Base$$
 The template parameter determines the
@@ -142,11 +145,7 @@ name used for error reporting
 template <class Base>
 atomic_three<Base>::atomic_three(const std::string& name )
 // END_PROTOTYPE
-{   CPPAD_ASSERT_KNOWN(
-        ! thread_alloc::in_parallel() ,
-        "atomic_three: constructor cannot be called in parallel mode."
-    );
-    //
+{   //
     // atomic_index
     bool        set_null  = false;
     size_t      index     = 0;
@@ -68,8 +68,11 @@ $icode atomic_user$$ implementations.
 $head atomic_base$$
 
 $subhead Restrictions$$
-The $code atomic_base$$ constructor and destructor cannot be called in
-$cref/parallel/ta_in_parallel/$$ mode.
+The $code atomic_base$$ constructor and destructor can be called in
+$cref/parallel/ta_in_parallel/$$ mode and by threads that were not
+set up using $cref/parallel_setup/ta_parallel_setup/$$.
+The object must not be used by other threads while it is being
+constructed or destructed.
 
 $subhead Base$$
 The template parameter determines the
@@ -148,11 +151,7 @@ atomic_base<Base>::atomic_base(
         option_enum            sparsity
 ) :
 sparsity_( sparsity               )
-{   CPPAD_ASSERT_KNOWN(
-        ! thread_alloc::in_parallel() ,
-        "atomic_base: constructor cannot be called in parallel mode."
-    );
-    CPPAD_ASSERT_UNKNOWN( constant_enum < dynamic_enum );
+{   CPPAD_ASSERT_UNKNOWN( constant_enum < dynamic_enum );
     CPPAD_ASSERT_UNKNOWN( dynamic_enum < variable_enum );
     //
     // atomic_index
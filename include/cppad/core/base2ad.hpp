@@ -84,6 +84,7 @@ ADFun< AD<Base>, RecBase > ADFun<Base,RecBase>::base2ad(void) const
     // bool values
     fun.has_been_optimized_        = has_been_optimized_;
     fun.check_for_nan_             = check_for_nan_;
+    fun.local_sparsity_            = local_sparsity_;
     //
     // size_t values
     fun.compare_change_count_      = compare_change_count_;
@@ -99,6 +100,7 @@ ADFun< AD<Base>, RecBase > ADFun<Base,RecBase>::base2ad(void) const
     fun.dep_taddr_                 = dep_taddr_;
     fun.dep_parameter_             = dep_parameter_;
     fun.cskip_op_                  = cskip_op_;
+    fun.cexp_select_               = cexp_select_;
     fun.load_op2var_               = load_op2var_;
     //
     // pod_maybe_vector< AD<Base> > = pod_maybe_vector<Base>
@@ -111,6 +113,14 @@ ADFun< AD<Base>, RecBase > ADFun<Base,RecBase>::base2ad(void) const
     // subgraph
     fun.subgraph_info_ = subgraph_info_;
     //
+    // live_slot
+    fun.live_slot_ = live_slot_;
+    //
+    // level_schedule
+    fun.level_schedule_ = level_schedule_;
+    //
+    // memo_table (memo_pure is not available for fun)
+    //
     // sparse_pack
     fun.for_jac_sparse_pack_ = for_jac_sparse_pack_;
     //
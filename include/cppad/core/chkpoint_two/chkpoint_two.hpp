@@ -28,6 +28,7 @@ $spell
     cppad
     bool
     hes
+    vec
 $$
 
 $section Checkpoint Functions: Second Generation$$
@@ -36,7 +37,8 @@ $head Syntax$$
 
 $subhead Constructor$$
 $codei%chkpoint_two<%Base%> %chk_fun%( %fun%, %name%,
-    %internal_bool%, %use_hes_sparsity%, %use_base2ad%, %use_in_parallel%
+    %internal_bool%, %use_hes_sparsity%, %use_base2ad%, %use_in_parallel%,
+    %use_optimize%
 )%$$
 
 $subhead Use Checkpoint Function$$
@@ -45,6 +47,14 @@ $codei% %chk_fun%(%ax%, %ay%)%$$
 $subhead new_dynamic$$
 $icode%chk_fun%.new_dynamic(%dynamic%)%$$
 
+$subhead revolve$$
+$icode%n_forward% = %chk_fun%.revolve(
+    %n_step%, %n_snapshot%, %x%, %w%, %y%, %dw%
+)%$$
+
+$subhead hes_vec$$
+$icode%chk_fun%.hes_vec(%x%, %w%, %v%, %dw%, %hv%)%$$
+
 $head Reduce Memory$$
 You can reduce the size of the tape and memory required for AD
 using a checkpoint representation of a function
@@ -65,6 +75,19 @@ with different arguments during a single forward mode operation.
 Thus, forward mode results are computed for each use of $icode chk_fun$$
 in a forward mode sweep.
 
+$head Taylor Coefficient Cache$$
+The copy of $icode fun$$ used by $icode chk_fun$$ remembers the
+Taylor coefficients for its domain space
+corresponding to its most recent forward mode calculation.
+If the lower orders of the next forward mode calculation are the same,
+they are not recomputed.
+If the reverse mode calculation for a use of $icode chk_fun$$
+has the same Taylor coefficients as the most recent forward mode
+calculation, forward mode is not repeated before the reverse mode sweep.
+For example, if $icode chk_fun$$ is used once in a recording,
+the zero order forward sweep for $icode fun$$ is only done
+when the argument to $icode chk_fun$$ changes.
+
 $head Operation Sequence$$
 The $cref/operation sequence/glossary/Operation/Sequence/$$
 representing $latex g(x)$$ is fixed; i.e.,
@@ -92,11 +115,15 @@ $codei%AD<%Base%>%$$ operations.
 $childtable%include/cppad/core/chkpoint_two/ctor.hpp
     %include/cppad/core/chkpoint_two/chk_fun.omh
     %include/cppad/core/chkpoint_two/dynamic.hpp
+    %include/cppad/core/chkpoint_two/revolve.hpp
+    %include/cppad/core/chkpoint_two/hes_vec.hpp
     %example/chkpoint_two/get_started.cpp
     %example/chkpoint_two/compare.cpp
     %example/chkpoint_two/base2ad.cpp
     %example/chkpoint_two/dynamic.cpp
     %example/chkpoint_two/ode.cpp
+    %example/chkpoint_two/revolve.cpp
+    %example/chkpoint_two/hes_vec.cpp
 %$$
 
 $end
@@ -127,12 +154,20 @@ private:
     sparse_rc< vector<size_t> > hes_sparsity_;
     //
     /// Function corresponding to this checkpoint object.
-    /// If use_in_parallel_, this is constant after the constructor.
+    /// If use_in_parallel_, this is constant after the constructor
+    /// and its operation sequence is shared by member_[thread]->g_.
     ADFun<Base>    g_;
     //
     /// AD version of function corresponding to this checkpoint object
-    /// If use_in_parallel_, this is constant after the constructor.
+    /// If use_in_parallel_, this is constant after the constructor
+    /// and its operation sequence is shared by member_[thread]->ag_.
     ADFun< AD<Base>, Base>  ag_;
+    //
+    /// Taylor coefficients for the domain space that correspond to the
+    /// Taylor coefficients currently stored in g_. The coefficient for
+    /// order k and component j is g_taylor_x_[ k * n + j ].
+    /// (Not used when use_in_parallel_ is true.)
+    vector<Base> g_taylor_x_;
     // ------------------------------------------------------------------------
     // member_
     // ------------------------------------------------------------------------
@@ -146,6 +181,9 @@ private:
         /// AD version of this function object
         ADFun< AD<Base>, Base >     ag_;
         //
+        /// Taylor coefficients for the domain space corresponding to g_
+        vector<Base>                g_taylor_x_;
+        //
     };
     /// use pointers and allocate memory to avoid false sharing
     /// (initialized to null by constructor)
@@ -165,9 +203,10 @@ private:
             // call member_struct constructor
             new( member_[thread] ) member_struct;
             //
-            // The thread has a copy of corresponding informaiton.
-            member_[thread]->g_  = g_;
-            member_[thread]->ag_ = ag_;
+            // The thread has a copy of corresponding informaiton
+            // that shares the constant operation sequence in g_ and ag_.
+            member_[thread]->g_.share_recording(g_);
+            member_[thread]->ag_.share_recording(ag_);
         }
         return;
     }
@@ -187,6 +226,26 @@ private:
         return;
     }
     // -----------------------------------------------------------------------
+    // g_forward
+    void g_forward(
+        ADFun<Base>*                 g_ptr        ,
+        vector<Base>&                g_taylor_x   ,
+        size_t                       order_low    ,
+        size_t                       order_up     ,
+        const vector<Base>&          taylor_x     ,
+        vector<Base>&                taylor_y
+    );
+    // -----------------------------------------------------------------------
+    // revolve_rec
+    size_t revolve_rec(
+        ADFun<Base>*                 g_ptr        ,
+        size_t                       n_step       ,
+        size_t                       n_snapshot   ,
+        const vector<Base>&          x_left       ,
+        vector<Base>&                partial      ,
+        vector<Base>*                y_ptr
+    );
+    // -----------------------------------------------------------------------
     // atomic_three virtual functions
     // ------------------------------------------------------------------------
     // type
@@ -267,7 +326,8 @@ public:
         bool  internal_bool       ,
         bool  use_hes_sparsity    ,
         bool  use_base2ad         ,
-        bool  use_in_parallel
+        bool  use_in_parallel     ,
+        bool  use_optimize = false
     );
     //
     // destructor
@@ -288,19 +348,44 @@ public:
     use_in_parallel_  ( other.use_in_parallel_ ) ,
     jac_sparsity_     ( other.jac_sparsity_ ) ,
     hes_sparsity_     ( other.hes_sparsity_ )
-    {   g_  = other.g_;
+    {   for(size_t thread = 0; thread < CPPAD_MAX_NUM_THREADS; thread++)
+            member_[thread] = nullptr;
+        g_  = other.g_;
         ag_ = other.ag_;
     }
     //
     // new_dynamic
     template <class BaseVector>
     void new_dynamic(const BaseVector& dynamic);
+    //
+    // revolve
+    template <class BaseVector>
+    size_t revolve(
+        size_t               n_step     ,
+        size_t               n_snapshot ,
+        const BaseVector&    x          ,
+        const BaseVector&    w          ,
+        BaseVector&          y          ,
+        BaseVector&          dw
+    );
+    //
+    // hes_vec
+    template <class BaseVector>
+    void hes_vec(
+        const BaseVector&    x          ,
+        const BaseVector&    w          ,
+        const BaseVector&    v          ,
+        BaseVector&          dw         ,
+        BaseVector&          hv
+    );
 };
 
 } // END_CPPAD_NAMESPACE
 
 # include <cppad/core/chkpoint_two/ctor.hpp>
 # include <cppad/core/chkpoint_two/dynamic.hpp>
+# include <cppad/core/chkpoint_two/revolve.hpp>
+# include <cppad/core/chkpoint_two/hes_vec.hpp>
 # include <cppad/core/chkpoint_two/for_type.hpp>
 # include <cppad/core/chkpoint_two/forward.hpp>
 # include <cppad/core/chkpoint_two/reverse.hpp>
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_CHKPOINT_TWO_CTOR_HPP
 # define CPPAD_CORE_CHKPOINT_TWO_CTOR_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -26,6 +26,10 @@ $head Syntax$$
 $codei%chkpoint_two<%Base%> %chk_fun%( %fun%, %name%,
     %internal_bool%, %use_hes_sparsity%, %use_base2ad%, %use_in_parallel%
 )%$$
+$codei%chkpoint_two<%Base%> %chk_fun%( %fun%, %name%,
+    %internal_bool%, %use_hes_sparsity%, %use_base2ad%, %use_in_parallel%,
+    %use_optimize%
+)%$$
 
 $head Prototype$$
 $srcthisfile%
@@ -45,7 +49,8 @@ $head fun$$
 This specifies the function $latex g(x)$$.
 Note that $icode fun$$ may or may not have been
 $cref/optimized/optimize/$$ before calling the constructor.
-This will determine if the internal representation for $icode g(x)$$
+If $icode use_optimize$$ is false,
+this will determine if the internal representation for $icode g(x)$$
 is optimized.
 
 $head name$$
@@ -73,6 +78,17 @@ If this is true, $icode chk_fun$$ can be used
 $cref/in_parallel/ta_parallel_setup/in_parallel/$$.
 This requires some extra memory for a constant copy of the $icode fun$$
 information and a separate copy (that changes) for each thread.
+The operation sequence for $icode fun$$ is not copied for each thread;
+i.e., all the threads share one constant copy of the operation sequence.
+Only the information that changes during calculations,
+for example the Taylor coefficients, is stored separately for each thread.
+
+$head use_optimize$$
+This argument is optional and its default value is false.
+If it is true, the internal representation of $latex g(x)$$
+is optimized (using the default $cref/options/optimize/options/$$)
+before it is used to compute sparsity patterns or shared with other threads.
+The object $icode fun$$ is not modified.
 
 $head chk_fun$$
 This is a checkpoint function representation of $latex g(x)$$
@@ -109,6 +125,9 @@ will this checkpoint function be used with base2ad.
 
 \param use_in_parallel
 will this checkpoint function be used in parallel mode.
+
+\param use_optimize
+should the constructor optimize its copy of fun.
 */
 
 // BEGIN_PROTOTYPE
@@ -119,7 +138,8 @@ chkpoint_two<Base>::chkpoint_two(
         bool  internal_bool       ,
         bool  use_hes_sparsity    ,
         bool  use_base2ad         ,
-        bool  use_in_parallel     )
+        bool  use_in_parallel     ,
+        bool  use_optimize        )
 // END_PROTOTYPE
 :
 atomic_three<Base>(name)              ,
@@ -137,6 +157,8 @@ use_in_parallel_ ( use_in_parallel )
     //
     // g_
     g_ = fun;
+    if( use_optimize )
+        g_.optimize();
     //
     // suppress check for nan because chkpoint_two object can be used in a
     // function that gets optimized and some checkpoint results may not matter.
@@ -203,6 +225,10 @@ use_in_parallel_ ( use_in_parallel )
         g_.size_forward_bool(0);
     else
         g_.size_forward_set(0);
+    //
+    // free memory holding Taylor coefficients
+    // (each use of this checkpoint function computes its own coefficients)
+    g_.capacity_order(0);
 }
 /// destructor
 template <class Base>
@@ -82,11 +82,13 @@ template <class Base>
 template <class BaseVector>
 void chkpoint_two<Base>::new_dynamic(const BaseVector& dynamic)
 // END_PROTOTYPE
-{   ADFun<Base>* g_ptr = &g_;
+{   ADFun<Base>*  g_ptr        = &g_;
+    vector<Base>* g_taylor_ptr = &g_taylor_x_;
     if( use_in_parallel_ )
     {   size_t thread = thread_alloc::thread_num();
         allocate_member(thread);
-        g_ptr = &(member_[thread]->g_);
+        g_ptr        = &(member_[thread]->g_);
+        g_taylor_ptr = &(member_[thread]->g_taylor_x_);
     }
 # ifndef NDEBUG
     else if( thread_alloc::in_parallel() )
@@ -96,6 +98,10 @@ void chkpoint_two<Base>::new_dynamic(const BaseVector& dynamic)
     }
 # endif
     g_ptr->new_dynamic(dynamic);
+    //
+    // the Taylor coefficients stored in g_ptr no longer correspond
+    // to the new dynamic parameter values
+    g_taylor_ptr->resize(0);
 }
 
 } // END_CPPAD_NAMESPACE
@@ -17,6 +17,92 @@ namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 Second generation checkpoint forward mode.
 */
 /*!
+Forward mode for the function corresponding to this checkpoint object
+that does not recompute the orders that are already stored.
+
+\param g_ptr [in,out]
+is the copy of the function for this thread.
+Upon return, it contains the Taylor coefficients for orders zero through
+order_up corresponding to taylor_x.
+
+\param g_taylor_x [in,out]
+On input, it contains the domain space Taylor coefficients corresponding to
+the Taylor coefficients stored in g_ptr. Upon return it is the domain space
+Taylor coefficients corresponding to taylor_x.
+The coefficient for order k and component j is g_taylor_x[ k * n + j ].
+
+\param order_low [in]
+is the lowest order that must be computed.
+Orders less than order_low are only computed if the corresponding
+Taylor coefficients are not already stored in g_ptr.
+If order_low is order_up + 1, no orders need to be computed.
+
+\param order_up [in]
+is the highest order that is stored in g_ptr upon return.
+
+\param taylor_x [in]
+is the domain space Taylor coefficients for orders zero through order_up.
+The coefficient for order k and component j is taylor_x[ j * q + k ]
+where q = order_up + 1.
+
+\param taylor_y [in,out]
+Upon return, the range space Taylor coefficients for the orders that are
+computed, including order_low through order_up, are set.
+The other orders are not modified.
+*/
+template <class Base>
+void chkpoint_two<Base>::g_forward(
+    ADFun<Base>*                 g_ptr        ,
+    vector<Base>&                g_taylor_x   ,
+    size_t                       order_low    ,
+    size_t                       order_up     ,
+    const vector<Base>&          taylor_x     ,
+    vector<Base>&                taylor_y     )
+{   size_t n = g_ptr->Domain();
+    size_t m = g_ptr->Range();
+    size_t q = order_up + 1;
+    CPPAD_ASSERT_UNKNOWN( order_low <= q );
+    CPPAD_ASSERT_UNKNOWN( taylor_x.size() == n * q );
+    //
+    // order_start
+    // first order that is not already stored in g_ptr
+    size_t order_start = 0;
+    size_t n_order     = std::min(g_taylor_x.size() / n, g_ptr->size_order());
+    bool   match       = true;
+    while( match && order_start < std::min(n_order, q) )
+    {   size_t k = order_start;
+        for(size_t j = 0; j < n; ++j)
+            match &= g_taylor_x[k * n + j] == taylor_x[j * q + k];
+        if( match )
+            ++order_start;
+    }
+    order_start = std::min(order_start, order_low);
+    if( order_start == q )
+        return;
+    //
+    // taylor_y, g_ptr
+    taylor_y.resize(m * q);
+    if( order_start == 0 )
+        taylor_y = g_ptr->Forward(order_up, taylor_x);
+    else
+    {   vector<Base> x_k(n), y_k(m);
+        for(size_t k = order_start; k < q; ++k)
+        {   for(size_t j = 0; j < n; ++j)
+                x_k[j] = taylor_x[j * q + k];
+            y_k = g_ptr->Forward(k, x_k);
+            for(size_t i = 0; i < m; ++i)
+                taylor_y[i * q + k] = y_k[i];
+        }
+    }
+    //
+    // g_taylor_x
+    g_taylor_x.resize(n * q);
+    for(size_t k = 0; k < q; ++k)
+        for(size_t j = 0; j < n; ++j)
+            g_taylor_x[k * n + j] = taylor_x[j * q + k];
+    return;
+}
+/*!
 Link from chkpoint_two to forward mode
 
 \param parameter_x [in]
@@ -51,11 +137,13 @@ bool chkpoint_two<Base>::forward(
     size_t                       order_up    ,
     const vector<Base>&          taylor_x    ,
     vector<Base>&                taylor_y    )
-{   ADFun<Base>* g_ptr = &g_;
+{   ADFun<Base>*  g_ptr        = &g_;
+    vector<Base>* g_taylor_ptr = &g_taylor_x_;
     if( use_in_parallel_ )
     {   size_t thread = thread_alloc::thread_num();
         allocate_member(thread);
-        g_ptr = &(member_[thread]->g_);
+        g_ptr        = &(member_[thread]->g_);
+        g_taylor_ptr = &(member_[thread]->g_taylor_x_);
     }
 # ifndef NDEBUG
     else if( thread_alloc::in_parallel() )
@@ -64,8 +152,9 @@ bool chkpoint_two<Base>::forward(
         CPPAD_ASSERT_KNOWN(false, msg.c_str() );
     }
 # endif
-    // compute forward mode results for all values and orders
-    taylor_y = g_ptr->Forward(order_up, taylor_x);
+    // compute forward mode results for orders order_low through order_up
+    // (lower orders are only computed if they are not stored in g_ptr)
+    g_forward(g_ptr, *g_taylor_ptr, order_low, order_up, taylor_x, taylor_y);
     //
     return true;
 }
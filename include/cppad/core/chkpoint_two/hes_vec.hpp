@@ -0,0 +1,171 @@
+# ifndef CPPAD_CORE_CHKPOINT_TWO_HES_VEC_HPP
+# define CPPAD_CORE_CHKPOINT_TWO_HES_VEC_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin chkpoint_two_hes_vec$$
+$spell
+    chk
+    chkpoint
+    vec
+    hv
+$$
+
+$section Hessian Times a Vector for a Checkpoint Function$$
+
+$head Syntax$$
+$icode%chk_fun%.hes_vec(%x%, %w%, %v%, %dw%, %hv%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head Purpose$$
+Suppose that $latex g : \B{R}^n \rightarrow \B{R}^m$$ is the function
+corresponding to $icode chk_fun$$ and $latex w \in \B{R}^m$$.
+This routine computes
+the gradient and Hessian times a vector for the function
+$latex \[
+    W(x) = w^\R{T} g(x)
+\] $$
+without recording $icode chk_fun$$ in another $codei%ADFun<%Base%>%$$.
+This is useful for methods, like Newton's method with conjugate gradients,
+that need the Hessian times many directions at the same argument value.
+
+$head Zero Order Forward$$
+The zero order forward sweep for $latex g(x)$$ is only done
+if $icode x$$ is different from the argument value for the most recent
+forward mode calculation using the copy of $icode fun$$
+in $icode chk_fun$$; see
+$cref/Taylor coefficient cache
+    /chkpoint_two
+    /Taylor Coefficient Cache
+/$$.
+Hence, repeated calls with the same $icode x$$ and different $icode v$$
+only require a first order forward sweep and a second order reverse sweep.
+
+$head chk_fun$$
+This object must have been created using the
+$cref/chkpoint_two/chkpoint_two_ctor/chk_fun/$$ constructor.
+The function $cref/fun/chkpoint_two_ctor/fun/$$
+in the $icode chk_fun$$ constructor is $latex g(x)$$.
+
+$head BaseVector$$
+This must be a $cref SimpleVector$$ with elements of type $icode Base$$.
+
+$head x$$
+This is the argument value and has size $latex n$$.
+
+$head w$$
+This is the weighting vector and has size $latex m$$.
+
+$head v$$
+This is the direction for the Hessian and has size $latex n$$.
+
+$head dw$$
+The input size and value of $icode dw$$ do not matter.
+Upon return, it is the gradient $latex W^{(1)} (x)$$
+and has size $latex n$$.
+
+$head hv$$
+The input size and value of $icode hv$$ do not matter.
+Upon return, it is the Hessian times a vector
+$latex W^{(2)} (x) v$$ and has size $latex n$$.
+
+$head Multi-Threading$$
+If one is using $cref/in_parallel/ta_in_parallel/$$,
+the copy of $icode fun$$ for the current
+$cref/thread number/ta_thread_num/$$ is used.
+
+$head Example$$
+The file $cref chkpoint_two_hes_vec.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file chkpoint_two/hes_vec.hpp
+Hessian times a vector for a checkpoint function.
+*/
+
+// BEGIN_PROTOTYPE
+template <class Base>
+template <class BaseVector>
+void chkpoint_two<Base>::hes_vec(
+    const BaseVector&    x          ,
+    const BaseVector&    w          ,
+    const BaseVector&    v          ,
+    BaseVector&          dw         ,
+    BaseVector&          hv         )
+// END_PROTOTYPE
+{   ADFun<Base>*  g_ptr        = &g_;
+    vector<Base>* g_taylor_ptr = &g_taylor_x_;
+    if( use_in_parallel_ )
+    {   size_t thread = thread_alloc::thread_num();
+        allocate_member(thread);
+        g_ptr        = &(member_[thread]->g_);
+        g_taylor_ptr = &(member_[thread]->g_taylor_x_);
+    }
+# ifndef NDEBUG
+    else if( thread_alloc::in_parallel() )
+    {   std::string msg = atomic_three<Base>::atomic_name();
+        msg += ": use_in_parallel is false and in_parallel() is true";
+        CPPAD_ASSERT_KNOWN(false, msg.c_str() );
+    }
+# endif
+    size_t n = g_ptr->Domain();
+    size_t m = g_ptr->Range();
+    CPPAD_ASSERT_KNOWN( size_t( x.size() ) == n,
+        "chkpoint_two hes_vec: size of x not equal domain size for fun"
+    );
+    CPPAD_ASSERT_KNOWN( size_t( w.size() ) == m,
+        "chkpoint_two hes_vec: size of w not equal range size for fun"
+    );
+    CPPAD_ASSERT_KNOWN( size_t( v.size() ) == n,
+        "chkpoint_two hes_vec: size of v not equal domain size for fun"
+    );
+    //
+    // taylor_x
+    vector<Base> taylor_x(n * 2);
+    for(size_t j = 0; j < n; ++j)
+    {   taylor_x[j * 2 + 0] = x[j];
+        taylor_x[j * 2 + 1] = v[j];
+    }
+    //
+    // g_ptr
+    // Taylor coefficients for orders zero and one
+    // (orders already stored in g_ptr are not recomputed)
+    size_t order_low = 2;
+    size_t order_up  = 1;
+    vector<Base> taylor_y;
+    g_forward(g_ptr, *g_taylor_ptr, order_low, order_up, taylor_x, taylor_y);
+    //
+    // partial
+    vector<Base> w_vec(m);
+    for(size_t i = 0; i < m; ++i)
+        w_vec[i] = w[i];
+    vector<Base> partial = g_ptr->Reverse(2, w_vec);
+    //
+    // dw, hv
+    dw.resize(n);
+    hv.resize(n);
+    for(size_t j = 0; j < n; ++j)
+    {   dw[j] = partial[j * 2 + 0];
+        hv[j] = partial[j * 2 + 1];
+    }
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -52,11 +52,13 @@ bool chkpoint_two<Base>::reverse(
     vector<Base>&               partial_x     ,
     const vector<Base>&         partial_y     )
 
-{   ADFun<Base>* g_ptr = &g_;
+{   ADFun<Base>*  g_ptr        = &g_;
+    vector<Base>* g_taylor_ptr = &g_taylor_x_;
     if( use_in_parallel_ )
     {   size_t thread = thread_alloc::thread_num();
         allocate_member(thread);
-        g_ptr = &(member_[thread]->g_);
+        g_ptr        = &(member_[thread]->g_);
+        g_taylor_ptr = &(member_[thread]->g_taylor_x_);
     }
 # ifndef NDEBUG
     else if( thread_alloc::in_parallel() )
@@ -66,10 +68,14 @@ bool chkpoint_two<Base>::reverse(
     }
 # endif
     // compute forward mode Taylor coefficient orders 0 through order_up
+    // (no orders are computed if they are already stored in g_ptr)
+    size_t order_low = order_up + 1;
 # ifdef NDEBUG
-    g_ptr->Forward(order_up, taylor_x);
+    vector<Base> check;
+    g_forward(g_ptr, *g_taylor_ptr, order_low, order_up, taylor_x, check);
 # else
-    vector<Base> check = g_ptr->Forward(order_up, taylor_x);
+    vector<Base> check = taylor_y;
+    g_forward(g_ptr, *g_taylor_ptr, order_low, order_up, taylor_x, check);
     CPPAD_ASSERT_UNKNOWN( taylor_y.size() == check.size() )
     for(size_t i = 0; i < taylor_y.size(); ++i)
         CPPAD_ASSERT_UNKNOWN( taylor_y[i] == check[i] );
@@ -0,0 +1,305 @@
+# ifndef CPPAD_CORE_CHKPOINT_TWO_REVOLVE_HPP
+# define CPPAD_CORE_CHKPOINT_TWO_REVOLVE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin chkpoint_two_revolve$$
+$spell
+    chk
+    chkpoint
+    revolve
+    Griewank
+$$
+
+$section Reverse Mode Through Repeated Use of a Checkpoint Function$$
+
+$head Syntax$$
+$icode%n_forward% = %chk_fun%.revolve(
+    %n_step%, %n_snapshot%, %x%, %w%, %y%, %dw%
+)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head Purpose$$
+Suppose that $latex g : \B{R}^n \rightarrow \B{R}^n$$ is one step
+of a time stepping method; e.g., an ODE integrator.
+This routine computes
+$latex \[
+    y = g^T (x) = g[ g( \cdots g(x) \cdots ) ]
+\] $$
+and the derivative
+$latex \[
+    dw = \partial_x [ w^\R{T} g^T (x) ]
+\] $$
+where $latex T$$ is the number of steps.
+If one records all $latex T$$ uses of $icode chk_fun$$ in one
+$codei%ADFun<%Base%>%$$, reverse mode holds the Taylor coefficients for
+every step.
+This routine instead holds at most $icode n_snapshot$$ states and
+recomputes the other states when they are needed.
+
+$head Schedule$$
+The steps are reversed using the binomial checkpointing schedule
+of Griewank (also known as revolve).
+Let $latex s$$ be $icode n_snapshot$$ and
+$latex r$$ the smallest integer such that
+$latex \[
+    T \leq \left( \begin{array}{c} s + r \\ s \end{array} \right)
+\] $$
+The total number of evaluations of $latex g(x)$$ is at most
+$latex ( r + 1 ) T$$.
+For example,
+if $latex T = 100000$$ and $latex s = 20$$, then $latex r = 6$$.
+If $latex s = 1$$, only $icode x$$ is stored and
+$latex r = T - 1$$.
+
+$head chk_fun$$
+This object must have been created using the
+$cref/chkpoint_two/chkpoint_two_ctor/chk_fun/$$ constructor.
+The function $cref/fun/chkpoint_two_ctor/fun/$$
+in the $icode chk_fun$$ constructor is $latex g(x)$$.
+Its domain and range size must be equal; i.e., $latex n$$.
+The state is evaluated and differentiated using zero order forward
+and first order reverse mode on the same copy of $icode fun$$
+that $icode chk_fun$$ uses for its forward and reverse callbacks.
+
+$head BaseVector$$
+This must be a $cref SimpleVector$$ with elements of type $icode Base$$.
+
+$head n_step$$
+This is the number of steps $latex T$$.
+
+$head n_snapshot$$
+This is the maximum number of states, including $icode x$$,
+that are stored at the same time.
+It must be greater than zero.
+
+$head x$$
+This is the initial state and has size $latex n$$.
+
+$head w$$
+This is the weighting vector for the final state and has size $latex n$$.
+
+$head y$$
+The input size and value of $icode y$$ do not matter.
+Upon return, it is the final state $latex g^T (x)$$ and has size $latex n$$.
+
+$head dw$$
+The input size and value of $icode dw$$ do not matter.
+Upon return, it is the derivative
+$latex \partial_x [ w^\R{T} g^T (x) ]$$ and has size $latex n$$.
+
+$head n_forward$$
+This is the number of times $latex g(x)$$ was evaluated.
+It is at least $latex T$$ and at most $latex ( r + 1 ) T$$.
+
+$head Multi-Threading$$
+If one is using $cref/in_parallel/ta_in_parallel/$$,
+the copy of $icode fun$$ for the current
+$cref/thread number/ta_thread_num/$$ is used.
+
+$head Example$$
+The file $cref chkpoint_two_revolve.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file chkpoint_two/revolve.hpp
+Binomial checkpointing for repeated use of a checkpoint function.
+*/
+
+/*!
+Binomial coefficient (s + r) choose s, or a value greater than
+bound if the coefficient is greater than bound.
+*/
+inline size_t chkpoint_two_binomial(size_t s, size_t r, size_t bound)
+{   size_t result = 1;
+    for(size_t i = 1; i <= s; ++i)
+    {   // result = (r + i) choose i
+        if( result > bound )
+            return result;
+        result = result * (r + i) / i;
+    }
+    return result;
+}
+
+/*!
+Reverse a sequence of steps using binomial checkpointing.
+
+\param g_ptr
+function that evaluates one step.
+
+\param n_step
+number of steps starting at x_left.
+
+\param n_snapshot
+number of states, including x_left, that can be stored.
+
+\param x_left
+state at the beginning of the steps.
+
+\param partial
+On input, the partial w.r.t. the state at the end of the steps.
+On output, the partial w.r.t. x_left.
+
+\param y_ptr
+If not null, *y_ptr is set to the state at the end of the steps.
+
+\return
+number of zero order forward evaluations of g.
+*/
+template <class Base>
+size_t chkpoint_two<Base>::revolve_rec(
+    ADFun<Base>*         g_ptr      ,
+    size_t               n_step     ,
+    size_t               n_snapshot ,
+    const vector<Base>&  x_left     ,
+    vector<Base>&        partial    ,
+    vector<Base>*        y_ptr      )
+{   CPPAD_ASSERT_UNKNOWN( 0 < n_step );
+    CPPAD_ASSERT_UNKNOWN( 0 < n_snapshot );
+    size_t n_forward = 0;
+    //
+    // one step
+    if( n_step == 1 )
+    {   vector<Base> y = g_ptr->Forward(0, x_left);
+        if( y_ptr != nullptr )
+            y_ptr->swap(y);
+        partial = g_ptr->Reverse(1, partial);
+        return 1;
+    }
+    //
+    // only x_left is stored
+    if( n_snapshot == 1 )
+    {   vector<Base> x;
+        for(size_t j = n_step; j > 0; --j)
+        {   // x = state at beginning of step j - 1
+            x = x_left;
+            for(size_t k = 0; k < j - 1; ++k)
+                x = g_ptr->Forward(0, x);
+            vector<Base> y = g_ptr->Forward(0, x);
+            n_forward += j;
+            if( j == n_step && y_ptr != nullptr )
+                y_ptr->swap(y);
+            partial = g_ptr->Reverse(1, partial);
+        }
+        return n_forward;
+    }
+    //
+    // n_repeat
+    // smallest r such that n_step <= (n_snapshot + r) choose n_snapshot
+    size_t n_repeat = 0;
+    while( chkpoint_two_binomial(n_snapshot, n_repeat, n_step) < n_step )
+        ++n_repeat;
+    CPPAD_ASSERT_UNKNOWN( 0 < n_repeat );
+    //
+    // n_left
+    // The steps to the right of the split are reversed with one less
+    // snapshot; the steps to the left are reversed with one less repeat.
+    size_t n_right = chkpoint_two_binomial(n_snapshot - 1, n_repeat, n_step);
+    n_right        = std::min(n_right, n_step - 1);
+    size_t n_left  = n_step - n_right;
+    CPPAD_ASSERT_UNKNOWN( 0 < n_left && 0 < n_right );
+    {   // x_split
+        vector<Base> x_split = x_left;
+        for(size_t k = 0; k < n_left; ++k)
+            x_split = g_ptr->Forward(0, x_split);
+        n_forward += n_left;
+        //
+        // steps to the right of the split
+        n_forward += revolve_rec(
+            g_ptr, n_right, n_snapshot - 1, x_split, partial, y_ptr
+        );
+    }
+    // steps to the left of the split
+    n_forward += revolve_rec(
+        g_ptr, n_left, n_snapshot, x_left, partial, nullptr
+    );
+    return n_forward;
+}
+
+// BEGIN_PROTOTYPE
+template <class Base>
+template <class BaseVector>
+size_t chkpoint_two<Base>::revolve(
+    size_t               n_step     ,
+    size_t               n_snapshot ,
+    const BaseVector&    x          ,
+    const BaseVector&    w          ,
+    BaseVector&          y          ,
+    BaseVector&          dw         )
+// END_PROTOTYPE
+{   ADFun<Base>*  g_ptr        = &g_;
+    vector<Base>* g_taylor_ptr = &g_taylor_x_;
+    if( use_in_parallel_ )
+    {   size_t thread = thread_alloc::thread_num();
+        allocate_member(thread);
+        g_ptr        = &(member_[thread]->g_);
+        g_taylor_ptr = &(member_[thread]->g_taylor_x_);
+    }
+# ifndef NDEBUG
+    else if( thread_alloc::in_parallel() )
+    {   std::string msg = atomic_three<Base>::atomic_name();
+        msg += ": use_in_parallel is false and in_parallel() is true";
+        CPPAD_ASSERT_KNOWN(false, msg.c_str() );
+    }
+# endif
+    size_t n = g_ptr->Domain();
+    CPPAD_ASSERT_KNOWN( g_ptr->Range() == n,
+        "chkpoint_two revolve: function domain and range sizes differ"
+    );
+    CPPAD_ASSERT_KNOWN( 0 < n_snapshot,
+        "chkpoint_two revolve: n_snapshot is zero"
+    );
+    CPPAD_ASSERT_KNOWN( size_t( x.size() ) == n,
+        "chkpoint_two revolve: size of x not equal domain size for fun"
+    );
+    CPPAD_ASSERT_KNOWN( size_t( w.size() ) == n,
+        "chkpoint_two revolve: size of w not equal domain size for fun"
+    );
+    //
+    // x_vec, partial
+    vector<Base> x_vec(n), partial(n), y_vec(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x_vec[j]   = x[j];
+        partial[j] = w[j];
+        y_vec[j]   = x[j];
+    }
+    //
+    // g_taylor_ptr
+    // revolve_rec changes the Taylor coefficients stored in g_ptr
+    g_taylor_ptr->resize(0);
+    //
+    // partial, y_vec, n_forward
+    size_t n_forward = 0;
+    if( 0 < n_step )
+        n_forward = revolve_rec(
+            g_ptr, n_step, n_snapshot, x_vec, partial, &y_vec
+        );
+    //
+    // y, dw
+    y.resize(n);
+    dw.resize(n);
+    for(size_t j = 0; j < n; ++j)
+    {   y[j]  = y_vec[j];
+        dw[j] = partial[j];
+    }
+    return n_forward;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -103,8 +103,8 @@ namespace CppAD {
         if( x.tape_id_ == 0 )
             return true;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ != *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ != *AD<Base>::tape_id_ptr(slot);
     }
     //
     template <class Base>
@@ -113,8 +113,8 @@ namespace CppAD {
         if( x.tape_id_ == 0 )
             return true;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ != *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ != *AD<Base>::tape_id_ptr(slot);
     }
     // -----------------------------------------------------------------------
     // Dynamic
@@ -124,8 +124,8 @@ namespace CppAD {
         if( (x.tape_id_ == 0) | (x.ad_type_ != dynamic_enum) )
             return false;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ == *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ == *AD<Base>::tape_id_ptr(slot);
     }
     //
     template <class Base>
@@ -134,8 +134,8 @@ namespace CppAD {
         if( (x.tape_id_ == 0) | (x.ad_type_ != dynamic_enum) )
             return false;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ == *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ == *AD<Base>::tape_id_ptr(slot);
     }
     // -----------------------------------------------------------------------
     // Parameter
@@ -145,8 +145,8 @@ namespace CppAD {
         if( (x.tape_id_ == 0) | (x.ad_type_ == dynamic_enum) )
             return true;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ != *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ != *AD<Base>::tape_id_ptr(slot);
     }
     //
     template <class Base>
@@ -155,8 +155,8 @@ namespace CppAD {
         if( (x.tape_id_ == 0) | (x.ad_type_ == dynamic_enum) )
             return true;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ != *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ != *AD<Base>::tape_id_ptr(slot);
     }
     // -----------------------------------------------------------------------
     // Variable
@@ -166,8 +166,8 @@ namespace CppAD {
         if( (x.tape_id_ == 0) | (x.ad_type_ != variable_enum) )
             return false;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ == *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ == *AD<Base>::tape_id_ptr(slot);
     }
     //
     template <class Base>
@@ -176,8 +176,8 @@ namespace CppAD {
         if( (x.tape_id_ == 0) | (x.ad_type_ != variable_enum) )
             return false;
         //
-        size_t thread = size_t(x.tape_id_ % CPPAD_MAX_NUM_THREADS);
-        return x.tape_id_ == *AD<Base>::tape_id_ptr(thread);
+        size_t slot = tape_slot::slot(x.tape_id_);
+        return x.tape_id_ == *AD<Base>::tape_id_ptr(slot);
     }
 }
 // END CppAD namespace
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_CPPAD_ASSERT_HPP
 # define CPPAD_CORE_CPPAD_ASSERT_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -90,6 +90,7 @@ $end
 */
 
 # include <cassert>
+# include <atomic>
 # include <iostream>
 # include <cppad/utility/error_handler.hpp>
 
@@ -175,13 +176,13 @@ execution is terminated and the source code line number is reported.
 # define CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL
 # else
 # define CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL                           \
-    static bool assert_first_call = true;                              \
-    if( assert_first_call )                                            \
+    static std::atomic<bool> assert_first_call(true);                  \
+    if( assert_first_call.load(std::memory_order_relaxed) )            \
     {   CPPAD_ASSERT_KNOWN(                                           \
         ! (CppAD::thread_alloc::in_parallel() ),                      \
         "In parallel mode and parallel_setup has not been called."    \
         );                                                            \
-        assert_first_call = false;                                    \
+        assert_first_call.store(false, std::memory_order_relaxed);    \
     }
 # endif
 
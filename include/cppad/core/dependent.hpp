@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_DEPENDENT_HPP
 # define CPPAD_CORE_DEPENDENT_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -226,7 +226,7 @@ The dependent variable vector for the function being stored in this object.
 
 \par
 All of the private member data in ad_fun.hpp is set to correspond to the
-new tape except for check_for_nan_.
+new tape except for check_for_nan_ and local_sparsity_.
 */
 
 template <class Base, class RecBase>
@@ -243,6 +243,9 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
         y.size() > 0,
         "ADFun operation sequence dependent variable size is zero size"
     );
+    // wait for asynchronous requests that use the current operation sequence
+    async_pool_.clear();
+
     // ---------------------------------------------------------------------
     // Begin setting ad_fun.hpp private member data
     // ---------------------------------------------------------------------
@@ -267,7 +270,7 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
     // put an EndOp at the end of the tape
     tape->Rec_.PutOp(local::EndOp);
 
-    // bool values in this object except check_for_nan_
+    // bool values in this object except check_for_nan_ and local_sparsity_
     has_been_optimized_        = false;
     //
     // size_t values in this object
@@ -314,6 +317,18 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
         play_.num_op_rec(),  // n_op
         play_.num_var_rec()  // n_var
     );
+
+    // free live_slot_
+    live_slot_.clear();
+
+    // free level_schedule_
+    level_schedule_.clear();
+
+    // free memo_table_ (memo_pure setting does not change)
+    memo_table_.clear();
+
+    // free cexp_select_
+    cexp_select_.clear();
     // ---------------------------------------------------------------------
     // End set ad_fun.hpp private member data
     // ---------------------------------------------------------------------
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_FOR_HES_SPARSITY_HPP
 # define CPPAD_CORE_FOR_HES_SPARSITY_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -48,6 +48,9 @@ $head x$$
 Note that the sparsity pattern $latex H(x)$$ corresponds to the
 operation sequence stored in $icode f$$ and does not depend on
 the argument $icode x$$.
+If $cref local_sparsity$$ is true for $icode f$$,
+the pattern only includes the $cref CondExp$$ branches that are
+selected at the point corresponding to the previous zero order forward.
 
 $head BoolVector$$
 The type $icode BoolVector$$ is a $cref SimpleVector$$ class with
@@ -187,6 +190,9 @@ void ADFun<Base,RecBase>::for_hes_sparsity(
     for(size_t j = 0; j < n; ++j)
         select_domain_pod_vector[j] = select_domain[j];
     //
+    // branch selection for conditional expressions (null unless local)
+    const local::pod_vector<unsigned char>* cexp_select = local_cexp_select();
+    //
     sparse_rc<SizeVector> pattern_tmp;
     if( internal_bool )
     {
@@ -205,7 +211,8 @@ void ADFun<Base,RecBase>::for_hes_sparsity(
             n,
             num_var_tape_,
             internal_rev_jac,
-            not_used_rec_base
+            not_used_rec_base,
+            cexp_select
         );
         // internal vector of sets that will hold Hessian
         local::sparse::pack_setvec internal_for_hes;
@@ -245,8 +252,8 @@ void ADFun<Base,RecBase>::for_hes_sparsity(
             n,
             num_var_tape_,
             internal_rev_jac,
-            not_used_rec_base
-
+            not_used_rec_base,
+            cexp_select
         );
         // internal vector of sets that will hold Hessian
         local::sparse::list_setvec internal_for_hes;
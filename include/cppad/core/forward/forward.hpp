@@ -16,6 +16,9 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/core/capacity_order.hpp>
 # include <cppad/core/num_skip.hpp>
 # include <cppad/core/check_for_nan.hpp>
+# include <cppad/core/forward_live.hpp>
+# include <cppad/core/forward_level.hpp>
+# include <cppad/core/memo_pure.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 
@@ -185,10 +188,12 @@ BaseVector ADFun<Base,RecBase>::Forward(
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
     if( q == 0 )
-    {
+    {   local::memo_table<Base>* memo = nullptr;
+        if( memo_table_.on() )
+            memo = &memo_table_;
         local::sweep::forward0(&play_, s, true,
             n, num_var_tape_, C,
-            taylor_.data(), cskip_op_.data(), load_op2var_,
+            taylor_.data(), nullptr, memo, cskip_op_.data(), load_op2var_,
             compare_change_count_,
             compare_change_number_,
             compare_change_op_index_,
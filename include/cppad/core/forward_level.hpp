@@ -0,0 +1,411 @@
+# ifndef CPPAD_CORE_FORWARD_LEVEL_HPP
+# define CPPAD_CORE_FORWARD_LEVEL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_level$$
+$spell
+    const
+    yq
+    xq
+    Taylor
+    VecAD
+    op
+    var
+    std
+$$
+
+$section Forward Mode Evaluating Dependency Levels in Parallel$$
+
+$head Syntax$$
+$icode%yq% = %f%.forward_level(%q%, %xq%, %run%, %min_width%)
+%$$
+$icode%n_level% = %f%.size_level()
+%$$
+$icode%f%.clear_level()
+%$$
+
+$head Purpose$$
+The $cref forward_order$$ routine computes the Taylor coefficients
+for one variable at a time.
+The $code forward_level$$ routine computes the same Taylor coefficients
+using the dependency levels for the operators in the operation sequence;
+see $cref var_level$$.
+All the operators in one level are split into tasks and the tasks
+are passed to a user defined runner which can execute them
+at the same time using multiple threads.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$.
+
+$head q$$
+This argument has prototype
+$codei%
+    size_t %q%
+%$$
+and is the highest order for this forward mode computation.
+
+$head xq$$
+The argument $icode xq$$ has prototype
+$codei%
+    const %BaseVector%& %xq%
+%$$
+Its size and value have the same meaning as for
+$cref/forward_order/forward_order/xq/$$; i.e.,
+its size is either $icode n$$ or $icode%n%*(%q%+1)%$$.
+
+$head yq$$
+The return value $icode yq$$ has prototype
+$codei%
+    %BaseVector% %yq%
+%$$
+Its size and value have the same meaning as for
+$cref/forward_order/forward_order/yq/$$.
+The Taylor coefficients for all the variables are stored in $icode f$$
+the same as for $code forward_order$$; i.e.,
+$cref Reverse$$ mode and higher order $cref Forward$$ mode can be used
+after this call.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head level_runner$$
+The $code CppAD::level_runner$$ class has the following definition:
+$srcthisfile%
+    0%// BEGIN_LEVEL_RUNNER%// END_LEVEL_RUNNER%1
+%$$
+
+$head run$$
+The argument $icode run$$ has prototype
+$codei%
+    level_runner& %run%
+%$$
+It is an object of a class, derived from $code level_runner$$,
+that defines the virtual function
+$codei%
+    void run(size_t %n_task%, const level_task& %task%)
+%$$
+This function must call $icode%task%(%k%)%$$,
+for $icode%k% = 0 , %...% , %n_task%-1%$$,
+and return when all of these calls have completed.
+The calls can be made in any order and at the same time in
+different threads.
+Each call only writes the results for a different set of operators,
+so the calls do not need to be synchronized with each other,
+but the $icode run$$ function must not return until the results of all the
+calls are visible to the calling thread
+(for example by joining, or waiting at a barrier for, the threads that
+executed the calls).
+The $icode run$$ function is called from the thread that called
+$code forward_level$$, once for each level that is split into more than
+one task.
+Dynamic load balancing, for example the threads taking the next
+unfinished $icode k$$ from a shared counter, is done by $icode run$$.
+
+$head min_width$$
+This argument has prototype
+$codei%
+    size_t %min_width%
+%$$
+It is the minimum number of operators in a task and must be greater
+than zero.
+The operators in each level are split into
+$icode%width%/%min_width%$$ tasks (rounded down)
+where $icode width$$ is the number of operators in the level.
+If this is one (or zero),
+the operators in the level are computed by the calling thread.
+
+$head Sequential Fallback$$
+The calculation is done by $cref forward_order$$ (and $icode run$$ is
+not used) in the following cases:
+
+$list number$$
+The average number of operators per level is less than $icode min_width$$;
+i.e., the operation sequence does not have enough parallelism.
+$lnext
+The operation sequence contains an operator that is not
+a function of its arguments only; i.e.,
+an $cref/atomic function/atomic/$$ call, a $cref discrete$$ function,
+a $cref VecAD$$ operation, a $cref PrintFor$$ operation, or a
+conditional skip generated by the $cref optimize$$ routine
+(see its $cref/no_conditional_skip/optimize/options/no_conditional_skip/$$
+option).
+$lnext
+The zero order Taylor coefficients are computed
+(the size of $icode xq$$ is $icode%n%*(%q%+1)%$$ or $icode q$$ is zero),
+the operation sequence contains comparison operators,
+and the $cref/count/compare_change/count/$$ for comparison changes
+is not zero.
+$lend
+Otherwise, when the zero order Taylor coefficients are computed,
+the comparison operators are not checked and the
+comparison change $cref/number/compare_change/number/$$ and
+$cref/op_index/compare_change/op_index/$$ are set to zero.
+
+$head n_level$$
+The return value $icode n_level$$ has prototype
+$codei%
+    size_t %n_level%
+%$$
+The first call to $code forward_level$$ (after the operation
+sequence in $icode f$$ is created or changed) computes a schedule
+that groups the operators by level.
+This schedule is stored in $icode f$$ and reused by subsequent calls.
+If the schedule has not been computed, or the operation sequence
+contains an operator that is not supported, $icode n_level$$ is zero.
+Otherwise, it is the number of levels and
+$codei%
+    %f%.size_var() / %n_level%
+%$$
+is the average parallelism for the operation sequence.
+
+$head clear_level$$
+This frees the memory corresponding to the schedule.
+The next call to $code forward_level$$ will compute it again.
+
+$children%
+    example/general/forward_level.cpp
+%$$
+$head Example$$
+The file $cref forward_level.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file forward_level.hpp
+Forward mode evaluating the operators in each level at the same time.
+*/
+
+// BEGIN_LEVEL_RUNNER
+class level_task {
+public:
+    virtual void operator()(size_t k) const = 0;
+    virtual ~level_task(void) { }
+};
+class level_runner {
+public:
+    virtual void run(size_t n_task, const level_task& task) = 0;
+    virtual ~level_runner(void) { }
+};
+// END_LEVEL_RUNNER
+
+/*!
+Compute forward mode Taylor coefficients by dependency level.
+
+\tparam Base
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type AD<Base>.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param q
+is the highest order for this forward mode computation.
+
+\param xq
+is the Taylor coefficients for the independent variables
+(see Forward(q, xq, s)).
+
+\param run
+is used to execute the tasks in each level.
+
+\param min_width
+is the minimum number of operators in a task.
+
+\return
+is the Taylor coefficients for the dependent variables
+(see Forward(q, xq, s)).
+
+\par level_schedule_
+If level_schedule_.set() is false, it is set using the current
+operation sequence.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::forward_level(
+    size_t              q         ,
+    const BaseVector&   xq        ,
+    level_runner&       run       ,
+    size_t              min_width )
+{   // number of independent and dependent variables
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+
+    // check Vector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        size_t(xq.size()) == n || size_t(xq.size()) == n*(q+1),
+        "forward_level(q, xq, run, min_width): "
+        "xq.size() is not equal n or n*(q+1)"
+    );
+    CPPAD_ASSERT_KNOWN(
+        min_width > 0,
+        "forward_level(q, xq, run, min_width): min_width is zero"
+    );
+
+    // p = lowest order we are computing
+    size_t p = q + 1 - size_t(xq.size()) / n;
+
+    // schedule
+    if( ! level_schedule_.set() )
+        level_schedule_.setup(&play_);
+    const local::level_schedule& schedule( level_schedule_ );
+
+    // sequential fallback
+    bool sequential = ! schedule.ok();
+    if( ! sequential )
+    {   sequential |= schedule.n_op() < min_width * schedule.n_level();
+        if( p == 0 && compare_change_count_ > 0 )
+            sequential |= schedule.has_compare();
+    }
+    if( sequential )
+        return Forward(q, xq);
+
+    // check one order case
+    CPPAD_ASSERT_KNOWN(
+        q <= num_order_taylor_ || p == 0,
+        "forward_level(q, xq, run, min_width): Number of Taylor coefficient"
+        " orders stored in this ADFun\nis less than q and xq.size() != n*(q+1)."
+    );
+
+    // does taylor_ need more orders or fewer directions
+    if( (cap_order_taylor_ <= q) | (num_direction_taylor_ != 1) )
+    {   if( p == 0 )
+        {   // no need to copy old values during capacity_order
+            num_order_taylor_ = 0;
+        }
+        else
+            num_order_taylor_ = q;
+        size_t c = std::max<size_t>(q + 1, cap_order_taylor_);
+        size_t r = 1;
+        capacity_order(c, r);
+    }
+    CPPAD_ASSERT_UNKNOWN( cap_order_taylor_ > q );
+    CPPAD_ASSERT_UNKNOWN( num_direction_taylor_ == 1 );
+
+    // short hand notation for order capacity
+    size_t C = cap_order_taylor_;
+
+    // Initilaizing the coefficients avoids valgrind warnings
+    // (the BeginOp variable is not computed).
+    for(size_t j = 0; j < num_var_tape_; j++)
+    {   for(size_t k = p; k <= q; k++)
+            taylor_[C * j + k] = CppAD::numeric_limits<Base>::quiet_NaN();
+    }
+
+    // set Taylor coefficients for independent variables
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+        if( p == q )
+            taylor_[ C * ind_taddr_[j] + q] = xq[j];
+        else
+        {   for(size_t k = 0; k <= q; k++)
+                taylor_[ C * ind_taddr_[j] + k] = xq[ (q+1)*j + k];
+        }
+    }
+
+    // comparison operators are not evaluated
+    if( p == 0 )
+    {   compare_change_number_   = 0;
+        compare_change_op_index_ = 0;
+    }
+
+    // arg_begin
+    local::OpCode op;
+    const addr_t* arg_begin;
+    size_t        i_var;
+    play_.begin().op_info(op, arg_begin, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == local::BeginOp );
+
+    // task_t
+    // computes the operators in one level
+    class task_t : public level_task {
+    public:
+        const local::level_schedule& schedule_;
+        size_t        p_, q_, J_, num_par_, start_, width_, n_task_;
+        const Base*   parameter_;
+        const addr_t* arg_begin_;
+        Base*         taylor_;
+        //
+        task_t(const local::level_schedule& schedule)
+        : schedule_(schedule)
+        { }
+        void operator()(size_t k) const override
+        {   CPPAD_ASSERT_UNKNOWN( k < n_task_ );
+            size_t begin = start_ + (k * width_) / n_task_;
+            size_t end   = start_ + ((k + 1) * width_) / n_task_;
+            for(size_t i = begin; i < end; ++i)
+            {   local::sweep::forward_level_op(
+                    p_, q_, schedule_.op(i), schedule_.var(i),
+                    arg_begin_ + schedule_.arg(i),
+                    num_par_, parameter_, J_, taylor_
+                );
+            }
+        }
+    };
+    task_t task(schedule);
+    task.p_         = p;
+    task.q_         = q;
+    task.J_         = C;
+    task.num_par_   = play_.num_par_rec();
+    task.parameter_ = play_.GetPar();
+    task.arg_begin_ = arg_begin;
+    task.taylor_    = taylor_.data();
+
+    // compute the levels in order
+    for(size_t ell = 0; ell < schedule.n_level(); ++ell)
+    {   task.start_  = schedule.level_start(ell);
+        task.width_  = schedule.level_start(ell + 1) - task.start_;
+        task.n_task_ = std::max<size_t>(task.width_ / min_width, 1);
+        if( task.n_task_ == 1 )
+            task(0);
+        else
+            run.run(task.n_task_, task);
+    }
+
+    // return Taylor coefficients for dependent variables
+    BaseVector yq;
+    if( p == q )
+    {   yq.resize(m);
+        for(size_t i = 0; i < m; i++)
+        {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_  );
+            yq[i] = taylor_[ C * dep_taddr_[i] + q];
+        }
+    }
+    else
+    {   yq.resize(m * (q+1) );
+        for(size_t i = 0; i < m; i++)
+        {   for(size_t k = 0; k <= q; k++)
+                yq[ (q+1) * i + k] = taylor_[ C * dep_taddr_[i] + k ];
+        }
+    }
+
+    // now we have q + 1  taylor_ coefficient orders per variable
+    num_order_taylor_ = q + 1;
+
+    return yq;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,255 @@
+# ifndef CPPAD_CORE_FORWARD_LIVE_HPP
+# define CPPAD_CORE_FORWARD_LIVE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_live$$
+$spell
+    const
+    var
+    taylor_
+    VecAD
+$$
+
+$section Zero Order Forward Mode Reusing Variable Memory$$
+
+$head Syntax$$
+$icode%y% = %f%.forward_live(%x%)
+%$$
+$icode%y% = %f%.forward_live(%x%, %s%)
+%$$
+$icode%n_slot% = %f%.size_live()
+%$$
+$icode%f%.clear_live()
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+The $cref forward_zero$$ routine stores the value of every variable
+in the operation sequence so that they can be used by subsequent
+$cref Forward$$ and $cref Reverse$$ mode calculations.
+The $code forward_live$$ routine computes $latex y = F(x)$$ using a
+liveness analysis of the operation sequence.
+The memory used to hold a variable's value is reused once the
+variable is no longer needed.
+For large operation sequences, where most variables are only used
+by the operations that directly follow them,
+this requires much less memory than $cref forward_zero$$.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$.
+
+$head x$$
+The argument $icode x$$ has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+(see $icode BaseVector$$ below)
+and its size must be equal to $icode n$$, the dimension of the
+$cref/domain/fun_property/Domain/$$ space for $icode f$$.
+It specifies the value of the independent variables.
+
+$head s$$
+This argument has prototype
+$codei%
+    std::ostream& %s%
+%$$
+It specifies where the output corresponding to $cref PrintFor$$
+will be written.
+If $icode s$$ is not present, $code std::cout$$ is used.
+
+$head y$$
+The result $icode y$$ has prototype
+$codei%
+    %BaseVector% %y%
+%$$
+and its size is equal to $icode m$$, the dimension of the
+$cref/range/fun_property/Range/$$ space for $icode f$$.
+It is the value $latex F(x)$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head n_slot$$
+The return value $icode n_slot$$ has prototype
+$codei%
+    size_t %n_slot%
+%$$
+It is the number of values of type $icode Base$$ that are used by
+$code forward_live$$ to hold the variables in the operation sequence.
+This should be compared with $icode%f%.size_var()%$$
+which is the number of values used by $cref forward_zero$$;
+see $cref/size_var/fun_property/size_var/$$.
+If $icode n_slot$$ is zero, the liveness analysis has not been done
+for the current operation sequence.
+
+$head Liveness Analysis$$
+The first call to $code forward_live$$ (after the operation
+sequence in $icode f$$ is created or changed) does a liveness
+analysis that maps each variable to a slot.
+This mapping is stored in $icode f$$ and reused by subsequent calls.
+A variable is live from the operation that creates it to the last
+operation that uses it.
+Dependent variables, independent variables, and variables that
+are stored in a $cref VecAD$$ vector are live for the entire
+operation sequence.
+The memory used for the mapping is proportional to the size of the
+operation sequence; see $cref/size_op_seq/fun_property/size_op_seq/$$.
+
+$head clear_live$$
+This frees the memory corresponding to the mapping from variables to slots.
+The next call to $code forward_live$$ will redo the liveness analysis.
+
+$head Taylor Coefficients$$
+The values of the variables are not retained by $code forward_live$$.
+After this call, there are no Taylor coefficients stored in $icode f$$; i.e.,
+$cref/f.size_order()/size_order/$$ is zero.
+It follows that $cref Reverse$$ mode and higher order $cref Forward$$
+mode can not be used until a zero order forward is done
+using $cref forward_zero$$.
+You can free the memory used to hold the Taylor coefficients using
+$codei%
+    %f%.capacity_order(0)
+%$$
+see $cref capacity_order$$.
+
+$head Comparison Changes$$
+The number of comparison changes,
+and the corresponding operator index,
+are computed by $code forward_live$$ the same way as by $cref forward_zero$$;
+see $cref compare_change$$.
+
+$children%
+    example/general/forward_live.cpp
+%$$
+$head Example$$
+The file $cref forward_live.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file forward_live.hpp
+Zero order forward mode using reusable variable slots.
+*/
+
+/*!
+Compute zero order forward mode values using reusable variable slots.
+
+\tparam Base
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type AD<Base>.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param x
+is the value of the independent variables.
+
+\param s
+is the stream where output corresponding to PriOp operations will written.
+
+\return
+is the value of the dependent variables.
+
+\par live_slot_
+If live_slot_.n_slot() is zero, it is set using the current
+operation sequence.
+
+\par num_order_taylor_
+is set to zero because the values in taylor_ no longer correspond to
+the values in cskip_op_.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::forward_live(
+    const BaseVector& x ,
+    std::ostream&     s )
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+
+    // number of independent and dependent variables
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+
+    // check Vector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "forward_live(x): x.size() is not equal to the domain dimension"
+    );
+
+    // mapping from variables to slots
+    if( live_slot_.n_slot() == 0 )
+        live_slot_.setup(&play_, dep_taddr_);
+    size_t n_slot = live_slot_.n_slot();
+    const local::pod_vector<addr_t>& op2slot( live_slot_.op2slot() );
+    const local::pod_vector<addr_t>& dep2slot( live_slot_.dep2slot() );
+
+    // The optimizer may skip a step that does not affect dependent variables.
+    // Initilaizing the slot values avoids following valgrind warning:
+    // "Conditional jump or move depends on uninitialised value(s)".
+    local::pod_vector_maybe<Base> slot_value(n_slot);
+    for(size_t i = 0; i < n_slot; ++i)
+        slot_value[i] = CppAD::numeric_limits<Base>::quiet_NaN();
+
+    // set values for independent variables
+    // (operator index equals variable index for independent variables)
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+        slot_value[ op2slot[ ind_taddr_[j] ] ] = x[j];
+    }
+
+    // load_op2slot: the slot version of load_op2var_
+    local::pod_vector<addr_t> load_op2slot( play_.num_var_load_rec() );
+
+    // compute the values of the variables
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
+    size_t J = 1;
+    local::memo_table<Base>* memo = nullptr;
+    if( memo_table_.on() )
+        memo = &memo_table_;
+    local::sweep::forward0(&play_, s, true,
+        n, n_slot, J,
+        slot_value.data(), &live_slot_, memo,
+        cskip_op_.data(), load_op2slot,
+        compare_change_count_,
+        compare_change_number_,
+        compare_change_op_index_,
+        not_used_rec_base
+    );
+
+    // values in taylor_ do not correspond to cskip_op_
+    num_order_taylor_ = 0;
+
+    // return values for dependent variables
+    BaseVector y(m);
+    for(size_t i = 0; i < m; i++)
+        y[i] = slot_value[ dep2slot[i] ];
+    //
+    return y;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
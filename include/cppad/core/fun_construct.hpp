@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_FUN_CONSTRUCT_HPP
 # define CPPAD_CORE_FUN_CONSTRUCT_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -40,6 +40,8 @@ $icode%f%.swap(%g%)
 %$$
 $icode%f% = %g
 %$$
+$icode%g%.share_recording(%f%)
+%$$
 
 $head Purpose$$
 The $codei%ADFun<%Base%>%$$ object $icode f$$
@@ -188,6 +190,37 @@ $codei%
     %g%.size_forward_set()  == %f%.size_forward_set()
 %$$
 
+$head share_recording$$
+The operation
+$codei%
+    %g%.share_recording(%f%)
+%$$
+is the same as the assignment $icode%g% = %f%$$ except that:
+$list number$$
+The memory for the operation sequence in $icode f$$
+is shared (not copied).
+$lnext
+The Taylor coefficients and sparsity patterns in $icode f$$ are not copied;
+i.e., directly after this operation
+$codei%
+    %g%.size_order() == 0
+    %g%.size_forward_bool() == 0
+    %g%.size_forward_set()  == 0
+%$$
+$lend
+This makes $icode g$$ a light weight evaluation context for the
+operation sequence in $icode f$$.
+For example, each thread can use its own $icode g$$ to
+compute $cref Forward$$, $cref Reverse$$,
+$cref sparse_jac$$, and $cref sparse_hes$$ values at the same time.
+The object $icode f$$ must not be deleted, and its operation sequence
+must not be changed (e.g., by $codei%f%.optimize()%$$),
+while another object is sharing it.
+The object $icode f$$ can still be used by one thread at a time.
+If the operation sequence in $icode g$$ is changed
+(e.g., by $icode%g%.optimize()%$$ or $icode%g% = %h%$$),
+$icode g$$ stops sharing the memory in $icode f$$.
+
 $head Parallel Mode$$
 The call to $code Independent$$,
 and the corresponding call to
@@ -218,7 +251,8 @@ contain an examples and tests using the default constructor.
 They return true if they succeed and false otherwise.
 
 $children%
-    example/general/fun_assign.cpp
+    example/general/fun_assign.cpp%
+    example/general/share_recording.cpp
 %$$
 $subhead Assignment Operator$$
 The file
@@ -226,6 +260,11 @@ $cref fun_assign.cpp$$
 contains an example and test of the $codei%ADFun<%Base%>%$$
 assignment operator.
 
+$subhead share_recording$$
+The file
+$cref share_recording.cpp$$
+contains an example and test of $code share_recording$$.
+
 $end
 ----------------------------------------------------------------------------
 */
@@ -257,7 +296,9 @@ ADFun<Base,RecBase>::ADFun(void) :
 function_name_(""),
 exceed_collision_limit_(false),
 has_been_optimized_(false),
+optimize_stat_(),
 check_for_nan_(true) ,
+local_sparsity_(false) ,
 compare_change_count_(0),
 compare_change_number_(0),
 compare_change_op_index_(0),
@@ -276,7 +317,9 @@ ADFun<Base,RecBase>::ADFun(ADFun&& f)
 // destructor
 template <class Base, class RecBase>
 ADFun<Base,RecBase>::~ADFun(void)
-{ }
+{   // wait for asynchronous requests that use this object
+    async_pool_.clear();
+}
 /*!
 ADFun assignment operator
 
@@ -298,7 +341,27 @@ ADFun object containing the operation sequence to be copied.
 */
 template <class Base, class RecBase>
 void ADFun<Base,RecBase>::operator=(const ADFun& f)
-{
+{   assign(f, false); }
+/*!
+Implementation of ADFun assignment
+
+\tparam Base
+is the base for the recording that can be stored in this ADFun object;
+i.e., operation sequences that were recorded using the type AD<Base>.
+
+\param f
+ADFun object containing the operation sequence to be copied.
+
+\param share_play
+If true (false) the operation sequence in f is shared (copied);
+see share_recording.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::assign(const ADFun& f, bool share_play)
+{   // wait for asynchronous requests that use the current operation sequence
+    // (the pool of threads is not copied)
+    async_pool_.clear();
+    //
     // go through member variables in ad_fun.hpp order
     //
     // string objects
@@ -308,14 +371,15 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     exceed_collision_limit_    = f.exceed_collision_limit_;
     has_been_optimized_        = f.has_been_optimized_;
     check_for_nan_             = f.check_for_nan_;
+    local_sparsity_            = f.local_sparsity_;
+    //
+    // optimize_stat_t objects
+    optimize_stat_             = f.optimize_stat_;
     //
     // size_t objects
     compare_change_count_      = f.compare_change_count_;
     compare_change_number_     = f.compare_change_number_;
     compare_change_op_index_   = f.compare_change_op_index_;
-    num_order_taylor_          = f.num_order_taylor_;
-    cap_order_taylor_          = f.cap_order_taylor_;
-    num_direction_taylor_      = f.num_direction_taylor_;
     num_var_tape_              = f.num_var_tape_;
     //
     // pod_vector objects
@@ -323,28 +387,89 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     dep_taddr_                 = f.dep_taddr_;
     dep_parameter_             = f.dep_parameter_;
     cskip_op_                  = f.cskip_op_;
+    cexp_select_               = f.cexp_select_;
     load_op2var_               = f.load_op2var_;
     //
-    // pod_vector_maybe_vectors
-    taylor_                    = f.taylor_;
-    subgraph_partial_          = f.subgraph_partial_;
-    //
     // player
-    play_                      = f.play_;
+    if( share_play )
+        play_.share( f.play_ );
+    else
+        play_                  = f.play_;
     //
     // subgraph
     subgraph_info_             = f.subgraph_info_;
     //
+    // live_slot
+    live_slot_                 = f.live_slot_;
+    level_schedule_            = f.level_schedule_;
+    //
+    // memo_table
+    memo_table_                = f.memo_table_;
+    //
+    if( share_play )
+    {   // Taylor coefficients and sparsity patterns are not copied
+        taylor_.clear();
+        subgraph_partial_.clear();
+        num_order_taylor_      = 0;
+        cap_order_taylor_      = 0;
+        num_direction_taylor_  = 0;
+        for_jac_sparse_pack_.resize(0, 0);
+        for_jac_sparse_set_.resize(0, 0);
+        return;
+    }
+    //
+    // size_t objects
+    num_order_taylor_          = f.num_order_taylor_;
+    cap_order_taylor_          = f.cap_order_taylor_;
+    num_direction_taylor_      = f.num_direction_taylor_;
+    //
+    // pod_vector_maybe_vectors
+    taylor_                    = f.taylor_;
+    subgraph_partial_          = f.subgraph_partial_;
+    //
     // sparse_pack
     for_jac_sparse_pack_       = f.for_jac_sparse_pack_;
     //
     // sparse_list
     for_jac_sparse_set_        = f.for_jac_sparse_set_;
 }
+/*!
+ADFun assignment that shares the operation sequence
+
+The C++ syntax for this operation is
+\verbatim
+    g.share_recording(f)
+\endverbatim
+where g and f are ADFun<Base> ADFun objects.
+This is the same as the assignment g = f except that the memory
+for the operation sequence in f is shared (not copied)
+and the Taylor coefficients and forward Jacobian sparsity patterns in f
+are not copied.
+This is used so that each thread can have its own Taylor coefficients
+without its own copy of the operation sequence.
+
+\tparam Base
+is the base for the recording that can be stored in this ADFun object;
+i.e., operation sequences that were recorded using the type AD<Base>.
+
+\param f
+ADFun object containing the operation sequence to be shared.
+The object f must not be deleted, or its operation sequence changed
+(for example by f.optimize()), while this ADFun object is using it.
+If the operation sequence in this ADFun object is changed,
+it stops sharing the memory in f.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::share_recording(const ADFun& f)
+{   assign(f, true); }
 /// swap
 template <class Base, class RecBase>
 void ADFun<Base,RecBase>::swap(ADFun& f)
-{
+{   // wait for asynchronous requests for both objects
+    // (the pools of threads are not swapped)
+    async_pool_.clear();
+    f.async_pool_.clear();
+    //
     // string objects
     function_name_.swap( f.function_name_ );
     //
@@ -352,6 +477,10 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     std::swap( exceed_collision_limit_    , f.exceed_collision_limit_);
     std::swap( has_been_optimized_        , f.has_been_optimized_);
     std::swap( check_for_nan_             , f.check_for_nan_);
+    std::swap( local_sparsity_            , f.local_sparsity_);
+    //
+    // optimize_stat_t objects
+    std::swap( optimize_stat_             , f.optimize_stat_);
     //
     // size_t objects
     std::swap( compare_change_count_      , f.compare_change_count_);
@@ -368,6 +497,7 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     dep_parameter_.swap(  f.dep_parameter_);
     taylor_.swap(         f.taylor_);
     cskip_op_.swap(       f.cskip_op_);
+    cexp_select_.swap(    f.cexp_select_);
     load_op2var_.swap(    f.load_op2var_);
     //
     // player
@@ -376,6 +506,13 @@ void ADFun<Base,RecBase>::swap(ADFun& f)
     // subgraph_info
     subgraph_info_.swap(f.subgraph_info_);
     //
+    // live_slot
+    live_slot_.swap(f.live_slot_);
+    level_schedule_.swap(f.level_schedule_);
+    //
+    // memo_table
+    memo_table_.swap(f.memo_table_);
+    //
     // sparse_pack
     for_jac_sparse_pack_.swap( f.for_jac_sparse_pack_);
     //
@@ -469,9 +606,11 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
 
     // This function has not yet been optimized
     exceed_collision_limit_    = false;
+    optimize_stat_             = optimize_stat_t();
 
     // ad_fun.hpp member values not set by dependent
     check_for_nan_       = true;
+    local_sparsity_      = false;
 
     // allocate memory for one zero order taylor_ coefficient
     CPPAD_ASSERT_UNKNOWN( num_order_taylor_ == 0 );
@@ -493,9 +632,10 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
     // use independent variable values to fill in values for others
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
+    local::memo_table<Base>* memo = nullptr;
     local::sweep::forward0(&play_, std::cout, false,
-        n, num_var_tape_, cap_order_taylor_, taylor_.data(),
-        cskip_op_.data(), load_op2var_,
+        n, num_var_tape_, cap_order_taylor_, taylor_.data(), nullptr,
+        memo, cskip_op_.data(), load_op2var_,
         compare_change_count_,
         compare_change_number_,
         compare_change_op_index_,
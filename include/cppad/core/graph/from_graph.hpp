@@ -120,6 +120,9 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
 {   using CppAD::isnan;
     using namespace CppAD::graph;
     //
+    // wait for asynchronous requests that use the current operation sequence
+    async_pool_.clear();
+    //
     // some sizes
     const std::string function_name  = graph_obj.function_name_get();
     const size_t n_dynamic_ind       = graph_obj.n_dynamic_ind_get();
@@ -1498,7 +1501,7 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
     // dep__parameter_ and dep_taddr_
     // ----------------------------------------------------------------------
     //
-    // bool values in this object except check_for_nan_
+    // bool values in this object except check_for_nan_ and local_sparsity_
     has_been_optimized_        = false;
     //
     // size_t values in this object
@@ -1546,6 +1549,18 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
         play_.num_var_rec()  // n_var
     );
     //
+    // free live_slot_
+    live_slot_.clear();
+    //
+    // free level_schedule_
+    level_schedule_.clear();
+    //
+    // free memo_table_ (memo_pure setting does not change)
+    memo_table_.clear();
+    //
+    // free cexp_select_
+    cexp_select_.clear();
+    //
     // set the function name
     function_name_ = function_name;
     //
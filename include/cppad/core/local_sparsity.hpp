@@ -0,0 +1,238 @@
+# ifndef CPPAD_CORE_LOCAL_SPARSITY_HPP
+# define CPPAD_CORE_LOCAL_SPARSITY_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin local_sparsity$$
+$spell
+    const
+    bool
+    jac
+    hes
+    Taylor
+$$
+$section Sparsity Patterns That are Local to the Current Point$$
+
+$head Syntax$$
+$icode%f%.local_sparsity(%b%)
+%$$
+$icode%b% = %f%.local_sparsity()
+%$$
+$icode%valid% = %f%.local_sparsity_valid()
+%$$
+
+$head Purpose$$
+The sparsity patterns computed by
+$cref for_jac_sparsity$$,
+$cref rev_jac_sparsity$$,
+$cref for_hes_sparsity$$, and
+$cref rev_hes_sparsity$$
+are usually valid for all values of the independent variables.
+For each $cref CondExp$$ in the operation sequence,
+they include both the $icode if_true$$ and $icode if_false$$ branches.
+If local sparsity is on, these routines only include the branch that
+is selected at the current point; i.e., the value of the independent
+variables and dynamic parameters in the previous zero order
+$cref forward$$ calculation.
+Operations that are only used by branches that are not selected
+(the operations that are skipped by zero order forward after an
+$cref optimize$$) do not affect the local patterns.
+This can greatly reduce the number of colors required to compute
+sparse derivatives; see $cref sparse_jac$$ and $cref sparse_hes$$.
+
+$head f$$
+For the syntax where $icode b$$ is an argument,
+$icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+For the other syntax $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head b$$
+This argument or result has prototype
+$codei%
+    bool %b%
+%$$
+If $icode b$$ is true (false),
+future sparsity pattern calculations for $icode f$$ are (are not)
+local to the current point.
+If it is true, $icode%f%.size_order()%$$ must be greater than zero
+when the sparsity patterns are computed.
+
+$head Default$$
+The value for this setting after construction of $icode f$$ is false.
+The value of this setting is not affected by calling
+$cref Dependent$$ for this function object.
+
+$head valid$$
+The result $icode valid$$ has prototype
+$codei%
+    bool %valid%
+%$$
+It is true if the previous local sparsity pattern calculation
+used the same branch for every conditional expression as is selected
+by the current zero order Taylor coefficients.
+In this case, the previous local sparsity patterns are still valid.
+If $icode b$$ is false, $icode valid$$ is always true.
+This check does not require any sparsity calculations;
+its cost is proportional to the number of operations
+in the operation sequence.
+
+$head rev_hes_sparsity$$
+The $cref rev_hes_sparsity$$ calculation uses the forward Jacobian
+sparsity pattern from the previous $cref for_jac_sparsity$$ calculation.
+Both of these calculations should be done with the same
+local sparsity setting and at the same point.
+
+$head Example$$
+$children%
+    example/sparse/local_sparsity.cpp
+%$$
+The file
+$cref local_sparsity.cpp$$
+contains an example and test of these operations.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file local_sparsity.hpp
+Sparsity patterns that are local to the current point.
+*/
+
+/*!
+Set local_sparsity
+
+\param value
+new value for this flag.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::local_sparsity(bool value)
+{   local_sparsity_ = value;
+    cexp_select_.clear();
+}
+
+/*!
+Get local_sparsity
+
+\return
+current value of local_sparsity_.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::local_sparsity(void) const
+{   return local_sparsity_; }
+
+/*!
+Compute the conditional expression branch selection at the current point.
+
+\param select [out]
+The input size and values do not matter.
+Upon return, its size is the number of operators in the recording.
+If the operator with index i_op is a CExpOp that is not skipped,
+select[i_op] is one (two) if the comparison is true (false) at the
+point corresponding to the zero order Taylor coefficients.
+Otherwise, select[i_op] is zero.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::cexp_select(
+    local::pod_vector<unsigned char>& select ) const
+{   CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ > 0,
+        "local_sparsity: f.size_order() is zero; i.e., "
+        "there is no current point for the local sparsity patterns."
+    );
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
+    //
+    // stride between zero order Taylor coefficients for each variable
+    size_t C = (cap_order_taylor_ - 1) * num_direction_taylor_ + 1;
+    //
+    // parameter vector
+    const Base* parameter = play_.GetPar();
+    //
+    select.resize( play_.num_op_rec() );
+    //
+    local::play::const_sequential_iterator itr = play_.begin();
+    local::OpCode op;
+    const addr_t* arg;
+    size_t        i_var;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == local::BeginOp );
+    select[0] = 0;
+    while( op != local::EndOp )
+    {   (++itr).op_info(op, arg, i_var);
+        size_t i_op  = itr.op_index();
+        select[i_op] = 0;
+        if( op == local::CExpOp && ! cskip_op_[i_op] )
+        {   Base left, right;
+            if( arg[1] & 1 )
+                left = taylor_[ size_t(arg[2]) * C ];
+            else
+                left = parameter[ arg[2] ];
+            if( arg[1] & 2 )
+                right = taylor_[ size_t(arg[3]) * C ];
+            else
+                right = parameter[ arg[3] ];
+            Base one(1.0), zero(0.0);
+            Base flag = CondExpOp( CompareOp(arg[0]), left, right, one, zero);
+            select[i_op] = IdenticalZero(flag) ? 2 : 1;
+        }
+    }
+    return;
+}
+
+/*!
+Branch selection used by the sparsity pattern calculations.
+
+\return
+If local_sparsity_ is false, the return value is null.
+Otherwise, cexp_select_ is set to the branch selection at the current
+point and its address is returned.
+*/
+template <class Base, class RecBase>
+const local::pod_vector<unsigned char>*
+ADFun<Base,RecBase>::local_cexp_select(void)
+{   if( ! local_sparsity_ )
+        return nullptr;
+    cexp_select(cexp_select_);
+    return &cexp_select_;
+}
+
+/*!
+Check if the previous local sparsity patterns are valid at current point.
+
+\return
+If local_sparsity_ is false, the return value is true.
+Otherwise, it is true if cexp_select_ is the same as the
+branch selection at the current point.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::local_sparsity_valid(void) const
+{   if( ! local_sparsity_ )
+        return true;
+    if( cexp_select_.size() == 0 )
+        return false;
+    local::pod_vector<unsigned char> select;
+    cexp_select(select);
+    CPPAD_ASSERT_UNKNOWN( select.size() == cexp_select_.size() );
+    for(size_t i_op = 0; i_op < select.size(); ++i_op)
+    {   if( select[i_op] != cexp_select_[i_op] )
+            return false;
+    }
+    return true;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,179 @@
+# ifndef CPPAD_CORE_MEMO_PURE_HPP
+# define CPPAD_CORE_MEMO_PURE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin memo_pure$$
+$spell
+    bool
+    const
+    memo
+    memoization
+    Taylor
+$$
+$section Memoize Discrete and Atomic Function Values$$
+
+$head Syntax$$
+$icode%f%.memo_pure(%b%)
+%$$
+$icode%b% = %f%.memo_pure()
+%$$
+$icode%n_hit% = %f%.memo_pure_hit()
+%$$
+$icode%n_miss% = %f%.memo_pure_miss()
+%$$
+
+$head Purpose$$
+Each call to a $cref/discrete/Discrete/$$ or
+$cref/atomic/atomic_four/$$ function in the operation sequence
+for $icode f$$ is a call site.
+If memoization is on, the zero order forward mode calculations
+remember the argument and result values for each call site.
+If the arguments for a call site are the same as for the previous
+zero order forward calculation, the results are copied from this memo
+instead of calling the function.
+This can save a lot of time when the discrete or atomic functions are
+expensive to evaluate and only some of the independent variables
+change between calls to $icode%f%.Forward(0, %x%)%$$.
+
+$head Pure Functions$$
+If memoization is on,
+all the discrete and atomic functions in $icode f$$ must be pure; i.e.,
+their values must only depend on their arguments.
+For example, if an atomic function has member data that affects its
+values, and that data changes, memoization should be turned off and
+back on to forget the previous values.
+
+$head f$$
+For the syntax where $icode b$$ is an argument,
+$icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+(see $codei%ADFun<%Base%>%$$ $cref/constructor/FunConstruct/$$).
+For the other syntaxes,
+$icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head b$$
+This argument or result has prototype
+$codei%
+    bool %b%
+%$$
+If $icode b$$ is true (false),
+future zero order forward calculations will (will not) use
+memoization.
+Setting this value forgets all the previous argument and result values
+and sets the hit and miss counts to zero.
+
+$subhead Default$$
+The value for this setting after construction of $icode f$$ is false.
+The value of this setting is not affected by calling
+$cref Dependent$$ or $cref optimize$$ for this function object,
+but the previous argument and result values, and the counts,
+are forgotten.
+
+$subhead base2ad$$
+Memoization is not available for functions created by
+$cref base2ad$$.
+
+$head n_hit$$
+This return value has prototype
+$codei%
+    size_t %n_hit%
+%$$
+It is the number of call sites, during zero order forward calculations,
+where the results were copied from the memo.
+
+$head n_miss$$
+This return value has prototype
+$codei%
+    size_t %n_miss%
+%$$
+It is the number of call sites, during zero order forward calculations,
+where the discrete or atomic function was evaluated.
+
+$head Zero Order Forward$$
+Memoization is used by
+$cref/Forward(0, x)/forward_zero/$$ and by $cref forward_live$$.
+It is not used when zero order is computed together with higher orders;
+e.g., by $codei%Forward(%q%, %xq%)%$$ with $icode%q% > 0%$$.
+It is not used by $cref new_dynamic$$ to compute
+discrete and atomic functions of the dynamic parameters.
+
+$head Atomic Functions$$
+Only the zero order forward $cref/forward/atomic_four_forward/$$
+callback is memoized.
+Consecutive calls to the same $code atomic_four$$ function are
+not combined into one
+$cref/forward_batch/atomic_four_forward_batch/$$ call when memoization is on.
+
+$head Example$$
+$children%
+    example/general/memo_pure.cpp
+%$$
+The file
+$cref memo_pure.cpp$$
+contains an example and test of these operations.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file memo_pure.hpp
+Memoization of discrete and atomic function values.
+*/
+
+/*!
+Set memo_pure
+
+\param value
+new value for this flag.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::memo_pure(bool value)
+{   CPPAD_ASSERT_KNOWN( ( ! value ) || ( std::is_same<Base, RecBase>::value ),
+        "memo_pure: not available for a function created by base2ad"
+    );
+    memo_table_.on(value);
+}
+
+/*!
+Get memo_pure
+
+\return
+is memoization turned on.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::memo_pure(void) const
+{   return memo_table_.on(); }
+
+/*!
+Number of call sites that used the memo.
+*/
+template <class Base, class RecBase>
+size_t ADFun<Base,RecBase>::memo_pure_hit(void) const
+{   return memo_table_.n_hit(); }
+
+/*!
+Number of call sites that evaluated their function.
+*/
+template <class Base, class RecBase>
+size_t ADFun<Base,RecBase>::memo_pure_miss(void) const
+{   return memo_table_.n_miss(); }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -109,6 +109,10 @@ void ADFun<Base,RecBase>::new_dynamic(const BaseVector& dynamic)
     // check BaseVector is Simple Vector class with Base elements
     CheckSimpleVector<Base, BaseVector>();
 
+    // wait for asynchronous requests that use the current parameters
+    // (the pool threads copied them when they started)
+    async_pool_.clear();
+
     // retrieve player information about the dynamic parameters
     local::pod_vector_maybe<Base>&     all_par_vec( play_.all_par_vec() );
     const pod_vector<bool>&            dyn_par_is ( play_.dyn_par_is()  );
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_OPTIMIZE_HPP
 # define CPPAD_CORE_OPTIMIZE_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -40,6 +40,8 @@ $icode%f%.optimize(%options%)
 %$$
 $icode%flag% = %f%.exceed_collision_limit()
 %$$
+$icode%stat% = %f%.optimize_stat()
+%$$
 
 $head Purpose$$
 The operation sequence corresponding to an $cref ADFun$$ object can
@@ -105,6 +107,8 @@ are removed and a new lists of expressions with that has code is started.
 The larger $icode value$$, the more identical expressions the optimizer
 can recognize, but the slower the optimizer may run.
 The default for $icode value$$ is $code 10$$.
+The number of hash codes grows with the size of the operation sequence,
+so this limit is rarely reached; see $cref optimize_stat$$.
 
 $head Re-Optimize$$
 Before 2019-06-28, optimizing twice was not supported and would fail
@@ -181,10 +185,15 @@ If the return value $icode flag$$ is true (false),
 the previous call to $icode%f%.optimize%$$ exceed the
 $cref/collision_limit/optimize/options/collision_limit=value/$$.
 
+$head optimize_stat$$
+The hash table statistics, and time, for the previous call to
+$icode%f%.optimize%$$ are returned by $cref optimize_stat$$.
+
 $head Examples$$
 $comment childtable without Example instead of Contents for header$$
 $children%
-    example/optimize/optimize_twice.cpp
+    include/cppad/core/optimize_stat.hpp
+    %example/optimize/optimize_twice.cpp
     %example/optimize/forward_active.cpp
     %example/optimize/reverse_active.cpp
     %example/optimize/compare_op.cpp
@@ -207,6 +216,7 @@ $tend
 $end
 -----------------------------------------------------------------------------
 */
+# include <chrono>
 # include <cppad/local/optimize/optimize_run.hpp>
 /*!
 \file optimize.hpp
@@ -240,12 +250,17 @@ when compare_change is not used.
 */
 template <class Base, class RecBase>
 void ADFun<Base,RecBase>::optimize(const std::string& options)
-{
+{   // start time for optimize_stat_.seconds
+    std::chrono::steady_clock::time_point start_time =
+        std::chrono::steady_clock::now();
 # if CPPAD_CORE_OPTIMIZE_PRINT_RESULT
     // size of operation sequence before optimizatiton
     size_t size_op_before = size_op();
 # endif
 
+    // wait for asynchronous requests that use the current operation sequence
+    async_pool_.clear();
+
     // place to store the optimized version of the recording
     local::recorder<Base> rec;
 
@@ -284,19 +299,19 @@ void ADFun<Base,RecBase>::optimize(const std::string& options)
     {
         case local::play::unsigned_short_enum:
         exceed = local::optimize::optimize_run<unsigned short>(
-            options, n, dep_taddr_, &play_, &rec
+            options, n, dep_taddr_, &play_, &rec, optimize_stat_
         );
         break;
 
         case local::play::unsigned_int_enum:
         exceed = local::optimize::optimize_run<unsigned int>(
-            options, n, dep_taddr_, &play_, &rec
+            options, n, dep_taddr_, &play_, &rec, optimize_stat_
         );
         break;
 
         case local::play::size_t_enum:
         exceed = local::optimize::optimize_run<size_t>(
-            options, n, dep_taddr_, &play_, &rec
+            options, n, dep_taddr_, &play_, &rec, optimize_stat_
         );
         break;
 
@@ -336,6 +351,23 @@ void ADFun<Base,RecBase>::optimize(const std::string& options)
         play_.num_var_rec()   // n_var
     );
 
+    // free live_slot_
+    live_slot_.clear();
+
+    // free level_schedule_
+    level_schedule_.clear();
+
+    // free memo_table_ (memo_pure setting does not change)
+    memo_table_.clear();
+
+    // free cexp_select_
+    cexp_select_.clear();
+
+    // time used by this optimization (not counting the debugging check below)
+    std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now() - start_time;
+    optimize_stat_.seconds = elapsed.count();
+
 # ifndef NDEBUG
     if( check_zero_order )
     {   std::stringstream s;
@@ -360,6 +392,7 @@ void ADFun<Base,RecBase>::optimize(const std::string& options)
         // Erase memory that this calculation was done so NDEBUG gives
         // same final state for this object (from users perspective)
         num_order_taylor_     = 0;
+        memo_table_.clear();
     }
 # endif
 # if CPPAD_CORE_OPTIMIZE_PRINT_RESULT
@@ -0,0 +1,126 @@
+# ifndef CPPAD_CORE_OPTIMIZE_STAT_HPP
+# define CPPAD_CORE_OPTIMIZE_STAT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin optimize_stat$$
+$spell
+    const
+    struct
+    stat
+    optimizer
+$$
+
+$section Optimizer Hash Table Statistics$$
+
+$head Syntax$$
+$icode%stat% = %f%.optimize_stat()
+%$$
+
+$head Purpose$$
+The optimizer uses a hash table to find operators that are equivalent
+to a previous operator in the operation sequence
+(common sub-expression elimination).
+This routine returns statistics for the previous call to
+$icode%f%.optimize%$$ that can be used to judge the quality of the hashing
+and to choose a value for the
+$cref/collision_limit/optimize/options/collision_limit=value/$$ option.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head stat$$
+The return value $icode stat$$ has prototype
+$codei%
+    const optimize_stat_t& %stat%
+%$$
+If $icode f$$ has not been optimized, all the fields in $icode stat$$
+are zero.
+The type $code optimize_stat_t$$ is defined by
+$srcthisfile%0%// BEGIN_OPTIMIZE_STAT_T%// END_OPTIMIZE_STAT_T%1%$$
+
+$subhead n_hash_code$$
+is the number of hash codes in the table; i.e., the number of buckets.
+This is a power of two that grows with the number of operators
+in the operation sequence.
+
+$subhead n_lookup$$
+is the number of operators that were looked up in the hash table.
+
+$subhead n_match$$
+is the number of operators that were found to be equivalent
+to a previous operator (and hence removed from the operation sequence).
+
+$subhead n_collision$$
+is the number of times an operator was compared with a previous
+operator that had the same hash code but was not equivalent.
+
+$subhead max_collision$$
+is the maximum number of collisions for one lookup.
+This is less than or equal to the collision limit.
+
+$subhead n_limit$$
+is the number of times the collision limit was reached;
+i.e., the list of operators with a hash code was restarted.
+The flag $icode%f%.exceed_collision_limit()%$$ is true if and only if
+$icode n_limit$$ is non-zero.
+Each restart can lose some common sub-expressions.
+
+$subhead seconds$$
+is the elapsed wall clock time, in seconds,
+used by the previous call to $icode%f%.optimize%$$.
+
+$children%
+    example/optimize/optimize_stat.cpp
+%$$
+$head Example$$
+The file $cref optimize_stat.cpp$$ contains an example and test of this
+operation.
+
+$end
+*/
+# include <cstddef>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file optimize_stat.hpp
+Hash table statistics for the previous optimization of an ADFun object.
+*/
+
+// BEGIN_OPTIMIZE_STAT_T
+struct optimize_stat_t {
+    size_t n_hash_code;
+    size_t n_lookup;
+    size_t n_match;
+    size_t n_collision;
+    size_t max_collision;
+    size_t n_limit;
+    double seconds;
+    // END_OPTIMIZE_STAT_T
+    //
+    /// default constructor (all fields are zero)
+    optimize_stat_t(void)
+    : n_hash_code(0)
+    , n_lookup(0)
+    , n_match(0)
+    , n_collision(0)
+    , max_collision(0)
+    , n_limit(0)
+    , seconds(0.0)
+    { }
+};
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,90 @@
+# ifndef CPPAD_CORE_RECORD_RESERVE_HPP
+# define CPPAD_CORE_RECORD_RESERVE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin record_reserve$$
+$spell
+    op
+    arg
+    par
+$$
+
+$section Reserve Memory for the Current Recording$$
+
+$head Syntax$$
+$codei%AD<%Base%>::record_reserve(%n_op%, %n_arg%, %n_par%)%$$
+
+$head Purpose$$
+Sometimes the size of an operation sequence is known,
+or can be approximated, before it is recorded; e.g.,
+from the recording for a previous time step.
+This routine allocates the memory for the recording that started
+with the most recent call to $cref Independent$$ by this thread.
+This avoids growing the corresponding vectors while operations are recorded.
+If there is no such recording in progress,
+$code record_reserve$$ has no effect.
+
+$head n_op$$
+This argument has prototype
+$codei%
+    size_t %n_op%
+%$$
+It is the total number of operators expected in the recording; see
+$cref/size_op/fun_property/size_op/$$.
+
+$head n_arg$$
+This argument has prototype
+$codei%
+    size_t %n_arg%
+%$$
+It is the total number of operator arguments expected in the recording; see
+$cref/size_op_arg/fun_property/size_op_arg/$$.
+
+$head n_par$$
+This argument has prototype
+$codei%
+    size_t %n_par%
+%$$
+It is the total number of parameters expected in the recording; see
+$cref/size_par/fun_property/size_par/$$.
+
+$head Operation Sequence$$
+This routine does not change the operation sequence being recorded.
+If the actual sizes are larger than the reserved sizes,
+the vectors grow in the usual way.
+If they are smaller, some of the extra memory may remain allocated
+until the corresponding $code ADFun$$ object is deleted.
+
+$children%
+    example/general/record_reserve.cpp
+%$$
+$head Example$$
+The file
+$cref record_reserve.cpp$$
+contains an example and test of this operation.
+
+$end
+----------------------------------------------------------------------------
+*/
+
+
+namespace CppAD {
+    template <class Base>
+    void AD<Base>::record_reserve(size_t n_op, size_t n_arg, size_t n_par)
+    {   local::ADTape<Base>* tape = AD<Base>::tape_ptr();
+        if( tape != nullptr )
+            tape->Rec_.reserve(n_op, n_arg, n_par);
+    }
+}
+
+# endif
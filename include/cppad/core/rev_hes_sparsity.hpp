@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_REV_HES_SPARSITY_HPP
 # define CPPAD_CORE_REV_HES_SPARSITY_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -48,6 +48,9 @@ $head x$$
 Note that the sparsity pattern $latex H(x)$$ corresponds to the
 operation sequence stored in $icode f$$ and does not depend on
 the argument $icode x$$.
+If $cref local_sparsity$$ is true for $icode f$$,
+the pattern only includes the $cref CondExp$$ branches that are
+selected at the point corresponding to the previous zero order forward.
 
 $head BoolVector$$
 The type $icode BoolVector$$ is a $cref SimpleVector$$ class with
@@ -188,6 +191,8 @@ void ADFun<Base,RecBase>::rev_hes_sparsity(
     for(size_t i = 0; i < m; i++)
         rev_jac_pattern[ dep_taddr_[i] ] = select_range[i];
     //
+    // branch selection for conditional expressions (null unless local)
+    const local::pod_vector<unsigned char>* cexp_select = local_cexp_select();
     //
     if( internal_bool )
     {   CPPAD_ASSERT_KNOWN(
@@ -211,7 +216,8 @@ void ADFun<Base,RecBase>::rev_hes_sparsity(
             for_jac_sparse_pack_,
             rev_jac_pattern.data(),
             internal_hes,
-            not_used_rec_base
+            not_used_rec_base,
+            cexp_select
         );
         // get sparstiy pattern for independent variables
         local::sparse::get_internal_pattern(
@@ -240,7 +246,8 @@ void ADFun<Base,RecBase>::rev_hes_sparsity(
             for_jac_sparse_set_,
             rev_jac_pattern.data(),
             internal_hes,
-            not_used_rec_base
+            not_used_rec_base,
+            cexp_select
         );
         // get sparstiy pattern for independent variables
         local::sparse::get_internal_pattern(
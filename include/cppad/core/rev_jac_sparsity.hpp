@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_REV_JAC_SPARSITY_HPP
 # define CPPAD_CORE_REV_JAC_SPARSITY_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -46,6 +46,9 @@ operation sequence stored in $icode f$$ and does not depend on
 the argument $icode x$$.
 (The operation sequence may contain
 $cref CondExp$$ and  $cref VecAD$$ operations.)
+If $cref local_sparsity$$ is true for $icode f$$,
+the pattern only includes the $cref CondExp$$ branches that are
+selected at the point corresponding to the previous zero order forward.
 
 $head SizeVector$$
 The type $icode SizeVector$$ is a $cref SimpleVector$$ class with
@@ -188,6 +191,9 @@ void ADFun<Base,RecBase>::rev_jac_sparsity(
     // number of independent variables
     size_t n = Domain();
     //
+    // branch selection for conditional expressions (null unless local)
+    const local::pod_vector<unsigned char>* cexp_select = local_cexp_select();
+    //
     bool zero_empty  = true;
     bool input_empty = true;
     if( internal_bool )
@@ -213,8 +219,8 @@ void ADFun<Base,RecBase>::rev_jac_sparsity(
             n,
             num_var_tape_,
             internal_jac,
-            not_used_rec_base
-
+            not_used_rec_base,
+            cexp_select
         );
         // get sparstiy pattern for independent variables
         local::sparse::get_internal_pattern(
@@ -244,8 +250,8 @@ void ADFun<Base,RecBase>::rev_jac_sparsity(
             n,
             num_var_tape_,
             internal_jac,
-            not_used_rec_base
-
+            not_used_rec_base,
+            cexp_select
         );
         // get sparstiy pattern for independent variables
         local::sparse::get_internal_pattern(
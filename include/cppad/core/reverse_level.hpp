@@ -0,0 +1,386 @@
+# ifndef CPPAD_CORE_REVERSE_LEVEL_HPP
+# define CPPAD_CORE_REVERSE_LEVEL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin reverse_level$$
+$spell
+    const
+    dw
+    VecAD
+    Taylor
+$$
+
+$section Reverse Mode Evaluating Dependency Levels in Parallel$$
+
+$head Syntax$$
+$icode%dw% = %f%.reverse_level(%q%, %w%, %run%, %min_width%, %n_part%)
+%$$
+
+$head Purpose$$
+The $cref reverse_any$$ routine computes the partial derivatives
+for one operator at a time, starting with the last operator.
+The $code reverse_level$$ routine computes the same derivatives
+using the dependency levels for the operators in the operation sequence;
+see $cref forward_level$$.
+The levels are processed in reverse order and
+all the operators in one level are split into tasks that are
+passed to a user defined runner.
+This can be used to compute the gradient of a sum of many
+independent terms (for example a likelihood that is a sum over samples)
+using multiple threads.
+
+$head Partial Sums$$
+Two operators in the same level may have the same argument;
+i.e., both tasks would add to the same partial derivative.
+For this reason, there are $icode n_part$$ private copies of the
+partial derivatives.
+Task number $icode k$$ (for each level) only adds to copy number $icode k$$.
+The partial derivative for a result of an operator is the sum of
+the copies, and is computed just before the operator is processed.
+The copies for the independent variables are added at the end of
+the calculation.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$.
+Before this call, $icode f$$ must contain the Taylor coefficients
+of order zero through $icode%q%-1%$$;
+e.g., computed by $cref Forward$$ or $cref forward_level$$.
+
+$head q$$
+This argument has prototype
+$codei%
+    size_t %q%
+%$$
+and is the number of Taylor coefficient orders that we are computing
+the derivative with respect to; see $cref/q/reverse_any/q/$$.
+
+$head w$$
+The argument $icode w$$ has prototype
+$codei%
+    const %BaseVector%& %w%
+%$$
+Its size and value have the same meaning as for
+$cref/reverse_any/reverse_any/w/$$.
+
+$head dw$$
+The result $icode dw$$ has prototype
+$codei%
+    %BaseVector% %dw%
+%$$
+Its size and value have the same meaning as for
+$cref/reverse_any/reverse_any/dw/$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head run$$
+The argument $icode run$$ has prototype
+$codei%
+    level_runner& %run%
+%$$
+The calls to $icode run$$ have the same specifications as for
+$cref/forward_level/forward_level/run/$$.
+In addition, the number of tasks for each call is less than or equal
+$icode n_part$$.
+It is also used to set the private copies of the partial derivatives
+to zero (one task for each copy).
+
+$head min_width$$
+This argument has prototype
+$codei%
+    size_t %min_width%
+%$$
+It is the minimum number of operators in a task and must be greater
+than zero.
+The operators in each level are split into the minimum of
+$icode%width%/%min_width%$$ (rounded down) and $icode n_part$$ tasks
+where $icode width$$ is the number of operators in the level.
+If this is one (or zero),
+the operators in the level are computed by the calling thread.
+
+$head n_part$$
+This argument has prototype
+$codei%
+    size_t %n_part%
+%$$
+It is the number of private copies of the partial derivatives
+and the maximum number of tasks for each level.
+It is usually equal to the number of threads used by $icode run$$.
+Note that the memory used for the partial derivatives is
+$icode%n_part% * %q%$$ values for each variable
+(instead of $icode q$$ for $cref reverse_any$$).
+
+$head Sequential Fallback$$
+The calculation is done by $cref reverse_any$$ (and $icode run$$ is
+not used) in the following cases:
+
+$list number$$
+The average number of operators per level is less than $icode min_width$$
+or $icode n_part$$ is one.
+$lnext
+The operation sequence contains an operator that is not
+supported by $cref forward_level$$; e.g., a $cref VecAD$$ operation.
+$lnext
+The previous forward mode calculation used more than one
+$cref/direction/forward_dir/$$.
+$lend
+
+$head Level Schedule$$
+The level schedule is shared with $code forward_level$$; see
+$cref/size_level/forward_level/n_level/$$ and
+$cref/clear_level/forward_level/clear_level/$$.
+
+$children%
+    example/general/reverse_level.cpp
+%$$
+$head Example$$
+The file $cref reverse_level.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file reverse_level.hpp
+Reverse mode evaluating the operators in each level at the same time.
+*/
+
+/*!
+Compute reverse mode partial derivatives by dependency level.
+
+\tparam Base
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type AD<Base>.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param q
+is the number of Taylor coefficient orders.
+
+\param w
+is the weighting for the dependent variables (see Reverse(q, w)).
+
+\param run
+is used to execute the tasks in each level.
+
+\param min_width
+is the minimum number of operators in a task.
+
+\param n_part
+is the number of private copies of the partial derivatives.
+
+\return
+is the derivative of the weighted sum (see Reverse(q, w)).
+
+\par level_schedule_
+If level_schedule_.set() is false, it is set using the current
+operation sequence.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::reverse_level(
+    size_t              q         ,
+    const BaseVector&   w         ,
+    level_runner&       run       ,
+    size_t              min_width ,
+    size_t              n_part    )
+{   // number of independent and dependent variables
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+
+    // check BaseVector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m || size_t(w.size()) == (m * q),
+        "reverse_level(q, w, run, min_width, n_part): "
+        "w.size() is not equal m or m*q"
+    );
+    CPPAD_ASSERT_KNOWN(
+        q > 0,
+        "reverse_level(q, w, run, min_width, n_part): q is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        num_order_taylor_ >= q,
+        "reverse_level(q, w, run, min_width, n_part): "
+        "Less than q Taylor coefficients are currently stored"
+    );
+    CPPAD_ASSERT_KNOWN(
+        min_width > 0 && n_part > 0,
+        "reverse_level(q, w, run, min_width, n_part): "
+        "min_width or n_part is zero"
+    );
+
+    // schedule
+    if( ! level_schedule_.set() )
+        level_schedule_.setup(&play_);
+    const local::level_schedule& schedule( level_schedule_ );
+
+    // sequential fallback
+    bool sequential = ! schedule.ok();
+    if( ! sequential )
+    {   sequential |= schedule.n_op() < min_width * schedule.n_level();
+        sequential |= n_part == 1;
+        sequential |= num_direction_taylor_ != 1;
+    }
+    if( sequential )
+        return Reverse(q, w);
+
+    // arg_begin
+    local::OpCode op;
+    const addr_t* arg_begin;
+    size_t        i_var;
+    play_.begin().op_info(op, arg_begin, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == local::BeginOp );
+
+    // partial
+    // private copies of the partial derivatives
+    size_t n_var = num_var_tape_;
+    local::pod_vector_maybe<Base> partial(n_part * n_var * q);
+
+    // zero_t
+    // sets one private copy of the partial derivatives to zero
+    class zero_t : public level_task {
+    public:
+        size_t size_;
+        Base*  partial_;
+        void operator()(size_t k) const override
+        {   Base* begin = partial_ + k * size_;
+            for(size_t i = 0; i < size_; ++i)
+                begin[i] = Base(0.0);
+        }
+    };
+    zero_t zero;
+    zero.size_    = n_var * q;
+    zero.partial_ = partial.data();
+    run.run(n_part, zero);
+
+    // set the dependent variable direction in the first copy
+    // (use += because two dependent variables can point to same location)
+    for(size_t i = 0; i < m; i++)
+    {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < n_var  );
+        if( size_t(w.size()) == m )
+            partial[dep_taddr_[i] * q + q - 1] += w[i];
+        else
+        {   for(size_t k = 0; k < q; k++)
+                partial[ dep_taddr_[i] * q + k ] += w[i * q + k ];
+        }
+    }
+
+    // task_t
+    // computes the operators in one level
+    class task_t : public level_task {
+    public:
+        const local::level_schedule& schedule_;
+        size_t        q_, J_, n_var_, n_part_, num_par_;
+        size_t        start_, width_, n_task_;
+        const Base*   parameter_;
+        const addr_t* arg_begin_;
+        const Base*   taylor_;
+        Base*         partial_;
+        mutable vector< vector<Base> > work_;
+        //
+        task_t(const local::level_schedule& schedule, size_t n_part)
+        : schedule_(schedule), work_(n_part)
+        { }
+        void operator()(size_t k) const override
+        {   CPPAD_ASSERT_UNKNOWN( k < n_task_ );
+            size_t K       = q_;
+            size_t size    = n_var_ * K;
+            Base*  partial = partial_ + k * size;
+            size_t begin   = start_ + (k * width_) / n_task_;
+            size_t end     = start_ + ((k + 1) * width_) / n_task_;
+            for(size_t i = begin; i < end; ++i)
+            {   local::OpCode op    = schedule_.op(i);
+                size_t        i_var = schedule_.var(i);
+                //
+                // partials for the results of this operator
+                for(size_t r = 0; r < local::NumRes(op); ++r)
+                {   size_t v = i_var - r;
+                    for(size_t d = 0; d < K; ++d)
+                    {   Base sum = Base(0.0);
+                        for(size_t t = 0; t < n_part_; ++t)
+                            sum += partial_[t * size + v * K + d];
+                        partial[v * K + d] = sum;
+                    }
+                }
+                //
+                // add this operator's contribution to its arguments
+                // (work_[k] is only used by task k)
+                local::sweep::reverse_level_op(
+                    q_ - 1, op, i_var, arg_begin_ + schedule_.arg(i),
+                    num_par_, parameter_, J_, taylor_, K, partial, work_[k]
+                );
+            }
+        }
+    };
+    task_t task(schedule, n_part);
+    task.q_         = q;
+    task.J_         = cap_order_taylor_;
+    task.n_var_     = n_var;
+    task.n_part_    = n_part;
+    task.num_par_   = play_.num_par_rec();
+    task.parameter_ = play_.GetPar();
+    task.arg_begin_ = arg_begin;
+    task.taylor_    = taylor_.data();
+    task.partial_   = partial.data();
+
+    // compute the levels in reverse order
+    size_t ell = schedule.n_level();
+    while( ell-- )
+    {   task.start_  = schedule.level_start(ell);
+        task.width_  = schedule.level_start(ell + 1) - task.start_;
+        task.n_task_ = std::min(task.width_ / min_width, n_part);
+        task.n_task_ = std::max<size_t>(task.n_task_, 1);
+        if( task.n_task_ == 1 )
+            task(0);
+        else
+            run.run(task.n_task_, task);
+    }
+
+    // return the derivative values
+    BaseVector value(n * q);
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < n_var  );
+        CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+        for(size_t k = 0; k < q; k++)
+        {   // by the Reverse Identity Theorem (see Reverse)
+            size_t d = k;
+            if( size_t(w.size()) == m )
+                d = q - 1 - k;
+            Base sum = Base(0.0);
+            for(size_t t = 0; t < n_part; ++t)
+                sum += partial[ t * n_var * q + ind_taddr_[j] * q + d ];
+            value[j * q + k] = sum;
+        }
+    }
+    CPPAD_ASSERT_KNOWN( ! ( hasnan(value) && check_for_nan_ ) ,
+        "dw = f.reverse_level(q, w, run, min_width, n_part): has a nan,\n"
+        "but none of its Taylor coefficents are nan."
+    );
+
+    return value;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,357 @@
+# ifndef CPPAD_CORE_REVERSE_LIVE_HPP
+# define CPPAD_CORE_REVERSE_LIVE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin reverse_live$$
+$spell
+    const
+    dw
+    VecAD
+    sqrt
+$$
+
+$section First Order Reverse Mode Reusing Variable Memory$$
+
+$head Syntax$$
+$icode%dw% = %f%.reverse_live(%x%, %w%)
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+The function $latex W : \B{R}^n \rightarrow \B{R}$$ is defined by
+$latex \[
+    W(x) = w_0 * F_0 ( x ) + \cdots + w_{m-1} * F_{m-1} (x)
+\] $$
+The result of this operation is the derivative
+$latex dw = W^{(1)} (x)$$.
+This is the same as
+$codei%
+    %f%.Forward(0, %x%)
+    %dw% = %f%.Reverse(1, %w%)
+%$$
+except that it uses much less memory for large operation sequences.
+
+$head Checkpoints$$
+The operators in $icode f$$ are split into segments
+that have about $latex \sqrt{N}$$ operators each, where $latex N$$ is
+$cref/f.size_op()/fun_property/size_op/$$.
+A zero order forward sweep, that uses the same
+$cref/liveness analysis/forward_live/Liveness Analysis/$$ as
+$cref forward_live$$, retains a copy of the slot values
+at the beginning of each segment.
+The reverse sweep is then done one segment at a time,
+starting with the last segment.
+For each segment, the values of the variables in the segment are
+recomputed from the corresponding checkpoint.
+Only the variables for one segment, the slots,
+and the checkpoints are in memory at the same time.
+The cost is about two zero order forward sweeps and one first order
+reverse sweep.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+Note that the $cref ADFun$$ object $icode f$$ is not $code const$$.
+There cannot be any $cref VecAD$$ vectors in the operation sequence
+corresponding to $icode f$$.
+
+$head x$$
+The argument $icode x$$ has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+(see $icode BaseVector$$ below)
+and its size must be equal to $icode n$$, the dimension of the
+$cref/domain/fun_property/Domain/$$ space for $icode f$$.
+It specifies the argument value at which the derivative is computed.
+
+$head w$$
+The argument $icode w$$ has prototype
+$codei%
+    const %BaseVector%& %w%
+%$$
+and its size must be equal to $icode m$$, the dimension of the
+$cref/range/fun_property/Range/$$ space for $icode f$$.
+
+$head dw$$
+The result $icode dw$$ has prototype
+$codei%
+    %BaseVector% %dw%
+%$$
+and its size is equal to $icode n$$.
+It is the value $latex W^{(1)} (x)$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head Taylor Coefficients$$
+As with $cref forward_live$$,
+after this call there are no Taylor coefficients stored in $icode f$$; i.e.,
+$cref/f.size_order()/size_order/$$ is zero.
+The mapping from variables to slots is stored in $icode f$$
+and can be freed using $cref/clear_live/forward_live/clear_live/$$.
+
+$head Comparison Changes$$
+The number of comparison changes,
+and the corresponding operator index,
+are computed by $code reverse_live$$ the same way as by $cref forward_zero$$;
+see $cref compare_change$$.
+
+$children%
+    example/general/reverse_live.cpp
+%$$
+$head Example$$
+The file $cref reverse_live.cpp$$
+contains an example and test of this operation.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file reverse_live.hpp
+First order reverse mode using reusable variable slots and checkpoints.
+*/
+
+/*!
+Compute first order reverse mode using reusable variable slots.
+
+\tparam Base
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type AD<Base>.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param x
+is the value of the independent variables.
+
+\param w
+is the weighting for each of the dependent variables.
+
+\return
+is the derivative of w^T F(x) with respect to x.
+
+\par live_slot_
+If live_slot_.n_slot() is zero, it is set using the current
+operation sequence.
+
+\par num_order_taylor_
+is set to zero because the values in taylor_ no longer correspond to
+the values in cskip_op_.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::reverse_live(
+    const BaseVector& x ,
+    const BaseVector& w )
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base(0.0);
+
+    // number of independent and dependent variables
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+
+    // check Vector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "reverse_live(x, w): x.size() is not equal to the domain dimension"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m,
+        "reverse_live(x, w): w.size() is not equal to the range dimension"
+    );
+    CPPAD_ASSERT_KNOWN(
+        play_.num_var_vecad_rec() == 0,
+        "reverse_live(x, w): f has VecAD vectors in its operation sequence"
+    );
+
+    // mapping from variables to slots
+    if( live_slot_.n_slot() == 0 )
+        live_slot_.setup(&play_, dep_taddr_);
+    size_t n_slot    = live_slot_.n_slot();
+    size_t n_segment = live_slot_.n_segment();
+    const local::pod_vector<addr_t>& op2slot( live_slot_.op2slot() );
+    const local::pod_vector<addr_t>& dep2slot( live_slot_.dep2slot() );
+
+    // n_row: maximum number of slots for a segment mapping
+    size_t n_row = n_slot;
+    for(size_t k = 0; k < n_segment; ++k)
+        n_row = std::max(n_row, n_slot + live_slot_.n_segment_var(k) );
+
+    // value: zero order coefficients for the slots, followed by the
+    // variables in the current segment
+    local::pod_vector_maybe<Base> value(n_row);
+    for(size_t i = 0; i < n_row; ++i)
+        value[i] = CppAD::numeric_limits<Base>::quiet_NaN();
+
+    // set values for independent variables
+    // (operator index equals variable index for independent variables)
+    for(size_t j = 0; j < n; j++)
+    {   CPPAD_ASSERT_UNKNOWN( play_.GetOp( ind_taddr_[j] ) == local::InvOp );
+        value[ op2slot[ ind_taddr_[j] ] ] = x[j];
+    }
+
+    // checkpoint: slot values at the beginning of each segment
+    local::pod_vector_maybe<Base> checkpoint(n_segment * n_slot);
+
+    // load_op2slot: not used because there are no VecAD vectors
+    local::pod_vector<addr_t> load_op2slot;
+
+    // memo for discrete and atomic functions
+    local::memo_table<Base>* memo = nullptr;
+    if( memo_table_.on() )
+        memo = &memo_table_;
+
+    // initialize the conditional skip flags for all the segments
+    CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
+    for(size_t i = 0; i < cskip_op_.size(); ++i)
+        cskip_op_[i] = false;
+
+    // seg: mapping for the current segment
+    local::live_slot seg;
+
+    // forward sweep, one segment at a time
+    size_t J                 = 1;
+    compare_change_number_   = 0;
+    compare_change_op_index_ = 0;
+    for(size_t k = 0; k < n_segment; ++k)
+    {   // checkpoint for this segment
+        for(size_t i = 0; i < n_slot; ++i)
+            checkpoint[k * n_slot + i] = value[i];
+        //
+        // values for the variables in this segment
+        seg.segment(&play_, live_slot_, k);
+        size_t count = compare_change_count_;
+        if( 0 < count && compare_change_number_ < count )
+            count -= compare_change_number_;
+        size_t number, op_index;
+        local::sweep::forward0(&play_, std::cout, false,
+            n, seg.n_slot(), J,
+            value.data(), &seg, memo,
+            cskip_op_.data(), load_op2slot,
+            count, number, op_index,
+            not_used_rec_base
+        );
+        if( compare_change_number_ < compare_change_count_ )
+        {   if( compare_change_count_ <= compare_change_number_ + number )
+                compare_change_op_index_ = op_index;
+        }
+        compare_change_number_ += number;
+        //
+        // copy values to their slots
+        // (when slots are shared, the last variable has the correct value)
+        for(size_t i_op = seg.range_op(0); i_op < seg.range_op(1); ++i_op)
+        {   size_t n_res = NumRes( play_.GetOp(i_op) );
+            for(size_t ell = 0; ell < n_res; ++ell)
+            {   size_t i_slot  = size_t( op2slot[i_op] ) - ell;
+                size_t i_seg   = size_t( seg.op2slot()[i_op] ) - ell;
+                value[i_slot]  = value[i_seg];
+            }
+        }
+    }
+
+    // partial: partial derivatives with the same rows as value
+    Base zero(0.0);
+    local::pod_vector_maybe<Base> partial(n_row);
+    for(size_t i = 0; i < n_row; ++i)
+        partial[i] = zero;
+    //
+    // set the dependent variable direction
+    // (use += because two dependent variables can point to same location)
+    for(size_t i = 0; i < m; i++)
+        partial[ dep2slot[i] ] += w[i];
+
+    // moved: has the partial for this slot been moved to its segment row
+    local::pod_vector<bool> moved(n_slot);
+    for(size_t i = 0; i < n_slot; ++i)
+        moved[i] = false;
+
+    // reverse sweep, one segment at a time
+    size_t K = 1;
+    for(size_t k = n_segment; k-- > 0; )
+    {   // recompute the values for the variables in this segment
+        for(size_t i = 0; i < n_slot; ++i)
+            value[i] = checkpoint[k * n_slot + i];
+        seg.segment(&play_, live_slot_, k);
+        size_t number, op_index;
+        local::sweep::forward0(&play_, std::cout, false,
+            n, seg.n_slot(), J,
+            value.data(), &seg, memo,
+            cskip_op_.data(), load_op2slot,
+            0, number, op_index,
+            not_used_rec_base
+        );
+        //
+        // move partials for variables in this segment from their slots
+        // (when slots are shared, the partial belongs to the last variable)
+        for(size_t i = n_slot; i < seg.n_slot(); ++i)
+            partial[i] = zero;
+        for(size_t i_op = seg.range_op(1); i_op-- > seg.range_op(0); )
+        {   size_t n_res = NumRes( play_.GetOp(i_op) );
+            for(size_t ell = 0; ell < n_res; ++ell)
+            {   size_t i_slot  = size_t( op2slot[i_op] ) - ell;
+                size_t i_seg   = size_t( seg.op2slot()[i_op] ) - ell;
+                if( ! moved[i_slot] )
+                {   partial[i_seg]  = partial[i_slot];
+                    partial[i_slot] = zero;
+                    moved[i_slot]   = true;
+                }
+            }
+        }
+        for(size_t i_op = seg.range_op(0); i_op < seg.range_op(1); ++i_op)
+        {   size_t n_res = NumRes( play_.GetOp(i_op) );
+            for(size_t ell = 0; ell < n_res; ++ell)
+                moved[ size_t( op2slot[i_op] ) - ell ] = false;
+        }
+        //
+        // partials for this segment
+        local::live_iterator play_itr(&play_, seg);
+        local::sweep::reverse(
+            0,
+            n,
+            seg.n_slot(),
+            &play_,
+            J,
+            value.data(),
+            K,
+            partial.data(),
+            cskip_op_.data(),
+            load_op2slot,
+            play_itr,
+            not_used_rec_base
+        );
+    }
+
+    // values in taylor_ do not correspond to cskip_op_
+    num_order_taylor_ = 0;
+
+    // return the derivative values
+    BaseVector dw(n);
+    for(size_t j = 0; j < n; j++)
+        dw[j] = partial[ op2slot[ ind_taddr_[j] ] ];
+    //
+    return dw;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
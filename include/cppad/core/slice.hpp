@@ -0,0 +1,297 @@
+# ifndef CPPAD_CORE_SLICE_HPP
+# define CPPAD_CORE_SLICE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin slice$$
+$spell
+    const
+    bool
+    dyn
+    Vec
+$$
+
+$section Create an ADFun Object For a Subset of the Domain and Range$$
+
+$head Syntax$$
+$icode%g% = %f%.slice(%select_domain%, %select_range%, %x%, %other_dynamic%)
+%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to
+the operation sequence stored in $icode f$$.
+This routine creates a new function object $icode g$$ that only
+contains the operations in $icode f$$ that are needed to compute
+the selected components of $latex F(x)$$ as a function of the
+selected components of $latex x$$.
+For example, one can evaluate only the constraints that are active
+during an iteration of an optimization algorithm.
+The subset of the operations can also be determined using
+$cref subgraph_reverse$$, but it does not create a separate function object.
+
+$head f$$
+This is the function object that is sliced.
+Its type is $codei%ADFun<%Base%>%$$; i.e., it can not be the result
+of a $cref base2ad$$ operation.
+
+$head BoolVector$$
+The type $icode BoolVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code bool$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head select_domain$$
+This vector has size $icode n$$.
+The independent variables for $icode g$$ are the components of $latex x$$
+for which $icode select_domain$$ is true (in the same order).
+At least one of these components must be true.
+
+$head select_range$$
+This vector has size $icode m$$.
+The dependent variables for $icode g$$ are the components of
+$latex F(x)$$ for which $icode select_range$$ is true (in the same order).
+At least one of these components must be true.
+
+$head x$$
+This vector has size $icode n$$.
+It specifies the value for the independent variables during the
+recording of $icode g$$.
+It also specifies the value for the other components of $latex x$$
+when $icode other_dynamic$$ is false.
+
+$head other_dynamic$$
+If this is false, the components of $latex x$$ for which
+$icode select_domain$$ is false are constant parameters in $icode g$$
+and their values are specified by $icode x$$.
+Otherwise, they are
+$cref/dynamic parameters/glossary/Parameter/Dynamic/$$ in $icode g$$
+and their values can be changed using $cref new_dynamic$$.
+
+$head Dynamic Parameters$$
+The independent dynamic parameters for $icode g$$ are
+the independent dynamic parameters for $icode f$$,
+followed by the components of $latex x$$ that are not selected
+(only if $icode other_dynamic$$ is true).
+The initial values for the dynamic parameters of $icode f$$
+are their values in $icode f$$ when $code slice$$ is called.
+
+$head g$$
+The operation sequence for $icode g$$ is
+$cref/optimized/optimize/$$ so that it only contains the operations
+needed to compute the selected range components.
+Initially, there are no Taylor coefficients stored in $icode g$$ and
+$cref%g.size_order()%size_order%$$ is zero.
+
+$head VecAD$$
+The $cref VecAD$$ operations in $icode f$$ are not preserved in $icode g$$;
+see $cref/base2ad/base2ad/VecAD/$$.
+The values stored in a VecAD vector can depend on the selected
+components of $latex x$$, but the indices used to access the vector
+must be constant parameters; i.e.,
+they cannot be variables or dynamic parameters in $icode f$$.
+Otherwise the index value during the call to $code slice$$ would be used
+for all values of $latex x$$ and the dynamic parameters.
+This is checked when $code NDEBUG$$ is not defined.
+
+$head Comparison Operators$$
+The comparison operators in $icode f$$ are not recorded in $icode g$$; i.e.,
+$cref/compare_change/compare_change/$$ can not be used to detect
+when $icode g$$ should be sliced again.
+
+$children%
+    example/general/slice.cpp
+%$$
+$head Example$$
+The file $cref slice.cpp$$
+contains an example and test of this operation.
+
+$end
+----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file slice.hpp
+*/
+/// ADFun for a subset of the domain and range of this ADFun
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+template <class BoolVector, class BaseVector>
+ADFun<Base,RecBase> ADFun<Base,RecBase>::slice(
+    const BoolVector& select_domain ,
+    const BoolVector& select_range  ,
+    const BaseVector& x             ,
+    bool              other_dynamic ) const
+// END_PROTOTYPE
+{   //
+    // n, m
+    size_t n = Domain();
+    size_t m = Range();
+    CPPAD_ASSERT_KNOWN(
+        size_t( select_domain.size() ) == n,
+        "slice: size of select_domain is not equal f.Domain()"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t( select_range.size() ) == m,
+        "slice: size of select_range is not equal f.Range()"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t( x.size() ) == n,
+        "slice: size of x is not equal f.Domain()"
+    );
+    //
+    // n_select, m_select
+    size_t n_select = 0;
+    for(size_t j = 0; j < n; ++j)
+        if( select_domain[j] )
+            ++n_select;
+    size_t m_select = 0;
+    for(size_t i = 0; i < m; ++i)
+        if( select_range[i] )
+            ++m_select;
+    CPPAD_ASSERT_KNOWN(
+        n_select > 0,
+        "slice: all the elements of select_domain are false"
+    );
+    CPPAD_ASSERT_KNOWN(
+        m_select > 0,
+        "slice: all the elements of select_range are false"
+    );
+# ifndef NDEBUG
+    // VecAD indices must be constant parameters
+    {   const local::pod_vector<bool>& dyn_par_is( play_.dyn_par_is() );
+        local::play::const_sequential_iterator itr = play_.begin();
+        local::OpCode op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == local::BeginOp );
+        while( op != local::EndOp )
+        {   (++itr).op_info(op, arg, i_var);
+            bool variable_index = false;
+            switch( op )
+            {   case local::LdvOp:
+                case local::StvpOp:
+                case local::StvvOp:
+                variable_index = true;
+                break;
+
+                case local::LdpOp:
+                case local::StppOp:
+                case local::StpvOp:
+                variable_index = dyn_par_is[ arg[1] ];
+                break;
+
+                case local::CSkipOp:
+                case local::CSumOp:
+                itr.correct_before_increment();
+                break;
+
+                default:
+                break;
+            }
+            CPPAD_ASSERT_KNOWN(
+                ! variable_index,
+                "slice: f has a VecAD index that is a variable "
+                "or dynamic parameter"
+            );
+        }
+    }
+# endif
+    //
+    // num_dyn_ind, num_dyn_other
+    size_t num_dyn_ind   = play_.num_dynamic_ind();
+    size_t num_dyn_other = 0;
+    if( other_dynamic )
+        num_dyn_other = n - n_select;
+    //
+    // ax_select, adyn
+    vector< AD<Base> > ax_select(n_select);
+    vector< AD<Base> > adyn(num_dyn_ind + num_dyn_other);
+    const local::pod_vector<addr_t>& dyn_ind2par_ind( play_.dyn_ind2par_ind() );
+    for(size_t j = 0; j < num_dyn_ind; ++j)
+        adyn[j] = play_.GetPar( size_t( dyn_ind2par_ind[j] ) );
+    size_t k_select = 0;
+    size_t k_other  = num_dyn_ind;
+    for(size_t j = 0; j < n; ++j)
+    {   if( select_domain[j] )
+            ax_select[k_select++] = x[j];
+        else if( other_dynamic )
+            adyn[k_other++] = x[j];
+    }
+    //
+    // af
+    // (checking for nan would record comparison operators in g)
+    ADFun< AD<Base>, RecBase > af = base2ad();
+    af.check_for_nan(false);
+    //
+    // start recording g
+    // (comparisons during af.Forward do not correspond to comparisons in f)
+    size_t abort_op_index = 0;
+    bool   record_compare = false;
+    if( adyn.size() == 0 )
+        Independent(ax_select, abort_op_index, record_compare);
+    else
+        Independent(ax_select, abort_op_index, record_compare, adyn);
+    //
+    // dynamic parameters in af
+    if( num_dyn_ind > 0 )
+    {   vector< AD<Base> > adyn_f(num_dyn_ind);
+        for(size_t j = 0; j < num_dyn_ind; ++j)
+            adyn_f[j] = adyn[j];
+        af.new_dynamic(adyn_f);
+    }
+    //
+    // ax
+    vector< AD<Base> > ax(n);
+    k_select = 0;
+    k_other  = num_dyn_ind;
+    for(size_t j = 0; j < n; ++j)
+    {   if( select_domain[j] )
+            ax[j] = ax_select[k_select++];
+        else if( other_dynamic )
+            ax[j] = adyn[k_other++];
+        else
+            ax[j] = x[j];
+    }
+    //
+    // ay_select
+    vector< AD<Base> > ay = af.Forward(0, ax);
+    vector< AD<Base> > ay_select(m_select);
+    size_t k = 0;
+    for(size_t i = 0; i < m; ++i)
+        if( select_range[i] )
+            ay_select[k++] = ay[i];
+    //
+    // g
+    ADFun<Base, RecBase> g;
+    g.Dependent(ax_select, ay_select);
+    g.check_for_nan( check_for_nan_ );
+    //
+    // remove the operations that are not needed for ay_select
+    g.optimize();
+    //
+    return g;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_SPARSE_HPP
 # define CPPAD_CORE_SPARSE_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -13,6 +13,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 ---------------------------------------------------------------------------- */
 
 //
+# include <cppad/core/local_sparsity.hpp>
 # include <cppad/core/for_jac_sparsity.hpp>
 # include <cppad/core/rev_jac_sparsity.hpp>
 //
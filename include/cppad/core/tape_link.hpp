@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_TAPE_LINK_HPP
 # define CPPAD_CORE_TAPE_LINK_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -15,6 +15,8 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/local/define.hpp>
 # include <cppad/utility/thread_alloc.hpp>
 # include <cppad/core/cppad_assert.hpp>
+# include <cppad/core/tape_slot.hpp>
+# include <cppad/local/chunk_table.hpp>
 
 // needed before one can use CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL
 # include <cppad/utility/thread_alloc.hpp>
@@ -25,65 +27,97 @@ namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 Routines that Link AD<Base> and local::ADTape<Base> Objects.
 
 The routines that connect the AD<Base> class to the corresponding tapes
-(one for each thread).
+(one for each tape slot).
 */
 
+namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/// tape identifier and tape for one tape slot
+template <class Base>
+struct tape_slot_record {
+    /// tape identifier for this slot
+    tape_id_t     tape_id;
+    /// tape for this slot (nullptr if not recording)
+    ADTape<Base>* tape;
+};
+
 /*!
-Pointer to the tape identifier for this AD<Base> class and the specific thread.
+Record for a tape slot greater than or equal CPPAD_MAX_NUM_THREADS.
+
+\param slot
+is the tape slot. It must hold that slot >= CPPAD_MAX_NUM_THREADS.
+
+\return
+is the record for this slot.
+*/
+template <class Base>
+tape_slot_record<Base>* tape_slot_overflow(size_t slot)
+{   CPPAD_ASSERT_UNKNOWN( CPPAD_MAX_NUM_THREADS <= slot );
+    static std::atomic< tape_slot_record<Base>* >
+        directory[chunk_table_num_chunk];
+    return chunk_table_record(directory, slot - CPPAD_MAX_NUM_THREADS);
+}
+} // END_CPPAD_LOCAL_NAMESPACE
+
+/*!
+Pointer to the tape identifier for this AD<Base> class and the specific slot.
 
 \tparam Base
 is the base type for this AD<Base> class.
 
-\param thread
-is the thread number. The following condition must hold
+\param slot
+is the tape slot. The following condition must hold
 \code
-(! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+(! thread_alloc::in_parallel()) || slot == tape_slot::current()
 \endcode
 
 \return
-is a pointer to the tape identifier for this thread and AD<Base> class.
+is a pointer to the tape identifier for this slot and AD<Base> class.
 */
 template <class Base>
-tape_id_t* AD<Base>::tape_id_ptr(size_t thread)
+tape_id_t* AD<Base>::tape_id_ptr(size_t slot)
 {   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
     static tape_id_t tape_id_table[CPPAD_MAX_NUM_THREADS];
     CPPAD_ASSERT_UNKNOWN(
-        (! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+        (! thread_alloc::in_parallel()) || slot == tape_slot::current()
     );
-    return tape_id_table + thread;
+    if( slot < CPPAD_MAX_NUM_THREADS )
+        return tape_id_table + slot;
+    return &( local::tape_slot_overflow<Base>(slot)->tape_id );
 }
 
 /*!
-Handle for the tape for this AD<Base> class and the specific thread.
+Handle for the tape for this AD<Base> class and the specific slot.
 
 \tparam Base
 is the base type for this AD<Base> class.
 
 
-\param thread
-is the thread number; i.e.,
+\param slot
+is the tape slot; i.e.,
 \code
-(! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+(! thread_alloc::in_parallel()) || slot == tape_slot::current()
 \endcode
 
 \return
-is a handle for the tape for this AD<Base> class and the specified thread.
+is a handle for the tape for this AD<Base> class and the specified slot.
 */
 template <class Base>
-local::ADTape<Base>** AD<Base>::tape_handle(size_t thread)
+local::ADTape<Base>** AD<Base>::tape_handle(size_t slot)
 {   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
     static local::ADTape<Base>* tape_table[CPPAD_MAX_NUM_THREADS];
     CPPAD_ASSERT_UNKNOWN(
-        (! thread_alloc::in_parallel()) || thread == thread_alloc::thread_num()
+        (! thread_alloc::in_parallel()) || slot == tape_slot::current()
     );
-    return tape_table + thread;
+    if( slot < CPPAD_MAX_NUM_THREADS )
+        return tape_table + slot;
+    return &( local::tape_slot_overflow<Base>(slot)->tape );
 }
 
 /*!
-Pointer for the tape for this AD<Base> class and the current thread.
+Pointer for the tape for this AD<Base> class and the current slot.
 
 \code
-thread == thread_alloc::thread_num()
+slot == tape_slot::current()
 \endcode
 
 \tparam Base
@@ -97,8 +131,8 @@ recording AD<Base> operations for this thread.
 */
 template <class Base>
 local::ADTape<Base>* AD<Base>::tape_ptr(void)
-{   size_t thread = thread_alloc::thread_num();
-    return *tape_handle(thread);
+{   size_t slot = tape_slot::current();
+    return *tape_handle(slot);
 }
 
 /*!
@@ -111,15 +145,15 @@ is the base type corresponding to AD<Base> operations.
 \param tape_id
 is the identifier for the tape that is currently recording
 AD<Base> operations for the current thread.
-It must hold that the current thread is
+It must hold that the current slot is
 \code
-    thread = size_t( tape_id % CPPAD_MAX_NUM_THREADS )
+    slot = tape_slot::slot(tape_id)
 \endcode
 and that there is a tape recording AD<Base> operations
-for this thread.
-If this is not the currently executing thread,
-a variable from a different thread is being recorded on the
-tape for this thread which is a user error.
+for this slot.
+If this is not the current slot,
+a variable from a different thread (or task) is being recorded on the
+tape for this slot which is a user error.
 
 \return
 is a pointer to the tape that is currently recording AD<Base> operations
@@ -131,23 +165,23 @@ for the specified thread.
 */
 template <class Base>
 local::ADTape<Base>* AD<Base>::tape_ptr(tape_id_t tape_id)
-{   size_t thread = size_t( tape_id % CPPAD_MAX_NUM_THREADS );
+{   size_t slot = tape_slot::slot(tape_id);
     CPPAD_ASSERT_KNOWN(
-        thread == thread_alloc::thread_num(),
+        slot == tape_slot::current(),
         "Attempt to use an AD variable with two different threads."
     );
-    CPPAD_ASSERT_UNKNOWN( tape_id == *tape_id_ptr(thread) );
-    CPPAD_ASSERT_UNKNOWN( *tape_handle(thread) != nullptr );
-    return *tape_handle(thread);
+    CPPAD_ASSERT_UNKNOWN( tape_id == *tape_id_ptr(slot) );
+    CPPAD_ASSERT_UNKNOWN( *tape_handle(slot) != nullptr );
+    return *tape_handle(slot);
 }
 
 /*!
-Create and delete tapes that record AD<Base> operations for current thread.
+Create and delete tapes that record AD<Base> operations for current slot.
 
-\par thread
-the current thread is given by
+\par slot
+the current slot is given by
 \code
-thread = thread_alloc::thread_num()
+slot = tape_slot::current()
 \endcode
 
 \tparam Base
@@ -160,13 +194,13 @@ old one.
 - new_tape_manage :
 Creates and a new tape.
 It is assumed that there is no tape recording AD<Base> operations
-for this thread when tape_manage is called.
+for this slot when tape_manage is called.
 
 - delete_tape_manage :
 It is assumed that there is a tape recording AD<Base> operations
-for this thread when tape_manage is called.
-The value of <tt>*tape_id_ptr(thread)</tt> will be advanced by
- CPPAD_MAX_NUM_THREADS.
+for this slot when tape_manage is called.
+The value of <tt>*tape_id_ptr(slot)</tt> will be advanced by
+tape_slot::num_slot().
 
 
 \return
@@ -179,36 +213,29 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
     CPPAD_ASSERT_UNKNOWN(
         job == new_tape_manage || job == delete_tape_manage
     );
-    // thread, tape_id, and tape for this call
-    size_t                thread     = thread_alloc::thread_num();
-    tape_id_t*            tape_id_p  = tape_id_ptr(thread);
-    local::ADTape<Base>** tape_h     = tape_handle(thread);
+    // slot, tape_id, and tape for this call
+    size_t                slot       = tape_slot::current();
+    tape_id_t*            tape_id_p  = tape_id_ptr(slot);
+    local::ADTape<Base>** tape_h     = tape_handle(slot);
 
 
     // -----------------------------------------------------------------------
     // new_tape_manage
     if( job == new_tape_manage )
     {
-        // tape for this thread must be null at the start
+        // tape for this slot must be null at the start
         CPPAD_ASSERT_UNKNOWN( *tape_h  == nullptr );
 
         // allocate separate memroy to avoid false sharing
         *tape_h = new local::ADTape<Base>();
 
-        // if tape id is zero, initialize it so that
-        // thread == tape id % CPPAD_MAX_NUM_THREADS
-        if( *tape_id_p == 0 )
-        {   size_t new_tape_id = thread + CPPAD_MAX_NUM_THREADS;
-            CPPAD_ASSERT_KNOWN(
-                size_t( std::numeric_limits<tape_id_t>::max() ) >= new_tape_id,
-                "cppad_tape_id_type maximum value has been exceeded"
-            );
-            *tape_id_p = static_cast<tape_id_t>( new_tape_id );
-        }
-        // make sure tape_id value is valid for this thread
-        CPPAD_ASSERT_UNKNOWN(
-            size_t( *tape_id_p % CPPAD_MAX_NUM_THREADS ) == thread
-        );
+        // if tape id is zero (or was used before the previous
+        // tape_slot::setup), initialize it so that
+        // slot == tape id % tape_slot::num_slot()
+        tape_slot::new_tape(slot, *tape_id_p);
+
+        // make sure tape_id value is valid for this slot
+        CPPAD_ASSERT_UNKNOWN( tape_slot::slot( *tape_id_p ) == slot );
         // set the tape_id for this tape
         (*tape_h)->id_ = *tape_id_p;
     }
@@ -221,44 +248,38 @@ local::ADTape<Base>*  AD<Base>::tape_manage(tape_manage_enum job)
         *tape_h = nullptr;
         //
         // advance tape_id so that all AD<Base> variables become parameters
-        CPPAD_ASSERT_KNOWN(
-            std::numeric_limits<CPPAD_TAPE_ID_TYPE>::max()
-            - CPPAD_MAX_NUM_THREADS > *tape_id_p,
-            "To many different tapes given the type used for "
-            "CPPAD_TAPE_ID_TYPE"
-        );
-        *tape_id_p  += CPPAD_MAX_NUM_THREADS;
+        tape_slot::delete_tape(*tape_id_p);
     }
     // -----------------------------------------------------------------------
     return *tape_h;
 }
 
 /*!
-Get a pointer to tape that records AD<Base> operations for the current thread.
+Get a pointer to tape that records AD<Base> operations for the current slot.
 
 \tparam Base
 is the base type corresponding to AD<Base> operations.
 
-\par thread
-The current thread must be given by
+\par slot
+The current slot must be given by
 \code
-    thread = this->tape_id_ % CPPAD_MAX_NUM_THREADS
+    slot = tape_slot::slot( this->tape_id_ )
 \endcode
 
 \return
 is a pointer to the tape that is currently recording AD<Base> operations
-for the current thread.
+for the current slot.
 This value must not be nullptr; i.e., there must be a tape currently
-recording AD<Base> operations for this thread.
+recording AD<Base> operations for this slot.
 */
 
 template <class Base>
 local::ADTape<Base> *AD<Base>::tape_this(void) const
 {
-    size_t thread = size_t( tape_id_ % CPPAD_MAX_NUM_THREADS );
-    CPPAD_ASSERT_UNKNOWN( tape_id_ == *tape_id_ptr(thread) );
-    CPPAD_ASSERT_UNKNOWN( *tape_handle(thread) != nullptr );
-    return *tape_handle(thread);
+    size_t slot = tape_slot::slot( tape_id_ );
+    CPPAD_ASSERT_UNKNOWN( tape_id_ == *tape_id_ptr(slot) );
+    CPPAD_ASSERT_UNKNOWN( *tape_handle(slot) != nullptr );
+    return *tape_handle(slot);
 }
 
 } // END_CPPAD_NAMESPACE
@@ -0,0 +1,302 @@
+# ifndef CPPAD_CORE_TAPE_SLOT_HPP
+# define CPPAD_CORE_TAPE_SLOT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin tape_slot$$
+$spell
+    CppAD
+    num
+    bool
+    const
+    alloc
+$$
+
+$section Bind AD Tapes to Tasks Instead of Threads$$
+
+$head Syntax$$
+$codei%tape_slot::setup(%num_slot%, %slot%)
+%$$
+$icode%num_slot% = tape_slot::num_slot()
+%$$
+$icode%current% = tape_slot::current()
+%$$
+
+$head Purpose$$
+For each $icode Base$$ type, there is one $codei%AD<%Base%>%$$ tape
+for each tape slot.
+By default, the tape slot is the
+$cref/thread number/ta_thread_num/$$ and there are
+$cref/CPPAD_MAX_NUM_THREADS/multi_thread/CPPAD_MAX_NUM_THREADS/$$ slots.
+Task based runtimes may have many more logical workers than
+$code CPPAD_MAX_NUM_THREADS$$ and a task may not stay on the same
+operating system thread.
+The $code setup$$ routine can be used to bind the tapes to tasks
+(or any other unit of work) and to choose the number of slots at run time.
+
+$head setup$$
+This routine must be called in sequential execution mode and
+while there is no $codei%AD<%Base%>%$$ tape recording, for any $icode Base$$.
+It can be called more than once;
+e.g., to restore the default values
+$codei%
+    tape_slot::setup(CPPAD_MAX_NUM_THREADS, nullptr)
+%$$
+The tape identifiers used after the call are different from all the
+identifiers used before the call.
+When the default values are active,
+the mapping from tape identifiers to slots uses the compile time constant
+$code CPPAD_MAX_NUM_THREADS$$ and does not call a slot function.
+This keeps the cost of checking if an $codei%AD<%Base%>%$$ object
+is a variable, and of finding its tape, close to a single modulus
+by a constant.
+
+$subhead num_slot$$
+This argument has prototype
+$codei%
+    size_t %num_slot%
+%$$
+It is the number of tape slots and must be greater than zero.
+There is no upper limit for $icode num_slot$$ (other than the maximum
+value for the $cref/tape identifier type/cmake/cppad_tape_id_type/$$).
+The memory used to keep track of the tapes for
+slots greater than or equal $code CPPAD_MAX_NUM_THREADS$$
+is only allocated when a slot is used.
+
+$subhead slot$$
+This argument has prototype
+$codei%
+    size_t (*%slot%)(void)
+%$$
+If it is $code nullptr$$, the tape slot is the
+$cref/thread number/ta_thread_num/$$.
+Otherwise, the return value of $icode%slot%()%$$ is the tape slot for
+the current task and must be less than $icode num_slot$$.
+It must be different for every task that is recording
+at the same time.
+All of the $codei%AD<%Base%>%$$ operations that use a tape,
+from the corresponding call to $cref Independent$$ to the
+call to $cref Dependent$$ or $cref abort_recording$$,
+must be done with the same tape slot;
+e.g., by the same task.
+
+$head num_slot$$
+The return value $icode num_slot$$ has prototype
+$codei%
+    size_t %num_slot%
+%$$
+It is the current number of tape slots.
+
+$head current$$
+The return value $icode current$$ has prototype
+$codei%
+    size_t %current%
+%$$
+It is the tape slot for the current task (or thread).
+
+$head thread_alloc$$
+The memory for the tapes is still allocated using
+$cref thread_alloc$$ and the thread that does the allocation.
+Memory returned by a different thread, in parallel mode,
+is returned to the pool for the thread that allocated it; see
+$cref/thread/ta_return_memory/Thread/$$.
+
+$head Example$$
+$children%
+    example/general/tape_slot.cpp
+%$$
+The file $cref tape_slot.cpp$$ contains an example and test
+of this routine.
+
+$end
+------------------------------------------------------------------------------
+*/
+# include <cppad/local/define.hpp>
+# include <cppad/local/declare_ad.hpp>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/utility/thread_alloc.hpp>
+# include <atomic>
+# include <limits>
+# include <algorithm>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file tape_slot.hpp
+Mapping from tasks (or threads) to AD<Base> tape slots.
+*/
+
+/*!
+Determines the tape slot for each task.
+
+The tape identifier for every tape satisfies
+tape_id % tape_slot::num_slot() == slot
+where slot is the tape slot that recorded the tape.
+*/
+class tape_slot {
+    // tape_manage uses the private functions below
+    template <class Base> friend class AD;
+private:
+    /// type of function that returns the current slot
+    typedef size_t (*slot_fun_t)(void);
+    // -----------------------------------------------------------------------
+    /// reference to the number of slots (constant initialized)
+    static size_t& num_slot_ref(void)
+    {   static size_t num_slot = CPPAD_MAX_NUM_THREADS;
+        return num_slot;
+    }
+    /// reference to the current slot function (constant initialized)
+    static slot_fun_t& slot_fun_ref(void)
+    {   static slot_fun_t slot_fun = nullptr;
+        return slot_fun;
+    }
+    /// reference to flag that is true when the default setup is active
+    /// (constant initialized)
+    static bool& is_default_ref(void)
+    {   static bool is_default = true;
+        return is_default;
+    }
+    /// reference to number of tapes that are currently recording
+    static std::atomic<size_t>& num_active_ref(void)
+    {   static std::atomic<size_t> num_active(0);
+        return num_active;
+    }
+    /// reference to the maximum tape identifier that has been used
+    static std::atomic<size_t>& max_id_ref(void)
+    {   static std::atomic<size_t> max_id(0);
+        return max_id;
+    }
+    /// reference to lower bound for tape identifiers after previous setup
+    static size_t& id_floor_ref(void)
+    {   static size_t id_floor = 0;
+        return id_floor;
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Called when a new tape is created.
+
+    \param slot
+    is the slot for the new tape.
+
+    \param tape_id
+    On input it is the tape identifier for the previous tape in this slot,
+    or zero if there is no previous tape.
+    Upon return it is the tape identifier for the new tape.
+    */
+    static void new_tape(size_t slot, tape_id_t& tape_id)
+    {   size_t num_slot = num_slot_ref();
+        CPPAD_ASSERT_KNOWN(
+            slot < num_slot,
+            "tape_slot: the current slot is greater than or equal num_slot"
+        );
+        // if necessary, move tape_id above identifiers used before setup
+        size_t id_floor = id_floor_ref();
+        if( size_t(tape_id) < id_floor || tape_id == 0 )
+        {   size_t id = std::max(id_floor, num_slot);
+            id        = id - id % num_slot + slot;
+            if( id < id_floor )
+                id += num_slot;
+            CPPAD_ASSERT_KNOWN(
+                size_t( std::numeric_limits<tape_id_t>::max() ) >= id,
+                "cppad_tape_id_type maximum value has been exceeded"
+            );
+            tape_id = static_cast<tape_id_t>( id );
+        }
+        CPPAD_ASSERT_UNKNOWN( size_t(tape_id) % num_slot == slot );
+        //
+        // max_id
+        size_t id     = size_t(tape_id);
+        size_t max_id = max_id_ref().load(std::memory_order_relaxed);
+        while( max_id < id && ! max_id_ref().compare_exchange_weak(
+            max_id, id, std::memory_order_relaxed
+        ) ) { }
+        //
+        // num_active
+        num_active_ref().fetch_add(1, std::memory_order_relaxed);
+    }
+    /*!
+    Called when a tape is deleted.
+
+    \param tape_id
+    On input it is the tape identifier for the tape that is being deleted.
+    Upon return it is advanced so that it is not the identifier for any tape.
+    */
+    static void delete_tape(tape_id_t& tape_id)
+    {   size_t num_slot = num_slot_ref();
+        CPPAD_ASSERT_KNOWN(
+            size_t( std::numeric_limits<tape_id_t>::max() ) - num_slot
+            > size_t( tape_id ),
+            "To many different tapes given the type used for "
+            "CPPAD_TAPE_ID_TYPE"
+        );
+        tape_id += static_cast<tape_id_t>( num_slot );
+        num_active_ref().fetch_sub(1, std::memory_order_relaxed);
+    }
+public:
+    // -----------------------------------------------------------------------
+    /*!
+    Set the number of slots and the function that determines the current slot.
+
+    \param num_slot
+    is the number of tape slots.
+
+    \param slot
+    if nullptr, thread_alloc::thread_num is the current slot.
+    Otherwise, slot() is the current slot.
+    */
+    static void setup(size_t num_slot, size_t (*slot)(void))
+    {   CPPAD_ASSERT_KNOWN(
+            ! thread_alloc::in_parallel() ,
+            "tape_slot::setup: called in parallel mode"
+        );
+        CPPAD_ASSERT_KNOWN(
+            num_active_ref().load() == 0 ,
+            "tape_slot::setup: called while an AD tape is recording"
+        );
+        CPPAD_ASSERT_KNOWN(
+            num_slot > 0 ,
+            "tape_slot::setup: num_slot is zero"
+        );
+        CPPAD_ASSERT_KNOWN(
+            num_slot < size_t( std::numeric_limits<tape_id_t>::max() ) / 2,
+            "tape_slot::setup: num_slot is to large for cppad_tape_id_type"
+        );
+        num_slot_ref()   = num_slot;
+        slot_fun_ref()   = slot;
+        is_default_ref() =
+            num_slot == CPPAD_MAX_NUM_THREADS && slot == nullptr;
+        //
+        // identifiers for future tapes are greater than all previous ones
+        id_floor_ref() = max_id_ref().load() + 1;
+    }
+    /// number of tape slots
+    static size_t num_slot(void)
+    {   return num_slot_ref(); }
+    /// tape slot for the current task
+    static size_t current(void)
+    {   if( is_default_ref() )
+            return thread_alloc::thread_num();
+        slot_fun_t slot_fun = slot_fun_ref();
+        if( slot_fun == nullptr )
+            return thread_alloc::thread_num();
+        return slot_fun();
+    }
+    /// tape slot corresponding to a tape identifier
+    static size_t slot(tape_id_t tape_id)
+    {   // the default setup uses a compile time constant for the modulus
+        if( is_default_ref() )
+            return size_t( tape_id ) % CPPAD_MAX_NUM_THREADS;
+        return size_t( tape_id ) % num_slot_ref();
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -0,0 +1,222 @@
+# ifndef CPPAD_CORE_VAR_LEVEL_HPP
+# define CPPAD_CORE_VAR_LEVEL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin var_level$$
+$spell
+    const
+    VecAD
+    op
+$$
+
+$section Dependency Levels for the Variables in an ADFun Object$$
+
+$head Syntax$$
+$icode%num_level% = %f%.var_level(%level%)
+%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head Purpose$$
+The $cref/variables/glossary/Variable/$$ in the operation sequence
+for $icode f$$ are computed one at a time by
+$cref Forward$$ and $cref Reverse$$ mode.
+This routine partitions the variables into dependency levels;
+i.e., a schedule where all the variables with the same level could be
+computed at the same time, once the variables with lower levels
+are known.
+It can be used to decide if a tape has enough parallelism to make it
+worth splitting its evaluation between threads; e.g.,
+using $cref forward_level$$, $cref subgraph_reverse$$ or $cref slice$$.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head SizeVector$$
+The type $icode SizeVector$$ is a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code size_t$$.
+
+$head level$$
+The input size and value of the elements of $icode level$$ do not matter.
+Upon return, it has size $icode%f%.size_var()%$$ and
+$icode%level%[%i%]%$$ is the level for the variable with index $icode i$$:
+
+$list number$$
+Variables that do not depend on any other variable,
+for example the $cref/independent variables/Independent/$$,
+have level zero.
+$lnext
+The level of any other variable is one plus the maximum level
+of the variables it depends on.
+$lnext
+The results of an $cref/atomic function/atomic/$$ call all have the same level.
+$lnext
+The operations on each $cref VecAD$$ vector are kept in order; i.e.,
+a load from a vector has a higher level than the previous operations
+on the same vector.
+$lend
+
+$head num_level$$
+The return value $icode num_level$$ is the number of levels; i.e.,
+one plus the maximum element of $icode level$$.
+The average parallelism for the tape is
+$codei%
+    %f%.size_var() / %num_level%
+%$$
+If this is small (close to one),
+the tape is mostly a sequential chain of operations.
+
+$head Example$$
+$children%
+    example/general/var_level.cpp
+%$$
+The file $cref var_level.cpp$$ contains an example and test
+of this operation.
+
+$end
+-------------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file var_level.hpp
+Dependency levels for the variables in an operation sequence.
+*/
+/*!
+Compute the dependency level of each variable.
+
+\param level
+is set to the level for each variable.
+
+\return
+is the number of levels.
+*/
+// BEGIN_PROTOTYPE
+template <class Base, class RecBase>
+template <class SizeVector>
+size_t ADFun<Base,RecBase>::var_level(SizeVector& level) const
+// END_PROTOTYPE
+{   using local::OpCode;
+    using local::pod_vector;
+    //
+    // level
+    size_t num_var = size_var();
+    level.resize(num_var);
+    if( num_var == 0 )
+        return 0;
+    //
+    // vecad_level
+    // maximum level for the operations on each VecAD vector
+    // (indexed by the offset of the vector in the VecAD indices)
+    pod_vector<size_t> vecad_level( play_.num_var_vecad_ind_rec() );
+    for(size_t i = 0; i < vecad_level.size(); ++i)
+        vecad_level[i] = 0;
+    //
+    // is_variable
+    pod_vector<bool> is_variable;
+    //
+    // atom_level
+    // level for the results of the current atomic function call
+    size_t atom_level = 0;
+    //
+    // BeginOp
+    local::play::const_sequential_iterator itr = play_.begin();
+    OpCode        op;
+    const addr_t* arg;
+    size_t        i_var;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == local::BeginOp && i_var == 0 );
+    level[0] = 0;
+    //
+    while( op != local::EndOp )
+    {   (++itr).op_info(op, arg, i_var);
+        //
+        // op_level
+        // one plus maximum level for the variable arguments
+        size_t op_level = 0;
+        switch( op )
+        {   // start or end of an atomic function call
+            case local::AFunOp:
+            atom_level = 0;
+            break;
+
+            // variable argument to an atomic function call
+            case local::FunavOp:
+            atom_level = std::max(atom_level, level[ size_t(arg[0]) ] + 1);
+            break;
+
+            // variable result of an atomic function call
+            case local::FunrvOp:
+            op_level     = atom_level;
+            level[i_var] = op_level;
+            break;
+
+            // parameter arguments and results for atomic function call
+            case local::FunapOp:
+            case local::FunrpOp:
+            break;
+
+            // operations on VecAD vectors are done in order
+            case local::LdpOp:
+            case local::LdvOp:
+            case local::StppOp:
+            case local::StpvOp:
+            case local::StvpOp:
+            case local::StvvOp:
+            {   local::arg_is_variable(op, arg, is_variable);
+                for(size_t j = 0; j < is_variable.size(); ++j)
+                {   if( is_variable[j] ) op_level = std::max(
+                        op_level, level[ size_t(arg[j]) ] + 1
+                    );
+                }
+                size_t i_vec = size_t( arg[0] );
+                CPPAD_ASSERT_UNKNOWN( i_vec < vecad_level.size() );
+                op_level = std::max(op_level, vecad_level[i_vec] + 1);
+                vecad_level[i_vec] = op_level;
+                if( op == local::LdpOp || op == local::LdvOp )
+                    level[i_var] = op_level;
+            }
+            break;
+
+            default:
+            local::arg_is_variable(op, arg, is_variable);
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] ) op_level = std::max(
+                    op_level, level[ size_t(arg[j]) ] + 1
+                );
+            }
+            if( op == local::CSkipOp || op == local::CSumOp )
+                itr.correct_before_increment();
+            //
+            // all the results for this operator have the same level
+            for(size_t k = 0; k < local::NumRes(op); ++k)
+                level[i_var - k] = op_level;
+            break;
+        }
+    }
+    //
+    // num_level
+    size_t num_level = 0;
+    for(size_t i = 0; i < num_var; ++i)
+        num_level = std::max(num_level, level[i] + 1);
+    return num_level;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
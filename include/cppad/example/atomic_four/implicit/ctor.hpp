@@ -0,0 +1,103 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_CTOR_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_CTOR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_ctor.hpp$$
+$spell
+    ctor
+    Jacobian
+$$
+
+$section
+Atomic Implicit Function Constructor: Example Implementation
+$$
+
+$head Purpose$$
+The constructor stores a copy of
+$cref/fun/atomic_four_implicit/fun/$$ and computes the sparsity pattern
+for the Jacobian of $latex F(x, p)$$.
+The subset of this pattern that corresponds to $latex F_x (x, p)$$
+is used to evaluate $latex F_x (x, p)$$ with
+$cref/sparse_jac_for/sparse_jac/sparse_jac_for/$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// ctor
+template <class Base>
+atomic_implicit<Base>::atomic_implicit(
+    const std::string&          name      ,
+    const ADFun<Base>&          fun       ,
+    const CppAD::vector<Base>&  x_start   ,
+    const Base&                 tolerance ,
+    size_t                      max_itr   )
+: CppAD::atomic_four<Base>(name)
+, x_start_(x_start)
+, tolerance_(tolerance)
+, max_itr_(max_itr)
+{   //
+    // fun_
+    fun_ = fun;
+    //
+    // n_x_, n_p_
+    n_x_ = fun_.Range();
+    CPPAD_ASSERT_KNOWN( n_x_ <= fun_.Domain(),
+        "atomic_implicit: fun.Range() is greater than fun.Domain()"
+    );
+    CPPAD_ASSERT_KNOWN( size_t( x_start_.size() ) == n_x_,
+        "atomic_implicit: x_start.size() is not equal fun.Range()"
+    );
+    n_p_ = fun_.Domain() - n_x_;
+    //
+    // pattern_
+    size_t n_xp = n_x_ + n_p_;
+    sparse_rc pattern_in(n_xp, n_xp, n_xp);
+    for(size_t k = 0; k < n_xp; ++k)
+        pattern_in.set(k, k, k);
+    bool transpose     = false;
+    bool dependency    = false;
+    bool internal_bool = false;
+    fun_.for_jac_sparsity(
+        pattern_in, transpose, dependency, internal_bool, pattern_
+    );
+    fun_.size_forward_set(0);
+    //
+    // subset_
+    size_t nnz = 0;
+    for(size_t k = 0; k < pattern_.nnz(); ++k)
+    {   if( pattern_.col()[k] < n_x_ )
+            ++nnz;
+    }
+    sparse_rc pattern_x(n_x_, n_xp, nnz);
+    nnz = 0;
+    for(size_t k = 0; k < pattern_.nnz(); ++k)
+    {   size_t i = pattern_.row()[k];
+        size_t j = pattern_.col()[k];
+        if( j < n_x_ )
+            pattern_x.set(nnz++, i, j);
+    }
+    subset_ = sparse_rcv(pattern_x);
+    //
+    // lu_
+    for(size_t transpose_index = 0; transpose_index < 2; ++transpose_index)
+        lu_[transpose_index].valid = false;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
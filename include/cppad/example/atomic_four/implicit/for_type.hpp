@@ -0,0 +1,65 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_FOR_TYPE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_FOR_TYPE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_for_type.hpp$$
+
+$section
+Atomic Implicit Function Forward Type Calculation: Example Implementation$$
+
+$head Purpose$$
+The $code for_type$$ routine overrides the virtual functions
+used by the atomic_four base; see
+$cref/for_type/atomic_four_for_type/$$.
+
+$head Theory$$
+Each component of $latex x(p)$$ may depend on every component of
+$latex p$$.
+Hence the type of each component of $latex x(p)$$ is the maximum
+of the types for the components of $latex p$$.
+Even if all the components of $latex p$$ are identically zero,
+the solution $latex x(0)$$ need not be zero.
+Hence the type for $latex x(p)$$ is at least constant.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// for_type override
+template <class Base>
+bool atomic_implicit<Base>::for_type(
+    size_t                                     call_id     ,
+    const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+    CppAD::vector<CppAD::ad_type_enum>&        type_y      )
+{   CPPAD_ASSERT_UNKNOWN( type_x.size() == n_p_ );
+    CPPAD_ASSERT_UNKNOWN( type_y.size() == n_x_ );
+    //
+    // type
+    CppAD::ad_type_enum type = constant_enum;
+    for(size_t j = 0; j < n_p_; ++j)
+        type = std::max(type, type_x[j]);
+    //
+    // type_y
+    for(size_t i = 0; i < n_x_; ++i)
+        type_y[i] = type;
+    //
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
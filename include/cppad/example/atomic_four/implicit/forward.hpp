@@ -0,0 +1,140 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_FORWARD_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_FORWARD_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_forward.hpp$$
+$spell
+    Taylor
+$$
+
+$section
+Atomic Implicit Function Forward Mode: Example Implementation
+$$
+
+$head Purpose$$
+The $code forward$$ routine overrides the virtual functions
+used by the atomic_four base; see
+$cref/forward/atomic_four_forward/$$.
+
+$head Theory$$
+Suppose we are given Taylor coefficients
+$latex p^0, \ldots , p^q$$ for $latex p(t)$$.
+The zero order coefficient $latex x^0$$ is computed using
+$cref/solve/atomic_four_implicit/solve/$$; i.e.,
+$latex F( x^0 , p^0 ) = 0$$.
+Let $latex x(t) = x^0 + x^1 t + \cdots + x^q t^q$$.
+The $th k$$ order Taylor coefficient of
+$latex F[ x(t) , p(t) ]$$ is
+$latex \[
+    F_x ( x^0 , p^0 ) x^k + R^k ( x^0, \ldots , x^{k-1} , p^0, \ldots , p^k )
+\] $$
+where $latex R^k$$ is the $th k$$ order coefficient
+when $latex x^k$$ is replaced by zero.
+Setting this coefficient to zero, we obtain
+$latex \[
+    x^k = - F_x ( x^0 , p^0 )^{-1} R^k
+\] $$
+The value $latex R^k$$ is computed using a $th k$$ order forward
+mode calculation for $icode fun$$ with $latex x^k$$ equal to zero.
+Thus each order requires one forward sweep of $icode fun$$,
+plus one more to store the correct value of $latex x^k$$,
+and one linear equation solve using the LU factor of
+$latex F_x ( x^0 , p^0 )$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// forward override for Base atomic implicit function
+template <class Base>
+bool atomic_implicit<Base>::forward(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_y    ,
+    size_t                                     order_low   ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    CppAD::vector<Base>&                       taylor_y    )
+{   //
+    // q
+    size_t q = order_up + 1;
+    CPPAD_ASSERT_UNKNOWN( taylor_x.size() == n_p_ * q );
+    CPPAD_ASSERT_UNKNOWN( taylor_y.size() == n_x_ * q );
+    //
+    // xp
+    // zero order Taylor coefficient for (x, p)
+    CppAD::vector<Base> xp(n_x_ + n_p_);
+    for(size_t j = 0; j < n_p_; ++j)
+        xp[n_x_ + j] = taylor_x[j * q + 0];
+    if( order_low == 0 )
+    {   // x^0
+        CppAD::vector<Base> p(n_p_), x(n_x_);
+        for(size_t j = 0; j < n_p_; ++j)
+            p[j] = xp[n_x_ + j];
+        if( ! solve(p, x) )
+            return false;
+        for(size_t i = 0; i < n_x_; ++i)
+            taylor_y[i * q + 0] = x[i];
+    }
+    for(size_t i = 0; i < n_x_; ++i)
+        xp[i] = taylor_y[i * q + 0];
+    if( order_up == 0 )
+        return true;
+    //
+    // lu_[0]
+    bool transpose = false;
+    if( ! factor(xp, transpose) )
+        return false;
+    //
+    // zero order forward for fun_
+    fun_.Forward(0, xp);
+    //
+    // k
+    for(size_t k = 1; k < q; ++k)
+    {   //
+        // xp
+        // k-th order Taylor coefficient for (x, p) with x^k = 0
+        for(size_t j = 0; j < n_p_; ++j)
+            xp[n_x_ + j] = taylor_x[j * q + k];
+        for(size_t i = 0; i < n_x_; ++i)
+        {   if( k < order_low )
+                xp[i] = taylor_y[i * q + k];
+            else
+                xp[i] = Base(0);
+        }
+        //
+        // rk
+        CppAD::vector<Base> rk = fun_.Forward(k, xp);
+        //
+        if( order_low <= k )
+        {   // x^k = - F_x(x^0, p^0)^{-1} R^k
+            lu_solve(transpose, rk);
+            for(size_t i = 0; i < n_x_; ++i)
+            {   taylor_y[i * q + k] = - rk[i];
+                xp[i]               = - rk[i];
+            }
+            //
+            // store the k-th order coefficients for fun_
+            if( k < order_up )
+                fun_.Forward(k, xp);
+        }
+    }
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
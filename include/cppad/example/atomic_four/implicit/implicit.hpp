@@ -0,0 +1,146 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_IMPLICIT_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_IMPLICIT_HPP
+
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit.hpp$$
+$spell
+$$
+
+$section Atomic Implicit Function Class: Example Implementation$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+template <class Base>
+class atomic_implicit : public CppAD::atomic_four<Base> {
+//
+public:
+    typedef CppAD::sparse_rc< CppAD::vector<size_t> >               sparse_rc;
+    typedef CppAD::sparse_rcv< CppAD::vector<size_t>, CppAD::vector<Base> >
+        sparse_rcv;
+    //
+    // ctor
+    atomic_implicit(
+        const std::string&          name      ,
+        const ADFun<Base>&          fun       ,
+        const CppAD::vector<Base>&  x_start   ,
+        const Base&                 tolerance ,
+        size_t                      max_itr
+    );
+    // destructor
+    virtual ~atomic_implicit(void)
+    { }
+    //
+    // solve
+    virtual bool solve(
+        const CppAD::vector<Base>& p ,
+        CppAD::vector<Base>&       x
+    );
+private:
+    //
+    // fun_
+    // F(x, p) in the ordering (x, p)
+    ADFun<Base> fun_;
+    //
+    // n_x_, n_p_
+    size_t n_x_;
+    size_t n_p_;
+    //
+    // x_start_, tolerance_, max_itr_
+    CppAD::vector<Base> x_start_;
+    Base                tolerance_;
+    size_t              max_itr_;
+    //
+    // pattern_, subset_, work_
+    // sparsity for F(x, p) and the subset of its Jacobian w.r.t. x
+    sparse_rc            pattern_;
+    sparse_rcv           subset_;
+    CppAD::sparse_jac_work work_;
+    //
+    // information for the LU factor of F_x(x, p) or its transpose
+    struct lu_struct {
+        bool                  valid;
+        CppAD::vector<Base>   xp;
+        CppAD::vector<size_t> ip;
+        CppAD::vector<size_t> jp;
+        CppAD::vector<Base>   lu;
+    };
+    //
+    // lu_[0] is for F_x(x, p), lu_[1] is for its transpose
+    lu_struct lu_[2];
+    //
+    // factor
+    bool factor(const CppAD::vector<Base>& xp, bool transpose);
+    //
+    // lu_solve
+    void lu_solve(bool transpose, CppAD::vector<Base>& b);
+    //
+    // -----------------------------------------------------------------------
+    // overrides
+    // -----------------------------------------------------------------------
+    //
+    // for_type
+    bool for_type(
+        size_t                                        call_id,
+        const CppAD::vector<CppAD::ad_type_enum>&     type_x,
+        CppAD::vector<CppAD::ad_type_enum>&           type_y
+    ) override;
+    //
+    // Base forward
+    bool forward(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_y,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       taylor_x,
+        CppAD::vector<Base>&                             taylor_y
+    ) override;
+    //
+    // Base reverse
+    bool reverse(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_x,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       taylor_x,
+        const CppAD::vector<Base>&                       taylor_y,
+        CppAD::vector<Base>&                             partial_x,
+        const CppAD::vector<Base>&                       partial_y
+    ) override;
+    //
+    // jac_sparsity
+    bool jac_sparsity(
+        size_t                                         call_id,
+        bool                                           dependency,
+        const CppAD::vector<bool>&                     ident_zero_x,
+        const CppAD::vector<bool>&                     select_x,
+        const CppAD::vector<bool>&                     select_y,
+        CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out
+    ) override;
+};
+} // END_CPPAD_NAMESPACE
+
+# include <cppad/example/atomic_four/implicit/ctor.hpp>
+# include <cppad/example/atomic_four/implicit/solve.hpp>
+# include <cppad/example/atomic_four/implicit/for_type.hpp>
+# include <cppad/example/atomic_four/implicit/forward.hpp>
+# include <cppad/example/atomic_four/implicit/reverse.hpp>
+# include <cppad/example/atomic_four/implicit/jac_sparsity.hpp>
+// END C++
+# endif
@@ -0,0 +1,72 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_JAC_SPARSITY_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_JAC_SPARSITY_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_jac_sparsity.hpp$$
+$spell
+    Jacobian
+    jac
+$$
+
+$section
+Atomic Implicit Function Jacobian Sparsity Pattern: Example Implementation
+$$
+
+$head Purpose$$
+The $code jac_sparsity$$ routine overrides the virtual functions
+used by the atomic_four base class for Jacobian sparsity calculations; see
+$cref/jac_sparsity/atomic_four_jac_sparsity/$$.
+
+$head Theory$$
+The Jacobian of the implicit function is
+$latex \[
+    x_p (p) = - F_x [ x(p), p ]^{-1} F_p [ x(p), p ]
+\] $$
+The inverse of a sparse matrix is usually dense.
+Hence this routine returns a dense pattern for the selected
+components of $latex p$$ and $latex x(p)$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// jac_sparsity override
+template <class Base>
+bool atomic_implicit<Base>::jac_sparsity(
+    size_t                                         call_id      ,
+    bool                                           dependency   ,
+    const CppAD::vector<bool>&                     ident_zero_x ,
+    const CppAD::vector<bool>&                     select_x     ,
+    const CppAD::vector<bool>&                     select_y     ,
+    CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out  )
+{   CPPAD_ASSERT_UNKNOWN( select_x.size() == n_p_ );
+    CPPAD_ASSERT_UNKNOWN( select_y.size() == n_x_ );
+    //
+    // pattern_out
+    pattern_out.resize(n_x_, n_p_, 0);
+    for(size_t i = 0; i < n_x_; ++i)
+    {   if( select_y[i] ) for(size_t j = 0; j < n_p_; ++j)
+        {   if( select_x[j] )
+                pattern_out.push_back(i, j);
+        }
+    }
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
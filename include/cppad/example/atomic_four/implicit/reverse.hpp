@@ -0,0 +1,150 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_REVERSE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_REVERSE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_reverse.hpp$$
+$spell
+    Taylor
+$$
+
+$section
+Atomic Implicit Function Reverse Mode: Example Implementation
+$$
+
+$head Purpose$$
+The $code reverse$$ routine overrides the virtual functions
+used by the atomic_four base; see
+$cref/reverse/atomic_four_reverse/$$.
+
+$head Notation$$
+We use $latex X = ( x^0 , \ldots , x^q )$$ and
+$latex P = ( p^0 , \ldots , p^q )$$ to denote the Taylor coefficients
+for $latex x(t)$$ and $latex p(t)$$.
+We use $latex H^k (X, P)$$ to denote the $th k$$ order Taylor coefficient
+for $latex F[ x(t), p(t) ]$$.
+
+$head Theory$$
+The Taylor coefficients $latex X(P)$$ are defined by
+$latex H(X, P) = 0$$.
+Given the partials $latex \bar{X}$$ of a scalar function w.r.t. $latex X$$,
+it follows from the implicit function theorem that
+the partials w.r.t. $latex P$$ are
+$latex \[
+    \bar{P}^\R{T} = - \lambda^\R{T} H_P (X, P)
+    \W{\R{where}}
+    \lambda^\R{T} H_X (X, P) = \bar{X}^\R{T}
+\] $$
+The matrix $latex H_X (X, P)$$ is block lower triangular
+because $latex H^k$$ does not depend on $latex x^\ell$$ for $latex \ell > k$$.
+Each of its diagonal blocks is $latex F_x ( x^0 , p^0 )$$.
+Hence we can solve for $latex \lambda^q , \ldots , \lambda^0$$
+in that order:
+$latex \[
+    \lambda^k
+    =
+    F_x ( x^0 , p^0 )^{-\R{T}} \left[
+        \bar{x}^k - \sum_{\ell > k} H_{x^k}^\ell (X, P)^\R{T} \lambda^\ell
+    \right]
+\] $$
+The summation is computed using
+$cref/reverse mode/reverse_any/$$ for $icode fun$$ with the Taylor
+coefficients for $latex \lambda^\ell$$ equal to zero for
+$latex \ell \leq k$$.
+One more reverse mode calculation computes $latex \bar{P}$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// reverse override for Base atomic implicit function
+template <class Base>
+bool atomic_implicit<Base>::reverse(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_x    ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    const CppAD::vector<Base>&                 taylor_y    ,
+    CppAD::vector<Base>&                       partial_x   ,
+    const CppAD::vector<Base>&                 partial_y   )
+{   //
+    // q, n_xp
+    size_t q    = order_up + 1;
+    size_t n_xp = n_x_ + n_p_;
+    CPPAD_ASSERT_UNKNOWN( taylor_x.size()  == n_p_ * q );
+    CPPAD_ASSERT_UNKNOWN( taylor_y.size()  == n_x_ * q );
+    CPPAD_ASSERT_UNKNOWN( partial_x.size() == n_p_ * q );
+    CPPAD_ASSERT_UNKNOWN( partial_y.size() == n_x_ * q );
+    //
+    // xp
+    // Taylor coefficients for (x, p)
+    CppAD::vector<Base> xp(n_xp * q);
+    for(size_t k = 0; k < q; ++k)
+    {   for(size_t i = 0; i < n_x_; ++i)
+            xp[i * q + k] = taylor_y[i * q + k];
+        for(size_t j = 0; j < n_p_; ++j)
+            xp[(n_x_ + j) * q + k] = taylor_x[j * q + k];
+    }
+    //
+    // lu_[1]
+    CppAD::vector<Base> xp0(n_xp);
+    for(size_t j = 0; j < n_xp; ++j)
+        xp0[j] = xp[j * q + 0];
+    bool transpose = true;
+    if( ! factor(xp0, transpose) )
+        return false;
+    //
+    // Taylor coefficients for fun_
+    fun_.Forward(order_up, xp);
+    //
+    // lambda
+    CppAD::vector<Base> lambda(n_x_ * q), dw(n_xp * q), rhs(n_x_);
+    for(size_t i = 0; i < n_x_ * q; ++i)
+        lambda[i] = Base(0);
+    //
+    // k
+    size_t k = q;
+    while( k-- )
+    {   //
+        // rhs = xbar^k
+        for(size_t i = 0; i < n_x_; ++i)
+            rhs[i] = partial_y[i * q + k];
+        //
+        // rhs = xbar^k - sum_{ell > k} H_{x^k}^ell (X, P)^T lambda^ell
+        if( k < order_up )
+        {   dw = fun_.Reverse(q, lambda);
+            for(size_t i = 0; i < n_x_; ++i)
+                rhs[i] -= dw[i * q + k];
+        }
+        //
+        // lambda^k
+        lu_solve(transpose, rhs);
+        for(size_t i = 0; i < n_x_; ++i)
+            lambda[i * q + k] = rhs[i];
+    }
+    //
+    // partial_x = - lambda^T H_P (X, P)
+    dw = fun_.Reverse(q, lambda);
+    for(size_t j = 0; j < n_p_; ++j)
+    {   for(size_t ell = 0; ell < q; ++ell)
+            partial_x[j * q + ell] = - dw[(n_x_ + j) * q + ell];
+    }
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
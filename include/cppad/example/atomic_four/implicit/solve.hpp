@@ -0,0 +1,173 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_SOLVE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_IMPLICIT_SOLVE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_implicit_solve.hpp$$
+$spell
+    Jacobian
+    lu
+    xp
+$$
+
+$section
+Atomic Implicit Function Newton Solver: Example Implementation
+$$
+
+$head solve$$
+The default $cref/solve/atomic_four_implicit/solve/$$ routine uses
+Newton's method
+$latex \[
+    x^{k+1} = x^k - F_x ( x^k , p )^{-1} F( x^k , p )
+\] $$
+starting at $latex x^0$$ equal to
+$cref/x_start/atomic_four_implicit/x_start/$$.
+It returns true when
+$latex | F_i ( x^k , p ) | \leq$$
+$cref/tolerance/atomic_four_implicit/tolerance/$$ for all $latex i$$.
+It returns false if this does not happen within
+$cref/max_itr/atomic_four_implicit/max_itr/$$ iterations
+or if $latex F_x ( x^k , p )$$ is singular.
+
+$head factor$$
+The $code factor$$ routine evaluates $latex F_x (x, p)$$ using
+$cref/sparse_jac_for/sparse_jac/sparse_jac_for/$$
+and then computes the LU factor of $latex F_x (x, p)$$,
+or its transpose, using $cref LuFactor$$.
+The factor is not recomputed if it was already computed at the same
+value of $latex (x, p)$$.
+This routine calls $codei%Forward(0, %xp%)%$$ for the function $icode fun$$
+unless the factor has already been computed.
+
+$head lu_solve$$
+The $code lu_solve$$ routine uses $cref LuInvert$$ and the most recent
+factor to solve a linear equation with $latex F_x (x, p)$$,
+or its transpose, as the coefficient matrix.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/implicit/implicit.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// factor
+template <class Base>
+bool atomic_implicit<Base>::factor(
+    const CppAD::vector<Base>& xp        ,
+    bool                       transpose )
+{   //
+    // lu
+    lu_struct& lu( lu_[ size_t(transpose) ] );
+    //
+    // check for case where factor is already available
+    if( lu.valid )
+    {   bool match = true;
+        for(size_t j = 0; j < n_x_ + n_p_; ++j)
+            match &= lu.xp[j] == xp[j];
+        if( match )
+            return true;
+    }
+    lu.valid = false;
+    //
+    // subset_
+    size_t      group_max = 1;
+    std::string coloring  = "cppad";
+    fun_.sparse_jac_for(group_max, xp, subset_, pattern_, coloring, work_);
+    //
+    // lu.lu
+    size_t n = n_x_;
+    lu.lu.resize(n * n);
+    for(size_t k = 0; k < n * n; ++k)
+        lu.lu[k] = Base(0);
+    for(size_t k = 0; k < subset_.nnz(); ++k)
+    {   size_t i = subset_.row()[k];
+        size_t j = subset_.col()[k];
+        if( transpose )
+            std::swap(i, j);
+        lu.lu[ i * n + j ] = subset_.val()[k];
+    }
+    //
+    // lu.ip, lu.jp, lu.lu
+    lu.ip.resize(n);
+    lu.jp.resize(n);
+    int sign = CppAD::LuFactor(lu.ip, lu.jp, lu.lu);
+    if( sign == 0 )
+        return false;
+    //
+    // lu.xp, lu.valid
+    lu.xp    = xp;
+    lu.valid = true;
+    return true;
+}
+//
+// lu_solve
+template <class Base>
+void atomic_implicit<Base>::lu_solve(
+    bool                 transpose ,
+    CppAD::vector<Base>& b         )
+{   const lu_struct& lu( lu_[ size_t(transpose) ] );
+    CPPAD_ASSERT_UNKNOWN( lu.valid );
+    CppAD::LuInvert(lu.ip, lu.jp, lu.lu, b);
+}
+//
+// solve
+template <class Base>
+bool atomic_implicit<Base>::solve(
+    const CppAD::vector<Base>& p ,
+    CppAD::vector<Base>&       x )
+{   //
+    // xp
+    CppAD::vector<Base> xp(n_x_ + n_p_);
+    for(size_t i = 0; i < n_x_; ++i)
+        xp[i] = x_start_[i];
+    for(size_t j = 0; j < n_p_; ++j)
+        xp[n_x_ + j] = p[j];
+    //
+    // itr
+    for(size_t itr = 0; itr <= max_itr_; ++itr)
+    {   //
+        // fxp
+        CppAD::vector<Base> fxp = fun_.Forward(0, xp);
+        //
+        // converged
+        bool converged = true;
+        for(size_t i = 0; i < n_x_; ++i)
+            converged &= CppAD::abs( fxp[i] ) <= tolerance_;
+        if( converged )
+        {   x.resize(n_x_);
+            for(size_t i = 0; i < n_x_; ++i)
+                x[i] = xp[i];
+            return true;
+        }
+        if( itr == max_itr_ )
+            return false;
+        //
+        // fxp = F_x(x, p)^{-1} F(x, p)
+        bool transpose = false;
+        if( ! factor(xp, transpose) )
+            return false;
+        lu_solve(transpose, fxp);
+        //
+        // xp
+        for(size_t i = 0; i < n_x_; ++i)
+            xp[i] -= fxp[i];
+    }
+    // not reached
+    CPPAD_ASSERT_UNKNOWN(false);
+    return false;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,134 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_DEPEND_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_DEPEND_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_depend.hpp$$
+$spell
+    alg
+    Cholesky
+$$
+
+$section
+Atomic Linear Algebra Dependency Pattern: Example Implementation
+$$
+
+$head Syntax$$
+$codei%depend(%op%, %n%, %m%, %i%, %dep_x%)%$$
+
+$head Purpose$$
+This static member function determines the components of the argument
+$icode x$$ that the result component $icode%y%[%i%]%$$ depends on.
+It is used by the $code for_type$$, $code jac_sparsity$$,
+$code hes_sparsity$$, and $code rev_depend$$ overrides.
+
+$head dep_x$$
+On return, this vector contains the indices in $icode x$$,
+in increasing order, that $icode%y%[%i%]%$$ depends on
+(for a general, non-zero, argument value).
+
+$head Solve$$
+For the $code solve_lower$$ operator,
+row $icode i$$ of $icode X$$ depends on the rows of $icode L$$
+and $icode B$$ with index less than or equal $icode i$$.
+For the $code solve_trans$$ operator,
+row $icode i$$ of $icode X$$ depends on the columns of $icode L$$
+and rows of $icode B$$ with index greater than or equal $icode i$$.
+In both cases, only the lower triangle of $icode L$$ is used and
+column $icode j$$ of $icode X$$ only depends on column $icode j$$ of $icode B$$.
+
+$head Cholesky$$
+For $icode%c% <= %r%$$, the element $latex L_{r,c}$$ depends on the
+elements $latex A_{i,j}$$ where $latex j \leq i$$,
+$latex j \leq c$$, and $latex i \leq c$$ or $latex i = r$$.
+The upper triangle of $icode L$$ is identically zero.
+
+$head Log-Determinant$$
+The log-determinant depends on the entire lower triangle of $icode A$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// depend
+template <class Base>
+void atomic_lin_alg<Base>::depend(
+    op_enum_t                                        op,
+    size_t                                           n,
+    size_t                                           m,
+    size_t                                           i,
+    CppAD::vector<size_t>&                           dep_x
+)
+{   dep_x.resize(0);
+    switch(op)
+    {   // X = L^{-1} B or X = L^{-T} B
+        case solve_lower_enum:
+        case solve_trans_enum:
+        {   // r, c, trans
+            size_t r   = i / m;
+            size_t c   = i % m;
+            bool trans = op == solve_trans_enum;
+            //
+            // L(k,ell) for ell <= k <= r or r <= ell <= k
+            for(size_t k = 0; k < n; ++k)
+            {   for(size_t ell = 0; ell <= k; ++ell)
+                {   bool use = trans ? r <= ell : k <= r;
+                    if( use )
+                        dep_x.push_back( k * n + ell );
+                }
+            }
+            //
+            // B(k,c) for k <= r or r <= k
+            for(size_t k = 0; k < n; ++k)
+            {   bool use = trans ? r <= k : k <= r;
+                if( use )
+                    dep_x.push_back( n * n + k * m + c );
+            }
+        }
+        break;
+
+        // L * L^T = A
+        case cholesky_enum:
+        {   size_t r = i / n;
+            size_t c = i % n;
+            if( c <= r )
+            {   for(size_t k = 0; k < n; ++k)
+                {   for(size_t ell = 0; ell <= k && ell <= c; ++ell)
+                    {   if( k <= c || k == r )
+                            dep_x.push_back( k * n + ell );
+                    }
+                }
+            }
+        }
+        break;
+
+        // log( det(A) )
+        case logdet_enum:
+        for(size_t k = 0; k < n; ++k)
+        {   for(size_t ell = 0; ell <= k; ++ell)
+                dep_x.push_back( k * n + ell );
+        }
+        break;
+
+        default:
+        assert( false );
+        break;
+    }
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
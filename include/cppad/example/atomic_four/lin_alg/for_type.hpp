@@ -0,0 +1,86 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_FOR_TYPE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_FOR_TYPE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_for_type.hpp$$
+$spell
+    alg
+$$
+
+$section
+Atomic Linear Algebra Forward Type Calculation: Example Implementation
+$$
+
+$head Purpose$$
+The $code for_type$$ routine overrides the virtual functions
+used by the atomic_four base class for forward type calculations; see
+$cref/for_type/atomic_four_for_type/$$.
+
+$head Identical Zero$$
+A column of the result of a solve is identically zero
+if the corresponding elements of the right hand side are identically zero.
+The upper triangle of the result of a Cholesky factorization
+is identically zero.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// for_type override
+template <class Base>
+bool atomic_lin_alg<Base>::for_type(
+    size_t                                     call_id     ,
+    const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+    CppAD::vector<CppAD::ad_type_enum>&        type_y      )
+{
+    // op, n, m
+    op_enum_t op;
+    size_t    n, m;
+    get(call_id, op, n, m);
+    //
+    // check sizes
+    assert( type_x.size() == size_x(op, n, m) );
+    assert( type_y.size() == size_y(op, n, m) );
+    //
+    // type_y
+    CppAD::vector<size_t> dep_x;
+    for(size_t i = 0; i < type_y.size(); ++i)
+    {   depend(op, n, m, i, dep_x);
+        //
+        // type_i, zero_rhs
+        // zero_rhs is true if all the right hand side elements that
+        // y[i] depends on are identically zero
+        CppAD::ad_type_enum type_i = CppAD::constant_enum;
+        bool zero_rhs              = true;
+        for(size_t k = 0; k < dep_x.size(); ++k)
+        {   size_t j = dep_x[k];
+            type_i   = std::max(type_i, type_x[j]);
+            if( n * n <= j && type_x[j] != CppAD::identical_zero_enum )
+                zero_rhs = false;
+        }
+        bool solve = op == solve_lower_enum || op == solve_trans_enum;
+        if( dep_x.size() == 0 || (solve && zero_rhs) )
+            type_i = CppAD::identical_zero_enum;
+        //
+        type_y[i] = type_i;
+    }
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
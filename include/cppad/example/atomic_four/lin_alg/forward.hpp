@@ -0,0 +1,293 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_FORWARD_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_FORWARD_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_forward.hpp$$
+$spell
+    alg
+    Taylor
+    logdet
+$$
+
+$section
+Atomic Linear Algebra Forward Mode: Example Implementation
+$$
+
+$head Purpose$$
+The $code forward$$ routine overrides the virtual functions
+used by the atomic_four base class for forward mode calculations; see
+$cref/forward/atomic_four_forward/$$.
+It has a mathematical $cref/theory/atomic_four_lin_alg/Theory/Forward/$$
+for each operator.
+
+$head Scalar$$
+The calculations are templated on the type $icode Scalar$$
+which is $icode Base$$ for the $icode Base$$ forward override
+and $codei%AD<%Base%>%$$ for the $codei%AD<%Base%>%$$ forward override.
+
+$head Example$$
+The files $cref atomic_four_lin_alg_solve.cpp$$,
+$cref atomic_four_lin_alg_cholesky.cpp$$, and
+$cref atomic_four_lin_alg_logdet.cpp$$ contain examples and tests
+that use forward mode.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// get_list
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::get_list(
+    size_t                                           offset,
+    size_t                                           size,
+    size_t                                           q,
+    const CppAD::vector<Scalar>&                     taylor,
+    mat_list<Scalar>&                                list
+)
+{   list.resize(q);
+    for(size_t k = 0; k < q; ++k)
+    {   list[k].resize(size);
+        for(size_t i = 0; i < size; ++i)
+            list[k][i] = taylor[ (offset + i) * q + k ];
+    }
+}
+//
+// set_list
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::set_list(
+    size_t                                           offset,
+    size_t                                           order_low,
+    const mat_list<Scalar>&                          list,
+    CppAD::vector<Scalar>&                           taylor
+)
+{   size_t q = list.size();
+    for(size_t k = order_low; k < q; ++k)
+    {   for(size_t i = 0; i < list[k].size(); ++i)
+            taylor[ (offset + i) * q + k ] = list[k][i];
+    }
+}
+//
+// forward_solve
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::forward_solve(
+    bool                                             trans,
+    size_t                                           n,
+    size_t                                           m,
+    size_t                                           order_low,
+    size_t                                           order_up,
+    const CppAD::vector<Scalar>&                     taylor_x,
+    CppAD::vector<Scalar>&                           taylor_y
+)
+{   // q
+    size_t q = order_up + 1;
+    //
+    // L, B, X
+    mat_list<Scalar> L, B, X;
+    get_list(0,     n * n, q, taylor_x, L);
+    get_list(n * n, n * m, q, taylor_x, B);
+    get_list(0,     n * m, q, taylor_y, X);
+    //
+    // X[k] = op(L[0])^{-1} ( B[k] - sum_{d=1}^k op(L[d]) X[k-d] )
+    CppAD::vector<Scalar> R;
+    for(size_t k = order_low; k < q; ++k)
+    {   R = B[k];
+        for(size_t d = 1; d <= k; ++d)
+            sub_mul_lower(trans, n, m, L[d], X[k-d], R);
+        solve_kernel(trans, n, m, L[0], R, X[k]);
+    }
+    //
+    // taylor_y
+    set_list(0, order_low, X, taylor_y);
+}
+//
+// forward_cholesky
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::forward_cholesky(
+    size_t                                           n,
+    size_t                                           order_low,
+    const mat_list<Scalar>&                          A,
+    mat_list<Scalar>&                                L
+)
+{   // q
+    size_t q = A.size();
+    assert( L.size() == q );
+    //
+    // k = 0
+    if( order_low == 0 )
+        cholesky_kernel(n, A[0], L[0]);
+    //
+    // B, W, M
+    CppAD::vector<Scalar> B(n * n), W(n * n), M(n * n);
+    for(size_t k = std::max(order_low, size_t(1)); k < q; ++k)
+    {   //
+        // B = A[k] - sum_{d=1}^{k-1} L[d] L[k-d]^T
+        // where A[k] is symmetric and only its lower triangle is used
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t j = 0; j <= i; ++j)
+            {   B[i * n + j] = A[k][i * n + j];
+                for(size_t d = 1; d < k; ++d)
+                {   for(size_t ell = 0; ell <= j; ++ell)
+                        B[i * n + j] -=
+                            L[d][i * n + ell] * L[k-d][j * n + ell];
+                }
+                B[j * n + i] = B[i * n + j];
+            }
+        }
+        //
+        // W = ( L[0]^{-1} B )^T
+        solve_kernel(false, n, n, L[0], B, M);
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t j = 0; j < n; ++j)
+                W[i * n + j] = M[j * n + i];
+        }
+        //
+        // M = L[0]^{-1} B L[0]^{-T}
+        solve_kernel(false, n, n, L[0], W, M);
+        //
+        // L[k] = L[0] * Phi(M)
+        // where Phi(M) is the lower triangle of M with the diagonal halved.
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t j = 0; j <= i; ++j)
+            {   Scalar sum = L[0][i * n + j] * M[j * n + j] / Scalar(2);
+                for(size_t ell = j + 1; ell <= i; ++ell)
+                    sum += L[0][i * n + ell] * M[ell * n + j];
+                L[k][i * n + j] = sum;
+            }
+            for(size_t j = i + 1; j < n; ++j)
+                L[k][i * n + j] = Scalar(0);
+        }
+    }
+}
+//
+// forward_logdet
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::forward_logdet(
+    size_t                                           n,
+    size_t                                           order_low,
+    size_t                                           order_up,
+    const CppAD::vector<Scalar>&                     taylor_x,
+    CppAD::vector<Scalar>&                           taylor_y
+)
+{   // q
+    size_t q = order_up + 1;
+    //
+    // A, L
+    // recompute all orders for L because it is not part of the result
+    mat_list<Scalar> A, L(q);
+    get_list(0, n * n, q, taylor_x, A);
+    for(size_t k = 0; k < q; ++k)
+        L[k].resize(n * n);
+    forward_cholesky(n, 0, A, L);
+    //
+    // taylor_y
+    // log(det(A)) = 2 * sum_i log( L_{i,i} )
+    for(size_t k = order_low; k < q; ++k)
+        taylor_y[k] = Scalar(0);
+    CppAD::vector<Scalar> z(q);
+    for(size_t i = 0; i < n; ++i)
+    {   // z = log(u) where u = L_{i,i}
+        size_t ii = i * n + i;
+        z[0]      = CppAD::log( L[0][ii] );
+        for(size_t k = 1; k < q; ++k)
+        {   z[k] = L[k][ii];
+            for(size_t j = 1; j < k; ++j)
+                z[k] -= Scalar(double(j) / double(k)) * z[j] * L[k-j][ii];
+            z[k] /= L[0][ii];
+        }
+        for(size_t k = order_low; k < q; ++k)
+            taylor_y[k] += Scalar(2) * z[k];
+    }
+}
+//
+// forward_any
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::forward_any(
+    size_t                                           call_id,
+    size_t                                           order_low,
+    size_t                                           order_up,
+    const CppAD::vector<Scalar>&                     taylor_x,
+    CppAD::vector<Scalar>&                           taylor_y
+)
+{   // op, n, m
+    op_enum_t op;
+    size_t    n, m;
+    get(call_id, op, n, m);
+    //
+    // q
+    size_t q = order_up + 1;
+    //
+    // check sizes
+    assert( taylor_x.size() == size_x(op, n, m) * q );
+    assert( taylor_y.size() == size_y(op, n, m) * q );
+    //
+    switch(op)
+    {   case solve_lower_enum:
+        case solve_trans_enum:
+        forward_solve(
+            op == solve_trans_enum, n, m, order_low, order_up,
+            taylor_x, taylor_y
+        );
+        break;
+
+        case cholesky_enum:
+        {   mat_list<Scalar> A, L;
+            get_list(0, n * n, q, taylor_x, A);
+            get_list(0, n * n, q, taylor_y, L);
+            forward_cholesky(n, order_low, A, L);
+            set_list(0, order_low, L, taylor_y);
+        }
+        break;
+
+        case logdet_enum:
+        forward_logdet(n, order_low, order_up, taylor_x, taylor_y);
+        break;
+
+        default:
+        assert( false );
+        break;
+    }
+}
+//
+// Base forward override
+template <class Base>
+bool atomic_lin_alg<Base>::forward(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_y    ,
+    size_t                                     order_low   ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    CppAD::vector<Base>&                       taylor_y    )
+{   forward_any(call_id, order_low, order_up, taylor_x, taylor_y);
+    return true;
+}
+//
+// AD<Base> forward override
+template <class Base>
+bool atomic_lin_alg<Base>::forward(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_y    ,
+    size_t                                     order_low   ,
+    size_t                                     order_up    ,
+    const ad_vector&                           ataylor_x   ,
+    ad_vector&                                 ataylor_y   )
+{   forward_any(call_id, order_low, order_up, ataylor_x, ataylor_y);
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,114 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_GET_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_GET_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+--------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_get.hpp$$
+$spell
+    alg
+    op
+$$
+
+$section atomic_lin_alg Get Routine: Example Implementation$$
+
+$head Syntax$$
+$icode%lin_alg%.get(%call_id%, %op%, %n%, %m%)
+%$$
+$icode%nx% = %lin_alg%.size_x(%op%, %n%, %m%)
+%$$
+$icode%ny% = %lin_alg%.size_y(%op%, %n%, %m%)
+%$$
+
+$head Prototype$$
+$srcthisfile%0%// BEGIN PROTOTYPE%// END PROTOTYPE%1%$$
+
+$head Purpose$$
+The $code get$$ routine retrieves the operator and dimension information
+stored by the corresponding call to $cref atomic_four_lin_alg_set.hpp$$.
+
+$head call_id$$
+This argument identifies the operator and dimensions.
+
+$head op, n, m$$
+These results are the values of $icode op$$, $icode n$$, and $icode m$$
+in the call to $code set$$ that returned $icode call_id$$.
+
+$head nx$$
+This return value is the size of the argument vector $icode x$$
+for an operation with the specified operator and dimensions.
+
+$head ny$$
+This return value is the size of the result vector $icode y$$
+for an operation with the specified operator and dimensions.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+// BEGIN PROTOTYPE
+template <class Base>
+void atomic_lin_alg<Base>::get(
+    size_t call_id, op_enum_t& op, size_t& n, size_t& m
+)
+// END PROTOTYPE
+{
+    // thread
+    size_t thread = thread_alloc::thread_num();
+    assert( work_[thread] != nullptr );
+    assert( thread == (*work_[thread])[call_id].thread );
+    //
+    // op, n, m
+    call_struct& call = (*work_[thread])[call_id];
+    op = call.op;
+    n  = call.n;
+    m  = call.m;
+    //
+    return;
+}
+//
+// size_x
+template <class Base>
+size_t atomic_lin_alg<Base>::size_x(op_enum_t op, size_t n, size_t m)
+{   switch(op)
+    {   case solve_lower_enum:
+        case solve_trans_enum:
+        return n * n + n * m;
+
+        default:
+        break;
+    }
+    return n * n;
+}
+//
+// size_y
+template <class Base>
+size_t atomic_lin_alg<Base>::size_y(op_enum_t op, size_t n, size_t m)
+{   switch(op)
+    {   case solve_lower_enum:
+        case solve_trans_enum:
+        return n * m;
+
+        case logdet_enum:
+        return 1;
+
+        default:
+        break;
+    }
+    return n * n;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,110 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_HES_SPARSITY_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_HES_SPARSITY_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_hes_sparsity.hpp$$
+$spell
+    alg
+    Hessian
+    hes
+$$
+
+$section
+Atomic Linear Algebra Hessian Sparsity Pattern: Example Implementation
+$$
+
+$head Purpose$$
+The $code hes_sparsity$$ routine overrides the virtual functions
+used by the atomic_four base class for Hessian sparsity calculations; see
+$cref/hes_sparsity/atomic_four_hes_sparsity/$$.
+
+$head Pattern$$
+For each selected result component,
+all the pairs of argument components that it
+$cref/depends/atomic_four_lin_alg_depend.hpp/$$ on are included,
+except for pairs of right hand side components of a solve
+(the solution is a linear function of the right hand side).
+
+$head Example$$
+The file $cref atomic_four_lin_alg_sparsity.cpp$$
+contains an example and test using this operator.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <set>
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// hes_sparsity override
+template <class Base>
+bool atomic_lin_alg<Base>::hes_sparsity(
+    size_t                                         call_id      ,
+    const CppAD::vector<bool>&                     select_x     ,
+    const CppAD::vector<bool>&                     select_y     ,
+    CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out  )
+{
+    // op, n, m
+    op_enum_t op;
+    size_t    n, m;
+    get(call_id, op, n, m);
+    //
+    // nx, ny
+    size_t nx = select_x.size();
+    size_t ny = select_y.size();
+    //
+    // check sizes
+    assert( nx == size_x(op, n, m) );
+    assert( ny == size_y(op, n, m) );
+    //
+    // n_nonlinear
+    // argument components with index greater than or equal n_nonlinear
+    // only appear linearly
+    size_t n_nonlinear = nx;
+    if( op == solve_lower_enum || op == solve_trans_enum )
+        n_nonlinear = n * n;
+    //
+    // pair
+    // set of (j1, j2) pairs in the pattern
+    std::set< std::pair<size_t, size_t> > pair;
+    CppAD::vector<size_t> dep_x;
+    for(size_t i = 0; i < ny; ++i) if( select_y[i] )
+    {   depend(op, n, m, i, dep_x);
+        for(size_t k1 = 0; k1 < dep_x.size(); ++k1)
+        {   size_t j1 = dep_x[k1];
+            if( select_x[j1] )
+            {   for(size_t k2 = 0; k2 < dep_x.size(); ++k2)
+                {   size_t j2 = dep_x[k2];
+                    bool nonlinear = j1 < n_nonlinear || j2 < n_nonlinear;
+                    if( select_x[j2] && nonlinear )
+                        pair.insert( std::make_pair(j1, j2) );
+                }
+            }
+        }
+    }
+    //
+    // pattern_out
+    pattern_out.resize(nx, nx, pair.size());
+    size_t k = 0;
+    std::set< std::pair<size_t, size_t> >::const_iterator itr;
+    for(itr = pair.begin(); itr != pair.end(); ++itr)
+        pattern_out.set(k++, itr->first, itr->second);
+    //
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,85 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_JAC_SPARSITY_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_JAC_SPARSITY_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_jac_sparsity.hpp$$
+$spell
+    alg
+    Jacobian
+    jac
+$$
+
+$section
+Atomic Linear Algebra Jacobian Sparsity Pattern: Example Implementation
+$$
+
+$head Purpose$$
+The $code jac_sparsity$$ routine overrides the virtual functions
+used by the atomic_four base class for Jacobian sparsity calculations; see
+$cref/jac_sparsity/atomic_four_jac_sparsity/$$.
+The pattern is the $cref/dependency/atomic_four_lin_alg_depend.hpp/$$
+pattern for each selected result component.
+
+$head Example$$
+The file $cref atomic_four_lin_alg_sparsity.cpp$$
+contains an example and test using this operator.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// jac_sparsity override
+template <class Base>
+bool atomic_lin_alg<Base>::jac_sparsity(
+    size_t                                         call_id      ,
+    bool                                           dependency   ,
+    const CppAD::vector<bool>&                     ident_zero_x ,
+    const CppAD::vector<bool>&                     select_x     ,
+    const CppAD::vector<bool>&                     select_y     ,
+    CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out  )
+{
+    // op, n, m
+    op_enum_t op;
+    size_t    n, m;
+    get(call_id, op, n, m);
+    //
+    // nx, ny
+    size_t nx = select_x.size();
+    size_t ny = select_y.size();
+    //
+    // check sizes
+    assert( nx == size_x(op, n, m) );
+    assert( ny == size_y(op, n, m) );
+    //
+    // pattern_out
+    CppAD::vector<size_t> dep_x;
+    pattern_out.resize(ny, nx, 0);
+    for(size_t i = 0; i < ny; ++i) if( select_y[i] )
+    {   depend(op, n, m, i, dep_x);
+        for(size_t k = 0; k < dep_x.size(); ++k)
+        {   size_t j = dep_x[k];
+            if( select_x[j] )
+                pattern_out.push_back(i, j);
+        }
+    }
+    //
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,212 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_KERNEL_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_KERNEL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_kernel.hpp$$
+$spell
+    alg
+    Cholesky
+$$
+
+$section
+Atomic Linear Algebra Kernels: Example Implementation
+$$
+
+$head Purpose$$
+The Taylor coefficient calculations in
+$cref atomic_four_lin_alg_forward.hpp$$ and
+$cref atomic_four_lin_alg_reverse.hpp$$ are templated on the scalar type.
+They use these kernels for the triangular solves, the
+zero order Cholesky factorization, and multiplication by a
+lower triangular matrix.
+
+$head Base$$
+The $icode Base$$ versions of the kernels loop over the rows of the matrices
+so that the inner loops access contiguous memory
+(all the matrices are stored in row major order).
+
+$head AD<Base>$$
+The $codei%AD<%Base%>%$$ versions of the kernels
+call this atomic function.
+Hence the recording of the derivative calculations uses one atomic
+operation for each solve or factorization, instead of one operation
+for each scalar multiply and add.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// Base solve_kernel
+// X = L^{-1} B  if trans is false
+// X = L^{-T} B  if trans is true
+// where L is the lower triangle of an n by n matrix and B is n by m.
+template <class Base>
+void atomic_lin_alg<Base>::solve_kernel(
+    bool                                             trans,
+    size_t                                           n,
+    size_t                                           m,
+    const CppAD::vector<Base>&                       L,
+    const CppAD::vector<Base>&                       B,
+    CppAD::vector<Base>&                             X
+)
+{   assert( L.size() == n * n );
+    assert( B.size() == n * m );
+    assert( X.size() == n * m );
+    //
+    for(size_t ell = 0; ell < n; ++ell)
+    {   // i
+        // forward substitution for L, back substitution for L^T
+        size_t i = ell;
+        if( trans )
+            i = n - ell - 1;
+        //
+        // x_i
+        Base*       x_i = X.data() + i * m;
+        const Base* b_i = B.data() + i * m;
+        for(size_t j = 0; j < m; ++j)
+            x_i[j] = b_i[j];
+        //
+        // x_i -= sum_{k < i} L(i,k) x_k  if trans is false
+        // x_i -= sum_{k > i} L(k,i) x_k  if trans is true
+        size_t k_start = 0, k_end = i;
+        if( trans )
+        {   k_start = i + 1;
+            k_end   = n;
+        }
+        for(size_t k = k_start; k < k_end; ++k)
+        {   Base        l_ik = trans ? L[k * n + i] : L[i * n + k];
+            const Base* x_k  = X.data() + k * m;
+            for(size_t j = 0; j < m; ++j)
+                x_i[j] -= l_ik * x_k[j];
+        }
+        //
+        // x_i = x_i / L(i,i)
+        Base l_ii = L[i * n + i];
+        for(size_t j = 0; j < m; ++j)
+            x_i[j] /= l_ii;
+    }
+}
+//
+// AD<Base> solve_kernel
+template <class Base>
+void atomic_lin_alg<Base>::solve_kernel(
+    bool                                             trans,
+    size_t                                           n,
+    size_t                                           m,
+    const ad_vector&                                 L,
+    const ad_vector&                                 B,
+    ad_vector&                                       X
+)
+{   assert( L.size() == n * n );
+    assert( B.size() == n * m );
+    assert( X.size() == n * m );
+    //
+    // ax
+    ad_vector ax(n * n + n * m);
+    for(size_t i = 0; i < n * n; ++i)
+        ax[i] = L[i];
+    for(size_t i = 0; i < n * m; ++i)
+        ax[n * n + i] = B[i];
+    //
+    // X
+    op_enum_t op = trans ? solve_trans_enum : solve_lower_enum;
+    size_t call_id = set(op, n, m);
+    (*this)(call_id, ax, X);
+}
+//
+// Base cholesky_kernel
+// L * L^T = A where L is lower triangular and only the lower triangle of
+// the n by n matrix A is used.
+template <class Base>
+void atomic_lin_alg<Base>::cholesky_kernel(
+    size_t                                           n,
+    const CppAD::vector<Base>&                       A,
+    CppAD::vector<Base>&                             L
+)
+{   assert( A.size() == n * n );
+    assert( L.size() == n * n );
+    //
+    for(size_t i = 0; i < n; ++i)
+    {   Base* l_i = L.data() + i * n;
+        for(size_t j = 0; j <= i; ++j)
+        {   // sum = A(i,j) - sum_{k < j} L(i,k) L(j,k)
+            const Base* l_j = L.data() + j * n;
+            Base sum        = A[i * n + j];
+            for(size_t k = 0; k < j; ++k)
+                sum -= l_i[k] * l_j[k];
+            //
+            // L(i,j)
+            if( j == i )
+                l_i[j] = CppAD::sqrt(sum);
+            else
+                l_i[j] = sum / l_j[j];
+        }
+        for(size_t j = i + 1; j < n; ++j)
+            l_i[j] = Base(0);
+    }
+}
+//
+// AD<Base> cholesky_kernel
+template <class Base>
+void atomic_lin_alg<Base>::cholesky_kernel(
+    size_t                                           n,
+    const ad_vector&                                 A,
+    ad_vector&                                       L
+)
+{   assert( A.size() == n * n );
+    assert( L.size() == n * n );
+    //
+    size_t call_id = set(cholesky_enum, n, 0);
+    (*this)(call_id, A, L);
+}
+//
+// sub_mul_lower
+// R = R - L * X    if trans is false
+// R = R - L^T * X  if trans is true
+// where only the lower triangle of the n by n matrix L is used,
+// and X and R are n by m.
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::sub_mul_lower(
+    bool                                             trans,
+    size_t                                           n,
+    size_t                                           m,
+    const CppAD::vector<Scalar>&                     L,
+    const CppAD::vector<Scalar>&                     X,
+    CppAD::vector<Scalar>&                           R
+)
+{   assert( L.size() == n * n );
+    assert( X.size() == n * m );
+    assert( R.size() == n * m );
+    //
+    for(size_t i = 0; i < n; ++i)
+    {   // k_start, k_end
+        size_t k_start = 0, k_end = i + 1;
+        if( trans )
+        {   k_start = i;
+            k_end   = n;
+        }
+        for(size_t k = k_start; k < k_end; ++k)
+        {   const Scalar& l_ik = trans ? L[k * n + i] : L[i * n + k];
+            for(size_t j = 0; j < m; ++j)
+                R[i * m + j] -= l_ik * X[k * m + j];
+        }
+    }
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
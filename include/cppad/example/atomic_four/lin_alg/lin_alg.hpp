@@ -0,0 +1,326 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_LIN_ALG_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_LIN_ALG_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg.hpp$$
+$spell
+    alg
+$$
+
+$section Atomic Linear Algebra Class: Example Implementation$$
+
+$head op_enum_t$$
+$srcthisfile%0%// BEGIN op_enum_t%// END op_enum_t%1%$$
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+template <class Base>
+class atomic_lin_alg : public CppAD::atomic_four<Base> {
+//
+public:
+    // BEGIN op_enum_t
+    // atomic_lin_alg::op_enum_t
+    typedef enum {
+        cholesky_enum,
+        logdet_enum,
+        solve_lower_enum,
+        solve_trans_enum,
+        number_op_enum
+    } op_enum_t;
+    // END op_enum_t
+    //
+    // ctor
+    atomic_lin_alg(const std::string& name) :
+    CppAD::atomic_four<Base>(name)
+    {   for(size_t thread = 0; thread < CPPAD_MAX_NUM_THREADS; ++thread)
+            work_[thread] = nullptr;
+    }
+    // destructor
+    ~atomic_lin_alg(void)
+    {   for(size_t thread = 0; thread < CPPAD_MAX_NUM_THREADS; ++thread)
+        {   if( work_[thread] != nullptr  )
+            {   // allocated in set member function
+                delete work_[thread];
+            }
+        }
+    }
+    // set
+    size_t set(op_enum_t op, size_t n, size_t m);
+    //
+    // get
+    void get(size_t call_id, op_enum_t& op, size_t& n, size_t& m);
+    //
+    // size_x, size_y
+    static size_t size_x(op_enum_t op, size_t n, size_t m);
+    static size_t size_y(op_enum_t op, size_t n, size_t m);
+private:
+    typedef CppAD::vector< CppAD::AD<Base> >              ad_vector;
+    //
+    // operator and dimensions corresponding to a call_id
+    struct call_struct {
+        op_enum_t op; size_t n; size_t m; size_t thread;
+    };
+    // map from call_id to operator and dimensions
+    typedef CppAD::vector<call_struct> call_vector;
+    //
+    // Use pointers, to avoid false sharing between threads.
+    call_vector* work_[CPPAD_MAX_NUM_THREADS];
+    //
+    // -----------------------------------------------------------------------
+    // kernels (see kernel.hpp)
+    // -----------------------------------------------------------------------
+    // solve_kernel
+    void solve_kernel(
+        bool                                             trans,
+        size_t                                           n,
+        size_t                                           m,
+        const CppAD::vector<Base>&                       L,
+        const CppAD::vector<Base>&                       B,
+        CppAD::vector<Base>&                             X
+    );
+    void solve_kernel(
+        bool                                             trans,
+        size_t                                           n,
+        size_t                                           m,
+        const ad_vector&                                 L,
+        const ad_vector&                                 B,
+        ad_vector&                                       X
+    );
+    // cholesky_kernel
+    void cholesky_kernel(
+        size_t                                           n,
+        const CppAD::vector<Base>&                       A,
+        CppAD::vector<Base>&                             L
+    );
+    void cholesky_kernel(
+        size_t                                           n,
+        const ad_vector&                                 A,
+        ad_vector&                                       L
+    );
+    // sub_mul_lower
+    template <class Scalar> static void sub_mul_lower(
+        bool                                             trans,
+        size_t                                           n,
+        size_t                                           m,
+        const CppAD::vector<Scalar>&                     L,
+        const CppAD::vector<Scalar>&                     X,
+        CppAD::vector<Scalar>&                           R
+    );
+    //
+    // -----------------------------------------------------------------------
+    // dependency (see depend.hpp)
+    // -----------------------------------------------------------------------
+    // depend
+    static void depend(
+        op_enum_t                                        op,
+        size_t                                           n,
+        size_t                                           m,
+        size_t                                           i,
+        CppAD::vector<size_t>&                           dep_x
+    );
+    //
+    // -----------------------------------------------------------------------
+    // Taylor coefficient calculations (see forward.hpp and reverse.hpp)
+    // Scalar is Base or AD<Base>
+    // -----------------------------------------------------------------------
+    template <class Scalar> using mat_list =
+        CppAD::vector< CppAD::vector<Scalar> >;
+    //
+    // get_list
+    // list[k][i] = taylor[ (offset + i) * q + k ] for k < q, i < size
+    template <class Scalar> static void get_list(
+        size_t                                           offset,
+        size_t                                           size,
+        size_t                                           q,
+        const CppAD::vector<Scalar>&                     taylor,
+        mat_list<Scalar>&                                list
+    );
+    // set_list
+    // taylor[ (offset + i) * q + k ] = list[k][i] for order_low <= k < q
+    template <class Scalar> static void set_list(
+        size_t                                           offset,
+        size_t                                           order_low,
+        const mat_list<Scalar>&                          list,
+        CppAD::vector<Scalar>&                           taylor
+    );
+    //
+    // forward_solve
+    template <class Scalar> void forward_solve(
+        bool                                             trans,
+        size_t                                           n,
+        size_t                                           m,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::vector<Scalar>&                     taylor_x,
+        CppAD::vector<Scalar>&                           taylor_y
+    );
+    // forward_cholesky
+    template <class Scalar> void forward_cholesky(
+        size_t                                           n,
+        size_t                                           order_low,
+        const mat_list<Scalar>&                          A,
+        mat_list<Scalar>&                                L
+    );
+    // forward_logdet
+    template <class Scalar> void forward_logdet(
+        size_t                                           n,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::vector<Scalar>&                     taylor_x,
+        CppAD::vector<Scalar>&                           taylor_y
+    );
+    // forward_any
+    template <class Scalar> void forward_any(
+        size_t                                           call_id,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::vector<Scalar>&                     taylor_x,
+        CppAD::vector<Scalar>&                           taylor_y
+    );
+    //
+    // reverse_solve
+    template <class Scalar> void reverse_solve(
+        bool                                             trans,
+        size_t                                           n,
+        size_t                                           m,
+        size_t                                           order_up,
+        const CppAD::vector<Scalar>&                     taylor_x,
+        const CppAD::vector<Scalar>&                     taylor_y,
+        CppAD::vector<Scalar>&                           partial_x,
+        const CppAD::vector<Scalar>&                     partial_y
+    );
+    // reverse_cholesky
+    template <class Scalar> void reverse_cholesky(
+        size_t                                           n,
+        const mat_list<Scalar>&                          L,
+        mat_list<Scalar>&                                A_bar,
+        mat_list<Scalar>&                                L_bar
+    );
+    // reverse_logdet
+    template <class Scalar> void reverse_logdet(
+        size_t                                           n,
+        size_t                                           order_up,
+        const CppAD::vector<Scalar>&                     taylor_x,
+        CppAD::vector<Scalar>&                           partial_x,
+        const CppAD::vector<Scalar>&                     partial_y
+    );
+    // reverse_any
+    template <class Scalar> void reverse_any(
+        size_t                                           call_id,
+        size_t                                           order_up,
+        const CppAD::vector<Scalar>&                     taylor_x,
+        const CppAD::vector<Scalar>&                     taylor_y,
+        CppAD::vector<Scalar>&                           partial_x,
+        const CppAD::vector<Scalar>&                     partial_y
+    );
+    //
+    // -----------------------------------------------------------------------
+    // overrides
+    // -----------------------------------------------------------------------
+    //
+    // for_type
+    bool for_type(
+        size_t                                        call_id,
+        const CppAD::vector<CppAD::ad_type_enum>&     type_x,
+        CppAD::vector<CppAD::ad_type_enum>&           type_y
+    ) override;
+    //
+    // Base forward
+    bool forward(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_y,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       taylor_x,
+        CppAD::vector<Base>&                             taylor_y
+    ) override;
+    //
+    // AD<Base> forward
+    bool forward(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_y,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const ad_vector&                                 ataylor_x,
+        ad_vector&                                       ataylor_y
+    ) override;
+    //
+    // Base reverse
+    bool reverse(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_x,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       taylor_x,
+        const CppAD::vector<Base>&                       taylor_y,
+        CppAD::vector<Base>&                             partial_x,
+        const CppAD::vector<Base>&                       partial_y
+    ) override;
+    //
+    // AD<Base> reverse
+    bool reverse(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_x,
+        size_t                                           order_up,
+        const ad_vector&                                 ataylor_x,
+        const ad_vector&                                 ataylor_y,
+        ad_vector&                                       apartial_x,
+        const ad_vector&                                 apartial_y
+    ) override;
+    //
+    // jac_sparsity
+    bool jac_sparsity(
+        size_t                                         call_id,
+        bool                                           dependency,
+        const CppAD::vector<bool>&                     ident_zero_x,
+        const CppAD::vector<bool>&                     select_x,
+        const CppAD::vector<bool>&                     select_y,
+        CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out
+    ) override;
+    //
+    // hes_sparsity
+    bool hes_sparsity(
+        size_t                                         call_id,
+        const CppAD::vector<bool>&                     select_x,
+        const CppAD::vector<bool>&                     select_y,
+        CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out
+    ) override;
+    //
+    // rev_depend
+    bool rev_depend(
+        size_t                                         call_id,
+        CppAD::vector<bool>&                           depend_x,
+        const CppAD::vector<bool>&                     depend_y
+    ) override;
+};
+} // END_CPPAD_NAMESPACE
+
+# include <cppad/example/atomic_four/lin_alg/set.hpp>
+# include <cppad/example/atomic_four/lin_alg/get.hpp>
+# include <cppad/example/atomic_four/lin_alg/kernel.hpp>
+# include <cppad/example/atomic_four/lin_alg/depend.hpp>
+# include <cppad/example/atomic_four/lin_alg/for_type.hpp>
+# include <cppad/example/atomic_four/lin_alg/forward.hpp>
+# include <cppad/example/atomic_four/lin_alg/reverse.hpp>
+# include <cppad/example/atomic_four/lin_alg/jac_sparsity.hpp>
+# include <cppad/example/atomic_four/lin_alg/hes_sparsity.hpp>
+# include <cppad/example/atomic_four/lin_alg/rev_depend.hpp>
+// END C++
+# endif
@@ -0,0 +1,73 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_REV_DEPEND_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_REV_DEPEND_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_rev_depend.hpp$$
+$spell
+    alg
+$$
+
+$section
+Atomic Linear Algebra Reverse Dependency Analysis: Example Implementation
+$$
+
+$head Purpose$$
+The $code rev_depend$$ routine is used by $cref optimize$$
+to reduce the number of variables in the recording of a function.
+An argument component is needed if one of the result components that
+$cref/depends/atomic_four_lin_alg_depend.hpp/$$ on it is needed.
+
+$head Example$$
+The file $cref atomic_four_lin_alg_sparsity.cpp$$
+contains an example and test using this operator.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// rev_depend override
+template <class Base>
+bool atomic_lin_alg<Base>::rev_depend(
+    size_t                         call_id  ,
+    CppAD::vector<bool>&           depend_x ,
+    const CppAD::vector<bool>&     depend_y )
+{
+    // op, n, m
+    op_enum_t op;
+    size_t    n, m;
+    get(call_id, op, n, m);
+    //
+    // check sizes
+    assert( depend_x.size() == size_x(op, n, m) );
+    assert( depend_y.size() == size_y(op, n, m) );
+    //
+    // depend_x
+    for(size_t j = 0; j < depend_x.size(); ++j)
+        depend_x[j] = false;
+    CppAD::vector<size_t> dep_x;
+    for(size_t i = 0; i < depend_y.size(); ++i) if( depend_y[i] )
+    {   depend(op, n, m, i, dep_x);
+        for(size_t k = 0; k < dep_x.size(); ++k)
+            depend_x[ dep_x[k] ] = true;
+    }
+    //
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,384 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_REVERSE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_REVERSE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_reverse.hpp$$
+$spell
+    alg
+    logdet
+$$
+
+$section
+Atomic Linear Algebra Reverse Mode: Example Implementation
+$$
+
+$head Purpose$$
+The $code reverse$$ routine overrides the virtual functions
+used by the atomic_four base class for reverse mode calculations; see
+$cref/reverse/atomic_four_reverse/$$.
+It has a mathematical $cref/theory/atomic_four_lin_alg/Theory/Reverse/$$
+for each operator.
+
+$head Scalar$$
+As for $cref/forward/atomic_four_lin_alg_forward.hpp/Scalar/$$,
+the calculations are templated on the type $icode Scalar$$.
+
+$head Example$$
+The files $cref atomic_four_lin_alg_solve.cpp$$,
+$cref atomic_four_lin_alg_cholesky.cpp$$, and
+$cref atomic_four_lin_alg_logdet.cpp$$ contain examples and tests
+that use reverse mode.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// reverse_solve
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::reverse_solve(
+    bool                                             trans,
+    size_t                                           n,
+    size_t                                           m,
+    size_t                                           order_up,
+    const CppAD::vector<Scalar>&                     taylor_x,
+    const CppAD::vector<Scalar>&                     taylor_y,
+    CppAD::vector<Scalar>&                           partial_x,
+    const CppAD::vector<Scalar>&                     partial_y
+)
+{   // q
+    size_t q = order_up + 1;
+    //
+    // L, X, X_bar
+    mat_list<Scalar> L, X, X_bar;
+    get_list(0, n * n, q, taylor_x, L);
+    get_list(0, n * m, q, taylor_y, X);
+    get_list(0, n * m, q, partial_y, X_bar);
+    //
+    // L_bar, B_bar
+    mat_list<Scalar> L_bar(q), B_bar(q);
+    for(size_t k = 0; k < q; ++k)
+    {   L_bar[k].resize(n * n);
+        B_bar[k].resize(n * m);
+        for(size_t i = 0; i < n * n; ++i)
+            L_bar[k][i] = Scalar(0);
+    }
+    //
+    // k = q-1, ... , 0
+    size_t k = q;
+    while( k-- )
+    {   // B_bar[k] = R_bar = op(L[0])^{-T} X_bar[k]
+        CppAD::vector<Scalar>& R_bar( B_bar[k] );
+        solve_kernel(! trans, n, m, L[0], X_bar[k], R_bar);
+        //
+        for(size_t d = 0; d <= k; ++d)
+        {   // L_bar[d] -= lower triangle of R_bar X[k-d]^T  (trans false)
+            // L_bar[d] -= lower triangle of X[k-d] R_bar^T  (trans true)
+            const CppAD::vector<Scalar>& U = trans ? X[k-d] : R_bar;
+            const CppAD::vector<Scalar>& V = trans ? R_bar  : X[k-d];
+            for(size_t i = 0; i < n; ++i)
+            {   for(size_t j = 0; j <= i; ++j)
+                {   for(size_t ell = 0; ell < m; ++ell)
+                        L_bar[d][i * n + j] -= U[i * m + ell] * V[j * m + ell];
+                }
+            }
+            //
+            // X_bar[k-d] -= op(L[d])^T R_bar
+            if( 0 < d )
+                sub_mul_lower(! trans, n, m, L[d], R_bar, X_bar[k-d]);
+        }
+    }
+    //
+    // partial_x
+    set_list(0,     0, L_bar, partial_x);
+    set_list(n * n, 0, B_bar, partial_x);
+}
+//
+// reverse_cholesky
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::reverse_cholesky(
+    size_t                                           n,
+    const mat_list<Scalar>&                          L,
+    mat_list<Scalar>&                                A_bar,
+    mat_list<Scalar>&                                L_bar
+)
+{   // q
+    size_t q = L.size();
+    assert( L_bar.size() == q );
+    //
+    // A_bar
+    A_bar.resize(q);
+    for(size_t k = 0; k < q; ++k)
+    {   A_bar[k].resize(n * n);
+        for(size_t i = 0; i < n * n; ++i)
+            A_bar[k][i] = Scalar(0);
+    }
+    //
+    // M_bar, Y, W, B_bar, P, T
+    CppAD::vector<Scalar> M_bar(n * n), Y(n * n), W(n * n), B_bar(n * n);
+    CppAD::vector<Scalar> P(n * n), T(n * n);
+    //
+    // k = q-1, ... , 0
+    size_t k = q;
+    while( k-- )
+    {   // L_bar[k]
+        // only the lower triangle is used
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t j = i + 1; j < n; ++j)
+                L_bar[k][i * n + j] = Scalar(0);
+        }
+        //
+        // M_bar = Phi^T( L[0]^T L_bar[k] )
+        // where Phi^T is the adjoint of Phi; i.e., it selects the lower
+        // triangle and halves the diagonal
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t j = 0; j <= i; ++j)
+            {   Scalar sum = Scalar(0);
+                for(size_t r = i; r < n; ++r)
+                    sum += L[0][r * n + i] * L_bar[k][r * n + j];
+                if( i == j )
+                    sum /= Scalar(2);
+                M_bar[i * n + j] = sum;
+            }
+            for(size_t j = i + 1; j < n; ++j)
+                M_bar[i * n + j] = Scalar(0);
+        }
+        //
+        // B_bar = L[0]^{-T} M_bar L[0]^{-1}
+        solve_kernel(true, n, n, L[0], M_bar, Y);
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t j = 0; j < n; ++j)
+                W[i * n + j] = Y[j * n + i];
+        }
+        solve_kernel(true, n, n, L[0], W, Y);
+        for(size_t i = 0; i < n; ++i)
+        {   for(size_t j = 0; j < n; ++j)
+                B_bar[i * n + j] = Y[j * n + i];
+        }
+        //
+        // A_bar[k]
+        // lower triangle of the partial w.r.t. the symmetric matrix A[k]
+        for(size_t i = 0; i < n; ++i)
+        {   A_bar[k][i * n + i] += B_bar[i * n + i];
+            for(size_t j = 0; j < i; ++j)
+                A_bar[k][i * n + j] += B_bar[i * n + j] + B_bar[j * n + i];
+        }
+        if( 0 < k )
+        {   //
+            // P = Phi(M) = L[0]^{-1} L[k]
+            solve_kernel(false, n, n, L[0], L[k], P);
+            //
+            // T = (M_bar + M_bar^T) M, where M = P + P^T
+            for(size_t i = 0; i < n; ++i)
+            {   for(size_t j = 0; j < n; ++j)
+                {   Scalar sum = Scalar(0);
+                    for(size_t ell = 0; ell < n; ++ell)
+                    {   sum += ( M_bar[i * n + ell] + M_bar[ell * n + i] )
+                            * ( P[ell * n + j] + P[j * n + ell] );
+                    }
+                    T[i * n + j] = sum;
+                }
+            }
+            // Y = L[0]^{-T} T
+            solve_kernel(true, n, n, L[0], T, Y);
+            //
+            // L_bar[0] += lower triangle of L_bar[k] P^T - Y
+            for(size_t i = 0; i < n; ++i)
+            {   for(size_t j = 0; j <= i; ++j)
+                {   Scalar sum = - Y[i * n + j];
+                    for(size_t ell = 0; ell <= j; ++ell)
+                        sum += L_bar[k][i * n + ell] * P[j * n + ell];
+                    L_bar[0][i * n + j] += sum;
+                }
+            }
+            //
+            // B = A[k] - sum_{d=1}^{k-1} L[d] L[k-d]^T
+            // L_bar[d]   -= lower triangle of B_bar   L[k-d]
+            // L_bar[k-d] -= lower triangle of B_bar^T L[d]
+            for(size_t d = 1; d < k; ++d)
+            {   for(size_t i = 0; i < n; ++i)
+                {   for(size_t j = 0; j <= i; ++j)
+                    {   Scalar sum_d  = Scalar(0);
+                        Scalar sum_kd = Scalar(0);
+                        for(size_t ell = j; ell < n; ++ell)
+                        {   sum_d  += B_bar[i * n + ell] * L[k-d][ell * n + j];
+                            sum_kd += B_bar[ell * n + i] * L[d][ell * n + j];
+                        }
+                        L_bar[d][i * n + j]   -= sum_d;
+                        L_bar[k-d][i * n + j] -= sum_kd;
+                    }
+                }
+            }
+        }
+    }
+}
+//
+// reverse_logdet
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::reverse_logdet(
+    size_t                                           n,
+    size_t                                           order_up,
+    const CppAD::vector<Scalar>&                     taylor_x,
+    CppAD::vector<Scalar>&                           partial_x,
+    const CppAD::vector<Scalar>&                     partial_y
+)
+{   // q
+    size_t q = order_up + 1;
+    //
+    // A, L
+    mat_list<Scalar> A, L(q);
+    get_list(0, n * n, q, taylor_x, A);
+    for(size_t k = 0; k < q; ++k)
+        L[k].resize(n * n);
+    forward_cholesky(n, 0, A, L);
+    //
+    // L_bar
+    mat_list<Scalar> L_bar(q);
+    for(size_t k = 0; k < q; ++k)
+    {   L_bar[k].resize(n * n);
+        for(size_t i = 0; i < n * n; ++i)
+            L_bar[k][i] = Scalar(0);
+    }
+    //
+    // z, z_bar
+    CppAD::vector<Scalar> z(q), z_bar(q);
+    for(size_t i = 0; i < n; ++i)
+    {   // u = L_{i,i}, z = log(u), u_bar = L_bar_{i,i}
+        size_t ii = i * n + i;
+        z[0]      = CppAD::log( L[0][ii] );
+        for(size_t k = 1; k < q; ++k)
+        {   z[k] = L[k][ii];
+            for(size_t j = 1; j < k; ++j)
+                z[k] -= Scalar(double(j) / double(k)) * z[j] * L[k-j][ii];
+            z[k] /= L[0][ii];
+        }
+        //
+        // z_bar
+        // y = 2 * sum_i z_i
+        for(size_t k = 0; k < q; ++k)
+            z_bar[k] = Scalar(2) * partial_y[k];
+        //
+        // reverse mode for z = log(u)
+        size_t k = q;
+        while( k-- )
+        {   Scalar zk_bar = z_bar[k] / L[0][ii];
+            L_bar[k][ii] += zk_bar;
+            if( 0 < k )
+            {   L_bar[0][ii] -= zk_bar * z[k];
+                for(size_t j = 1; j < k; ++j)
+                {   Scalar c = Scalar( double(j) / double(k) );
+                    z_bar[j]       -= zk_bar * c * L[k-j][ii];
+                    L_bar[k-j][ii] -= zk_bar * c * z[j];
+                }
+            }
+        }
+    }
+    //
+    // A_bar
+    mat_list<Scalar> A_bar;
+    reverse_cholesky(n, L, A_bar, L_bar);
+    //
+    // partial_x
+    set_list(0, 0, A_bar, partial_x);
+}
+//
+// reverse_any
+template <class Base> template <class Scalar>
+void atomic_lin_alg<Base>::reverse_any(
+    size_t                                           call_id,
+    size_t                                           order_up,
+    const CppAD::vector<Scalar>&                     taylor_x,
+    const CppAD::vector<Scalar>&                     taylor_y,
+    CppAD::vector<Scalar>&                           partial_x,
+    const CppAD::vector<Scalar>&                     partial_y
+)
+{   // op, n, m
+    op_enum_t op;
+    size_t    n, m;
+    get(call_id, op, n, m);
+    //
+    // q
+    size_t q = order_up + 1;
+    //
+    // check sizes
+    assert( taylor_x.size()  == size_x(op, n, m) * q );
+    assert( taylor_y.size()  == size_y(op, n, m) * q );
+    assert( partial_x.size() == taylor_x.size() );
+    assert( partial_y.size() == taylor_y.size() );
+    //
+    switch(op)
+    {   case solve_lower_enum:
+        case solve_trans_enum:
+        reverse_solve(
+            op == solve_trans_enum, n, m, order_up,
+            taylor_x, taylor_y, partial_x, partial_y
+        );
+        break;
+
+        case cholesky_enum:
+        {   mat_list<Scalar> L, L_bar, A_bar;
+            get_list(0, n * n, q, taylor_y, L);
+            get_list(0, n * n, q, partial_y, L_bar);
+            reverse_cholesky(n, L, A_bar, L_bar);
+            set_list(0, 0, A_bar, partial_x);
+        }
+        break;
+
+        case logdet_enum:
+        reverse_logdet(n, order_up, taylor_x, partial_x, partial_y);
+        break;
+
+        default:
+        assert( false );
+        break;
+    }
+}
+//
+// Base reverse override
+template <class Base>
+bool atomic_lin_alg<Base>::reverse(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_x    ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    const CppAD::vector<Base>&                 taylor_y    ,
+    CppAD::vector<Base>&                       partial_x   ,
+    const CppAD::vector<Base>&                 partial_y   )
+{   reverse_any(
+        call_id, order_up, taylor_x, taylor_y, partial_x, partial_y
+    );
+    return true;
+}
+//
+// AD<Base> reverse override
+template <class Base>
+bool atomic_lin_alg<Base>::reverse(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_x    ,
+    size_t                                     order_up    ,
+    const ad_vector&                           ataylor_x   ,
+    const ad_vector&                           ataylor_y   ,
+    ad_vector&                                 apartial_x  ,
+    const ad_vector&                           apartial_y  )
+{   reverse_any(
+        call_id, order_up, ataylor_x, ataylor_y, apartial_x, apartial_y
+    );
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
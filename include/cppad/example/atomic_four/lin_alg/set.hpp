@@ -0,0 +1,87 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_SET_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_LIN_ALG_SET_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+--------------------------------------------------------------------------- */
+/*
+$begin atomic_four_lin_alg_set.hpp$$
+$spell
+    alg
+    op
+$$
+
+$section atomic_lin_alg Set Routine: Example Implementation$$
+
+$head Syntax$$
+$icode%call_id% = %lin_alg%.set(%op%, %n%, %m%)%$$
+
+$head Prototype$$
+$srcthisfile%0%// BEGIN PROTOTYPE%// END PROTOTYPE%1%$$
+
+$head Purpose$$
+Stores the operator and dimension information for an atomic
+linear algebra operation.
+
+$head op$$
+This argument is the operator; see
+$cref/op/atomic_four_lin_alg/op/$$.
+
+$head n$$
+This argument is the row and column dimension of the
+square matrix argument.
+
+$head m$$
+This argument is the column dimension of the right hand side
+for the solve operators. It is not used by the other operators.
+
+$head call_id$$
+This return value identifies the information above.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/lin_alg/lin_alg.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+// BEGIN PROTOTYPE
+template <class Base>
+size_t atomic_lin_alg<Base>::set(
+    op_enum_t op, size_t n, size_t m
+)
+// END PROTOTYPE
+{
+    // thread
+    size_t thread = thread_alloc::thread_num();
+    //
+    // work_[thread]
+    if( work_[thread] == nullptr )
+        work_[thread] = new call_vector;
+    //
+    // call_id
+    size_t call_id = work_[thread]->size();
+    //
+    // call
+    call_struct call;
+    call.op     = op;
+    call.n      = n;
+    call.m      = m;
+    call.thread = thread;
+    //
+    // work_[thread]
+    work_[thread]->push_back( call );
+    //
+    return call_id;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
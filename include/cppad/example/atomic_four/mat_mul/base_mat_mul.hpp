@@ -20,6 +20,14 @@ $section
 Atomic Multiply Base Matrices: Example Implementation
 $$
 
+$head Blocking$$
+The loops over the middle and right indices are split into blocks.
+The rows of the right matrix in a block, and the corresponding
+section of the result, are reused while they are in cache.
+For each element of the result,
+the terms in the sum are added in the same order as without blocking.
+If $icode n_right$$ is one, this is a matrix times a vector.
+
 $head Source$$
 $srcthisfile%0%// BEGIN C++%// END C++%1%$$
 $end
@@ -48,22 +56,34 @@ void atomic_mat_mul<Base>::base_mat_mul(
     assert( m == n_left * n_right );
 # endif
     //
-    // offset
-    size_t offset = n_left * n_middle;
+    // block_size
+    // number of middle and right indices in a block
+    const size_t block_size = 64;
+    //
+    // left, right, result
+    const Base* left   = x.data();
+    const Base* right  = x.data() + n_left * n_middle;
+    Base*       result = y.data();
+    //
+    // result = 0
+    for(size_t ij = 0; ij < n_left * n_right; ++ij)
+        result[ij] = Base(0);
     //
-    // y
-    // y[ i * n_right + j] = sum_k
-    //      x[i * n_middle + k] * x[ offset + k * n_right + j]
-    // type_y
-    for(size_t i = 0; i < n_left; ++i)
-    {   for(size_t j = 0; j < n_right; ++j)
-        {   Base sum_ij = Base(0);
-            for(size_t k = 0; k < n_middle; ++k)
-            {   Base left_ik  = x[i * n_middle + k];
-                Base right_kj = x[offset + k * n_right + j];
-                sum_ij       += left_ik * right_kj;
+    // result[ i * n_right + j] = sum_k
+    //      left[i * n_middle + k] * right[k * n_right + j]
+    for(size_t k_start = 0; k_start < n_middle; k_start += block_size)
+    {   size_t k_end = std::min(k_start + block_size, n_middle);
+        for(size_t j_start = 0; j_start < n_right; j_start += block_size)
+        {   size_t j_end = std::min(j_start + block_size, n_right);
+            for(size_t i = 0; i < n_left; ++i)
+            {   Base* result_i = result + i * n_right;
+                for(size_t k = k_start; k < k_end; ++k)
+                {   Base        left_ik = left[i * n_middle + k];
+                    const Base* right_k = right + k * n_right;
+                    for(size_t j = j_start; j < j_end; ++j)
+                        result_i[j] += left_ik * right_k[j];
+                }
             }
-            y[i * n_right + j] = sum_ij;
         }
     }
     return;
@@ -36,15 +36,15 @@ $end
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 //
-// forward override for Base matrix multiply
+// forward override for Base matrix multiply using views
 template <class Base>
 bool atomic_mat_mul<Base>::forward(
     size_t                                     call_id     ,
     const CppAD::vector<bool>&                 select_y    ,
     size_t                                     order_low   ,
     size_t                                     order_up    ,
-    const CppAD::vector<Base>&                 taylor_x    ,
-    CppAD::vector<Base>&                       taylor_y    )
+    const CppAD::atomic_view<const Base>&      taylor_x    ,
+    const CppAD::atomic_view<Base>&            taylor_y    )
 {
     // q
     size_t q     = order_up + 1;
@@ -52,15 +52,12 @@ bool atomic_mat_mul<Base>::forward(
     // n_left, n_middle, n_right
     size_t n_left, n_middle, n_right;
     get(call_id, n_left, n_middle, n_right);
-# ifndef NDEBUG
-    // n, m
-    size_t n     = taylor_x.size();
-    size_t m     = taylor_y.size();
     //
     // check sizes
-    assert( n == n_middle * ( n_left +  n_right ) * q );
-    assert( m == n_left * n_right * q );
-# endif
+    assert( taylor_x.n_row() == n_middle * ( n_left +  n_right ) );
+    assert( taylor_y.n_row() == n_left * n_right );
+    assert( taylor_x.n_order() == q );
+    assert( taylor_y.n_order() == q );
     //
     // offset
     size_t offset = n_left * n_middle;
@@ -77,9 +74,9 @@ bool atomic_mat_mul<Base>::forward(
         for(size_t ell = 0; ell <= k; ++ell)
         {   // x = [ A^ell, B^{k-ell} ]
             for(size_t i = 0; i < n_left * n_middle; ++i)
-                x[i] = taylor_x[ i * q + ell ];
+                x[i] = taylor_x(i, ell);
             for(size_t i = 0; i < n_middle * n_right; ++i)
-                x[offset + i] = taylor_x[ (offset + i) * q + (k - ell) ];
+                x[offset + i] = taylor_x(offset + i, k - ell);
             //
             // y = A^ell * B^{k-ell}
             base_mat_mul(n_left, n_middle, n_right, x, y);
@@ -90,11 +87,47 @@ bool atomic_mat_mul<Base>::forward(
         }
         // C^k = sum
         for(size_t i = 0; i < n_left * n_right; ++i)
-            taylor_y[i * q + k] = sum[i];
+            taylor_y(i, k) = sum[i];
     }
     return true;
 }
 //
+// forward override for Base matrix multiply
+template <class Base>
+bool atomic_mat_mul<Base>::forward(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_y    ,
+    size_t                                     order_low   ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    CppAD::vector<Base>&                       taylor_y    )
+{
+    // q
+    size_t q     = order_up + 1;
+    //
+    // n, m
+    size_t n     = taylor_x.size() / q;
+    size_t m     = taylor_y.size() / q;
+    //
+    // row_x, row_y
+    CppAD::vector<const Base*> row_x(n);
+    CppAD::vector<Base*>       row_y(m);
+    for(size_t j = 0; j < n; ++j)
+        row_x[j] = taylor_x.data() + j * q;
+    for(size_t i = 0; i < m; ++i)
+        row_y[i] = taylor_y.data() + i * q;
+    //
+    // view version
+    return forward(
+        call_id,
+        select_y,
+        order_low,
+        order_up,
+        CppAD::atomic_view<const Base>(row_x.data(), n, q),
+        CppAD::atomic_view<Base>(row_y.data(), m, q)
+    );
+}
+//
 // forward override for AD<Base> matrix multiply
 template <class Base>
 bool atomic_mat_mul<Base>::forward(
@@ -97,6 +97,16 @@ private:
         CppAD::vector<Base>&                             taylor_y
     ) override;
     //
+    // Base forward using views
+    bool forward(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_y,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::atomic_view<const Base>&            taylor_x,
+        const CppAD::atomic_view<Base>&                  taylor_y
+    ) override;
+    //
     // AD<Base> forward
     bool forward(
         size_t                                           call_id,
@@ -118,6 +128,17 @@ private:
         const CppAD::vector<Base>&                       partial_y
     ) override;
     //
+    // Base reverse using views
+    bool reverse(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_x,
+        size_t                                           order_up,
+        const CppAD::atomic_view<const Base>&            taylor_x,
+        const CppAD::atomic_view<const Base>&            taylor_y,
+        const CppAD::atomic_view<Base>&                  partial_x,
+        const CppAD::atomic_view<const Base>&            partial_y
+    ) override;
+    //
     // AD<Base> reverse
     bool reverse(
         size_t                                           call_id,
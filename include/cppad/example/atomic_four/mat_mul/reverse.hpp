@@ -40,16 +40,16 @@ $end
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 //
-// reverse override for Base matrix multiply
+// reverse override for Base matrix multiply using views
 template <class Base>
 bool atomic_mat_mul<Base>::reverse(
     size_t                                     call_id     ,
     const CppAD::vector<bool>&                 select_y    ,
     size_t                                     order_up    ,
-    const CppAD::vector<Base>&                 taylor_x    ,
-    const CppAD::vector<Base>&                 taylor_y    ,
-    CppAD::vector<Base>&                       partial_x   ,
-    const CppAD::vector<Base>&                 partial_y   )
+    const CppAD::atomic_view<const Base>&      taylor_x    ,
+    const CppAD::atomic_view<const Base>&      taylor_y    ,
+    const CppAD::atomic_view<Base>&            partial_x   ,
+    const CppAD::atomic_view<const Base>&      partial_y   )
 {
     // q
     size_t q     = order_up + 1;
@@ -57,17 +57,14 @@ bool atomic_mat_mul<Base>::reverse(
     // n_left, n_middle, n_right
     size_t n_left, n_middle, n_right;
     get(call_id, n_left, n_middle, n_right);
-# ifndef NDEBUG
-    // n, m
-    size_t n     = taylor_x.size();
-    size_t m     = taylor_y.size();
     //
     // check sizes
-    assert( n == n_middle * ( n_left +  n_right ) * q );
-    assert( m == n_left * n_right * q );
-    assert( n == partial_x.size() );
-    assert( m == partial_y.size() );
-# endif
+    assert( taylor_x.n_row() == n_middle * ( n_left +  n_right ) );
+    assert( taylor_y.n_row() == n_left * n_right );
+    assert( partial_x.n_row() == taylor_x.n_row() );
+    assert( partial_y.n_row() == taylor_y.n_row() );
+    assert( taylor_x.n_order() == q );
+    assert( partial_x.n_order() == q );
     //
     // offset
     size_t x_offset = n_left * n_middle;
@@ -78,10 +75,6 @@ bool atomic_mat_mul<Base>::reverse(
     CppAD::vector<Base> v;
     size_t u_offset;
     //
-    // partial_x
-    for(size_t i = 0; i < partial_x.size(); ++i)
-        partial_x[i] = Base(0);
-    //
     // k
     size_t k = q;
     while(k > 0)
@@ -90,20 +83,20 @@ bool atomic_mat_mul<Base>::reverse(
         // for ell = 0, ..., k :
         //    bar{A}^ell      += bar{C}^k [ B^{k-ell} ]^T
         //    bar{B}^{k-ell}  += [ A^ell ]^T \bar{C}^k
-        for(size_t ell = 0; ell < q; ++ell)
+        for(size_t ell = 0; ell <= k; ++ell)
         {   //
             // u = [ \bar{C}^k, B^{k-ell}^T ]
             u.resize(0);
             u.resize( n_left * n_right + n_right * n_middle );
             u_offset = n_left * n_right;
             for(size_t i = 0; i < n_left * n_right; ++i)
-                u[i] = partial_y[ i * q + k ];
+                u[i] = partial_y(i, k);
             for(size_t i = 0; i < n_middle; ++i)
             {   for(size_t j = 0; j < n_right; ++j)
                 {   size_t ij = i * n_right + j;
                     size_t ji = j * n_middle + i;
                     u[u_offset + ji] =
-                        taylor_x[(x_offset + ij) * q + (k - ell) ];
+                        taylor_x(x_offset + ij, k - ell);
                 }
             }
             //
@@ -114,7 +107,7 @@ bool atomic_mat_mul<Base>::reverse(
             //
             // \bar{A}^ell += v
             for(size_t i = 0; i < n_left * n_middle; ++i)
-                partial_x[i * q + ell] += v[i];
+                partial_x(i, ell) += v[i];
             //
             // u = [ A^ell^T , \bar{C}^k ]
             u.resize(0);
@@ -124,11 +117,11 @@ bool atomic_mat_mul<Base>::reverse(
             {   for(size_t j = 0; j < n_middle; ++j)
                 {   size_t ij = i * n_middle + j;
                     size_t ji = j * n_left + i;
-                    u[ji] = taylor_x[ij * q + ell];
+                    u[ji] = taylor_x(ij, ell);
                 }
             }
             for(size_t i = 0; i < n_left * n_right; ++i)
-                u[u_offset + i] = partial_y[ i * q + k ];
+                u[u_offset + i] = partial_y(i, k);
             //
             // v = [ A^ell ]^T * \bar{C}^k
             v.resize(0);
@@ -137,12 +130,59 @@ bool atomic_mat_mul<Base>::reverse(
             //
             // \bar{B}^{k-\ell} += v
             for(size_t i = 0; i < n_middle * n_right; ++i)
-                partial_x[ (x_offset + i) * q + (k - ell) ] += v[i];
+                partial_x(x_offset + i, k - ell) += v[i];
         }
     }
     return true;
 }
 //
+// reverse override for Base matrix multiply
+template <class Base>
+bool atomic_mat_mul<Base>::reverse(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_y    ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    const CppAD::vector<Base>&                 taylor_y    ,
+    CppAD::vector<Base>&                       partial_x   ,
+    const CppAD::vector<Base>&                 partial_y   )
+{
+    // q
+    size_t q     = order_up + 1;
+    //
+    // n, m
+    size_t n     = taylor_x.size() / q;
+    size_t m     = taylor_y.size() / q;
+    //
+    // partial_x
+    // (the view version adds to partial_x)
+    for(size_t i = 0; i < partial_x.size(); ++i)
+        partial_x[i] = Base(0);
+    //
+    // row_tx, row_ty, row_px, row_py
+    CppAD::vector<const Base*> row_tx(n), row_ty(m), row_py(m);
+    CppAD::vector<Base*>       row_px(n);
+    for(size_t j = 0; j < n; ++j)
+    {   row_tx[j] = taylor_x.data() + j * q;
+        row_px[j] = partial_x.data() + j * q;
+    }
+    for(size_t i = 0; i < m; ++i)
+    {   row_ty[i] = taylor_y.data() + i * q;
+        row_py[i] = partial_y.data() + i * q;
+    }
+    //
+    // view version
+    return reverse(
+        call_id,
+        select_y,
+        order_up,
+        CppAD::atomic_view<const Base>(row_tx.data(), n, q),
+        CppAD::atomic_view<const Base>(row_ty.data(), m, q),
+        CppAD::atomic_view<Base>(row_px.data(), n, q),
+        CppAD::atomic_view<const Base>(row_py.data(), m, q)
+    );
+}
+//
 // reverse override for AD<Base> matrix multiply
 template <class Base>
 bool atomic_mat_mul<Base>::reverse(
@@ -194,7 +234,7 @@ bool atomic_mat_mul<Base>::reverse(
         // for ell = 0, ..., k :
         //    bar{A}^ell      += bar{C}^k [ B^{k-ell} ]^T
         //    bar{B}^{k-ell}  += [ A^ell ]^T \bar{C}^k
-        for(size_t ell = 0; ell < q; ++ell)
+        for(size_t ell = 0; ell <= k; ++ell)
         {   //
             // u = [ \bar{C}^k, B^{k-ell}^T ]
             u.resize(0);
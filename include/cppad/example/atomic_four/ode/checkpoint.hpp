@@ -0,0 +1,301 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_CHECKPOINT_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_CHECKPOINT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_ode_checkpoint.hpp$$
+$spell
+    Runge
+    Hermite
+$$
+
+$section
+Atomic ODE Checkpoints: Example Implementation
+$$
+
+$head set_checkpoint$$
+The $code set_checkpoint$$ routine solves the ODE
+$latex z_t (t) = G[ z(t), p ]$$ from $latex t = 0$$ to $latex t = r$$
+using one $cref Runge45$$ step at a time.
+A step is accepted when the maximum of its error estimate is less than
+or equal $cref/tolerance/atomic_four_ode/tolerance/$$.
+The next step size is chosen using the usual fifth order
+error estimate
+$latex \[
+    h_{k+1} = h_k \cdot 0.9 \cdot ( \R{tolerance} / e_k )^{1/5}
+\] $$
+where $latex e_k$$ is the error estimate for the current step,
+and the ratio $latex h_{k+1} / h_k$$ is limited to the interval
+$latex [ 0.2 , 5 ]$$.
+The time $latex t_k$$, state $latex z_k$$ and derivative
+$latex G( z_k , p )$$ at the end of each accepted step
+are stored as checkpoints.
+The checkpoints are not recomputed when $code set_checkpoint$$ is called
+with the same value of $latex x = ( z(0), p )$$ as the previous call.
+It returns false if the step size becomes zero or not a number.
+
+$head interpolate$$
+The $code interpolate$$ routine approximates $latex z(t)$$
+for $latex t$$ between $latex t_k$$ and $latex t_{k+1}$$
+using the cubic Hermite polynomial that matches
+the values and derivatives at the two checkpoints.
+
+$head forward_ode$$
+This class evaluates $latex G( z , p^0 )$$ and, if a first order
+Taylor coefficient $latex p^1$$ is present,
+the tangent equation
+$latex \[
+    z_t^1 (t) = G_z [ z^0 (t) , p^0 ] z^1 (t) + G_p [ z^0 (t), p^0 ] p^1
+\] $$
+
+$head adjoint_ode$$
+This class evaluates the adjoint equations
+$latex \[
+\begin{array}{rcl}
+    \lambda_t (t) & = & - G_z [ z(t) , p ]^\R{T} \lambda (t)
+    \\
+    \mu_t (t) & = & - G_p [ z(t) , p ]^\R{T} \lambda (t)
+\end{array}
+\] $$
+where $latex z(t)$$ is approximated using $code interpolate$$.
+The right hand side is computed using one zero order forward
+and one first order reverse mode calculation for $icode fun$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/ode/ode.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+// ---------------------------------------------------------------------------
+// forward_ode
+template <class Base>
+class atomic_ode<Base>::forward_ode {
+private:
+    ADFun<Base>&                fun_;
+    const CppAD::vector<Base>&  p0_;
+    const CppAD::vector<Base>&  p1_;
+public:
+    // if p1.size() is zero, the state is z^0, otherwise it is (z^0, z^1)
+    forward_ode(
+        ADFun<Base>&                fun ,
+        const CppAD::vector<Base>&  p0  ,
+        const CppAD::vector<Base>&  p1  )
+    : fun_(fun), p0_(p0), p1_(p1)
+    { }
+    void Ode(
+        const Base&                t ,
+        const CppAD::vector<Base>& z ,
+        CppAD::vector<Base>&       f )
+    {   size_t n_z = fun_.Range();
+        size_t n_p = p0_.size();
+        //
+        // f^0 = G(z^0, p^0)
+        CppAD::vector<Base> zp(n_z + n_p), fk;
+        for(size_t i = 0; i < n_z; ++i)
+            zp[i] = z[i];
+        for(size_t j = 0; j < n_p; ++j)
+            zp[n_z + j] = p0_[j];
+        fk = fun_.Forward(0, zp);
+        for(size_t i = 0; i < n_z; ++i)
+            f[i] = fk[i];
+        if( p1_.size() == 0 )
+            return;
+        //
+        // f^1 = G_z(z^0, p^0) z^1 + G_p(z^0, p^0) p^1
+        for(size_t i = 0; i < n_z; ++i)
+            zp[i] = z[n_z + i];
+        for(size_t j = 0; j < n_p; ++j)
+            zp[n_z + j] = p1_[j];
+        fk = fun_.Forward(1, zp);
+        for(size_t i = 0; i < n_z; ++i)
+            f[n_z + i] = fk[i];
+    }
+};
+// ---------------------------------------------------------------------------
+// adjoint_ode
+template <class Base>
+class atomic_ode<Base>::adjoint_ode {
+private:
+    const atomic_ode&           ode_;
+    ADFun<Base>&                fun_;
+    const CppAD::vector<Base>&  p_;
+    size_t                      k_;
+public:
+    // the state is (lambda, mu)
+    adjoint_ode(
+        const atomic_ode&           ode ,
+        ADFun<Base>&                fun ,
+        const CppAD::vector<Base>&  p   )
+    : ode_(ode), fun_(fun), p_(p), k_(0)
+    { }
+    // set the checkpoint interval [ t_k , t_{k+1} ]
+    void set_interval(size_t k)
+    {   k_ = k; }
+    void Ode(
+        const Base&                t ,
+        const CppAD::vector<Base>& a ,
+        CppAD::vector<Base>&       f )
+    {   size_t n_z = fun_.Range();
+        size_t n_p = p_.size();
+        //
+        // zp
+        CppAD::vector<Base> z(n_z), zp(n_z + n_p);
+        ode_.interpolate(k_, t, z);
+        for(size_t i = 0; i < n_z; ++i)
+            zp[i] = z[i];
+        for(size_t j = 0; j < n_p; ++j)
+            zp[n_z + j] = p_[j];
+        //
+        // f = - [ G_z(z, p), G_p(z, p) ]^T lambda
+        CppAD::vector<Base> lambda(n_z), dw;
+        for(size_t i = 0; i < n_z; ++i)
+            lambda[i] = a[i];
+        fun_.Forward(0, zp);
+        dw = fun_.Reverse(1, lambda);
+        for(size_t j = 0; j < n_z + n_p; ++j)
+            f[j] = - dw[j];
+    }
+};
+// ---------------------------------------------------------------------------
+// set_checkpoint
+template <class Base>
+bool atomic_ode<Base>::set_checkpoint(const CppAD::vector<Base>& x)
+{   //
+    // check for case where checkpoints are already available
+    if( checkpoint_.valid )
+    {   bool match = true;
+        for(size_t j = 0; j < n_z_ + n_p_; ++j)
+            match &= checkpoint_.x[j] == x[j];
+        if( match )
+            return true;
+    }
+    checkpoint_.valid = false;
+    //
+    // z, p, empty
+    CppAD::vector<Base> z(n_z_), p(n_p_), empty(0);
+    for(size_t i = 0; i < n_z_; ++i)
+        z[i] = x[i];
+    for(size_t j = 0; j < n_p_; ++j)
+        p[j] = x[n_z_ + j];
+    //
+    // ode
+    forward_ode ode(fun_, p, empty);
+    //
+    // f
+    CppAD::vector<Base> f(n_z_);
+    ode.Ode(Base(0), z, f);
+    //
+    // checkpoint_
+    checkpoint_.t.resize(0);
+    checkpoint_.z.resize(0);
+    checkpoint_.f.resize(0);
+    checkpoint_.t.push_back( Base(0) );
+    for(size_t i = 0; i < n_z_; ++i)
+    {   checkpoint_.z.push_back( z[i] );
+        checkpoint_.f.push_back( f[i] );
+    }
+    //
+    // t, h
+    Base t = Base(0);
+    Base h = r_;
+    //
+    size_t M = 1;
+    CppAD::vector<Base> e(n_z_), z_next(n_z_);
+    while( t < r_ )
+    {   //
+        // t_next, h
+        Base t_next = t + h;
+        if( r_ <= t_next )
+        {   t_next = r_;
+            h      = r_ - t;
+        }
+        if( ! ( Base(0) < h ) )
+            return false;
+        //
+        // z_next, e_max
+        z_next = CppAD::Runge45(ode, M, t, t_next, z, e);
+        Base e_max = Base(0);
+        for(size_t i = 0; i < n_z_; ++i)
+        {   if( CppAD::isnan( e[i] ) )
+                return false;
+            if( e_max < e[i] )
+                e_max = e[i];
+        }
+        //
+        // checkpoint_, t, z
+        bool accept = e_max <= tolerance_;
+        if( accept )
+        {   t = t_next;
+            z = z_next;
+            ode.Ode(t, z, f);
+            checkpoint_.t.push_back(t);
+            for(size_t i = 0; i < n_z_; ++i)
+            {   checkpoint_.z.push_back( z[i] );
+                checkpoint_.f.push_back( f[i] );
+            }
+        }
+        //
+        // h
+        Base ratio = Base(5);
+        if( Base(0) < e_max )
+        {   ratio = Base(0.9) * CppAD::pow(tolerance_ / e_max, Base(0.2));
+            if( ratio < Base(0.2) )
+                ratio = Base(0.2);
+            if( Base(5) < ratio )
+                ratio = Base(5);
+        }
+        h = h * ratio;
+    }
+    //
+    // checkpoint_
+    checkpoint_.x     = x;
+    checkpoint_.valid = true;
+    return true;
+}
+// ---------------------------------------------------------------------------
+// interpolate
+template <class Base>
+void atomic_ode<Base>::interpolate(
+    size_t                k  ,
+    const Base&           t  ,
+    CppAD::vector<Base>&  z  ) const
+{   CPPAD_ASSERT_UNKNOWN( checkpoint_.valid );
+    CPPAD_ASSERT_UNKNOWN( k + 1 < checkpoint_.t.size() );
+    //
+    // h, s
+    Base h = checkpoint_.t[k+1] - checkpoint_.t[k];
+    Base s = (t - checkpoint_.t[k]) / h;
+    //
+    // cubic Hermite basis functions
+    Base s2  = s * s;
+    Base s3  = s2 * s;
+    Base h00 = Base(2) * s3 - Base(3) * s2 + Base(1);
+    Base h10 = s3 - Base(2) * s2 + s;
+    Base h01 = Base(3) * s2 - Base(2) * s3;
+    Base h11 = s3 - s2;
+    //
+    // z
+    const CppAD::vector<Base>& cz( checkpoint_.z );
+    const CppAD::vector<Base>& cf( checkpoint_.f );
+    for(size_t i = 0; i < n_z_; ++i)
+    {   size_t k0 = k * n_z_ + i;
+        size_t k1 = (k + 1) * n_z_ + i;
+        z[i] = h00 * cz[k0] + h10 * h * cf[k0]
+             + h01 * cz[k1] + h11 * h * cf[k1];
+    }
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
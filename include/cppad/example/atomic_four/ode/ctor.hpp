@@ -0,0 +1,65 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_CTOR_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_CTOR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_ode_ctor.hpp$$
+$spell
+    ctor
+$$
+
+$section
+Atomic ODE Constructor: Example Implementation
+$$
+
+$head Purpose$$
+The constructor stores a copy of
+$cref/fun/atomic_four_ode/fun/$$ and the other constructor arguments.
+No checkpoints are available until the first call to
+$code forward$$ or $code reverse$$.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/ode/ode.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// ctor
+template <class Base>
+atomic_ode<Base>::atomic_ode(
+    const std::string&          name      ,
+    const ADFun<Base>&          fun       ,
+    const Base&                 r         ,
+    const Base&                 tolerance )
+: CppAD::atomic_four<Base>(name)
+, r_(r)
+, tolerance_(tolerance)
+{   //
+    // fun_
+    fun_ = fun;
+    //
+    // n_z_, n_p_
+    n_z_ = fun_.Range();
+    CPPAD_ASSERT_KNOWN( n_z_ <= fun_.Domain(),
+        "atomic_ode: fun.Range() is greater than fun.Domain()"
+    );
+    n_p_ = fun_.Domain() - n_z_;
+    //
+    // checkpoint_
+    checkpoint_.valid = false;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,127 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_FORWARD_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_FORWARD_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_ode_forward.hpp$$
+$spell
+    Taylor
+    Runge
+$$
+
+$section
+Atomic ODE Forward Mode: Example Implementation
+$$
+
+$head Purpose$$
+The $code forward$$ routine overrides the virtual functions
+used by the atomic_four base; see
+$cref/forward/atomic_four_forward/$$.
+
+$head Theory$$
+Suppose we are given Taylor coefficients
+$latex x^0 = ( z^0 (0) , p^0 )$$ and $latex x^1 = ( z^1 (0) , p^1 )$$.
+The zero order coefficient $latex y^0 = z^0 (r)$$ is computed using
+the adaptive $cref/set_checkpoint/atomic_four_ode_checkpoint.hpp/set_checkpoint/$$
+routine.
+The first order coefficient $latex y^1 = z^1 (r)$$ is computed
+by solving the tangent equation
+$latex \[
+    z_t^1 (t) = G_z [ z^0 (t) , p^0 ] z^1 (t) + G_p [ z^0 (t), p^0 ] p^1
+\] $$
+together with the original ODE for $latex z^0 (t)$$.
+This uses one $cref Runge45$$ step for each interval between checkpoints.
+
+$head Restrictions$$
+Forward orders greater than one are not implemented and
+this routine returns false if $icode order_up$$ is greater than one.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/ode/ode.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// forward override for Base atomic ODE
+template <class Base>
+bool atomic_ode<Base>::forward(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_y    ,
+    size_t                                     order_low   ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    CppAD::vector<Base>&                       taylor_y    )
+{   //
+    // q, n_x
+    size_t q   = order_up + 1;
+    size_t n_x = n_z_ + n_p_;
+    CPPAD_ASSERT_UNKNOWN( taylor_x.size() == n_x * q );
+    CPPAD_ASSERT_UNKNOWN( taylor_y.size() == n_z_ * q );
+    //
+    if( order_up > 1 )
+        return false;
+    //
+    // checkpoint_
+    CppAD::vector<Base> x0(n_x);
+    for(size_t j = 0; j < n_x; ++j)
+        x0[j] = taylor_x[j * q + 0];
+    if( ! set_checkpoint(x0) )
+        return false;
+    //
+    // n_step
+    size_t n_step = checkpoint_.t.size() - 1;
+    //
+    // taylor_y
+    if( order_low == 0 )
+    {   for(size_t i = 0; i < n_z_; ++i)
+            taylor_y[i * q + 0] = checkpoint_.z[n_step * n_z_ + i];
+    }
+    if( order_up == 0 )
+        return true;
+    //
+    // p0, p1
+    CppAD::vector<Base> p0(n_p_), p1(n_p_);
+    for(size_t j = 0; j < n_p_; ++j)
+    {   p0[j] = taylor_x[(n_z_ + j) * q + 0];
+        p1[j] = taylor_x[(n_z_ + j) * q + 1];
+    }
+    //
+    // ode
+    forward_ode ode(fun_, p0, p1);
+    //
+    // z01 = ( z^0 (t) , z^1 (t) )
+    CppAD::vector<Base> z01(2 * n_z_);
+    for(size_t i = 0; i < n_z_; ++i)
+    {   z01[i]        = taylor_x[i * q + 0];
+        z01[n_z_ + i] = taylor_x[i * q + 1];
+    }
+    //
+    // z01
+    size_t M = 1;
+    for(size_t k = 0; k < n_step; ++k)
+    {   const Base& ti = checkpoint_.t[k];
+        const Base& tf = checkpoint_.t[k+1];
+        z01 = CppAD::Runge45(ode, M, ti, tf, z01);
+    }
+    //
+    // taylor_y
+    for(size_t i = 0; i < n_z_; ++i)
+        taylor_y[i * q + 1] = z01[n_z_ + i];
+    //
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -0,0 +1,135 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_ODE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_ODE_HPP
+
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_ode.hpp$$
+$spell
+$$
+
+$section Atomic ODE Class: Example Implementation$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+template <class Base>
+class atomic_ode : public CppAD::atomic_four<Base> {
+//
+public:
+    // ctor
+    atomic_ode(
+        const std::string&          name      ,
+        const ADFun<Base>&          fun       ,
+        const Base&                 r         ,
+        const Base&                 tolerance
+    );
+    //
+    // n_step
+    size_t n_step(void) const
+    {   CPPAD_ASSERT_UNKNOWN( checkpoint_.valid );
+        return checkpoint_.t.size() - 1;
+    }
+private:
+    //
+    // fun_
+    // G(z, p) in the ordering (z, p)
+    ADFun<Base> fun_;
+    //
+    // n_z_, n_p_
+    size_t n_z_;
+    size_t n_p_;
+    //
+    // r_, tolerance_
+    Base r_;
+    Base tolerance_;
+    //
+    // checkpoints for the most recent value of x = (z(0), p).
+    // z and f are n_step + 1 by n_z matrices in row major order and
+    // f contains G(z, p) at the corresponding z.
+    struct checkpoint_struct {
+        bool                valid;
+        CppAD::vector<Base> x;
+        CppAD::vector<Base> t;
+        CppAD::vector<Base> z;
+        CppAD::vector<Base> f;
+    };
+    checkpoint_struct checkpoint_;
+    //
+    // ode functions used with Runge45
+    class forward_ode;
+    class adjoint_ode;
+    //
+    // set_checkpoint
+    bool set_checkpoint(const CppAD::vector<Base>& x);
+    //
+    // interpolate
+    void interpolate(size_t k, const Base& t, CppAD::vector<Base>& z) const;
+    //
+    // -----------------------------------------------------------------------
+    // overrides
+    // -----------------------------------------------------------------------
+    //
+    // for_type
+    bool for_type(
+        size_t                                        call_id,
+        const CppAD::vector<CppAD::ad_type_enum>&     type_x,
+        CppAD::vector<CppAD::ad_type_enum>&           type_y
+    ) override;
+    //
+    // Base forward
+    bool forward(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_y,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       taylor_x,
+        CppAD::vector<Base>&                             taylor_y
+    ) override;
+    //
+    // Base reverse
+    bool reverse(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_x,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       taylor_x,
+        const CppAD::vector<Base>&                       taylor_y,
+        CppAD::vector<Base>&                             partial_x,
+        const CppAD::vector<Base>&                       partial_y
+    ) override;
+    //
+    // jac_sparsity
+    bool jac_sparsity(
+        size_t                                         call_id,
+        bool                                           dependency,
+        const CppAD::vector<bool>&                     ident_zero_x,
+        const CppAD::vector<bool>&                     select_x,
+        const CppAD::vector<bool>&                     select_y,
+        CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out
+    ) override;
+};
+} // END_CPPAD_NAMESPACE
+
+# include <cppad/example/atomic_four/ode/ctor.hpp>
+# include <cppad/example/atomic_four/ode/checkpoint.hpp>
+# include <cppad/example/atomic_four/ode/for_type.hpp>
+# include <cppad/example/atomic_four/ode/forward.hpp>
+# include <cppad/example/atomic_four/ode/reverse.hpp>
+# include <cppad/example/atomic_four/ode/jac_sparsity.hpp>
+// END C++
+# endif
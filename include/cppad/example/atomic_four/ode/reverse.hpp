@@ -0,0 +1,125 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_REVERSE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_ODE_REVERSE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_ode_reverse.hpp$$
+$spell
+    Runge
+    Hermite
+$$
+
+$section
+Atomic ODE Reverse Mode: Example Implementation
+$$
+
+$head Purpose$$
+The $code reverse$$ routine overrides the virtual functions
+used by the atomic_four base; see
+$cref/reverse/atomic_four_reverse/$$.
+
+$head Theory$$
+Suppose that $latex \bar{y}$$ is the partial of a scalar function
+$latex H(y)$$ w.r.t. $latex y = z(r)$$.
+Define $latex \lambda(t)$$ and $latex \mu (t)$$ by
+$latex \lambda (r) = \bar{y}$$, $latex \mu (r) = 0$$ and
+$latex \[
+\begin{array}{rcl}
+    \lambda_t (t) & = & - G_z [ z(t) , p ]^\R{T} \lambda (t)
+    \\
+    \mu_t (t) & = & - G_p [ z(t) , p ]^\R{T} \lambda (t)
+\end{array}
+\] $$
+It follows that the partials of $latex H[ y(x) ]$$ w.r.t.
+$latex z(0)$$ and $latex p$$ are
+$latex \lambda (0)$$ and $latex \mu (0)$$ respectively.
+These adjoint equations are solved backwards in time
+using one $cref Runge45$$ step for each interval between checkpoints.
+The value of $latex z(t)$$ between checkpoints is approximated by
+cubic Hermite
+$cref/interpolation/atomic_four_ode_checkpoint.hpp/interpolate/$$.
+Hence the ODE is not solved again during reverse mode,
+except when the checkpoints were computed for a different
+value of $latex x$$.
+
+$head Restrictions$$
+Reverse mode is only implemented for first order; i.e.,
+this routine returns false if $icode order_up$$ is greater than zero.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/ode/ode.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+// reverse override for Base atomic ODE
+template <class Base>
+bool atomic_ode<Base>::reverse(
+    size_t                                     call_id     ,
+    const CppAD::vector<bool>&                 select_x    ,
+    size_t                                     order_up    ,
+    const CppAD::vector<Base>&                 taylor_x    ,
+    const CppAD::vector<Base>&                 taylor_y    ,
+    CppAD::vector<Base>&                       partial_x   ,
+    const CppAD::vector<Base>&                 partial_y   )
+{   //
+    // n_x
+    size_t n_x = n_z_ + n_p_;
+    //
+    if( order_up > 0 )
+        return false;
+    CPPAD_ASSERT_UNKNOWN( taylor_x.size()  == n_x );
+    CPPAD_ASSERT_UNKNOWN( taylor_y.size()  == n_z_ );
+    CPPAD_ASSERT_UNKNOWN( partial_x.size() == n_x );
+    CPPAD_ASSERT_UNKNOWN( partial_y.size() == n_z_ );
+    //
+    // checkpoint_
+    if( ! set_checkpoint(taylor_x) )
+        return false;
+    //
+    // p
+    CppAD::vector<Base> p(n_p_);
+    for(size_t j = 0; j < n_p_; ++j)
+        p[j] = taylor_x[n_z_ + j];
+    //
+    // ode
+    adjoint_ode ode(*this, fun_, p);
+    //
+    // a = ( lambda(r), mu(r) )
+    CppAD::vector<Base> a(n_x);
+    for(size_t i = 0; i < n_z_; ++i)
+        a[i] = partial_y[i];
+    for(size_t j = 0; j < n_p_; ++j)
+        a[n_z_ + j] = Base(0);
+    //
+    // a = ( lambda(0), mu(0) )
+    size_t M = 1;
+    size_t k = checkpoint_.t.size() - 1;
+    while( k-- )
+    {   const Base& ti = checkpoint_.t[k+1];
+        const Base& tf = checkpoint_.t[k];
+        ode.set_interval(k);
+        a = CppAD::Runge45(ode, M, ti, tf, a);
+    }
+    //
+    // partial_x
+    for(size_t j = 0; j < n_x; ++j)
+        partial_x[j] = a[j];
+    //
+    return true;
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
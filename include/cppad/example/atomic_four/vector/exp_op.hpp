@@ -0,0 +1,308 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_VECTOR_EXP_OP_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_VECTOR_EXP_OP_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_vector_exp_op.hpp$$
+
+$section Atomic Vector Exponential Operator: Example Implementation$$
+
+$head Taylor Coefficients$$
+If $latex y(t) = \exp[ u(t) ]$$ then $latex y'(t) = u'(t) y(t)$$.
+It follows that the Taylor coefficients for $latex y$$ are given by
+$latex \[
+\begin{array}{rcl}
+    y^0 & = & \exp( u^0 )
+    \\
+    y^k & = & \frac{1}{k} \sum_{d=1}^k d \; u^d \; y^{k-d}
+\end{array}
+\] $$
+
+$head AD<Base>$$
+The $codei%AD<%Base%>%$$ versions of
+$code forward_exp$$ and $code reverse_exp$$ use the atomic vector
+exponential, multiply, and add operators.
+Hence the number of atomic function calls they record does not depend on
+the length of the vectors.
+
+$head Example$$
+The file $cref atomic_four_vector_exp.cpp$$ contains an example
+and test for this operator.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/vector/vector.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+// ---------------------------------------------------------------------------
+// forward_exp
+template <class Base>
+void atomic_vector<Base>::forward_exp(
+    size_t                                           m,
+    size_t                                           p,
+    size_t                                           q,
+    const CppAD::vector<Base>&                       tx,
+    CppAD::vector<Base>&                             ty)
+{
+    for(size_t i = 0; i < m; ++i)
+    {   for(size_t k = p; k < q; ++k)
+        {   size_t y_index = i * q + k;
+            if( k == 0 )
+            {   // y^0 = exp( u^0 )
+                ty[y_index] = exp( tx[y_index] );
+            }
+            else
+            {   // y^k = sum_{d=1}^k d * u^d * y^{k-d} / k
+                ty[y_index] = Base(0);
+                for(size_t d = 1; d <= k; ++d)
+                {   size_t u_index = i * q + d;
+                    size_t z_index = i * q + (k - d);
+                    ty[y_index]   += Base( double(d) ) *
+                        tx[u_index] * ty[z_index];
+                }
+                ty[y_index] /= Base( double(k) );
+            }
+        }
+    }
+}
+template <class Base>
+void atomic_vector<Base>::forward_exp(
+    size_t                                           m,
+    size_t                                           p,
+    size_t                                           q,
+    const CppAD::vector< CppAD::AD<Base> >&          atx,
+    CppAD::vector< CppAD::AD<Base> >&                aty)
+{   size_t n = m;
+    assert( atx.size() == n * q );
+    assert( aty.size() == m * q );
+    //
+    // atu
+    ad_const_iterator atu = atx.begin();
+    //
+    // ax_mul
+    ad_vector ax_mul(2 * m);
+    ad_iterator au_mul = ax_mul.begin();
+    ad_iterator av_mul = ax_mul.begin() + ad_difference_type(m);
+    //
+    // ax_add
+    ad_vector ax_add(2 * m);
+    ad_iterator au_add = ax_add.begin();
+    ad_iterator av_add = ax_add.begin() + ad_difference_type(m);
+    //
+    // ay
+    ad_vector ay(m);
+    //
+    for(size_t k = p; k < q; ++k)
+    {   if( k == 0 )
+        {   // ay = exp( u^0 )
+            ad_vector ax(n);
+            copy_mat_to_vec(m, q, 0, atu, ax.begin());
+            (*this)(exp_enum, ax, ay); // atomic vector exp
+        }
+        else
+        {   // ay = 0
+            for(size_t i = 0; i < m; ++i)
+                ay[i] = 0.0;
+            for(size_t d = 1; d <= k; ++d)
+            {   // au_mul = u^d, av_mul = d / k
+                copy_mat_to_vec(m, q, d, atu, au_mul);
+                for(size_t i = 0; i < m; ++i)
+                    av_mul[i] = double(d) / double(k);
+                //
+                // au_mul = u^d * d / k
+                ad_vector az(m);
+                (*this)(mul_enum, ax_mul, az); // atomic vector multiply
+                for(size_t i = 0; i < m; ++i)
+                    au_mul[i] = az[i];
+                //
+                // av_mul = y^{k-d}
+                copy_mat_to_vec(m, q, k-d, aty.begin(), av_mul);
+                //
+                // v_add = u^d * y^{k-d} * d / k
+                (*this)(mul_enum, ax_mul, az); // atomic vector multiply
+                for(size_t i = 0; i < m; ++i)
+                    av_add[i] = az[i];
+                //
+                // ay = ay + v_add
+                for(size_t i = 0; i < m; ++i)
+                    au_add[i] = ay[i];
+                (*this)(add_enum, ax_add, ay); // atomic vector add
+            }
+        }
+        // y^k = ay
+        copy_vec_to_mat(m, q, k, ay.begin(), aty.begin());
+    }
+}
+// ---------------------------------------------------------------------------
+// reverse_exp
+template <class Base>
+void atomic_vector<Base>::reverse_exp(
+    size_t                                           m,
+    size_t                                           q,
+    const CppAD::vector<Base>&                       tx,
+    const CppAD::vector<Base>&                       ty,
+    CppAD::vector<Base>&                             px,
+    const CppAD::vector<Base>&                       py)
+{   size_t n = m;
+    assert( tx.size() == n * q );
+    assert( ty.size() == m * q );
+    assert( px.size() == n * q );
+    assert( py.size() == m * q );
+    //
+    // pz
+    // partials w.r.t. y that include the effect of higher orders
+    CppAD::vector<Base> pz(q);
+    //
+    for(size_t i = 0; i < m; ++i)
+    {   // px, pz
+        for(size_t k = 0; k < q; ++k)
+        {   px[i * q + k] = Base(0);
+            pz[k]         = py[i * q + k];
+        }
+        //
+        // j
+        size_t j = q;
+        while(--j)
+        {   // y^j = sum_{k=1}^j k * u^k * y^{j-k} / j
+            pz[j] /= Base( double(j) );
+            for(size_t k = 1; k <= j; ++k)
+            {   size_t u_index = i * q + k;
+                size_t z_index = i * q + (j - k);
+                //
+                // must use azmul becasue pz[j] = 0 may mean that this
+                // component of the function was not selected.
+                px[u_index] += Base( double(k) ) *
+                    CppAD::azmul( pz[j], ty[z_index] );
+                pz[j-k]     += Base( double(k) ) *
+                    CppAD::azmul( pz[j], tx[u_index] );
+            }
+        }
+        // y^0 = exp( u^0 )
+        px[i * q + 0] += CppAD::azmul( pz[0], ty[i * q + 0] );
+    }
+}
+template <class Base>
+void atomic_vector<Base>::reverse_exp(
+    size_t                                           m,
+    size_t                                           q,
+    const CppAD::vector< CppAD::AD<Base> >&          atx,
+    const CppAD::vector< CppAD::AD<Base> >&          aty,
+    CppAD::vector< CppAD::AD<Base> >&                apx,
+    const CppAD::vector< CppAD::AD<Base> >&          apy)
+{   size_t n = m;
+    assert( atx.size() == n * q );
+    assert( aty.size() == m * q );
+    assert( apx.size() == n * q );
+    assert( apy.size() == m * q );
+    //
+    // atu, apu
+    ad_const_iterator atu = atx.begin();
+    ad_iterator       apu = apx.begin();
+    //
+    // apz
+    // copying AD variables does not create operators on the tape
+    ad_vector apz(m * q);
+    for(size_t i = 0; i < m * q; ++i)
+        apz[i] = apy[i];
+    //
+    // ax_mul
+    // need azmul_op but it is not yet available
+    ad_vector ax_mul(2 * m);
+    ad_iterator au_mul = ax_mul.begin();
+    ad_iterator av_mul = ax_mul.begin() + ad_difference_type(m);
+    //
+    // ax_add
+    ad_vector ax_add(2 * m);
+    ad_iterator au_add = ax_add.begin();
+    ad_iterator av_add = ax_add.begin() + ad_difference_type(m);
+    //
+    // ay
+    ad_vector ay(m);
+    //
+    // px
+    // assigning to the value zero does not create operators on the tape
+    for(size_t j = 0; j < n; ++j)
+    {   for(size_t k = 0; k < q; ++k)
+            apx[j * q + k] = 0.0;
+    }
+    //
+    // j
+    size_t j = q;
+    while(--j)
+    {   // apz^j = apz^j / j
+        copy_mat_to_vec(m, q, j, apz.begin(), au_mul);
+        for(size_t i = 0; i < m; ++i)
+            av_mul[i] = 1.0 / double(j);
+        (*this)(mul_enum, ax_mul, ay); // atomic vector multiply
+        copy_vec_to_mat(m, q, j, ay.begin(), apz.begin());
+        //
+        for(size_t k = 1; k <= j; ++k)
+        {   // au_mul = apz^j * k
+            copy_mat_to_vec(m, q, j, apz.begin(), au_mul);
+            for(size_t i = 0; i < m; ++i)
+                av_mul[i] = double(k);
+            (*this)(mul_enum, ax_mul, ay); // atomic vector multiply
+            for(size_t i = 0; i < m; ++i)
+                au_mul[i] = ay[i];
+            // ------------------------------------------------------------
+            // reverse:
+            //  px[u_index] += k * azmul( pz[j], ty[z_index] )
+            // ------------------------------------------------------------
+            // av_add = apz^j * k * y^{j-k}
+            copy_mat_to_vec(m, q, j-k, aty.begin(), av_mul);
+            (*this)(mul_enum, ax_mul, ay); // atomic vector multiply
+            for(size_t i = 0; i < m; ++i)
+                av_add[i] = ay[i];
+            //
+            // apu^k = apu^k + av_add
+            copy_mat_to_vec(m, q, k, apu, au_add);
+            (*this)(add_enum, ax_add, ay); // atomic vector add
+            copy_vec_to_mat(m, q, k, ay.begin(), apu);
+            // ------------------------------------------------------------
+            // reverse:
+            //  pz[j-k] += k * azmul( pz[j], tx[u_index] )
+            // ------------------------------------------------------------
+            // av_add = apz^j * k * u^k
+            copy_mat_to_vec(m, q, k, atu, av_mul);
+            (*this)(mul_enum, ax_mul, ay); // atomic vector multiply
+            for(size_t i = 0; i < m; ++i)
+                av_add[i] = ay[i];
+            //
+            // apz^{j-k} = apz^{j-k} + av_add
+            copy_mat_to_vec(m, q, j-k, apz.begin(), au_add);
+            (*this)(add_enum, ax_add, ay); // atomic vector add
+            copy_vec_to_mat(m, q, j-k, ay.begin(), apz.begin());
+        }
+    }
+    // ------------------------------------------------------------------------
+    // reverse:
+    //  px[i * q + 0] += azmul( pz[0], ty[i * q + 0] )
+    // ------------------------------------------------------------------------
+    // av_add = apz^0 * y^0
+    copy_mat_to_vec(m, q, 0, apz.begin(), au_mul);
+    copy_mat_to_vec(m, q, 0, aty.begin(), av_mul);
+    (*this)(mul_enum, ax_mul, ay); // atomic vector multiply
+    for(size_t i = 0; i < m; ++i)
+        av_add[i] = ay[i];
+    //
+    // apu^0 = apu^0 + av_add
+    copy_mat_to_vec(m, q, 0, apu, au_add);
+    (*this)(add_enum, ax_add, ay); // atomic vector add
+    copy_vec_to_mat(m, q, 0, ay.begin(), apu);
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -92,12 +92,45 @@ bool atomic_vector<Base>::for_type(
         }
         break;
 
-        // unary minus
+        // exponential
+        // exp of identically zero is the constant one
+        case exp_enum:
+        for(size_t i = 0; i < m; ++i)
+        {   if( type_x[i] == identical_zero_enum )
+                type_y[i] = constant_enum;
+            else
+                type_y[i] = type_x[i];
+        }
+        break;
+
+        // unary minus, and unary functions that map zero to zero
         case neg_enum:
+        case erf_enum:
+        case sin_enum:
+        case sqrt_enum:
+        case tanh_enum:
         for(size_t i = 0; i < m; ++i)
             type_y[i] = type_x[i];
         break;
 
+        // cos and log of identically zero are constants
+        case cos_enum:
+        case log_enum:
+        for(size_t i = 0; i < m; ++i)
+        {   if( type_x[i] == identical_zero_enum )
+                type_y[i] = constant_enum;
+            else
+                type_y[i] = type_x[i];
+        }
+        break;
+
+        // power
+        // not sure result is identically 0 unless both are identically 0
+        case pow_enum:
+        for(size_t i = 0; i < m; ++i)
+            type_y[i] = std::max( type_x[i] , type_x[m + i] );
+        break;
+
         // error
         case number_op_enum:
         assert(false);
@@ -85,12 +85,30 @@ bool atomic_vector<Base>::forward(
         ok = true;
         break;
 
+        // exponential
+        case exp_enum:
+        forward_exp(m, p, q, tx, ty);
+        ok = true;
+        break;
+
         // unary minus
         case neg_enum:
         forward_neg(m, p, q, tx, ty);
         ok = true;
         break;
 
+        // other math functions
+        case cos_enum:
+        case erf_enum:
+        case log_enum:
+        case pow_enum:
+        case sin_enum:
+        case sqrt_enum:
+        case tanh_enum:
+        forward_math(op, m, p, q, tx, ty);
+        ok = true;
+        break;
+
         // error
         case number_op_enum:
         assert(false);
@@ -149,12 +167,30 @@ bool atomic_vector<Base>::forward(
         ok = true;
         break;
 
+        // exponential
+        case exp_enum:
+        forward_exp(m, p, q, atx, aty);
+        ok = true;
+        break;
+
         // unary minus
         case neg_enum:
         forward_neg(m, p, q, atx, aty);
         ok = true;
         break;
 
+        // other math functions
+        case cos_enum:
+        case erf_enum:
+        case log_enum:
+        case pow_enum:
+        case sin_enum:
+        case sqrt_enum:
+        case tanh_enum:
+        forward_math(op, m, p, q, atx, aty);
+        ok = true;
+        break;
+
         // error
         case number_op_enum:
         assert(false);
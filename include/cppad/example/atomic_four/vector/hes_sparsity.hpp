@@ -79,6 +79,9 @@ bool atomic_vector<Base>::hes_sparsity(
             j = m + i;
             if( select_x[j] )
                 nnz += 2;
+            // pow is also not linear w.r.t. the second argument
+            if( select_x[j] && op == pow_enum )
+                ++nnz;
         }
     }
     //
@@ -96,6 +99,8 @@ bool atomic_vector<Base>::hes_sparsity(
             {   pattern_out.set(k++, i, j);
                 pattern_out.set(k++, j, i);
             }
+            if( select_x[j] && op == pow_enum )
+                pattern_out.set(k++, j, j);
         }
     }
     assert( k == nnz);
@@ -0,0 +1,570 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_VECTOR_MATH_OP_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_VECTOR_MATH_OP_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_vector_math_op.hpp$$
+$spell
+    erf
+    tanh
+    sqrt
+    azmul
+$$
+
+$section Atomic Vector Math Function Operators: Example Implementation$$
+
+$head Operators$$
+This file implements the
+$code cos$$, $code erf$$, $code log$$, $code sin$$, $code sqrt$$,
+$code tanh$$ unary operators and the $code pow$$ binary operator.
+The same source code is used for the $icode Base$$ and
+$codei%AD<%Base%>%$$ cases.
+
+$head Notation$$
+We use $latex u(t)$$ ($latex v(t)$$) to denote the Taylor polynomial
+for one component of $icode u$$ ($icode v$$),
+$latex y(t) = f[ u(t) ]$$ ($latex y(t) = u(t)^{v(t)}$$)
+for the corresponding component of the result,
+and $latex z^k$$ for the $th k$$ order Taylor coefficient
+of a function $latex z(t)$$.
+
+$head Derivative Series$$
+For the unary operators,
+$latex g(t) = f^{(1)} [ u(t) ]$$ is the derivative series.
+Because $latex y^{(1)} (t) = g(t) u^{(1)} (t)$$,
+$latex \[
+    y^k = \frac{1}{k} \sum_{d=1}^k d \; u^d \; g^{k-d}
+\] $$
+for $latex k > 0$$.
+In addition, the partial of $latex y^k$$ with respect to $latex u^j$$
+is $latex g^{k-j}$$ (zero when $latex k < j$$).
+Hence reverse mode only requires the derivative series.
+The derivative series are computed using the following identities:
+$table
+$icode f$$ $cnext $latex g$$ $cnext recurrence for $latex k > 0$$
+$rnext
+$code cos$$ $cnext $latex - \sin(u)$$ $cnext
+    $latex g^k = - \frac{1}{k} \sum_{d=1}^k d \; u^d \; y^{k-d}$$
+$rnext
+$code erf$$ $cnext $latex \frac{2}{\sqrt \pi} \exp( - u^2 )$$ $cnext
+    $latex g^k = \frac{1}{k} \sum_{d=1}^k d \; u^d \; h^{k-d}$$
+    where $latex h = - 2 u g$$
+$rnext
+$code log$$ $cnext $latex 1 / u$$ $cnext
+    $latex g^k = - \frac{1}{u^0} \sum_{d=1}^k u^d \; g^{k-d}$$
+$rnext
+$code sin$$ $cnext $latex \cos(u)$$ $cnext
+    $latex g^k = - \frac{1}{k} \sum_{d=1}^k d \; u^d \; y^{k-d}$$
+$rnext
+$code sqrt$$ $cnext $latex 1 / (2 y)$$ $cnext
+    $latex g^k = - \frac{1}{y^0} \sum_{d=1}^k y^d \; g^{k-d}$$
+$rnext
+$code tanh$$ $cnext $latex 1 - y^2$$ $cnext
+    $latex g^k = - \sum_{d=0}^k y^d \; y^{k-d}$$
+$tend
+
+$head pow$$
+For the $code pow$$ operator,
+$latex y(t) = \exp[ v(t) \log u(t) ]$$.
+The Taylor coefficients of $latex r = 1 / u$$ and
+$latex \ell = \log(u)$$ are computed as for the $code log$$ operator,
+$latex z = v \ell$$ using the product rule,
+and $latex y$$ using
+$latex y^k = \frac{1}{k} \sum_{d=1}^k d \; z^d \; y^{k-d}$$.
+The partials of $latex y$$ with respect to $latex u$$ and $latex v$$
+are $latex v y r$$ and $latex \ell y$$.
+The Taylor coefficients of these derivative series are used
+in reverse mode as for the unary operators.
+
+$head AD<Base>$$
+The $codei%AD<%Base%>%$$ versions of the vector operations used by
+this implementation are atomic vector operations.
+Hence the number of atomic function calls that
+$code forward_math$$ and $code reverse_math$$ record
+does not depend on the length of the vectors.
+
+$head azmul$$
+The $icode Base$$ version of reverse mode uses $cref azmul$$
+to multiply a partial times a derivative series.
+This is because a zero partial may mean that the
+corresponding component of the function was not selected.
+The $codei%AD<%Base%>%$$ version uses multiplication
+because there is no atomic vector $code azmul$$ operator.
+
+$head Example$$
+The file $cref atomic_four_vector_math.cpp$$ contains an example
+and test for these operators.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/vector/vector.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+// ---------------------------------------------------------------------------
+// get_column
+// return the k-th order coefficients for the vector starting at offset
+template <class Base> template <class Scalar>
+CppAD::vector<Scalar> atomic_vector<Base>::get_column(
+    size_t                                           m,
+    size_t                                           q,
+    size_t                                           offset,
+    size_t                                           k,
+    const CppAD::vector<Scalar>&                     mat)
+{   CppAD::vector<Scalar> vec(m);
+    for(size_t i = 0; i < m; ++i)
+        vec[i] = mat[ (offset + i) * q + k ];
+    return vec;
+}
+// set_column
+// set the k-th order coefficients for the vector starting at offset
+template <class Base> template <class Scalar>
+void atomic_vector<Base>::set_column(
+    size_t                                           q,
+    size_t                                           offset,
+    size_t                                           k,
+    const CppAD::vector<Scalar>&                     vec,
+    CppAD::vector<Scalar>&                           mat)
+{   for(size_t i = 0; i < vec.size(); ++i)
+        mat[ (offset + i) * q + k ] = vec[i];
+}
+// ---------------------------------------------------------------------------
+// vec_op
+// Base unary operators
+template <class Base>
+void atomic_vector<Base>::vec_op(
+    op_enum_t                                        op,
+    const CppAD::vector<Base>&                       u,
+    CppAD::vector<Base>&                             y)
+{   size_t m = u.size();
+    y.resize(m);
+    switch(op)
+    {   case cos_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = cos( u[i] );
+        break;
+
+        case erf_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = erf( u[i] );
+        break;
+
+        case exp_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = exp( u[i] );
+        break;
+
+        case log_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = log( u[i] );
+        break;
+
+        case neg_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = - u[i];
+        break;
+
+        case sin_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = sin( u[i] );
+        break;
+
+        case sqrt_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = sqrt( u[i] );
+        break;
+
+        case tanh_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = tanh( u[i] );
+        break;
+
+        default:
+        assert(false);
+        break;
+    }
+}
+// Base binary operators
+template <class Base>
+void atomic_vector<Base>::vec_op(
+    op_enum_t                                        op,
+    const CppAD::vector<Base>&                       u,
+    const CppAD::vector<Base>&                       v,
+    CppAD::vector<Base>&                             y)
+{   size_t m = u.size();
+    assert( v.size() == m );
+    y.resize(m);
+    switch(op)
+    {   case add_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = u[i] + v[i];
+        break;
+
+        case div_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = u[i] / v[i];
+        break;
+
+        case mul_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = u[i] * v[i];
+        break;
+
+        case pow_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = pow( u[i], v[i] );
+        break;
+
+        case sub_enum:
+        for(size_t i = 0; i < m; ++i)
+            y[i] = u[i] - v[i];
+        break;
+
+        default:
+        assert(false);
+        break;
+    }
+}
+// AD<Base> unary operators
+template <class Base>
+void atomic_vector<Base>::vec_op(
+    op_enum_t                                        op,
+    const ad_vector&                                 au,
+    ad_vector&                                       ay)
+{   // copy so that au and ay can be the same vector
+    // (copying AD variables does not create operators on the tape)
+    ad_vector ax(au);
+    ay.resize( ax.size() );
+    (*this)(op, ax, ay); // atomic vector unary operator
+}
+// AD<Base> binary operators
+template <class Base>
+void atomic_vector<Base>::vec_op(
+    op_enum_t                                        op,
+    const ad_vector&                                 au,
+    const ad_vector&                                 av,
+    ad_vector&                                       ay)
+{   size_t m = au.size();
+    assert( av.size() == m );
+    ad_vector ax(2 * m);
+    for(size_t i = 0; i < m; ++i)
+    {   ax[i]     = au[i];
+        ax[m + i] = av[i];
+    }
+    ay.resize(m);
+    (*this)(op, ax, ay); // atomic vector binary operator
+}
+// ---------------------------------------------------------------------------
+// vec_azmul
+template <class Base>
+void atomic_vector<Base>::vec_azmul(
+    const CppAD::vector<Base>&                       u,
+    const CppAD::vector<Base>&                       v,
+    CppAD::vector<Base>&                             y)
+{   size_t m = u.size();
+    assert( v.size() == m );
+    y.resize(m);
+    for(size_t i = 0; i < m; ++i)
+        y[i] = CppAD::azmul( u[i], v[i] );
+}
+template <class Base>
+void atomic_vector<Base>::vec_azmul(
+    const ad_vector&                                 au,
+    const ad_vector&                                 av,
+    ad_vector&                                       ay)
+{   // need azmul_op but it is not yet available
+    vec_op(mul_enum, au, av, ay);
+}
+// ---------------------------------------------------------------------------
+// conv_sum
+// sum_{d=d_low}^k a^d * b^{k-d}
+template <class Base> template <class Scalar>
+CppAD::vector<Scalar> atomic_vector<Base>::conv_sum(
+    size_t                                           d_low,
+    size_t                                           k,
+    const vec_list<Scalar>&                          a,
+    const vec_list<Scalar>&                          b)
+{   assert( d_low <= k );
+    CppAD::vector<Scalar> sum, term;
+    vec_op(mul_enum, a[d_low], b[k - d_low], sum);
+    for(size_t d = d_low + 1; d <= k; ++d)
+    {   vec_op(mul_enum, a[d], b[k - d], term);
+        vec_op(add_enum, sum, term, sum);
+    }
+    return sum;
+}
+// ---------------------------------------------------------------------------
+// int_sum
+// sum_{d=1}^k d * u^d * a^{k-d} / k
+template <class Base> template <class Scalar>
+CppAD::vector<Scalar> atomic_vector<Base>::int_sum(
+    size_t                                           k,
+    const vec_list<Scalar>&                          u,
+    const vec_list<Scalar>&                          a)
+{   assert( 0 < k );
+    size_t m = u[0].size();
+    CppAD::vector<Scalar> sum, term, scale(m);
+    for(size_t d = 1; d <= k; ++d)
+    {   // term = (d / k) * u^d * a^{k-d}
+        for(size_t i = 0; i < m; ++i)
+            scale[i] = Scalar( double(d) / double(k) );
+        vec_op(mul_enum, scale, u[d], term);
+        vec_op(mul_enum, term, a[k - d], term);
+        if( d == 1 )
+            sum = term;
+        else
+            vec_op(add_enum, sum, term, sum);
+    }
+    return sum;
+}
+// ---------------------------------------------------------------------------
+// math_series
+// compute g^k (and h^k for erf) given u^0, ..., u^k and y^0, ..., y^k
+template <class Base> template <class Scalar>
+void atomic_vector<Base>::math_series(
+    op_enum_t                                        op,
+    size_t                                           k,
+    const vec_list<Scalar>&                          u,
+    const vec_list<Scalar>&                          y,
+    vec_list<Scalar>&                                g,
+    vec_list<Scalar>&                                h)
+{   size_t m = u[0].size();
+    CppAD::vector<Scalar> work(m);
+    switch(op)
+    {   // g = - sin(u)
+        case cos_enum:
+        if( k == 0 )
+        {   vec_op(sin_enum, u[0], work);
+            vec_op(neg_enum, work, g[0]);
+        }
+        else
+        {   work = int_sum(k, u, y);
+            vec_op(neg_enum, work, g[k]);
+        }
+        break;
+
+        // g = 2 / sqrt(pi) * exp( - u * u ), h = - 2 * u * g
+        case erf_enum:
+        if( k == 0 )
+        {   double two_by_sqrt_pi = 2.0 / std::sqrt( 4.0 * std::atan(1.0) );
+            vec_op(mul_enum, u[0], u[0], work);
+            vec_op(neg_enum, work, work);
+            vec_op(exp_enum, work, g[0]);
+            for(size_t i = 0; i < m; ++i)
+                work[i] = Scalar( two_by_sqrt_pi );
+            vec_op(mul_enum, work, g[0], g[0]);
+        }
+        else
+            g[k] = int_sum(k, u, h);
+        for(size_t i = 0; i < m; ++i)
+            work[i] = Scalar( -2.0 );
+        vec_op(mul_enum, work, conv_sum(0, k, u, g), h[k]);
+        break;
+
+        // g = 1 / u
+        case log_enum:
+        if( k == 0 )
+        {   for(size_t i = 0; i < m; ++i)
+                work[i] = Scalar( 1.0 );
+            vec_op(div_enum, work, u[0], g[0]);
+        }
+        else
+        {   vec_op(div_enum, conv_sum(1, k, u, g), u[0], work);
+            vec_op(neg_enum, work, g[k]);
+        }
+        break;
+
+        // g = cos(u)
+        case sin_enum:
+        if( k == 0 )
+            vec_op(cos_enum, u[0], g[0]);
+        else
+        {   work = int_sum(k, u, y);
+            vec_op(neg_enum, work, g[k]);
+        }
+        break;
+
+        // g = 1 / (2 * y)
+        case sqrt_enum:
+        if( k == 0 )
+        {   for(size_t i = 0; i < m; ++i)
+                work[i] = Scalar( 0.5 );
+            vec_op(div_enum, work, y[0], g[0]);
+        }
+        else
+        {   vec_op(div_enum, conv_sum(1, k, y, g), y[0], work);
+            vec_op(neg_enum, work, g[k]);
+        }
+        break;
+
+        // g = 1 - y * y
+        case tanh_enum:
+        work = conv_sum(0, k, y, y);
+        if( k == 0 )
+        {   CppAD::vector<Scalar> one(m);
+            for(size_t i = 0; i < m; ++i)
+                one[i] = Scalar( 1.0 );
+            vec_op(sub_enum, one, work, g[0]);
+        }
+        else
+            vec_op(neg_enum, work, g[k]);
+        break;
+
+        default:
+        assert(false);
+        break;
+    }
+}
+// ---------------------------------------------------------------------------
+// forward_math
+template <class Base> template <class Scalar>
+void atomic_vector<Base>::forward_math(
+    op_enum_t                                        op,
+    size_t                                           m,
+    size_t                                           p,
+    size_t                                           q,
+    const CppAD::vector<Scalar>&                     tx,
+    CppAD::vector<Scalar>&                           ty)
+{   assert( ty.size() == m * q );
+    //
+    // u, y
+    vec_list<Scalar> u(q), y(q);
+    for(size_t k = 0; k < q; ++k)
+        u[k] = get_column(m, q, 0, k, tx);
+    for(size_t k = 0; k < p; ++k)
+        y[k] = get_column(m, q, 0, k, ty);
+    //
+    if( op == pow_enum )
+    {   assert( tx.size() == 2 * m * q );
+        //
+        // v, r = 1 / u, ell = log(u), z = v * ell
+        vec_list<Scalar> v(q), r(q), ell(q), z(q), not_used(q);
+        for(size_t k = 0; k < q; ++k)
+        {   v[k] = get_column(m, q, m, k, tx);
+            math_series(log_enum, k, u, ell, r, not_used);
+            if( k == 0 )
+                vec_op(log_enum, u[0], ell[0]);
+            else
+                ell[k] = int_sum(k, u, r);
+            z[k] = conv_sum(0, k, v, ell);
+        }
+        //
+        // y
+        for(size_t k = p; k < q; ++k)
+        {   if( k == 0 )
+                vec_op(pow_enum, u[0], v[0], y[0]);
+            else
+                y[k] = int_sum(k, z, y);
+            set_column(q, 0, k, y[k], ty);
+        }
+        return;
+    }
+    assert( tx.size() == m * q );
+    //
+    // g, h
+    vec_list<Scalar> g(q), h(q);
+    for(size_t k = 0; k < q; ++k)
+    {   // y^k
+        if( p <= k )
+        {   if( k == 0 )
+                vec_op(op, u[0], y[0]);
+            else
+                y[k] = int_sum(k, u, g);
+            set_column(q, 0, k, y[k], ty);
+        }
+        // g^k
+        if( k + 1 < q )
+            math_series(op, k, u, y, g, h);
+    }
+}
+// ---------------------------------------------------------------------------
+// reverse_math
+template <class Base> template <class Scalar>
+void atomic_vector<Base>::reverse_math(
+    op_enum_t                                        op,
+    size_t                                           m,
+    size_t                                           q,
+    const CppAD::vector<Scalar>&                     tx,
+    const CppAD::vector<Scalar>&                     ty,
+    CppAD::vector<Scalar>&                           px,
+    const CppAD::vector<Scalar>&                     py)
+{   assert( ty.size() == m * q );
+    assert( px.size() == tx.size() );
+    assert( py.size() == m * q );
+    //
+    // u, y, w
+    vec_list<Scalar> u(q), y(q), w(q);
+    for(size_t k = 0; k < q; ++k)
+    {   u[k] = get_column(m, q, 0, k, tx);
+        y[k] = get_column(m, q, 0, k, ty);
+        w[k] = get_column(m, q, 0, k, py);
+    }
+    //
+    // g_list
+    // derivative series for each argument vector
+    vec_list< CppAD::vector<Scalar> > g_list;
+    if( op == pow_enum )
+    {   assert( tx.size() == 2 * m * q );
+        //
+        // v, r = 1 / u, ell = log(u), vy = v * y
+        vec_list<Scalar> v(q), r(q), ell(q), vy(q), not_used(q);
+        for(size_t k = 0; k < q; ++k)
+        {   v[k] = get_column(m, q, m, k, tx);
+            math_series(log_enum, k, u, ell, r, not_used);
+            if( k == 0 )
+                vec_op(log_enum, u[0], ell[0]);
+            else
+                ell[k] = int_sum(k, u, r);
+            vy[k] = conv_sum(0, k, v, y);
+        }
+        //
+        // g_list[0] = v * y / u, g_list[1] = log(u) * y
+        g_list.resize(2);
+        g_list[0].resize(q);
+        g_list[1].resize(q);
+        for(size_t k = 0; k < q; ++k)
+        {   g_list[0][k] = conv_sum(0, k, vy, r);
+            g_list[1][k] = conv_sum(0, k, ell, y);
+        }
+    }
+    else
+    {   assert( tx.size() == m * q );
+        //
+        // g_list[0] = f'(u)
+        g_list.resize(1);
+        g_list[0].resize(q);
+        vec_list<Scalar> h(q);
+        for(size_t k = 0; k < q; ++k)
+            math_series(op, k, u, y, g_list[0], h);
+    }
+    //
+    // px
+    // partial of y^k w.r.t. the j-th order argument is g^{k-j}
+    CppAD::vector<Scalar> sum, term;
+    for(size_t i_arg = 0; i_arg < g_list.size(); ++i_arg)
+    {   const vec_list<Scalar>& g = g_list[i_arg];
+        for(size_t j = 0; j < q; ++j)
+        {   vec_azmul(w[j], g[0], sum);
+            for(size_t k = j + 1; k < q; ++k)
+            {   vec_azmul(w[k], g[k - j], term);
+                vec_op(add_enum, sum, term, sum);
+            }
+            set_column(q, i_arg * m, j, sum, px);
+        }
+    }
+}
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
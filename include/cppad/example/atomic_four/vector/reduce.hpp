@@ -0,0 +1,464 @@
+# ifndef CPPAD_EXAMPLE_ATOMIC_FOUR_VECTOR_REDUCE_HPP
+# define CPPAD_EXAMPLE_ATOMIC_FOUR_VECTOR_REDUCE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_four_vector_reduce.hpp$$
+$spell
+    op
+    enum
+    sq
+$$
+
+$section Atomic Vector Reduction Class: Example Implementation$$
+
+$head Syntax$$
+$codei%atomic_vector_reduce<%Base%> %reduce_op%(%name%)
+%$$
+$icode%reduce_op%(%op%, %x%, %y%)
+%$$
+
+$head Purpose$$
+This atomic function computes a scalar $icode y$$ from a vector $icode x$$
+using one atomic operation (instead of one operation for each
+component of $icode x$$).
+It has the same purpose as $cref atomic_four_vector$$
+except that the range has dimension one.
+
+$head op$$
+The value $icode op$$ has the following possible values:
+$srcthisfile%
+    0%// BEGIN reduce_enum_t%// END reduce_enum_t%0
+%$$
+
+$head x$$
+We use $icode x$$ to denote the argument to the atomic function.
+The length of $icode x$$ is denoted by $icode n$$.
+
+$head m$$
+This is the length of the vectors in the operations.
+In the $code dot$$ case $icode%m% = %n% / 2%$$,
+otherwise $icode%m% = %n%$$.
+
+$head u$$
+We use $icode u$$ to denote the sub-vector
+$codei%( %x%[0] , %...% , %x%[%m%-1] )%$$.
+
+$head v$$
+In the $code dot$$ case,
+we use $icode v$$ to denote the sub-vector
+$codei%( %x%[%m%] , %...% , %x%[2*%m%-1] )%$$.
+
+$head y$$
+This vector has size one and its element is
+$table
+$icode op$$ $cnext $icode%y%[0]%$$
+$rnext
+$code sum_enum$$     $cnext $latex \sum_i u_i$$
+$rnext
+$code dot_enum$$     $cnext $latex \sum_i u_i v_i$$
+$rnext
+$code norm_sq_enum$$ $cnext $latex \sum_i u_i^2$$
+$tend
+
+$head Taylor Coefficients$$
+Each of these functions is a polynomial of degree at most two,
+so the Taylor coefficients of $latex y$$ are sums of
+products of the Taylor coefficients of $latex u$$ and $latex v$$:
+$latex \[
+    y^k = \sum_i \sum_{d=0}^k u_i^d v_i^{k-d}
+\] $$
+in the $code dot$$ case, and $latex v = u$$ in the $code norm_sq$$ case.
+Reverse mode uses the fact that the partial of $latex y^k$$ w.r.t.
+$latex u_i^d$$ is $latex v_i^{k-d}$$.
+
+$head AD<Base>$$
+The $codei%AD<%Base%>%$$ forward mode uses this atomic function
+and the $codei%AD<%Base%>%$$ reverse mode uses the
+$cref atomic_four_vector$$ multiply and add operators.
+Hence the number of atomic function calls they record does not depend
+on the length of the vectors.
+
+$head Example$$
+The file $cref atomic_four_vector_reduce.cpp$$ contains an example
+and test for this class.
+
+$head Source$$
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/example/atomic_four/vector/vector.hpp>
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+//
+template <class Base>
+class atomic_vector_reduce : public CppAD::atomic_four<Base> {
+//
+public:
+    // BEGIN reduce_enum_t
+    // atomic_vector_reduce::reduce_enum_t
+    typedef enum {
+        dot_enum,
+        norm_sq_enum,
+        sum_enum,
+        number_reduce_enum
+    } reduce_enum_t;
+    // END reduce_enum_t
+    //
+    // ctor
+    atomic_vector_reduce(const std::string& name) :
+    CppAD::atomic_four<Base>(name) ,
+    vec_op_(name + "_vec_op")
+    { }
+private:
+    typedef CppAD::vector< CppAD::AD<Base> >      ad_vector;
+    typedef typename atomic_vector<Base>::op_enum_t op_enum_t;
+    //
+    // vec_op_
+    // element-wise operations used by the AD<Base> reverse mode
+    atomic_vector<Base> vec_op_;
+    //
+    // n_vec
+    // number of vectors in the argument x
+    static size_t n_vec(reduce_enum_t op)
+    {   if( op == dot_enum )
+            return 2;
+        return 1;
+    }
+    // -----------------------------------------------------------------------
+    // for_type override
+    bool for_type(
+        size_t                                     call_id     ,
+        const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+        CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+    {   reduce_enum_t op = reduce_enum_t( call_id );
+        size_t m         = type_x.size() / n_vec(op);
+        //
+        // type_y[0]
+        // a product with an identically zero factor is identically zero
+        type_y[0] = identical_zero_enum;
+        for(size_t i = 0; i < m; ++i)
+        {   ad_type_enum type_i = type_x[i];
+            if( op == dot_enum )
+            {   if( type_x[m + i] == identical_zero_enum )
+                    type_i = identical_zero_enum;
+                else if( type_i != identical_zero_enum )
+                    type_i = std::max(type_i, type_x[m + i]);
+            }
+            type_y[0] = std::max(type_y[0], type_i);
+        }
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    // rev_depend override
+    bool rev_depend(
+        size_t                         call_id     ,
+        CppAD::vector<bool>&           depend_x    ,
+        const CppAD::vector<bool>&     depend_y    ) override
+    {   for(size_t j = 0; j < depend_x.size(); ++j)
+            depend_x[j] = depend_y[0];
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    // jac_sparsity override
+    bool jac_sparsity(
+        size_t                                         call_id      ,
+        bool                                           dependency   ,
+        const CppAD::vector<bool>&                     ident_zero_x ,
+        const CppAD::vector<bool>&                     select_x     ,
+        const CppAD::vector<bool>&                     select_y     ,
+        CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out  ) override
+    {   size_t n = select_x.size();
+        //
+        // nnz
+        size_t nnz = 0;
+        if( select_y[0] )
+        {   for(size_t j = 0; j < n; ++j)
+                if( select_x[j] )
+                    ++nnz;
+        }
+        //
+        // pattern_out
+        pattern_out.resize(1, n, nnz);
+        size_t k = 0;
+        if( select_y[0] )
+        {   for(size_t j = 0; j < n; ++j)
+                if( select_x[j] )
+                    pattern_out.set(k++, 0, j);
+        }
+        assert( k == nnz );
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    // hes_sparsity override
+    bool hes_sparsity(
+        size_t                                         call_id      ,
+        const CppAD::vector<bool>&                     select_x     ,
+        const CppAD::vector<bool>&                     select_y     ,
+        CppAD::sparse_rc< CppAD::vector<size_t> >&     pattern_out  ) override
+    {   reduce_enum_t op = reduce_enum_t( call_id );
+        size_t n         = select_x.size();
+        size_t m         = n / n_vec(op);
+        //
+        // nnz
+        size_t nnz = 0;
+        if( select_y[0] ) for(size_t i = 0; i < m; ++i)
+        {   switch(op)
+            {   case dot_enum:
+                if( select_x[i] && select_x[m + i] )
+                    nnz += 2;
+                break;
+
+                case norm_sq_enum:
+                if( select_x[i] )
+                    ++nnz;
+                break;
+
+                default:
+                break;
+            }
+        }
+        //
+        // pattern_out
+        pattern_out.resize(n, n, nnz);
+        size_t k = 0;
+        if( select_y[0] ) for(size_t i = 0; i < m; ++i)
+        {   switch(op)
+            {   case dot_enum:
+                if( select_x[i] && select_x[m + i] )
+                {   pattern_out.set(k++, i, m + i);
+                    pattern_out.set(k++, m + i, i);
+                }
+                break;
+
+                case norm_sq_enum:
+                if( select_x[i] )
+                    pattern_out.set(k++, i, i);
+                break;
+
+                default:
+                break;
+            }
+        }
+        assert( k == nnz );
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    // Base forward override
+    bool forward(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_y,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       tx,
+        CppAD::vector<Base>&                             ty) override
+    {   reduce_enum_t op = reduce_enum_t( call_id );
+        size_t q         = order_up + 1;
+        size_t m         = tx.size() / (q * n_vec(op) );
+        //
+        // v_offset
+        // index in tx of the first v coefficient (minus the u index)
+        size_t v_offset = 0;
+        if( op == dot_enum )
+            v_offset = m * q;
+        //
+        for(size_t k = order_low; k < q; ++k)
+        {   ty[k] = Base(0);
+            for(size_t i = 0; i < m; ++i)
+            {   if( op == sum_enum )
+                    ty[k] += tx[i * q + k];
+                else
+                {   for(size_t d = 0; d <= k; ++d)
+                        ty[k] += tx[i * q + d] * tx[v_offset + i * q + k - d];
+                }
+            }
+        }
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    // AD<Base> forward override
+    bool forward(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_y,
+        size_t                                           order_low,
+        size_t                                           order_up,
+        const ad_vector&                                 atx,
+        ad_vector&                                       aty) override
+    {   reduce_enum_t op = reduce_enum_t( call_id );
+        size_t q         = order_up + 1;
+        size_t m         = atx.size() / (q * n_vec(op) );
+        //
+        // v_offset
+        size_t v_offset = 0;
+        if( op == dot_enum )
+            v_offset = m * q;
+        //
+        ad_vector ax(2 * m), ay(1);
+        for(size_t k = order_low; k < q; ++k)
+        {   if( op == sum_enum )
+            {   // y^k = sum( u^k )
+                ax.resize(m);
+                for(size_t i = 0; i < m; ++i)
+                    ax[i] = atx[i * q + k];
+                (*this)(sum_enum, ax, ay); // atomic reduce sum
+                aty[k] = ay[0];
+            }
+            else
+            {   // y^k = sum_d dot( u^d , v^{k-d} )
+                ax.resize(2 * m);
+                for(size_t d = 0; d <= k; ++d)
+                {   for(size_t i = 0; i < m; ++i)
+                    {   ax[i]     = atx[i * q + d];
+                        ax[m + i] = atx[v_offset + i * q + k - d];
+                    }
+                    (*this)(dot_enum, ax, ay); // atomic reduce dot
+                    if( d == 0 )
+                        aty[k] = ay[0];
+                    else
+                        aty[k] += ay[0];
+                }
+            }
+        }
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    // Base reverse override
+    bool reverse(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_x,
+        size_t                                           order_up,
+        const CppAD::vector<Base>&                       tx,
+        const CppAD::vector<Base>&                       ty,
+        CppAD::vector<Base>&                             px,
+        const CppAD::vector<Base>&                       py) override
+    {   reduce_enum_t op = reduce_enum_t( call_id );
+        size_t q         = order_up + 1;
+        size_t m         = tx.size() / (q * n_vec(op) );
+        //
+        for(size_t i = 0; i < m; ++i)
+        {   for(size_t j = 0; j < q; ++j)
+            {   switch(op)
+                {   // partial of y^k w.r.t. u_i^j is one if k == j
+                    case sum_enum:
+                    px[i * q + j] = py[j];
+                    break;
+
+                    // partial of y^k w.r.t. u_i^j is v_i^{k-j}
+                    // partial of y^k w.r.t. v_i^j is u_i^{k-j}
+                    case dot_enum:
+                    px[i * q + j]         = Base(0);
+                    px[m * q + i * q + j] = Base(0);
+                    for(size_t k = j; k < q; ++k)
+                    {   px[i * q + j] += CppAD::azmul(
+                            py[k], tx[m * q + i * q + k - j]
+                        );
+                        px[m * q + i * q + j] += CppAD::azmul(
+                            py[k], tx[i * q + k - j]
+                        );
+                    }
+                    break;
+
+                    // partial of y^k w.r.t. u_i^j is 2 * u_i^{k-j}
+                    case norm_sq_enum:
+                    px[i * q + j] = Base(0);
+                    for(size_t k = j; k < q; ++k)
+                        px[i * q + j] += Base(2.0) * CppAD::azmul(
+                            py[k], tx[i * q + k - j]
+                        );
+                    break;
+
+                    default:
+                    assert(false);
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+    // -----------------------------------------------------------------------
+    // AD<Base> reverse override
+    bool reverse(
+        size_t                                           call_id,
+        const CppAD::vector<bool>&                       select_x,
+        size_t                                           order_up,
+        const ad_vector&                                 atx,
+        const ad_vector&                                 aty,
+        ad_vector&                                       apx,
+        const ad_vector&                                 apy) override
+    {   reduce_enum_t op = reduce_enum_t( call_id );
+        size_t q         = order_up + 1;
+        size_t m         = atx.size() / (q * n_vec(op) );
+        //
+        // sum_enum
+        // copying AD variables does not create operators on the tape
+        if( op == sum_enum )
+        {   for(size_t i = 0; i < m; ++i)
+            {   for(size_t j = 0; j < q; ++j)
+                    apx[i * q + j] = apy[j];
+            }
+            return true;
+        }
+        //
+        // scale
+        // factor for the partials w.r.t. u
+        double scale = 1.0;
+        if( op == norm_sq_enum )
+            scale = 2.0;
+        //
+        // v_offset, n_arg
+        size_t v_offset = m * q;
+        size_t n_arg    = 2;
+        if( op == norm_sq_enum )
+        {   v_offset = 0;
+            n_arg    = 1;
+        }
+        //
+        // ax_mul, ax_add, ay
+        ad_vector ax_mul(2 * m), ax_add(2 * m), ay(m);
+        //
+        for(size_t i_arg = 0; i_arg < n_arg; ++i_arg)
+        {   // offset for this argument and for the other argument
+            size_t offset       = i_arg * m * q;
+            size_t other_offset = v_offset - offset;
+            for(size_t j = 0; j < q; ++j)
+            {   for(size_t k = j; k < q; ++k)
+                {   // ay = scale * py^k * other^{k-j}
+                    for(size_t i = 0; i < m; ++i)
+                    {   ax_mul[i]     = scale * apy[k];
+                        ax_mul[m + i] = atx[other_offset + i * q + k - j];
+                    }
+                    vec_op_(atomic_vector<Base>::mul_enum, ax_mul, ay);
+                    if( k == j )
+                    {   for(size_t i = 0; i < m; ++i)
+                            ax_add[i] = ay[i];
+                    }
+                    else
+                    {   // ax_add[0:m-1] = ax_add[0:m-1] + ay
+                        for(size_t i = 0; i < m; ++i)
+                            ax_add[m + i] = ay[i];
+                        vec_op_(atomic_vector<Base>::add_enum, ax_add, ay);
+                        for(size_t i = 0; i < m; ++i)
+                            ax_add[i] = ay[i];
+                    }
+                }
+                for(size_t i = 0; i < m; ++i)
+                    apx[offset + i * q + j] = ax_add[i];
+            }
+        }
+        return true;
+    }
+};
+} // END_CPPAD_NAMESPACE
+// END C++
+# endif
@@ -85,12 +85,30 @@ bool atomic_vector<Base>::reverse(
         ok = true;
         break;
 
+        // exponential
+        case exp_enum:
+        reverse_exp(m, q, tx, ty, px, py);
+        ok = true;
+        break;
+
         // unary minus
         case neg_enum:
         reverse_neg(m, q, tx, ty, px, py);
         ok = true;
         break;
 
+        // other math functions
+        case cos_enum:
+        case erf_enum:
+        case log_enum:
+        case pow_enum:
+        case sin_enum:
+        case sqrt_enum:
+        case tanh_enum:
+        reverse_math(op, m, q, tx, ty, px, py);
+        ok = true;
+        break;
+
         // error
         case number_op_enum:
         assert(false);
@@ -148,12 +166,30 @@ bool atomic_vector<Base>::reverse(
         ok = true;
         break;
 
+        // exponential
+        case exp_enum:
+        reverse_exp(m, q, atx, aty, apx, apy);
+        ok = true;
+        break;
+
         // unary minus
         case neg_enum:
         reverse_neg(m, q, atx, aty, apx, apy);
         ok = true;
         break;
 
+        // other math functions
+        case cos_enum:
+        case erf_enum:
+        case log_enum:
+        case pow_enum:
+        case sin_enum:
+        case sqrt_enum:
+        case tanh_enum:
+        reverse_math(op, m, q, atx, aty, apx, apy);
+        ok = true;
+        break;
+
         // error
         case number_op_enum:
         assert(false);
@@ -68,10 +68,18 @@ public:
     // atomic_vector::op_enum_t
     typedef enum {
         add_enum,
+        cos_enum,
         div_enum,
+        erf_enum,
+        exp_enum,
+        log_enum,
         mul_enum,
         neg_enum,
+        pow_enum,
+        sin_enum,
+        sqrt_enum,
         sub_enum,
+        tanh_enum,
         number_op_enum
     } op_enum_t;
     // END op_enum_t
@@ -94,6 +102,7 @@ private:
             case sub_enum:
             case mul_enum:
             case div_enum:
+            case pow_enum:
             result = false;
             break;
 
@@ -214,7 +223,111 @@ private:
     CPPAD_ATOMIC_FOUR_FORWARD_AND_REVERSE(sub)
     CPPAD_ATOMIC_FOUR_FORWARD_AND_REVERSE(mul)
     CPPAD_ATOMIC_FOUR_FORWARD_AND_REVERSE(div)
+    CPPAD_ATOMIC_FOUR_FORWARD_AND_REVERSE(exp)
     CPPAD_ATOMIC_FOUR_FORWARD_AND_REVERSE(neg)
+    // ----------------------------------------------------------------------
+    // Other Math Functions (see math_op.hpp)
+    // ----------------------------------------------------------------------
+    // Scalar is Base or AD<Base>
+    template <class Scalar> using vec_list =
+        CppAD::vector< CppAD::vector<Scalar> >;
+    //
+    // vec_op
+    void vec_op(
+        op_enum_t                                        op,
+        const CppAD::vector<Base>&                       u,
+        CppAD::vector<Base>&                             y
+    );
+    void vec_op(
+        op_enum_t                                        op,
+        const CppAD::vector<Base>&                       u,
+        const CppAD::vector<Base>&                       v,
+        CppAD::vector<Base>&                             y
+    );
+    void vec_op(
+        op_enum_t                                        op,
+        const ad_vector&                                 au,
+        ad_vector&                                       ay
+    );
+    void vec_op(
+        op_enum_t                                        op,
+        const ad_vector&                                 au,
+        const ad_vector&                                 av,
+        ad_vector&                                       ay
+    );
+    //
+    // vec_azmul
+    void vec_azmul(
+        const CppAD::vector<Base>&                       u,
+        const CppAD::vector<Base>&                       v,
+        CppAD::vector<Base>&                             y
+    );
+    void vec_azmul(
+        const ad_vector&                                 au,
+        const ad_vector&                                 av,
+        ad_vector&                                       ay
+    );
+    //
+    // get_column, set_column
+    template <class Scalar>
+    static CppAD::vector<Scalar> get_column(
+        size_t                                           m,
+        size_t                                           q,
+        size_t                                           offset,
+        size_t                                           k,
+        const CppAD::vector<Scalar>&                     mat
+    );
+    template <class Scalar>
+    static void set_column(
+        size_t                                           q,
+        size_t                                           offset,
+        size_t                                           k,
+        const CppAD::vector<Scalar>&                     vec,
+        CppAD::vector<Scalar>&                           mat
+    );
+    //
+    // conv_sum, int_sum, math_series, forward_math, reverse_math
+    template <class Scalar>
+    CppAD::vector<Scalar> conv_sum(
+        size_t                                           d_low,
+        size_t                                           k,
+        const vec_list<Scalar>&                          a,
+        const vec_list<Scalar>&                          b
+    );
+    template <class Scalar>
+    CppAD::vector<Scalar> int_sum(
+        size_t                                           k,
+        const vec_list<Scalar>&                          u,
+        const vec_list<Scalar>&                          a
+    );
+    template <class Scalar>
+    void math_series(
+        op_enum_t                                        op,
+        size_t                                           k,
+        const vec_list<Scalar>&                          u,
+        const vec_list<Scalar>&                          y,
+        vec_list<Scalar>&                                g,
+        vec_list<Scalar>&                                h
+    );
+    template <class Scalar>
+    void forward_math(
+        op_enum_t                                        op,
+        size_t                                           m,
+        size_t                                           p,
+        size_t                                           q,
+        const CppAD::vector<Scalar>&                     tx,
+        CppAD::vector<Scalar>&                           ty
+    );
+    template <class Scalar>
+    void reverse_math(
+        op_enum_t                                        op,
+        size_t                                           m,
+        size_t                                           q,
+        const CppAD::vector<Scalar>&                     tx,
+        const CppAD::vector<Scalar>&                     ty,
+        CppAD::vector<Scalar>&                           px,
+        const CppAD::vector<Scalar>&                     py
+    );
 };
 } // END_CPPAD_NAMESPACE
 
@@ -226,6 +339,8 @@ private:
 # include <cppad/example/atomic_four/vector/hes_sparsity.hpp>
 # include <cppad/example/atomic_four/vector/reverse_op.hpp>
 # include <cppad/example/atomic_four/vector/forward_op.hpp>
+# include <cppad/example/atomic_four/vector/math_op.hpp>
+# include <cppad/example/atomic_four/vector/exp_op.hpp>
 # include <cppad/example/atomic_four/vector/neg_op.hpp>
 # include <cppad/example/atomic_four/vector/div_op.hpp>
 # include <cppad/example/atomic_four/vector/mul_op.hpp>
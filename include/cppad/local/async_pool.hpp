@@ -0,0 +1,225 @@
+# ifndef CPPAD_LOCAL_ASYNC_POOL_HPP
+# define CPPAD_LOCAL_ASYNC_POOL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <new>
+# include <utility>
+# include <algorithm>
+# include <thread>
+# include <mutex>
+# include <condition_variable>
+# include <deque>
+# include <future>
+# include <vector>
+# include <cppad/core/cppad_assert.hpp>
+# include <cppad/utility/thread_alloc.hpp>
+
+// BEGIN_CPPAD_LOCAL_NAMESPACE
+namespace CppAD { namespace local {
+/*!
+\file async_pool.hpp
+Pool of threads that evaluates requests for one ADFun object.
+*/
+
+/*!
+One request that is evaluated by an async_pool.
+
+\tparam Fun
+is the ADFun type for the function that is evaluated.
+*/
+template <class Fun>
+class async_request {
+public:
+    /// evaluate this request using the evaluation context g
+    /// (must not throw an exception)
+    virtual void run(Fun& g) = 0;
+
+    /// destructor
+    virtual ~async_request(void)
+    { }
+};
+
+/*!
+Create a request in memory obtained from thread_alloc.
+
+\tparam Request
+is a class derived from async_request<Fun>.
+
+\param request
+is the value for the new request.
+
+\return
+is a pointer to the new request.
+The pool thread that evaluates the request calls its destructor and
+returns its memory to thread_alloc.
+*/
+template <class Request>
+Request* async_request_create(Request&& request)
+{   size_t cap_bytes;
+    void*  v_ptr = thread_alloc::get_memory(sizeof(Request), cap_bytes);
+    return new(v_ptr) Request( std::move(request) );
+}
+
+/*!
+Pool of threads that evaluates requests for one ADFun object.
+
+\tparam Fun
+is the ADFun type for the function that is evaluated.
+
+\par Evaluation Context
+Each thread in the pool uses share_recording to create its own
+evaluation context for the function.
+Hence the operation sequence in the function must not change
+while the pool is running; see clear().
+
+\par Memory
+The threads do not call parallel_setup,
+so each thread uses its default thread_alloc thread number
+and the memory for the evaluation context, and the results of a request,
+come from that thread's thread_alloc pool.
+*/
+template <class Fun>
+class async_pool {
+private:
+    /// function that is evaluated (nullptr if threads are not running)
+    const Fun*                          fun_;
+
+    /// number of threads to start (zero means use hardware_concurrency)
+    size_t                              num_threads_;
+
+    /// the threads in the pool
+    std::vector<std::thread>            thread_;
+
+    /// protects queue_ and stop_
+    std::mutex                          mutex_;
+
+    /// signals that queue_ or stop_ has changed
+    std::condition_variable             ready_;
+
+    /// requests that have not yet been started
+    std::deque< async_request<Fun>* >   queue_;
+
+    /// have the threads been asked to stop
+    bool                                stop_;
+
+    /// evaluate requests until stop_ is true and the queue is empty
+    void work(void)
+    {   {   // evaluation context for this thread
+            Fun g;
+            g.share_recording(*fun_);
+            while( true )
+            {   async_request<Fun>* request;
+                {   std::unique_lock<std::mutex> lock(mutex_);
+                    ready_.wait(lock,
+                        [this]{ return stop_ || ! queue_.empty(); }
+                    );
+                    if( queue_.empty() )
+                        break;
+                    request = queue_.front();
+                    queue_.pop_front();
+                }
+                request->run(g);
+                //
+                // free the request
+                void* v_ptr = dynamic_cast<void*>(request);
+                request->~async_request();
+                thread_alloc::return_memory(v_ptr);
+            }
+        }
+        // return the memory this thread is holding for future use
+        thread_alloc::free_available( thread_alloc::thread_num() );
+    }
+public:
+    /// default constructor
+    async_pool(void)
+    : fun_(nullptr), num_threads_(0), stop_(false)
+    { }
+
+    /// destructor
+    ~async_pool(void)
+    {   clear(); }
+
+    /// number of threads that are running
+    size_t size(void) const
+    {   return thread_.size(); }
+
+    /*!
+    Finish the pending requests and terminate the threads.
+    This must be called before the operation sequence in the function
+    changes, and must not be called at the same time as post.
+    */
+    void clear(void)
+    {   if( thread_.size() == 0 )
+            return;
+        {   std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        ready_.notify_all();
+        for(size_t i = 0; i < thread_.size(); ++i)
+            thread_[i].join();
+        thread_.clear();
+        fun_  = nullptr;
+        stop_ = false;
+    }
+
+    /*!
+    Set the number of threads used the next time the pool is started.
+
+    \param num_threads
+    is the number of threads. If it is zero,
+    std::thread::hardware_concurrency() threads are used
+    (at least one and less than CPPAD_MAX_NUM_THREADS).
+    */
+    void num_threads(size_t num_threads)
+    {   clear();
+        num_threads_ = num_threads;
+    }
+
+    /*!
+    Put a request in the queue (start the threads if necessary).
+
+    \param fun
+    is the function that the threads evaluate.
+
+    \param request
+    was created using async_request_create.
+    */
+    void post(const Fun* fun, async_request<Fun>* request)
+    {   CPPAD_ASSERT_KNOWN(
+            thread_alloc::num_threads() == 1,
+            "f.forward_async or f.sparse_jac_rev_async: "
+            "parallel_setup has been called with num_threads > 1"
+        );
+        {   std::lock_guard<std::mutex> lock(mutex_);
+            queue_.push_back(request);
+            if( thread_.size() == 0 )
+            {   fun_ = fun;
+                size_t num_threads = num_threads_;
+                if( num_threads == 0 )
+                {   num_threads = std::thread::hardware_concurrency();
+                    num_threads = std::min(
+                        num_threads, size_t(CPPAD_MAX_NUM_THREADS) - 1
+                    );
+                }
+                num_threads = std::max(num_threads, size_t(1));
+                for(size_t i = 0; i < num_threads; ++i)
+                    thread_.push_back( std::thread(&async_pool::work, this) );
+            }
+        }
+        ready_.notify_one();
+    }
+};
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
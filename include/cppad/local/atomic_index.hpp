@@ -104,19 +104,50 @@ corresponding to the input values for
 $icode type$$, $codei%*%name%$$, and $icode ptr$$.
 Otherwise, $index_out$$ is zero.
 
+$head n_null$$
+The syntax
+$codei%
+    %n_null% = local::atomic_index_n_null<%Base%>().load()
+%$$
+returns the number of times a $icode ptr$$ has been set to null; i.e.,
+the number of atomic functions that have been deleted.
+The $icode type$$ and $icode ptr$$ corresponding to an index do not change
+while this value does not change.
+This is used to cache the information for an index; see
+$code play::atom_table$$.
+
+$head Thread Safety$$
+This routine does not use locks and can be called by any thread.
+Storing the information for a new index does not move the information
+for other indices.
+In the get number case,
+some of the indices may correspond to information that is being stored
+by another thread.
+For these indices, $icode type$$ is zero, $icode ptr$$ is null,
+and $codei%*%name%$$ is empty.
+
 $end
 */
 # include <vector>
 # include <cppad/utility/thread_alloc.hpp>
+# include <cppad/local/chunk_table.hpp>
 
 namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
 
 struct atomic_index_info {
-    size_t      type;
-    std::string name;
-    void*       ptr;
+    // zero until the information for this index has been stored
+    std::atomic<size_t> type;
+    std::string         name;
+    std::atomic<void*>  ptr;
 };
 
+// n_null
+template <class Base>
+std::atomic<size_t>& atomic_index_n_null(void)
+{   static std::atomic<size_t> n_null(0);
+    return n_null;
+}
+
 // BEGIN_ATOMIC_INDEX
 template <class Base>
 size_t atomic_index(
@@ -128,43 +159,48 @@ size_t atomic_index(
 // END_PROTOTYPE
 {   //
     // information for each index
-    static std::vector<atomic_index_info> vec;
-# ifndef NDEBUG
-    if( index_in == 0 || set_null )
-    {   CPPAD_ASSERT_KNOWN( ! thread_alloc::in_parallel(),
-        "calling atomic function constructor or destructor in parallel mode"
-        );
-    }
-# endif
+    // (lock free so atomic functions can be created by any thread)
+    static std::atomic<atomic_index_info*> directory[chunk_table_num_chunk];
+    static std::atomic<size_t>             n_index(0);
+    //
     if( set_null & (index_in == 0) )
-        return vec.size();
+        return n_index.load(std::memory_order_acquire);
     //
     // case were we are retreving informaiton for an atomic function
     if( 0 < index_in )
-    {   CPPAD_ASSERT_UNKNOWN( index_in <= vec.size() )
+    {   CPPAD_ASSERT_UNKNOWN( index_in <= n_index.load() )
+        atomic_index_info* entry = chunk_table_record(directory, index_in - 1);
+        //
+        // case where the information is not yet stored by another thread
+        type = entry->type.load(std::memory_order_acquire);
+        if( type == 0 )
+        {   ptr = nullptr;
+            if( name != nullptr )
+                *name = "";
+            return 0;
+        }
         //
         // case where we are setting the pointer to null
         if( set_null )
-            vec[index_in-1].ptr = nullptr;
+        {   entry->ptr.store(nullptr);
+            atomic_index_n_null<Base>().fetch_add(1, std::memory_order_acq_rel);
+        }
         //
-        atomic_index_info& entry = vec[index_in - 1];
-        type = entry.type;
-        ptr  = entry.ptr;
+        ptr  = entry->ptr.load();
         if( name != nullptr )
-            *name  = entry.name;
+            *name  = entry->name;
         return 0;
     }
     //
     // case where we are storing information for an atomic function
-    atomic_index_info entry;
-    entry.type = type;
-    entry.name = *name;
-    entry.ptr  = ptr;
-    vec.push_back(entry);
+    CPPAD_ASSERT_UNKNOWN( type != 0 );
+    size_t index = n_index.fetch_add(1, std::memory_order_acq_rel);
+    atomic_index_info* entry = chunk_table_record(directory, index);
+    entry->name = *name;
+    entry->ptr.store(ptr);
+    entry->type.store(type, std::memory_order_release);
     //
-    return vec.size();
+    return index + 1;
 }
-
 } } // END_CPPAD_LOCAL_NAMESPACE
-
 # endif
@@ -0,0 +1,81 @@
+# ifndef CPPAD_LOCAL_CHUNK_TABLE_HPP
+# define CPPAD_LOCAL_CHUNK_TABLE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <atomic>
+# include <cppad/core/cppad_assert.hpp>
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file chunk_table.hpp
+A table that grows without locks or reallocation.
+*/
+
+/// log base 2 of the number of records in the first chunk
+const size_t chunk_table_log2_first = 6;
+
+/// number of chunks in the directory for a chunk table
+const size_t chunk_table_num_chunk  =
+    8 * sizeof(size_t) - chunk_table_log2_first;
+
+/*!
+Get a record in a chunk table.
+
+The records are stored in chunks that are allocated when they are first used.
+The chunk with index k has 64 * 2^k records, so the directory of chunks
+never needs to be reallocated and lookups are lock free.
+The chunks are never freed.
+
+\tparam Record
+is the type of the records in the table. A new chunk is value initialized;
+i.e., if Record is a struct, its std::atomic and plain old data members
+are zero.
+
+\param directory
+is the directory for this chunk table and has chunk_table_num_chunk elements.
+It is usually a static array and hence initialized as null pointers.
+
+\param index
+is the index of the record in the table.
+
+\return
+is a pointer to the record in the table with the specified index.
+*/
+template <class Record>
+Record* chunk_table_record(std::atomic<Record*>* directory, size_t index)
+{   //
+    // k, offset: chunk k and offset within chunk
+    size_t j = index + ( size_t(1) << chunk_table_log2_first );
+    size_t k = 0;
+    while( (j >> (k + chunk_table_log2_first + 1)) != 0 )
+        ++k;
+    size_t size   = size_t(1) << (k + chunk_table_log2_first);
+    size_t offset = j - size;
+    CPPAD_ASSERT_UNKNOWN( k < chunk_table_num_chunk && offset < size );
+    //
+    // chunk
+    Record* chunk = directory[k].load(std::memory_order_acquire);
+    if( chunk == nullptr )
+    {   // allocate and value initialize this chunk
+        Record* new_chunk = new Record[size]();
+        if( directory[k].compare_exchange_strong(
+            chunk, new_chunk, std::memory_order_acq_rel
+        ) )
+            chunk = new_chunk;
+        else
+            delete [] new_chunk; // another thread allocated this chunk
+    }
+    return chunk + offset;
+}
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+# endif
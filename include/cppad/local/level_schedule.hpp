@@ -0,0 +1,302 @@
+# ifndef CPPAD_LOCAL_LEVEL_SCHEDULE_HPP
+# define CPPAD_LOCAL_LEVEL_SCHEDULE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/op_code_var.hpp>
+# include <cppad/local/play/sequential_iterator.hpp>
+
+// BEGIN_CPPAD_LOCAL_NAMESPACE
+namespace CppAD { namespace local {
+/*!
+\file level_schedule.hpp
+Schedule that evaluates the operators in an operation sequence by
+dependency level.
+*/
+
+/*!
+Class used to group the operators in an operation sequence by dependency
+level so that the operators in one level can be evaluated at the same time.
+
+\par Levels
+The level of an operator is zero if none of its arguments are variables.
+Otherwise it is one plus the maximum level of the operators that created
+its variable arguments (the independent variables have level zero and are
+not in the schedule).
+
+\par Supported Operators
+The schedule is only created when every operator is a function of its
+arguments that writes only its own results; i.e.,
+there are no atomic function calls, conditional skips,
+discrete functions, print operators, or VecAD operators.
+Comparison operators are not in the schedule; has_compare() is true
+if there are any.
+*/
+class level_schedule {
+private:
+    /// is the schedule set (setup has been called and not cleared)
+    bool set_;
+
+    /// are all the operators supported
+    bool ok_;
+
+    /// are there any comparison operators
+    bool has_compare_;
+
+    /// index in op_, arg_, var_ for the start of each level
+    /// followed by the number of scheduled operators
+    pod_vector<size_t> level_start_;
+
+    /// operator for each entry in the schedule
+    pod_vector<opcode_t> op_;
+
+    /// index in the argument vector of the first argument for each entry
+    pod_vector<addr_t> arg_;
+
+    /// primary result variable for each entry
+    pod_vector<addr_t> var_;
+
+public:
+    /// default constructor
+    level_schedule(void)
+    : set_(false), ok_(false), has_compare_(false)
+    { }
+    // -----------------------------------------------------------------------
+    /// has setup been called (since the last clear)
+    bool set(void) const
+    {   return set_; }
+
+    /// are all the operators supported
+    bool ok(void) const
+    {   return ok_; }
+
+    /// are there any comparison operators
+    bool has_compare(void) const
+    {   return has_compare_; }
+
+    /// number of levels (zero when not ok)
+    size_t n_level(void) const
+    {   if( level_start_.size() == 0 )
+            return 0;
+        return level_start_.size() - 1;
+    }
+
+    /// number of operators in the schedule
+    size_t n_op(void) const
+    {   return op_.size(); }
+
+    /// index in the schedule for the start of level ell (ell <= n_level)
+    size_t level_start(size_t ell) const
+    {   return level_start_[ell]; }
+
+    /// operator for the k-th entry in the schedule
+    OpCode op(size_t k) const
+    {   return OpCode( op_[k] ); }
+
+    /// offset of the first argument for the k-th entry
+    size_t arg(size_t k) const
+    {   return size_t( arg_[k] ); }
+
+    /// primary result for the k-th entry
+    size_t var(size_t k) const
+    {   return size_t( var_[k] ); }
+
+    /// amount of memory corresonding to this object
+    size_t memory(void) const
+    {   size_t sum = level_start_.size() * sizeof(size_t);
+        sum       += op_.size()          * sizeof(opcode_t);
+        sum       += arg_.size()         * sizeof(addr_t);
+        sum       += var_.size()         * sizeof(addr_t);
+        return sum;
+    }
+    // -----------------------------------------------------------------------
+    /// free memory used by this object
+    void clear(void)
+    {   set_         = false;
+        ok_          = false;
+        has_compare_ = false;
+        level_start_.clear();
+        op_.clear();
+        arg_.clear();
+        var_.clear();
+    }
+
+    /// assignment operator
+    void operator=(const level_schedule& schedule)
+    {   set_         = schedule.set_;
+        ok_          = schedule.ok_;
+        has_compare_ = schedule.has_compare_;
+        level_start_ = schedule.level_start_;
+        op_          = schedule.op_;
+        arg_         = schedule.arg_;
+        var_         = schedule.var_;
+    }
+
+    /// swap
+    /// (used for move semantics version of ADFun assignment)
+    void swap(level_schedule& schedule)
+    {   std::swap(set_,         schedule.set_);
+        std::swap(ok_,          schedule.ok_);
+        std::swap(has_compare_, schedule.has_compare_);
+        level_start_.swap( schedule.level_start_ );
+        op_.swap(          schedule.op_          );
+        arg_.swap(         schedule.arg_         );
+        var_.swap(         schedule.var_         );
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Compute the schedule for an operation sequence.
+
+    \param play
+    is the player for this operation sequence.
+    */
+    template <class Base>
+    void setup(const player<Base>* play)
+    {   clear();
+        set_ = true;
+        //
+        // num_op, num_var
+        size_t num_op  = play->num_op_rec();
+        size_t num_var = play->num_var_rec();
+        //
+        // var_level
+        // level for the operator that created each variable
+        pod_vector<size_t> var_level(num_var);
+        //
+        // op_level
+        // level for each operator (num_op if it is not in the schedule)
+        pod_vector<size_t> op_level(num_op);
+        //
+        // level_count
+        // number of operators in each level
+        pod_vector<size_t> level_count;
+        //
+        // work space used by arg_is_variable
+        pod_vector<bool> is_variable;
+        //
+        // first pass: level for each operator
+        play::const_sequential_iterator itr = play->begin();
+        OpCode        op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        var_level[0] = 0;
+        op_level[0]  = num_op;
+        while( op != EndOp )
+        {   (++itr).op_info(op, arg, i_var);
+            size_t i_op  = itr.op_index();
+            op_level[i_op] = num_op;
+            switch( op )
+            {   // operators that are not supported
+                case AFunOp:
+                case CSkipOp:
+                case DisOp:
+                case FunapOp:
+                case FunavOp:
+                case FunrpOp:
+                case FunrvOp:
+                case LdpOp:
+                case LdvOp:
+                case PriOp:
+                case StppOp:
+                case StpvOp:
+                case StvpOp:
+                case StvvOp:
+                return;
+
+                // comparison operators
+                case EqppOp:
+                case EqpvOp:
+                case EqvvOp:
+                case LeppOp:
+                case LepvOp:
+                case LevpOp:
+                case LevvOp:
+                case LtppOp:
+                case LtpvOp:
+                case LtvpOp:
+                case LtvvOp:
+                case NeppOp:
+                case NepvOp:
+                case NevvOp:
+                has_compare_ = true;
+                break;
+
+                // independent variables have level zero
+                case InvOp:
+                var_level[i_var] = 0;
+                break;
+
+                case EndOp:
+                break;
+
+                default:
+                {   size_t level = 0;
+                    arg_is_variable(op, arg, is_variable);
+                    for(size_t j = 0; j < is_variable.size(); ++j)
+                    {   if( is_variable[j] ) level = std::max(
+                            level, var_level[ size_t(arg[j]) ] + 1
+                        );
+                    }
+                    CPPAD_ASSERT_UNKNOWN( NumRes(op) > 0 );
+                    for(size_t k = 0; k < NumRes(op); ++k)
+                        var_level[i_var - k] = level;
+                    op_level[i_op] = level;
+                    while( level_count.size() <= level )
+                        level_count.push_back(0);
+                    ++level_count[level];
+                }
+                if( op == CSumOp )
+                    itr.correct_before_increment();
+                break;
+            }
+        }
+        //
+        // level_start_
+        size_t n_level = level_count.size();
+        level_start_.resize(n_level + 1);
+        level_start_[0] = 0;
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_start_[ell + 1] = level_start_[ell] + level_count[ell];
+        size_t n_sched = level_start_[n_level];
+        //
+        // second pass: op_, arg_, var_ in level order
+        op_.resize(n_sched);
+        arg_.resize(n_sched);
+        var_.resize(n_sched);
+        for(size_t ell = 0; ell < n_level; ++ell)
+            level_count[ell] = level_start_[ell];
+        itr = play->begin();
+        itr.op_info(op, arg, i_var);
+        const addr_t* arg_begin = arg;
+        while( op != EndOp )
+        {   (++itr).op_info(op, arg, i_var);
+            size_t level = op_level[ itr.op_index() ];
+            if( level < num_op )
+            {   size_t k = level_count[level]++;
+                op_[k]   = opcode_t( op );
+                arg_[k]  = addr_t( arg - arg_begin );
+                var_[k]  = addr_t( i_var );
+            }
+            if( op == CSumOp )
+                itr.correct_before_increment();
+        }
+        ok_ = true;
+        return;
+    }
+};
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
@@ -0,0 +1,637 @@
+# ifndef CPPAD_LOCAL_LIVE_SLOT_HPP
+# define CPPAD_LOCAL_LIVE_SLOT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/op_code_var.hpp>
+# include <cppad/local/play/sequential_iterator.hpp>
+
+// BEGIN_CPPAD_LOCAL_NAMESPACE
+namespace CppAD { namespace local {
+/*!
+\file live_slot.hpp
+Mapping of variables to a reusable pool of zero order value slots.
+*/
+
+/*!
+Class used to map the variables in an operation sequence to a smaller
+set of slots that can be reused once a variable is no longer needed.
+
+\par Liveness
+A variable is live from the operator that creates it to the last operator
+that uses it as an argument. Dependent variables and variables that are
+stored in a VecAD vector are live until the end of the operation sequence.
+Independent variables are never freed (so that their values can be set
+before the sweep starts).
+
+\par Slots
+All the results for one operator are assigned a block of consecutive slots
+(the operator functions access auxillary results using offsets from the
+primary result). The results of an operator are allocated before its
+arguments are freed so that a result never shares a slot with an argument
+of the same operator. Slot zero corresponds to the BeginOp variable and
+is never reused; i.e., a non-zero slot index always corresponds to a
+variable (this is used by the atomic function results).
+
+\par Segments
+The operators after the independent variables are split into segments
+that have about the square root of the number of operators in each segment
+(an atomic function call is never split between segments).
+These are used by reverse_live to recompute one segment at a time.
+The segment method converts this object into the mapping for one segment.
+In this case, a variable created before the segment uses the same slot
+as in the original mapping, and a variable created during the segment
+has its own slot (following all the original slots);
+i.e., the segment slots do not reuse memory and are in the same order as
+the corresponding variables.
+*/
+class live_slot {
+private:
+    /// number of slots (zero when setup has not been called)
+    size_t n_slot_;
+
+    /// operator index at the start (index zero) and end (index one)
+    /// of the operators that are mapped (both zero for the entire recording)
+    size_t range_op_[2];
+
+    /// argument index for the operators at the start and end of the range
+    size_t range_arg_[2];
+
+    /// index of last result for the operators at the start and end of
+    /// the range (see const_sequential_iterator)
+    size_t range_var_[2];
+
+    /// operator index at the start of each segment followed by the
+    /// operator index for the EndOp (size zero or number of segments plus one)
+    pod_vector<size_t> seg_op_;
+
+    /// index of first argument for each operator in seg_op_
+    pod_vector<size_t> seg_arg_;
+
+    /// index of first variable created by each operator in seg_op_
+    /// (or that would be created if the operator had a result)
+    pod_vector<size_t> seg_var_;
+
+    /// slot corresponding to the primary result for each operator
+    /// (size zero or number of operators)
+    pod_vector<addr_t> op2slot_;
+
+    /// copy of the operator argument vector with the variable indices
+    /// replaced by slot indices (size zero or number of arguments)
+    pod_vector<addr_t> arg_slot_;
+
+    /// slot corresponding to each dependent variable
+    /// (size zero or number of dependent variables)
+    pod_vector<addr_t> dep2slot_;
+
+public:
+    /// default constructor (all sizes are zero)
+    live_slot(void)
+    : n_slot_(0)
+    {   for(size_t i = 0; i < 2; ++i)
+        {   range_op_[i]  = 0;
+            range_arg_[i] = 0;
+            range_var_[i] = 0;
+        }
+    }
+    // -----------------------------------------------------------------------
+    /// number of slots (zero if setup has not been called)
+    size_t n_slot(void) const
+    {   return n_slot_; }
+
+    /// number of segments (zero if setup has not been called)
+    size_t n_segment(void) const
+    {   if( seg_op_.size() == 0 )
+            return 0;
+        return seg_op_.size() - 1;
+    }
+
+    /// number of variables created by the operators in segment k
+    size_t n_segment_var(size_t k) const
+    {   return seg_var_[k+1] - seg_var_[k]; }
+
+    /// operator index at the start (i = 0) or end (i = 1) of the range
+    /// (both are zero for the entire recording)
+    size_t range_op(size_t i) const
+    {   return range_op_[i]; }
+
+    /// iterator for the operator at the start (i = 0) or end (i = 1)
+    /// of the range (not for the entire recording)
+    template <class Base>
+    play::const_sequential_iterator range_itr(
+        const player<Base>* play, size_t i
+    ) const
+    {   CPPAD_ASSERT_UNKNOWN( range_op_[0] != 0 );
+        return play->begin_at(range_op_[i], range_arg_[i], range_var_[i]);
+    }
+
+    /// slot for the primary result of each operator
+    const pod_vector<addr_t>& op2slot(void) const
+    {   return op2slot_; }
+
+    /// argument vector with variable indices replaced by slot indices
+    const pod_vector<addr_t>& arg_slot(void) const
+    {   return arg_slot_; }
+
+    /// slot for each dependent variable
+    const pod_vector<addr_t>& dep2slot(void) const
+    {   return dep2slot_; }
+
+    /// amount of memory corresonding to this object
+    size_t memory(void) const
+    {   size_t sum = op2slot_.size()  * sizeof(addr_t);
+        sum       += arg_slot_.size() * sizeof(addr_t);
+        sum       += dep2slot_.size() * sizeof(addr_t);
+        sum       += seg_op_.size()   * sizeof(size_t);
+        sum       += seg_arg_.size()  * sizeof(size_t);
+        sum       += seg_var_.size()  * sizeof(size_t);
+        return sum;
+    }
+    // -----------------------------------------------------------------------
+    /// free memory used by this object
+    void clear(void)
+    {   n_slot_ = 0;
+        for(size_t i = 0; i < 2; ++i)
+        {   range_op_[i]  = 0;
+            range_arg_[i] = 0;
+            range_var_[i] = 0;
+        }
+        op2slot_.clear();
+        arg_slot_.clear();
+        dep2slot_.clear();
+        seg_op_.clear();
+        seg_arg_.clear();
+        seg_var_.clear();
+    }
+
+    /// assignment operator
+    void operator=(const live_slot& slot)
+    {   n_slot_    = slot.n_slot_;
+        for(size_t i = 0; i < 2; ++i)
+        {   range_op_[i]  = slot.range_op_[i];
+            range_arg_[i] = slot.range_arg_[i];
+            range_var_[i] = slot.range_var_[i];
+        }
+        op2slot_   = slot.op2slot_;
+        arg_slot_  = slot.arg_slot_;
+        dep2slot_  = slot.dep2slot_;
+        seg_op_    = slot.seg_op_;
+        seg_arg_   = slot.seg_arg_;
+        seg_var_   = slot.seg_var_;
+    }
+
+    /// swap
+    /// (used for move semantics version of ADFun assignment)
+    void swap(live_slot& slot)
+    {   std::swap(n_slot_, slot.n_slot_);
+        for(size_t i = 0; i < 2; ++i)
+        {   std::swap(range_op_[i],  slot.range_op_[i]);
+            std::swap(range_arg_[i], slot.range_arg_[i]);
+            std::swap(range_var_[i], slot.range_var_[i]);
+        }
+        op2slot_.swap(  slot.op2slot_  );
+        arg_slot_.swap( slot.arg_slot_ );
+        dep2slot_.swap( slot.dep2slot_ );
+        seg_op_.swap(   slot.seg_op_   );
+        seg_arg_.swap(  slot.seg_arg_  );
+        seg_var_.swap(  slot.seg_var_  );
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Compute the mapping from variables to slots for an operation sequence.
+
+    \param play
+    is the player for this operation sequence.
+
+    \param dep_taddr
+    is the variable index for each of the dependent variables.
+    */
+    template <class Base>
+    void setup(
+        const player<Base>*       play      ,
+        const pod_vector<size_t>& dep_taddr )
+    {   // number of operators, variables, and arguments
+        size_t num_op  = play->num_op_rec();
+        size_t num_var = play->num_var_rec();
+        size_t num_arg = play->num_op_arg_rec();
+        CPPAD_ASSERT_UNKNOWN(
+            num_op < size_t( std::numeric_limits<addr_t>::max() )
+        );
+        //
+        // keep: value of last_use for variables that are never freed
+        addr_t keep = addr_t( num_op );
+        //
+        // last_use
+        // operator index where each variable is last used as an argument
+        // (zero if it is never used).
+        pod_vector<addr_t> last_use(num_var);
+        for(size_t i = 0; i < num_var; ++i)
+            last_use[i] = 0;
+        for(size_t i = 0; i < dep_taddr.size(); ++i)
+            last_use[ dep_taddr[i] ] = keep;
+        //
+        // work space used by arg_is_variable
+        pod_vector<bool> is_variable;
+        //
+        // first pass: liveness analysis
+        play::const_sequential_iterator itr = play->begin();
+        OpCode        op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        const addr_t* arg_begin = arg;
+        while( op != EndOp )
+        {   (++itr).op_info(op, arg, i_var);
+            addr_t i_op = addr_t( itr.op_index() );
+            //
+            arg_is_variable(op, arg, is_variable);
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] )
+                {   size_t j_var = size_t( arg[j] );
+                    if( last_use[j_var] != keep )
+                        last_use[j_var] = i_op;
+                }
+            }
+            // a variable stored in a VecAD vector can be loaded later
+            if( op == StpvOp || op == StvvOp )
+                last_use[ arg[2] ] = keep;
+            //
+            if( op == CSkipOp || op == CSumOp )
+                itr.correct_before_increment();
+        }
+        //
+        // arg_slot_: variable arguments are replaced during second pass
+        arg_slot_.resize(num_arg);
+        for(size_t i = 0; i < num_arg; ++i)
+            arg_slot_[i] = arg_begin[i];
+        //
+        // op2slot_
+        op2slot_.resize(num_op);
+        //
+        // var2slot
+        // slot for the primary result of each variable (zero once it is freed)
+        pod_vector<addr_t> var2slot(num_var);
+        //
+        // var2n_res
+        // number of results for the operator that created each variable
+        pod_vector<unsigned char> var2n_res(num_var);
+        //
+        // free_list
+        // free_list[k] is a stack of free blocks that have k slots
+        const size_t n_res_max = 5;
+        pod_vector<addr_t> free_list[n_res_max + 1];
+        //
+        // n_seg_op: number of operators in each segment
+        size_t n_seg_op = 1;
+        while( n_seg_op * n_seg_op < num_op )
+            ++n_seg_op;
+        //
+        // in_call: is the current operator inside an atomic function call
+        bool in_call = false;
+        //
+        // second pass: assign slots
+        // slot zero is reserved for the BeginOp variable
+        n_slot_ = 1;
+        seg_op_.resize(0);
+        seg_arg_.resize(0);
+        seg_var_.resize(0);
+        for(size_t i = 0; i < 2; ++i)
+        {   range_op_[i]  = 0;
+            range_arg_[i] = 0;
+            range_var_[i] = 0;
+        }
+        itr     = play->begin();
+        itr.op_info(op, arg, i_var);
+        op2slot_[0] = 0;
+        var2slot[0] = 0;
+        while( op != EndOp )
+        {   (++itr).op_info(op, arg, i_var);
+            size_t i_op  = itr.op_index();
+            size_t n_res = NumRes(op);
+            CPPAD_ASSERT_UNKNOWN( n_res <= n_res_max );
+            //
+            // start of a segment (the EndOp terminates the last segment)
+            if( op != InvOp && ! in_call )
+            {   size_t n_seg = seg_op_.size();
+                bool start   = n_seg == 0 || op == EndOp;
+                if( ! start )
+                    start = n_seg_op <= i_op - seg_op_[n_seg - 1];
+                if( start )
+                {   seg_op_.push_back( i_op );
+                    seg_arg_.push_back( size_t(arg - arg_begin) );
+                    seg_var_.push_back( i_var + 1 - n_res );
+                }
+            }
+            if( op == AFunOp )
+                in_call = ! in_call;
+            //
+            // allocate the results for this operator
+            op2slot_[i_op] = 0;
+            if( n_res > 0 )
+            {   size_t start;
+                if( free_list[n_res].size() > 0 )
+                {   size_t top = free_list[n_res].size() - 1;
+                    start      = size_t( free_list[n_res][top] );
+                    free_list[n_res].resize(top);
+                }
+                else
+                {   start    = n_slot_;
+                    n_slot_ += n_res;
+                }
+                op2slot_[i_op]   = addr_t( start + n_res - 1 );
+                var2slot[i_var]  = op2slot_[i_op];
+                var2n_res[i_var] = static_cast<unsigned char>( n_res );
+            }
+            //
+            // map the variable arguments to slots
+            size_t offset = size_t(arg - arg_begin);
+            arg_is_variable(op, arg, is_variable);
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] )
+                {   size_t j_var = size_t( arg[j] );
+                    CPPAD_ASSERT_UNKNOWN( var2slot[j_var] != 0 );
+                    arg_slot_[offset + j] = var2slot[j_var];
+                }
+            }
+            //
+            // free the arguments that are not used after this operator
+            // (var2slot is zero after the first free of a variable)
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] )
+                {   size_t j_var = size_t( arg[j] );
+                    bool   last  = size_t( last_use[j_var] ) == i_op;
+                    if( last && var2slot[j_var] != 0 )
+                    {   size_t k     = size_t( var2n_res[j_var] );
+                        size_t start = size_t( var2slot[j_var] ) + 1 - k;
+                        free_list[k].push_back( addr_t(start) );
+                        var2slot[j_var] = 0;
+                    }
+                }
+            }
+            //
+            // free results that are never used
+            // (independent variables are never freed)
+            if( n_res > 0 && last_use[i_var] == 0 && op != InvOp )
+            {   size_t start = size_t( var2slot[i_var] ) + 1 - n_res;
+                free_list[n_res].push_back( addr_t(start) );
+                var2slot[i_var] = 0;
+            }
+            //
+            if( op == CSkipOp || op == CSumOp )
+                itr.correct_before_increment();
+        }
+        //
+        // dep2slot_
+        dep2slot_.resize( dep_taddr.size() );
+        for(size_t i = 0; i < dep_taddr.size(); ++i)
+        {   CPPAD_ASSERT_UNKNOWN( var2slot[ dep_taddr[i] ] != 0 );
+            dep2slot_[i] = var2slot[ dep_taddr[i] ];
+        }
+        return;
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Set this object to the mapping for one segment of another mapping.
+
+    \param play
+    is the player for this operation sequence.
+    There cannot be any VecAD vectors in this operation sequence.
+
+    \param slot
+    is the mapping for the entire operation sequence; i.e.,
+    setup was called for slot (and segment was not).
+
+    \param k
+    is the index of the segment; k < slot.n_segment().
+
+    \par
+    Upon return, n_slot() is slot.n_slot() plus the number of
+    variables created by the segment.
+    Only the values of op2slot() and arg_slot() that correspond to the
+    operators in the segment are specified.
+    The range for this object is the operators in the segment.
+    */
+    template <class Base>
+    void segment(
+        const player<Base>* play ,
+        const live_slot&    slot ,
+        size_t              k    )
+    {   CPPAD_ASSERT_UNKNOWN( k < slot.n_segment() );
+        CPPAD_ASSERT_UNKNOWN( slot.range_op_[0] == 0 );
+        CPPAD_ASSERT_UNKNOWN( play->num_var_vecad_rec() == 0 );
+        //
+        // first_var, n_slot_
+        size_t first_var = slot.seg_var_[k];
+        size_t n_slot    = slot.n_slot_;
+        n_slot_          = n_slot + slot.n_segment_var(k);
+        CPPAD_ASSERT_UNKNOWN(
+            n_slot_ < size_t( std::numeric_limits<addr_t>::max() )
+        );
+        //
+        // range_op_, range_arg_, range_var_
+        for(size_t i = 0; i < 2; ++i)
+        {   range_op_[i]  = slot.seg_op_[k + i];
+            range_arg_[i] = slot.seg_arg_[k + i];
+            OpCode op     = play->GetOp( range_op_[i] );
+            range_var_[i] = slot.seg_var_[k + i] + NumRes(op) - 1;
+        }
+        //
+        // the segment mappings are not used
+        seg_op_.clear();
+        seg_arg_.clear();
+        seg_var_.clear();
+        dep2slot_.clear();
+        //
+        // op2slot_, arg_slot_
+        op2slot_.resize( play->num_op_rec() );
+        arg_slot_.resize( play->num_op_arg_rec() );
+        //
+        // arg_begin
+        play::const_sequential_iterator itr = play->begin();
+        OpCode        op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        const addr_t* arg_begin = arg;
+        //
+        // arguments that are not variables are the same as in the recording
+        for(size_t i = range_arg_[0]; i < range_arg_[1]; ++i)
+            arg_slot_[i] = arg_begin[i];
+        //
+        // work space used by arg_is_variable
+        pod_vector<bool> is_variable;
+        //
+        itr = range_itr(play, 0);
+        itr.op_info(op, arg, i_var);
+        while( itr.op_index() < range_op_[1] )
+        {   size_t i_op = itr.op_index();
+            //
+            // results
+            op2slot_[i_op] = 0;
+            if( NumRes(op) > 0 )
+                op2slot_[i_op] = addr_t( n_slot + i_var - first_var );
+            //
+            // arguments
+            size_t offset = size_t(arg - arg_begin);
+            arg_is_variable(op, arg, is_variable);
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] )
+                {   size_t j_var = size_t( arg[j] );
+                    if( j_var < first_var )
+                        arg_slot_[offset + j] = slot.arg_slot_[offset + j];
+                    else
+                    {   j_var = n_slot + j_var - first_var;
+                        arg_slot_[offset + j] = addr_t(j_var);
+                    }
+                }
+            }
+            //
+            if( op == CSkipOp || op == CSumOp )
+                itr.correct_before_increment();
+            (++itr).op_info(op, arg, i_var);
+        }
+        return;
+    }
+};
+
+/*!
+Iterator that uses a live_slot segment mapping.
+
+\par
+This has the same API as const_sequential_iterator except that only
+the reverse direction is supported.
+The operators are the ones in the segment, preceded by a BeginOp and
+followed by an EndOp. The arguments and the index of the last result
+are mapped to slots.
+*/
+class live_iterator {
+private:
+    /// iterator for the current operator in the segment
+    play::const_sequential_iterator itr_;
+
+    /// first argument for the first operator in the recording
+    const addr_t* arg_begin_;
+
+    /// arguments with variable indices replaced by slot indices
+    const addr_t* arg_slot_;
+
+    /// slot for primary result of each operator
+    const addr_t* op2slot_;
+
+    /// index of the first operator in the segment
+    size_t op_begin_;
+
+    /// number of operators in the recording
+    size_t num_op_;
+
+    /// is the current operator the BeginOp preceding the segment
+    bool at_begin_;
+
+    /// is the current operator the EndOp following the segment
+    bool at_end_;
+public:
+    /*!
+    Create an iterator at the EndOp following a segment
+
+    \param play
+    is the player for this operation sequence.
+
+    \param slot
+    is the segment mapping for this iterator; see live_slot::segment.
+    */
+    template <class Base>
+    live_iterator(const player<Base>* play, const live_slot& slot)
+    :
+    itr_        ( slot.range_itr(play, 1) )        ,
+    arg_slot_   ( slot.arg_slot().data() )         ,
+    op2slot_    ( slot.op2slot().data() )          ,
+    op_begin_   ( slot.range_op(0) )               ,
+    num_op_     ( play->num_op_rec() )             ,
+    at_begin_   ( false )                          ,
+    at_end_     ( true )
+    {   play::const_sequential_iterator itr = play->begin();
+        OpCode op;
+        size_t i_var;
+        itr.op_info(op, arg_begin_, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    }
+    /// Backup iterator to previous operator
+    live_iterator& operator--(void)
+    {   CPPAD_ASSERT_UNKNOWN( ! at_begin_ );
+        if( at_end_ )
+        {   at_end_ = false;
+            --itr_;
+        }
+        else if( itr_.op_index() == op_begin_ )
+            at_begin_ = true;
+        else
+            --itr_;
+        return *this;
+    }
+    /*!
+    Correction applied after -- operation when current operator
+    is CSumOp or CSkipOp.
+
+    \param arg [out]
+    corrected point to arguments for this operation.
+    */
+    void correct_after_decrement(const addr_t*& arg)
+    {   CPPAD_ASSERT_UNKNOWN( ! (at_begin_ || at_end_) );
+        const addr_t* arg_rec;
+        itr_.correct_after_decrement(arg_rec);
+        arg = arg_slot_ + (arg_rec - arg_begin_);
+    }
+    /*!
+    Get information corresponding to current operator.
+
+    \param op [out]
+    op code for this operator.
+
+    \param arg [out]
+    pointer to the first arguement to this operator
+    (variable indices are replaced by slot indices).
+
+    \param var_index [out]
+    slot for the primary result of this operator.
+    If there is no primary variable for this operator, var_index
+    is not sepcified and could have any value.
+    */
+    void op_info(
+        OpCode&        op         ,
+        const addr_t*& arg        ,
+        size_t&        var_index  ) const
+    {   if( at_begin_ || at_end_ )
+        {   op        = at_begin_ ? BeginOp : EndOp;
+            arg       = arg_slot_;
+            var_index = 0;
+            return;
+        }
+        const addr_t* arg_rec;
+        itr_.op_info(op, arg_rec, var_index);
+        arg       = arg_slot_ + (arg_rec - arg_begin_);
+        var_index = size_t( op2slot_[ itr_.op_index() ] );
+    }
+    /// current operator index
+    size_t op_index(void) const
+    {   if( at_begin_ )
+            return 0;
+        if( at_end_ )
+            return num_op_ - 1;
+        return itr_.op_index();
+    }
+};
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
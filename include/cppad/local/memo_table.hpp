@@ -0,0 +1,302 @@
+# ifndef CPPAD_LOCAL_MEMO_TABLE_HPP
+# define CPPAD_LOCAL_MEMO_TABLE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/op_code_var.hpp>
+# include <cppad/local/play/sequential_iterator.hpp>
+# include <cppad/local/play/atom_op_info.hpp>
+
+// BEGIN_CPPAD_LOCAL_NAMESPACE
+namespace CppAD { namespace local {
+/*!
+\file memo_table.hpp
+Memo of the most recent discrete and atomic function values for each call.
+*/
+
+/*!
+Class used to remember the argument and result values for each
+discrete and atomic function call in an operation sequence.
+
+\par Call Sites
+Each DisOp operator, and the first AFunOp operator for each atomic function
+call, is a call site. The call sites are identified by their operator index
+and are stored in increasing order. The zero order forward sweep visits the
+operators in increasing order, so a cursor into the sites is advanced
+instead of searching for each operator index.
+
+\par Memo
+For each call site, the memo is the argument and result values for the
+most recent zero order evaluation of the function at that site.
+If the arguments have not changed, the results are copied from the memo
+instead of calling the function. This assumes that the functions are pure;
+i.e., their values only depend on their arguments.
+
+\tparam Base
+is the type used for the zero order forward mode values.
+*/
+template <class Base>
+class memo_table {
+private:
+    /// is memoization turned on
+    bool on_;
+
+    /// number of calls where the result came from the memo
+    size_t n_hit_;
+
+    /// number of calls where the function was evaluated
+    size_t n_miss_;
+
+    /// current call site (used by find and store)
+    size_t cursor_;
+
+    /// operator index for each call site (size zero before setup)
+    pod_vector<size_t> site_op_;
+
+    /// start of the arguments for each call site in x_
+    /// (size zero before setup, otherwise number of call sites plus one)
+    pod_vector<size_t> site_x_;
+
+    /// start of the results for each call site in y_
+    /// (size zero before setup, otherwise number of call sites plus one)
+    pod_vector<size_t> site_y_;
+
+    /// does the memo for each call site have valid values
+    pod_vector<bool> valid_;
+
+    /// argument values for the most recent evaluation at each call site
+    pod_vector_maybe<Base> x_;
+
+    /// result values for the most recent evaluation at each call site
+    pod_vector_maybe<Base> y_;
+
+public:
+    /// default constructor (memoization is off)
+    memo_table(void)
+    : on_(false), n_hit_(0), n_miss_(0), cursor_(0)
+    { }
+    // -----------------------------------------------------------------------
+    /// is memoization turned on
+    bool on(void) const
+    {   return on_; }
+
+    /// number of calls where the result came from the memo
+    size_t n_hit(void) const
+    {   return n_hit_; }
+
+    /// number of calls where the function was evaluated
+    size_t n_miss(void) const
+    {   return n_miss_; }
+
+    /// amount of memory corresonding to this object
+    size_t memory(void) const
+    {   size_t sum = site_op_.size() * sizeof(size_t);
+        sum       += site_x_.size()  * sizeof(size_t);
+        sum       += site_y_.size()  * sizeof(size_t);
+        sum       += valid_.size()   * sizeof(bool);
+        sum       += x_.size()       * sizeof(Base);
+        sum       += y_.size()       * sizeof(Base);
+        return sum;
+    }
+    // -----------------------------------------------------------------------
+    /// turn memoization on or off (frees the memo and zeros the counters)
+    void on(bool value)
+    {   clear();
+        on_ = value;
+    }
+
+    /// free the memo and zero the counters (does not change on)
+    void clear(void)
+    {   n_hit_  = 0;
+        n_miss_ = 0;
+        cursor_ = 0;
+        site_op_.clear();
+        site_x_.clear();
+        site_y_.clear();
+        valid_.clear();
+        x_.clear();
+        y_.clear();
+    }
+
+    /// assignment operator
+    void operator=(const memo_table& memo)
+    {   on_      = memo.on_;
+        n_hit_   = memo.n_hit_;
+        n_miss_  = memo.n_miss_;
+        cursor_  = 0;
+        site_op_ = memo.site_op_;
+        site_x_  = memo.site_x_;
+        site_y_  = memo.site_y_;
+        valid_   = memo.valid_;
+        x_       = memo.x_;
+        y_       = memo.y_;
+    }
+
+    /// swap
+    /// (used for move semantics version of ADFun assignment)
+    void swap(memo_table& memo)
+    {   std::swap(on_,     memo.on_);
+        std::swap(n_hit_,  memo.n_hit_);
+        std::swap(n_miss_, memo.n_miss_);
+        std::swap(cursor_, memo.cursor_);
+        site_op_.swap( memo.site_op_ );
+        site_x_.swap(  memo.site_x_ );
+        site_y_.swap(  memo.site_y_ );
+        valid_.swap(   memo.valid_ );
+        x_.swap(       memo.x_ );
+        y_.swap(       memo.y_ );
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Prepare for a zero order forward sweep.
+
+    \tparam RecBase
+    is the base type for the atomic functions in this operation sequence.
+
+    \param play
+    is the player for this operation sequence.
+    If the call sites have not yet been determined, they are
+    determined using play.
+    The cursor is moved to the first call site.
+    */
+    template <class RecBase>
+    void start(const player<Base>* play)
+    {   CPPAD_ASSERT_UNKNOWN( on_ );
+        cursor_ = 0;
+        if( site_x_.size() > 0 )
+            return;
+        //
+        // site_op_, site_x_, site_y_
+        size_t n_x = 0;
+        size_t n_y = 0;
+        site_x_.push_back(n_x);
+        site_y_.push_back(n_y);
+        bool in_call = false;
+        play::const_sequential_iterator itr = play->begin();
+        OpCode        op;
+        const addr_t* arg;
+        size_t        i_var;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        while( op != EndOp )
+        {   (++itr).op_info(op, arg, i_var);
+            switch( op )
+            {   case DisOp:
+                site_op_.push_back( itr.op_index() );
+                site_x_.push_back( ++n_x );
+                site_y_.push_back( ++n_y );
+                break;
+
+                case AFunOp:
+                if( ! in_call )
+                {   size_t atom_index, call_id, atom_m, atom_n;
+                    play::atom_op_info<RecBase>(
+                        op, arg, atom_index, call_id, atom_m, atom_n
+                    );
+                    n_x += atom_n;
+                    n_y += atom_m;
+                    site_op_.push_back( itr.op_index() );
+                    site_x_.push_back( n_x );
+                    site_y_.push_back( n_y );
+                }
+                in_call = ! in_call;
+                break;
+
+                case CSkipOp:
+                case CSumOp:
+                itr.correct_before_increment();
+                break;
+
+                default:
+                break;
+            }
+        }
+        //
+        // valid_, x_, y_
+        size_t n_site = site_op_.size();
+        valid_.resize(n_site);
+        for(size_t i = 0; i < n_site; ++i)
+            valid_[i] = false;
+        x_.resize(n_x);
+        y_.resize(n_y);
+    }
+    /*!
+    Look for the result of a call in the memo.
+
+    \param op_index
+    is the operator index for this call site. It must be greater than the
+    operator index in the previous call to find (since the previous start).
+
+    \param x
+    is the argument vector for this call.
+
+    \param y
+    If the return value is true, the memo results for this call site
+    are stored in y. Otherwise, y is not modified.
+
+    \return
+    is true if the memo for this call site is valid and its arguments
+    are identically equal to x.
+    */
+    bool find(size_t op_index, const Base* x, Base* y)
+    {   CPPAD_ASSERT_UNKNOWN( on_ );
+        CPPAD_ASSERT_UNKNOWN( cursor_ < site_op_.size() );
+        while( site_op_[cursor_] < op_index )
+        {   ++cursor_;
+            CPPAD_ASSERT_UNKNOWN( cursor_ < site_op_.size() );
+        }
+        CPPAD_ASSERT_UNKNOWN( site_op_[cursor_] == op_index );
+        //
+        bool hit = valid_[cursor_];
+        size_t start = site_x_[cursor_];
+        size_t end   = site_x_[cursor_ + 1];
+        for(size_t j = start; hit && j < end; ++j)
+            hit = EqualOpSeq(x_[j], x[j - start]);
+        if( ! hit )
+        {   ++n_miss_;
+            return false;
+        }
+        ++n_hit_;
+        start = site_y_[cursor_];
+        end   = site_y_[cursor_ + 1];
+        for(size_t i = start; i < end; ++i)
+            y[i - start] = y_[i];
+        return true;
+    }
+    /*!
+    Store the arguments and results for the call site in the previous find.
+
+    \param x
+    is the argument vector for this call.
+
+    \param y
+    is the result vector for this call.
+    */
+    void store(const Base* x, const Base* y)
+    {   CPPAD_ASSERT_UNKNOWN( on_ );
+        CPPAD_ASSERT_UNKNOWN( cursor_ < site_op_.size() );
+        size_t start = site_x_[cursor_];
+        size_t end   = site_x_[cursor_ + 1];
+        for(size_t j = start; j < end; ++j)
+            x_[j] = x[j - start];
+        start = site_y_[cursor_];
+        end   = site_y_[cursor_ + 1];
+        for(size_t i = start; i < end; ++i)
+            y_[i] = y[i - start];
+        valid_[cursor_] = true;
+    }
+};
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+
+# endif
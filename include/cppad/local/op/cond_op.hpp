@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_OP_COND_OP_HPP
 # define CPPAD_LOCAL_OP_COND_OP_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -980,6 +980,11 @@ The set with index T is
 the sparsity pattern corresponding to z.
 This identifies which of the independent variables the variable z
 depends on.
+
+\param select
+If select is zero, both y_2 and y_3 are included in the pattern for z.
+If it is one (two), only y_2 (y_3) is included; i.e., the pattern
+is local to a point where the comparison is true (false).
 */
 template <class Vector_set>
 void forward_sparse_jacobian_cond_op(
@@ -987,12 +992,14 @@ void forward_sparse_jacobian_cond_op(
     size_t             i_z           ,
     const addr_t*      arg           ,
     size_t             num_par       ,
-    Vector_set&        sparsity      )
+    Vector_set&        sparsity      ,
+    size_t             select = 0    )
 {
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < static_cast<size_t> (CompareNe) );
     CPPAD_ASSERT_UNKNOWN( NumArg(CExpOp) == 6 );
     CPPAD_ASSERT_UNKNOWN( NumRes(CExpOp) == 1 );
     CPPAD_ASSERT_UNKNOWN( arg[1] != 0 );
+    CPPAD_ASSERT_UNKNOWN( select <= 2 );
 # ifndef NDEBUG
     addr_t k = 1;
     for( size_t j = 0; j < 4; j++)
@@ -1008,9 +1015,9 @@ void forward_sparse_jacobian_cond_op(
         if( arg[1] & 2 )
             sparsity.binary_union(i_z, i_z, size_t(arg[3]), sparsity);
     }
-    if( arg[1] & 4 )
+    if( (arg[1] & 4) && select != 2 )
         sparsity.binary_union(i_z, i_z, size_t(arg[4]), sparsity);
-    if( arg[1] & 8 )
+    if( (arg[1] & 8) && select != 1 )
         sparsity.binary_union(i_z, i_z, size_t(arg[5]), sparsity);
     return;
 }
@@ -1121,6 +1128,11 @@ The set with index T is
 the sparsity pattern corresponding to z.
 This identifies which of the dependent variables depend on the variable z.
 On input and output, this pattern corresponds to the function G.
+
+\param select
+If select is zero, both y_2 and y_3 are included in the pattern for z.
+If it is one (two), only y_2 (y_3) is included; i.e., the pattern
+is local to a point where the comparison is true (false).
 */
 template <class Vector_set>
 void reverse_sparse_jacobian_cond_op(
@@ -1128,12 +1140,14 @@ void reverse_sparse_jacobian_cond_op(
     size_t              i_z           ,
     const addr_t*       arg           ,
     size_t              num_par       ,
-    Vector_set&         sparsity      )
+    Vector_set&         sparsity      ,
+    size_t              select = 0    )
 {
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < static_cast<size_t> (CompareNe) );
     CPPAD_ASSERT_UNKNOWN( NumArg(CExpOp) == 6 );
     CPPAD_ASSERT_UNKNOWN( NumRes(CExpOp) == 1 );
     CPPAD_ASSERT_UNKNOWN( arg[1] != 0 );
+    CPPAD_ASSERT_UNKNOWN( select <= 2 );
 # ifndef NDEBUG
     addr_t k = 1;
     for( size_t j = 0; j < 4; j++)
@@ -1149,9 +1163,9 @@ void reverse_sparse_jacobian_cond_op(
             sparsity.binary_union( size_t(arg[3]), size_t(arg[3]), i_z, sparsity);
     }
     // --------------------------------------------------------------------
-    if( arg[1] & 4 )
+    if( (arg[1] & 4) && select != 2 )
         sparsity.binary_union( size_t(arg[4]), size_t(arg[4]), i_z, sparsity);
-    if( arg[1] & 8 )
+    if( (arg[1] & 8) && select != 1 )
         sparsity.binary_union( size_t(arg[5]), size_t(arg[5]), i_z, sparsity);
     return;
 }
@@ -1278,6 +1292,11 @@ is the Hessian sparsity pattern
 where one of the partials is with respect to y_3.
 On input, this pattern corresponds to the function G.
 On output, this pattern corresponds to the function H.
+
+\param select
+If select is zero, both y_2 and y_3 are included in the pattern for z.
+If it is one (two), only y_2 (y_3) is included; i.e., the pattern
+is local to a point where the comparison is true (false).
 */
 template <class Vector_set>
 void reverse_sparse_hessian_cond_op(
@@ -1285,13 +1304,15 @@ void reverse_sparse_hessian_cond_op(
     const addr_t*        arg           ,
     size_t               num_par       ,
     bool*                jac_reverse   ,
-    Vector_set&          hes_sparsity  )
+    Vector_set&          hes_sparsity  ,
+    size_t               select = 0    )
 {
 
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < static_cast<size_t> (CompareNe) );
     CPPAD_ASSERT_UNKNOWN( NumArg(CExpOp) == 6 );
     CPPAD_ASSERT_UNKNOWN( NumRes(CExpOp) == 1 );
     CPPAD_ASSERT_UNKNOWN( arg[1] != 0 );
+    CPPAD_ASSERT_UNKNOWN( select <= 2 );
 # ifndef NDEBUG
     addr_t k = 1;
     for( size_t j = 0; j < 4; j++)
@@ -1300,12 +1321,12 @@ void reverse_sparse_hessian_cond_op(
         k *= 2;
     }
 # endif
-    if( arg[1] & 4 )
+    if( (arg[1] & 4) && select != 2 )
     {
         hes_sparsity.binary_union( size_t(arg[4]), size_t(arg[4]), i_z, hes_sparsity);
         jac_reverse[ arg[4] ] |= jac_reverse[i_z];
     }
-    if( arg[1] & 8 )
+    if( (arg[1] & 8) && select != 1 )
     {
         hes_sparsity.binary_union( size_t(arg[5]), size_t(arg[5]), i_z, hes_sparsity);
         jac_reverse[ arg[5] ] |= jac_reverse[i_z];
@@ -114,6 +114,11 @@ is the zeroth order Taylor coefficient corresponding to right.
 is vector specifying which operations are at this point are know to be
 unecessary and can be skipped.
 This is both an input and an output.
+
+\param slot_index [in]
+If this is true, i_z and the variable indices in arg are
+forward_live slot indices and the left and right operands
+are not checked against i_z.
 */
 template <class Base>
 void forward_cskip_op_0(
@@ -123,7 +128,8 @@ void forward_cskip_op_0(
     const Base*          parameter      ,
     size_t               cap_order      ,
     Base*                taylor         ,
-    bool*                cskip_op       )
+    bool*                cskip_op       ,
+    bool                 slot_index     )
 {
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < size_t(CompareNe) );
     CPPAD_ASSERT_UNKNOWN( arg[1] != 0 );
@@ -132,7 +138,7 @@ void forward_cskip_op_0(
     if( arg[1] & 1 )
     {   // If variable arg[2] <= i_z, it has already been computed,
         // but it will be skipped for higher orders.
-        CPPAD_ASSERT_UNKNOWN( size_t(arg[2]) <= i_z );
+        CPPAD_ASSERT_UNKNOWN( size_t(arg[2]) <= i_z || slot_index );
         left = taylor[ size_t(arg[2]) * cap_order + 0 ];
     }
     else
@@ -142,7 +148,7 @@ void forward_cskip_op_0(
     if( arg[1] & 2 )
     {   // If variable arg[3] <= i_z, it has already been computed,
         // but it will be skipped for higher orders.
-        CPPAD_ASSERT_UNKNOWN( size_t(arg[3]) <= i_z );
+        CPPAD_ASSERT_UNKNOWN( size_t(arg[3]) <= i_z || slot_index );
         right = taylor[ size_t(arg[3]) * cap_order + 0 ];
     }
     else
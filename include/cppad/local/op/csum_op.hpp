@@ -89,6 +89,12 @@ is the k-th order Taylor coefficient corresponding to z.
 \b Output: taylor [ i_z * cap_order + k ]
 for k = p , ... , q,
 is the k-th order Taylor coefficient corresponding to z.
+
+\param slot_index
+If this is true, i_z and the variable indices in arg are
+forward_live slot indices (and p == q == 0).
+In this case the variable arguments are only checked to be different
+from i_z. Otherwise they are checked to be less than i_z.
 */
 template <class Base>
 void forward_csum_op(
@@ -99,7 +105,8 @@ void forward_csum_op(
     size_t        num_par     ,
     const Base*   parameter   ,
     size_t        cap_order   ,
-    Base*         taylor      )
+    Base*         taylor      ,
+    bool          slot_index  )
 {   Base zero(0);
 
     // check assumptions
@@ -110,6 +117,7 @@ void forward_csum_op(
     CPPAD_ASSERT_UNKNOWN(
         arg[arg[4]] == arg[4]
     );
+    CPPAD_ASSERT_UNKNOWN( ! slot_index || q == 0 );
 
     // Taylor coefficients corresponding to result
     Base* z = taylor + i_z    * cap_order;
@@ -127,13 +135,15 @@ void forward_csum_op(
     }
     Base* x;
     for(size_t i = 5; i < size_t(arg[1]); ++i)
-    {   CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) < i_z );
+    {   CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) < i_z || slot_index );
+        CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) != i_z );
         x     = taylor + size_t(arg[i]) * cap_order;
         for(size_t k = p; k <= q; k++)
             z[k] += x[k];
     }
     for(size_t i = size_t(arg[1]); i < size_t(arg[2]); ++i)
-    {   CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) < i_z );
+    {   CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) < i_z || slot_index );
+        CPPAD_ASSERT_UNKNOWN( size_t(arg[i]) != i_z );
         x     = taylor + size_t(arg[i]) * cap_order;
         for(size_t k = p; k <= q; k++)
             z[k] -= x[k];
@@ -45,7 +45,8 @@ $codei%forward_load_%I%_op_0(
     %taylor%,
     %vec_ad2isvar%,
     %vec_ad2index%,
-    %load_op2var%
+    %load_op2var%,
+    %slot_index%
 )
 %$$
 where the index type $icode I$$ is $code p$$ (for parameter)
@@ -162,6 +163,14 @@ $codei%
     %load_op2var%[%arg%[2]] = 0
 %$$
 
+$head slot_index$$
+If this is true, $icode i_z$$, $icode%arg%[1]%$$ in the
+$code forward_load_v_op_0$$ case, and the variable indices in
+$icode vec_ad2index$$ are $cref forward_live$$ slot indices.
+In this case the variable indices are only checked to be different
+from $icode i_z$$.
+Otherwise they are checked to be less than $icode i_z$$.
+
 $end
 */
 // BEGIN_FORWARD_LOAD_P_OP_0
@@ -175,7 +184,8 @@ void forward_load_p_op_0(
     Base*          taylor           ,
     const bool*    vec_ad2isvar     ,
     const size_t*  vec_ad2index     ,
-    Addr*          load_op2var   )
+    Addr*          load_op2var      ,
+    bool           slot_index       )
 // END_FORWARD_LOAD_P_OP_0
 {   CPPAD_ASSERT_UNKNOWN( NumArg(LdpOp) == 3 );
     CPPAD_ASSERT_UNKNOWN( NumRes(LdpOp) == 1 );
@@ -196,7 +206,8 @@ void forward_load_p_op_0(
     size_t i_pv   = vec_ad2index[ arg[0] + i_vec ];
     Base* z       = taylor + i_z * cap_order;
     if( vec_ad2isvar[ arg[0] + i_vec ]  )
-    {   CPPAD_ASSERT_UNKNOWN( i_pv < i_z );
+    {   CPPAD_ASSERT_UNKNOWN( i_pv < i_z || slot_index );
+        CPPAD_ASSERT_UNKNOWN( i_pv != i_z );
         load_op2var[ arg[2] ] = addr_t( i_pv );
         Base* v_x = taylor + i_pv * cap_order;
         z[0]      = v_x[0];
@@ -218,11 +229,13 @@ void forward_load_v_op_0(
     Base*          taylor           ,
     const bool*    vec_ad2isvar     ,
     const size_t*  vec_ad2index     ,
-    Addr*          load_op2var   )
+    Addr*          load_op2var      ,
+    bool           slot_index       )
 {   CPPAD_ASSERT_UNKNOWN( NumArg(LdvOp) == 3 );
     CPPAD_ASSERT_UNKNOWN( NumRes(LdvOp) == 1 );
     CPPAD_ASSERT_UNKNOWN( 0 < arg[0] );
-    CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < i_z );
+    CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < i_z || slot_index );
+    CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) != i_z );
     CPPAD_ASSERT_UNKNOWN( size_t(arg[2]) < play->num_var_load_rec() );
     CPPAD_ASSERT_UNKNOWN(
         size_t( std::numeric_limits<addr_t>::max() ) >= i_z
@@ -238,7 +251,8 @@ void forward_load_v_op_0(
     size_t i_pv   = vec_ad2index[ arg[0] + i_vec ];
     Base* z       = taylor + i_z * cap_order;
     if( vec_ad2isvar[ arg[0] + i_vec ]  )
-    {   CPPAD_ASSERT_UNKNOWN( i_pv < i_z );
+    {   CPPAD_ASSERT_UNKNOWN( i_pv < i_z || slot_index );
+        CPPAD_ASSERT_UNKNOWN( i_pv != i_z );
         load_op2var[ arg[2] ] = addr_t( i_pv );
         Base* v_x = taylor + i_pv * cap_order;
         z[0]      = v_x[0];
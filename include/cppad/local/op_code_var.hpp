@@ -12,6 +12,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
 # include <string>
+# include <atomic>
 # include <sstream>
 # include <iomanip>
 
@@ -587,10 +588,9 @@ inline size_t NumArg( OpCode op)
     };
 # ifndef NDEBUG
     // only do these checks once to save time
-    static bool first = true;
-    if( first )
-    {   first = false;
-        // check that NumberOp is last value in op code table
+    static std::atomic<bool> first(true);
+    if( first.exchange(false) )
+    {   // check that NumberOp is last value in op code table
         CPPAD_ASSERT_UNKNOWN(
             size_t(NumberOp) + 1 == sizeof(NumArgTable)/sizeof(NumArgTable[0])
         );
@@ -1465,10 +1465,10 @@ void arg_is_variable(
         CPPAD_ASSERT_UNKNOWN( NumArg(op) == 6 );
         is_variable[0] = false;
         is_variable[1] = false;
-        is_variable[2] = (arg[0] & 1) != 0;
-        is_variable[3] = (arg[0] & 2) != 0;
-        is_variable[4] = (arg[0] & 4) != 0;
-        is_variable[5] = (arg[0] & 8) != 0;
+        is_variable[2] = (arg[1] & 1) != 0;
+        is_variable[3] = (arg[1] & 2) != 0;
+        is_variable[4] = (arg[1] & 4) != 0;
+        is_variable[5] = (arg[1] & 8) != 0;
         break;
 
         // -------------------------------------------------------------------
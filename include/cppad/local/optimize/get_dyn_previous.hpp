@@ -180,8 +180,10 @@ void get_dyn_previous(
     // ----------------------------------------------------------------------
     // compute dyn_previous
     // ----------------------------------------------------------------------
+    // the number of hash codes grows with the number of dynamic parameters
+    size_t n_hash = optimize_hash_table_size(num_dynamic_par);
     sparse::list_setvec  hash_table_dyn;
-    hash_table_dyn.resize(CPPAD_HASH_TABLE_SIZE, num_dynamic_par);
+    hash_table_dyn.resize(n_hash, num_dynamic_par);
     //
     // Initialize in dyn_par_arg
     // (independent dynamic parameters do not have any arguments)
@@ -274,7 +276,7 @@ void get_dyn_previous(
                 );
                 opcode_t op_t  = opcode_t(op);
                 code           = optimize_hash_code(
-                    op_t, num_arg, arg_match.data()
+                    op_t, num_arg, arg_match.data(), n_hash
                 );
                 //
                 // iterator for the set with this hash code
@@ -342,7 +344,7 @@ void get_dyn_previous(
                 );
                 opcode_t op_t  = opcode_t(op);
                 code           = optimize_hash_code(
-                    op_t, num_arg, arg_match.data()
+                    op_t, num_arg, arg_match.data(), n_hash
                 );
                 //
                 // iterator for the set with this hash code
@@ -377,7 +379,7 @@ void get_dyn_previous(
                 std::swap( arg_match[0], arg_match[1] );
                 opcode_t op_t    = opcode_t(op);
                 size_t code_swp  = optimize_hash_code(
-                    op_t, num_arg, arg_match.data()
+                    op_t, num_arg, arg_match.data(), n_hash
                 );
                 //
                 // iterator for the set with this hash code
@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_OPTIMIZE_GET_OP_PREVIOUS_HPP
 # define CPPAD_LOCAL_OPTIMIZE_GET_OP_PREVIOUS_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -40,7 +40,8 @@ $icode%exceed_collision_limit% = get_op_previous(
     %random_itr%,
     %cexp_set%,
     %op_previous%,
-    %op_usage%
+    %op_usage%,
+    %stat%
 )%$$
 
 $head Prototype$$
@@ -106,6 +107,15 @@ the i-th operator in the operation sequence not counting previous
 optimization.
 On output, it is the usage counting previous operator optimization.
 
+$head stat$$
+The input value of $icode stat$$ does not matter.
+Upon return, the fields
+$code n_hash_code$$, $code n_lookup$$, $code n_match$$, $code n_collision$$,
+$code max_collision$$, and $code n_limit$$
+are the statistics for this call to $code get_op_previous$$;
+see $cref optimize_stat$$.
+The $code seconds$$ field is not modified.
+
 $head exceed_collision_limit$$
 If the $icode collision_limit$$ is exceeded (is not exceeded),
 the return value is true (false).
@@ -121,7 +131,8 @@ bool get_op_previous(
     const play::const_random_iterator<Addr>&    random_itr          ,
     sparse::list_setvec&                        cexp_set            ,
     pod_vector<addr_t>&                         op_previous         ,
-    pod_vector<usage_t>&                        op_usage            )
+    pod_vector<usage_t>&                        op_usage            ,
+    optimize_stat_t&                            stat                )
 // END_PROTOTYPE
 {   bool exceed_collision_limit = false;
     //
@@ -140,8 +151,18 @@ bool get_op_previous(
     // ----------------------------------------------------------------------
     // compute op_previous
     // ----------------------------------------------------------------------
+    // the number of hash codes grows with the size of the operation sequence
+    size_t n_hash = optimize_hash_table_size(num_op);
     sparse::list_setvec  hash_table_op;
-    hash_table_op.resize(CPPAD_HASH_TABLE_SIZE, num_op);
+    hash_table_op.resize(n_hash, num_op);
+    //
+    // initialize the statistics
+    stat.n_hash_code   = n_hash;
+    stat.n_lookup      = 0;
+    stat.n_match       = 0;
+    stat.n_collision   = 0;
+    stat.max_collision = 0;
+    stat.n_limit       = 0;
     //
     pod_vector<bool> work_bool;
     pod_vector<addr_t> work_addr_t;
@@ -232,7 +253,8 @@ bool get_op_previous(
                 i_op,
                 hash_table_op,
                 work_bool,
-                work_addr_t
+                work_addr_t,
+                stat
             );
             if( op_previous[i_op] != 0 )
             {   // like a unary operator that assigns i_op equal to previous.
@@ -251,17 +273,7 @@ bool get_op_previous(
             break;
         }
     }
-    /* ---------------------------------------------------------------------
-    // Print out hash code usage summary
-    CppAD::vector<size_t> count(collision_limit + 1);
-    for(size_t i = 0; i <= collision_limit; ++i)
-        count[i] = 0;
-    for(size_t code = 0; code < CPPAD_HASH_TABLE_SIZE; ++code)
-    {   size_t size = hash_table_op.number_elements(code);
-        ++count[size];
-    }
-    std::cout << "count = " << count << "\n";
-    --------------------------------------------------------------------- */
+    CPPAD_ASSERT_UNKNOWN( exceed_collision_limit == (stat.n_limit > 0) );
     return exceed_collision_limit;
 }
 
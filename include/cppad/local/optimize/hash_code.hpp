@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_OPTIMIZE_HASH_CODE_HPP
 # define CPPAD_LOCAL_OPTIMIZE_HASH_CODE_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -11,6 +11,7 @@ Secondary License when the conditions for such availability set forth
 in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
+# include <cstdint>
 /*!
 \file local/optimize/hash_code.hpp
 CppAD hashing utility.
@@ -19,6 +20,24 @@ CppAD hashing utility.
 
 // BEGIN_CPPAD_LOCAL_OPTIMIZE_NAMESPACE
 namespace CppAD { namespace local { namespace optimize {
+/*!
+Number of hash codes to use for an operation sequence (during optimization).
+
+\param num_op
+is the number of operators in the operation sequence.
+
+\return
+is the smallest power of two that is greater than or equal to num_op
+and greater than or equal to 1024.
+This keeps the average number of operators per hash code less than one.
+*/
+inline size_t optimize_hash_table_size(size_t num_op)
+{   size_t n_hash = 1024;
+    while( n_hash < num_op )
+        n_hash *= 2;
+    return n_hash;
+}
+
 /*!
 Specialized hash code for a CppAD operator and its arguments
 (used during optimization).
@@ -33,23 +52,41 @@ number of elements of arg to include in the hash code.
 is a vector of length num_arg
 containing the corresponding argument indices for this operator.
 
+\param n_hash
+is the number of hash codes. This must be a power of two; see
+optimize_hash_table_size.
+
 \return
-is a hash code that is between zero and CPPAD_HASH_TABLE_SIZE - 1.
+is a hash code that is between zero and n_hash - 1.
+Each argument is mixed into the code using a multiplicative hash
+and the final value is scrambled so that all of its bits depend on
+all of the arguments (the low order bits are used for the table index).
 */
 
 inline size_t optimize_hash_code(
     opcode_t      op      ,
     size_t        num_arg ,
-    const addr_t* arg     )
+    const addr_t* arg     ,
+    size_t        n_hash  )
 {   CPPAD_ASSERT_UNKNOWN( num_arg < 4 );
-    size_t prime = 1;
-    size_t sum   = prime * size_t(op);
+    CPPAD_ASSERT_UNKNOWN( n_hash > 0 && (n_hash & (n_hash - 1)) == 0 );
+    //
+    // golden ratio multiplier (an odd number so multiplication is one to one)
+    const std::uint64_t multiplier = 0x9e3779b97f4a7c15ULL;
+    //
+    std::uint64_t code = std::uint64_t(op) + 1;
     for(size_t i = 0; i < num_arg; i++)
-    {   prime    = prime + 2;  // 3, 5, 7 in that order
-        sum += prime * size_t(arg[i]);
+    {   code  = (code ^ std::uint64_t( arg[i] ) ) * multiplier;
+        code ^= code >> 32;
     }
+    // final scramble of bits (murmur3 finalizer)
+    code ^= code >> 33;
+    code *= 0xff51afd7ed558ccdULL;
+    code ^= code >> 33;
+    code *= 0xc4ceb9fe1a85ec53ULL;
+    code ^= code >> 33;
     //
-    return sum % CPPAD_HASH_TABLE_SIZE;
+    return size_t(code) & (n_hash - 1);
 }
 
 } } } // END_CPPAD_LOCAL_OPTIMIZE_NAMESPACE
@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_OPTIMIZE_MATCH_OP_HPP
 # define CPPAD_LOCAL_OPTIMIZE_MATCH_OP_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -12,6 +12,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
 # include <cppad/local/optimize/hash_code.hpp>
+# include <cppad/core/optimize_stat.hpp>
 // BEGIN_CPPAD_LOCAL_OPTIMIZE_NAMESPACE
 namespace CppAD { namespace local { namespace optimize  {
 /*
@@ -36,7 +37,8 @@ $codei%exceed_collision_limit% = match_op(
     %current%,
     %hash_tape_op%,
     %work_bool%,
-    %work_addr_t%
+    %work_addr_t%,
+    %stat%
 )%$$
 
 $head Prototype$$
@@ -86,9 +88,10 @@ $head hash_table_op$$
 is assumed to be initialized as a vector of empty sets before the
 first call to match_op (for a pass of the operation sequence).
 $codei%
-    %hash_table_op%.n_set() == CPPAD_HASH_TABLE_SIZE
+    %hash_table_op%.n_set() == optimize_hash_table_size(%num_op%)
     %hash_table_op%.end()   == %op_previous%.size()
 %$$
+where $icode num_op$$ is the number of operators in the operation sequence.
 If $icode i_op$$ is an element of the j-th set,
 then the operation $icode%op_previous%[%i_op%]%$$ has hash code j,
 and does not match any other element of the j-th set.
@@ -105,6 +108,11 @@ work space that is used by match_op between calls to increase speed.
 Should be empty on first call for this forward pass of the operation
 sequence and not modified until forward pass is done
 
+$head stat$$
+The fields $code n_lookup$$, $code n_match$$, $code n_collision$$,
+$code max_collision$$, and $code n_limit$$ are updated
+to include this call to $code match_op$$; see $cref optimize_stat$$.
+
 $head exceed_collision_limit$$
 If the $icode collision_limit$$ is exceeded (is not exceeded),
 the return value is true (false).
@@ -120,7 +128,8 @@ bool match_op(
     size_t                                      current         ,
     sparse::list_setvec&                        hash_table_op   ,
     pod_vector<bool>&                           work_bool       ,
-    pod_vector<addr_t>&                         work_addr_t     )
+    pod_vector<addr_t>&                         work_addr_t     ,
+    optimize_stat_t&                            stat            )
 // END_PROTOTYPE
 {
 # ifndef NDEBUG
@@ -176,9 +185,10 @@ bool match_op(
     CPPAD_ASSERT_UNKNOWN( var2previous_var.size() == num_var );
     CPPAD_ASSERT_UNKNOWN( num_op == op_previous.size() );
     CPPAD_ASSERT_UNKNOWN( op_previous[current] == 0 );
-    CPPAD_ASSERT_UNKNOWN(
-        hash_table_op.n_set() == CPPAD_HASH_TABLE_SIZE
-    );
+    //
+    // n_hash
+    size_t n_hash = hash_table_op.n_set();
+    CPPAD_ASSERT_UNKNOWN( n_hash == optimize_hash_table_size(num_op) );
     CPPAD_ASSERT_UNKNOWN( hash_table_op.end() == num_op );
     CPPAD_ASSERT_UNKNOWN( current < num_op );
     //
@@ -224,7 +234,8 @@ bool match_op(
     }
 
     //
-    size_t code = optimize_hash_code(opcode_t(op), num_arg, arg_match);
+    size_t code = optimize_hash_code(opcode_t(op), num_arg, arg_match, n_hash);
+    ++stat.n_lookup;
     //
     // iterator for the set with this hash code
     sparse::list_setvec_const_iterator itr(hash_table_op, code);
@@ -261,20 +272,22 @@ bool match_op(
             match &= arg_match[1] == var2previous_var[ arg_c[0] ];
         }
         if( match )
-        {   op_previous[current] = static_cast<addr_t>( candidate );
+        {   ++stat.n_match;
+            op_previous[current] = static_cast<addr_t>( candidate );
             if( NumRes(op) > 0 )
             {   CPPAD_ASSERT_UNKNOWN( i_var_c < i_var );
                 var2previous_var[i_var] = addr_t( i_var_c );
             }
             return exceed_collision_limit;
         }
+        ++stat.n_collision;
+        stat.max_collision = std::max(stat.max_collision, count);
         ++itr;
     }
-
-    // see print (that is commented out) at bottom of get_op_previous.hpp
     CPPAD_ASSERT_UNKNOWN( count <= collision_limit );
     if( count == collision_limit )
-    {   // restart the list
+    {   ++stat.n_limit;
+        // restart the list
         hash_table_op.clear(code);
         // limit has been exceeded
         exceed_collision_limit = true;
@@ -45,7 +45,7 @@ $section Convert a player object to an optimized recorder object $$
 
 $head Syntax$$
 $codei%exceed_collision_limit% = local::optimize::optimize_run(
-    %options%, %n%, %dep_taddr%, %play%, %rec%
+    %options%, %n%, %dep_taddr%, %play%, %rec%, %stat%
 )%$$
 
 $head Prototype$$
@@ -119,6 +119,11 @@ it corresponds to directly after the default constructor.
 Upon return, it contains an optimized version of the
 operation sequence corresponding to $icode play$$.
 
+$head stat$$
+Upon return, the hash table statistics in $icode stat$$
+correspond to this optimization; see $cref optimize_stat$$.
+The $code seconds$$ field is not modified.
+
 $head exceed_collision_limit$$
 If the $icode collision_limit$$ is exceeded (is not exceeded),
 the return value is true (false).
@@ -143,7 +148,8 @@ bool optimize_run(
     size_t                                     n          ,
     pod_vector<size_t>&                        dep_taddr  ,
     player<Base>*                              play       ,
-    recorder<Base>*                            rec        )
+    recorder<Base>*                            rec        ,
+    optimize_stat_t&                           stat       )
 // END_PROTOTYPE
 {   bool exceed_collision_limit = false;
     //
@@ -257,7 +263,8 @@ bool optimize_run(
         random_itr,
         cexp_set,
         op_previous,
-        op_usage
+        op_usage,
+        stat
     );
     size_t num_cexp = cexp2op.size();
     CPPAD_ASSERT_UNKNOWN( conditional_skip || num_cexp == 0 );
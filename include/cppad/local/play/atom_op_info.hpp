@@ -41,21 +41,20 @@ is the number of results for this user atmoic function.
 \param atom_n   [out]
 is the number of arguments for this user atmoic function.
 
-\return
-Is a pointer to this atomic function.
+\par Deleted Atomic Functions
+If NDEBUG is not defined, an error is generated if this atomic function
+has been deleted. Otherwise, local::atomic_index is not used by this routine
+(the sweeps get the atomic function using play::atom_table).
 */
-// MUSTDO: change return to void once all sweeps switch to use call_atomic.
 template <class Base>
-atomic_base<Base>* atom_op_info(
+void atom_op_info(
     const OpCode     op         ,
     const addr_t*    op_arg     ,
     size_t&          atom_index ,
     size_t&          call_id    ,
     size_t&          atom_m     ,
     size_t&          atom_n     )
-{   atomic_base<Base>* atom_fun;
-    //
-    CPPAD_ASSERT_UNKNOWN( op == AFunOp );
+{   CPPAD_ASSERT_UNKNOWN( op == AFunOp );
     CPPAD_ASSERT_NARG_NRES(op, 4, 0);
     //
     atom_index = size_t(op_arg[0]);
@@ -64,24 +63,19 @@ atomic_base<Base>* atom_op_info(
     atom_m     = size_t(op_arg[3]);
     CPPAD_ASSERT_UNKNOWN( atom_n > 0 );
     //
+# ifndef NDEBUG
     bool         set_null = false;
     size_t       type     = 0;          // set to avoid warning
     std::string* name_ptr = nullptr;
     void*        v_ptr    = nullptr; // set to avoid warning
     local::atomic_index<Base>(set_null, atom_index, type, name_ptr, v_ptr);
-    if( type == 3 )
-        return nullptr;
-# ifndef NDEBUG
-    if( v_ptr == nullptr )
+    if( type != 3 && v_ptr == nullptr )
     {   // atom_fun is null so cannot use atom_fun->atomic_name()
         std::string msg = atomic_base<Base>::class_name(atom_index)
             + ": atomic_base function has been deleted";
         CPPAD_ASSERT_KNOWN(false, msg.c_str() );
     }
 # endif
-    // the atomic_base object corresponding to this atomic function
-    atom_fun = reinterpret_cast< atomic_base<Base>* >( v_ptr );
-    return atom_fun;
 }
 
 } } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
@@ -0,0 +1,110 @@
+# ifndef CPPAD_LOCAL_PLAY_ATOM_TABLE_HPP
+# define CPPAD_LOCAL_PLAY_ATOM_TABLE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/utility/vector.hpp>
+# include <cppad/local/atomic_index.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file atom_table.hpp
+*/
+
+/*!
+Table that maps an atom_index to the type and pointer for the corresponding
+atomic function.
+
+Each atom_index is resolved, using local::atomic_index, the first time
+it is used by a player. After that, a call site gets its callback
+information by indexing this table. The table is cleared when an
+atomic function is deleted; see local::atomic_index_n_null.
+*/
+class atom_table {
+private:
+    /// value of atomic_index_n_null when this table was last cleared
+    size_t n_null_;
+    /// type for each atom_index (zero if not yet resolved)
+    CppAD::vector<size_t> type_;
+    /// pointer to the atomic function object for each atom_index
+    CppAD::vector<void*> ptr_;
+public:
+    /// constructor
+    atom_table(void) : n_null_(0)
+    { }
+    /// remove all the resolved entries
+    void clear(void)
+    {   type_.clear();
+        ptr_.clear();
+    }
+    /// swap with another table
+    void swap(atom_table& other)
+    {   std::swap(n_null_, other.n_null_);
+        type_.swap(other.type_);
+        ptr_.swap(other.ptr_);
+    }
+    /*!
+    Get the information for an atomic function.
+
+    \tparam RecBase
+    is the base type for the atomic functions; i.e., the RecBase template
+    parameter for the sweeps that use this table.
+
+    \param atom_index [in]
+    is the index, in local::atomic_index, for this atomic function.
+
+    \param type [out]
+    is 2, 3, or 4 for atomic_two, atomic_three, or atomic_four functions.
+
+    \param ptr [out]
+    is a pointer to the atomic function object
+    (null if the atomic function has been deleted).
+    */
+    template <class RecBase>
+    void get(size_t atom_index, size_t& type, void*& ptr)
+    {   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+        //
+        // n_null_, type_, ptr_
+        size_t n_null =
+            atomic_index_n_null<RecBase>().load(std::memory_order_acquire);
+        if( n_null != n_null_ )
+        {   clear();
+            n_null_ = n_null;
+        }
+        if( type_.size() <= atom_index )
+        {   size_t old_size = type_.size();
+            type_.resize(atom_index + 1);
+            ptr_.resize(atom_index + 1);
+            for(size_t i = old_size; i <= atom_index; ++i)
+            {   type_[i] = 0;
+                ptr_[i]  = nullptr;
+            }
+        }
+        if( type_[atom_index] == 0 )
+        {   bool         set_null = false;
+            std::string* name_ptr = nullptr;
+            local::atomic_index<RecBase>(
+                set_null, atom_index, type_[atom_index], name_ptr,
+                ptr_[atom_index]
+            );
+        }
+        //
+        type = type_[atom_index];
+        ptr  = ptr_[atom_index];
+    }
+};
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
@@ -16,6 +16,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/local/play/sequential_iterator.hpp>
 # include <cppad/local/play/subgraph_iterator.hpp>
 # include <cppad/local/play/random_setup.hpp>
+# include <cppad/local/play/atom_table.hpp>
 # include <cppad/local/atom_state.hpp>
 # include <cppad/local/is_pod.hpp>
 
@@ -106,6 +107,12 @@ private:
     /// This value is valid (invalid) for primary (auxillary) variables.
     pod_vector<unsigned char> var2op_vec_;
 
+    // ----------------------------------------------------------------------
+    /// Type and pointer for the atomic functions used by this recording.
+    /// This is a cache that is filled in as the atomic functions are called
+    /// and hence it can be changed by const functions.
+    mutable play::atom_table atom_table_;
+
 public:
     // =================================================================
     /// default constructor
@@ -180,11 +187,12 @@ public:
         num_var_load_rec_   = rec.num_var_load_rec_;
 
         // op_vec_
-        op_vec_.swap(rec.op_vec_);
+        // (the recorder stores it in chunks, this is the only copy)
+        rec.op_vec_.move_to(op_vec_);
         CPPAD_ASSERT_UNKNOWN(op_vec_.size() < addr_t_max );
 
         // op_arg_vec_
-        arg_vec_.swap(rec.arg_vec_);
+        rec.arg_vec_.move_to(arg_vec_);
         CPPAD_ASSERT_UNKNOWN(arg_vec_.size()    < addr_t_max );
 
         // all_par_vec_
@@ -521,6 +529,43 @@ public:
         all_par_vec_        = play.all_par_vec_;
     }
     // ===============================================================
+    /*!
+    Share the operation sequence in another player<Base>
+
+    \param play
+    object that contains the operation sequence to share.
+    This player uses the same memory as play for the operation sequence
+    (and the random access information if it is already setup).
+    The parameter vector is copied because it changes when new
+    dynamic parameter values are set.
+    The object play must not be deleted, or its operation sequence changed,
+    while this player is sharing its memory.
+    */
+    void share(const player& play)
+    {
+        // size_t objects
+        num_dynamic_ind_    = play.num_dynamic_ind_;
+        num_var_rec_        = play.num_var_rec_;
+        num_var_load_rec_   = play.num_var_load_rec_;
+        num_var_vecad_rec_  = play.num_var_vecad_rec_;
+        //
+        // pod_vectors
+        op_vec_.share(            play.op_vec_ );
+        arg_vec_.share(           play.arg_vec_ );
+        text_vec_.share(          play.text_vec_ );
+        all_var_vecad_ind_.share( play.all_var_vecad_ind_ );
+        dyn_par_is_.share(        play.dyn_par_is_ );
+        dyn_ind2par_ind_.share(   play.dyn_ind2par_ind_ );
+        dyn_par_op_.share(        play.dyn_par_op_ );
+        dyn_par_arg_.share(       play.dyn_par_arg_ );
+        op2arg_vec_.share(        play.op2arg_vec_ );
+        op2var_vec_.share(        play.op2var_vec_ );
+        var2op_vec_.share(        play.var2op_vec_ );
+        //
+        // pod_maybe_vectors
+        all_par_vec_        = play.all_par_vec_;
+    }
+    // ===============================================================
     /// Create a player< AD<Base> > from this player<Base>
     player< AD<Base> > base2ad(void) const
     {   player< AD<Base> > play;
@@ -576,6 +621,9 @@ public:
         //
         // pod_maybe_vectors
         all_par_vec_.swap(    other.all_par_vec_);
+        //
+        // atom_table
+        atom_table_.swap(     other.atom_table_);
     }
     // move semantics assignment
     void operator=(player&& play)
@@ -605,6 +653,9 @@ public:
         CPPAD_ASSERT_UNKNOWN( op2var_vec_.size() == 0  );
         CPPAD_ASSERT_UNKNOWN( var2op_vec_.size() == 0  );
     }
+    /// table used to get the type and pointer for atomic functions
+    play::atom_table& atom_table(void) const
+    {   return atom_table_; }
     /// get non-const version of all_par_vec
     pod_vector_maybe<Base>& all_par_vec(void)
     {   return all_par_vec_; }
@@ -812,6 +863,16 @@ public:
             num_var, &op_vec_, &arg_vec_, op_index
         );
     }
+    /// const sequential iterator starting at an arbitrary operator
+    /// (see the corresponding const_sequential_iterator constructor)
+    play::const_sequential_iterator begin_at(
+        size_t op_index, size_t arg_index, size_t var_index
+    ) const
+    {   size_t num_var  = num_var_rec_;
+        return play::const_sequential_iterator(
+            num_var, &op_vec_, &arg_vec_, op_index, arg_index, var_index
+        );
+    }
     // -----------------------------------------------------------------------
     /// const subgraph iterator begin
     play::const_subgraph_iterator<addr_t>  begin_subgraph(
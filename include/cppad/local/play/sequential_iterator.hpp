@@ -147,6 +147,49 @@ public:
         }
     }
     /*!
+    Create a sequential iterator starting at an arbitrary operator
+
+    \param num_var
+    is the number of variables in the tape.
+
+    \param op_vec
+    is the vector of operators on the tape.
+
+    \param arg_vec
+    is the vector of arguments for all the operators
+
+    \param op_index
+    is the operator index that iterator will start at.
+
+    \param arg_index
+    is the index in arg_vec of the first argument for this operator.
+
+    \param var_index
+    is the index of the last result for this operator
+    (if it has no results, the last result for a previous operator).
+    */
+    const_sequential_iterator(
+        size_t                                num_var    ,
+        const pod_vector<opcode_t>*           op_vec     ,
+        const pod_vector<addr_t>*             arg_vec    ,
+        size_t                                op_index   ,
+        size_t                                arg_index  ,
+        size_t                                var_index  )
+    :
+    op_begin_   ( op_vec->data() )                   ,
+    op_end_     ( op_vec->data() + op_vec->size() )  ,
+    arg_begin_  ( arg_vec->data() )                  ,
+    arg_end_    ( arg_vec->data() + arg_vec->size() ),
+    op_cur_     ( op_vec->data() + op_index )        ,
+    arg_        ( arg_vec->data() + arg_index )      ,
+    num_var_    ( num_var )                          ,
+    var_index_  ( var_index )
+    {   CPPAD_ASSERT_UNKNOWN( op_index < op_vec->size() );
+        CPPAD_ASSERT_UNKNOWN( arg_index <= arg_vec->size() );
+        CPPAD_ASSERT_UNKNOWN( var_index < num_var );
+        op_ = OpCode( *op_cur_ );
+    }
+    /*!
     Advance iterator to next operator
     */
     const_sequential_iterator& operator++(void)
@@ -281,7 +324,7 @@ public:
         var_index = var_index_;
     }
     /// current operator index
-    size_t op_index(void)
+    size_t op_index(void) const
     {   return size_t(op_cur_ - op_begin_); }
 };
 
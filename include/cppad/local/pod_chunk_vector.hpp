@@ -0,0 +1,221 @@
+# ifndef CPPAD_LOCAL_POD_CHUNK_VECTOR_HPP
+# define CPPAD_LOCAL_POD_CHUNK_VECTOR_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <vector>
+# include <cstring>
+# include <algorithm>
+# include <cppad/local/pod_vector.hpp>
+
+namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
+/*!
+\file pod_chunk_vector.hpp
+File used to define pod_chunk_vector class
+*/
+
+/// log base 2 of the number of elements in a pod_chunk_vector chunk
+const size_t pod_chunk_vector_log2_chunk = 16;
+
+/*!
+A vector of plain old data that grows without copying its elements.
+
+The elements are stored in chunks with pod_chunk_vector_log2_chunk
+elements. The first chunk is a pod_vector that grows by reallocation
+until it is full; i.e., small vectors use the same memory as a pod_vector.
+The other chunks are allocated at full size and never move.
+The elements are copied once, to a contiguous pod_vector, by move_to.
+*/
+template <class Type>
+class pod_chunk_vector {
+private:
+    /// number of elements in a chunk
+    static size_t chunk_length(void)
+    {   return size_t(1) << pod_chunk_vector_log2_chunk; }
+
+    /// number of elements currently in this vector
+    size_t length_;
+
+    /// the first chunk (grows by reallocation until it is full)
+    pod_vector<Type> first_;
+
+    /// pointer to the data for each chunk; chunk_[0] is first_.data()
+    std::vector<Type*> chunk_;
+
+    /// do not use the copy constructor
+    explicit pod_chunk_vector(const pod_chunk_vector& )
+    {   CPPAD_ASSERT_UNKNOWN(false); }
+
+    /// do not use the assignment operator
+    void operator=(const pod_chunk_vector& )
+    {   CPPAD_ASSERT_UNKNOWN(false); }
+public:
+    /// default constructor sets the size to zero
+    pod_chunk_vector(void) : length_(0)
+    {   CPPAD_ASSERT_UNKNOWN( is_pod<Type>() ); }
+
+    /// destructor returns all the chunks to thread_alloc
+    ~pod_chunk_vector(void)
+    {   clear(); }
+
+    /// current number of elements in this vector.
+    size_t size(void) const
+    {   return length_; }
+
+    /// current capacity (amount of allocated storage) for this vector.
+    size_t capacity(void) const
+    {   if( chunk_.size() == 0 )
+            return 0;
+        return first_.capacity() + (chunk_.size() - 1) * chunk_length();
+    }
+
+    /// non-constant element access; i.e., we can change this element value
+    Type& operator[](
+        /// element index, must be less than length
+        size_t i
+    )
+    {   CPPAD_ASSERT_UNKNOWN( i < length_ );
+        size_t mask = chunk_length() - 1;
+        return chunk_[i >> pod_chunk_vector_log2_chunk][i & mask];
+    }
+
+    /// constant element access; i.e., we cannot change this element value
+    const Type& operator[](
+        /// element index, must be less than length
+        size_t i
+    ) const
+    {   CPPAD_ASSERT_UNKNOWN( i < length_ );
+        size_t mask = chunk_length() - 1;
+        return chunk_[i >> pod_chunk_vector_log2_chunk][i & mask];
+    }
+
+    /*!
+    Increase the number of elements the end of this vector
+    (existing elements are always preserved and only the first chunk moves).
+
+    \param n
+    is the number of elements to add to end of this vector.
+    The new elements are not initialized and need not be contiguous
+    in memory; i.e., they must be accessed using operator[].
+
+    \return
+    is the number of elements in the vector before it was extended.
+    This is the index of the first new element added to the vector.
+    */
+    size_t extend(size_t n)
+    {   size_t old_length = length_;
+        length_          += n;
+        //
+        // first chunk
+        if( first_.size() < chunk_length() )
+        {   size_t n_first = std::min(length_, chunk_length()) - first_.size();
+            first_.extend(n_first);
+            if( chunk_.size() == 0 )
+                chunk_.push_back( first_.data() );
+            else
+                chunk_[0] = first_.data();
+        }
+        //
+        // other chunks
+        while( chunk_.size() * chunk_length() < length_ )
+        {   size_t min_bytes = chunk_length() * sizeof(Type);
+            size_t cap_bytes;
+            void*  v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+            chunk_.push_back( reinterpret_cast<Type*>(v_ptr) );
+        }
+        return old_length;
+    }
+
+    /*!
+    Allocate memory so that the capacity is at least n
+    (the size and the existing elements are not changed).
+
+    \param n
+    is the minimum capacity after this call.
+    */
+    void reserve(size_t n)
+    {   // first chunk
+        size_t n_first = std::min(n, chunk_length());
+        if( first_.capacity() < n_first )
+        {   size_t old_size = first_.size();
+            first_.extend(n_first - old_size);
+            first_.resize(old_size);
+            if( chunk_.size() == 0 )
+                chunk_.push_back( first_.data() );
+            else
+                chunk_[0] = first_.data();
+        }
+        //
+        // other chunks
+        while( chunk_.size() * chunk_length() < n )
+        {   size_t min_bytes = chunk_length() * sizeof(Type);
+            size_t cap_bytes;
+            void*  v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+            chunk_.push_back( reinterpret_cast<Type*>(v_ptr) );
+        }
+    }
+
+    /// Remove all the elements from this vector and free its memory.
+    void clear(void)
+    {   for(size_t k = 1; k < chunk_.size(); ++k)
+        {   void* v_ptr = reinterpret_cast<void*>( chunk_[k] );
+            thread_alloc::return_memory(v_ptr);
+        }
+        chunk_.clear();
+        first_.clear();
+        length_ = 0;
+    }
+
+    /*!
+    Move the elements of this vector to a pod_vector and clear this vector.
+
+    \param vec
+    The input value of the elements of vec does not matter.
+    Upon return, it contains the elements of this vector.
+    If there is only one chunk, its memory is swapped into vec
+    and no elements are copied.
+    Otherwise, each chunk is returned to thread_alloc as soon as it is
+    copied, so the peak memory is the size of vec plus one chunk.
+    */
+    void move_to(pod_vector<Type>& vec)
+    {   if( chunk_.size() <= 1 )
+        {   CPPAD_ASSERT_UNKNOWN( first_.size() == length_ );
+            vec.swap(first_);
+            clear();
+            return;
+        }
+        // free the previous contents of vec before allocating its new memory
+        vec.clear();
+        vec.resize(length_);
+        size_t start = 0;
+        for(size_t k = 0; k < chunk_.size(); ++k)
+        {   size_t n = std::min(chunk_length(), length_ - start);
+            void*  v_ptr = reinterpret_cast<void*>( vec.data() + start );
+            std::memcpy(v_ptr, chunk_[k], n * sizeof(Type) );
+            start += n;
+            //
+            // free this chunk
+            if( k == 0 )
+                first_.clear();
+            else
+            {   v_ptr = reinterpret_cast<void*>( chunk_[k] );
+                thread_alloc::return_memory(v_ptr);
+            }
+            chunk_[k] = nullptr;
+        }
+        CPPAD_ASSERT_UNKNOWN( start == length_ );
+        chunk_.clear();
+        length_ = 0;
+    }
+};
+
+} } // END_CPPAD_LOCAL_NAMESPACE
+# endif
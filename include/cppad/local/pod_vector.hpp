@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_POD_VECTOR_HPP
 # define CPPAD_LOCAL_POD_VECTOR_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -42,7 +42,8 @@ private:
     size_t byte_length_;
 
     /// pointer to the first type elements
-    /// (not defined and should not be used when byte_capacity_ = 0)
+    /// (not defined and should not be used when byte_capacity_ = 0
+    /// unless this vector is sharing memory with another; see share)
     Type   *data_;
 
     /// do not use the copy constructor
@@ -258,6 +259,26 @@ public:
     }
     // ----------------------------------------------------------------------
     /*!
+    Use the same memory as another vector (without copying its elements).
+
+    \param other
+    is the vector that owns the memory. It must not be deleted, or have
+    its elements changed, while this vector is sharing its memory.
+
+    \par
+    The capacity of this vector is zero, so it never frees the shared memory.
+    Any operation that increases the size of this vector
+    (extend, resize, assignment) allocates new memory for this vector.
+    The elements of this vector must not be changed using the non-const
+    versions of operator[] or data.
+    */
+    void share(const pod_vector& other)
+    {   clear();
+        byte_length_ = other.byte_length_;
+        data_        = other.data_;
+    }
+    // ----------------------------------------------------------------------
+    /*!
     Remove all the elements from this vector and free its memory.
     */
     void clear(void)
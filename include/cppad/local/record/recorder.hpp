@@ -13,6 +13,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 ---------------------------------------------------------------------------- */
 # include <cppad/core/hash_code.hpp>
 # include <cppad/local/pod_vector.hpp>
+# include <cppad/local/pod_chunk_vector.hpp>
 # include <cppad/core/ad_type.hpp>
 
 // ----------------------------------------------------------------------------
@@ -52,14 +53,15 @@ private:
     size_t num_var_load_rec_;
 
     /// The operators in the recording.
-    pod_vector<opcode_t> op_vec_;
+    /// (chunked so that long recordings are not copied while they grow)
+    pod_chunk_vector<opcode_t> op_vec_;
 
     /// The VecAD indices in the recording.
     pod_vector<addr_t> all_dyn_vecad_ind_;
     pod_vector<addr_t> all_var_vecad_ind_;
 
     /// The argument indices in the recording
-    pod_vector<addr_t> arg_vec_;
+    pod_chunk_vector<addr_t> arg_vec_;
 
     /// Character strings ('\\0' terminated) in the recording.
     pod_vector<char> text_vec_;
@@ -111,6 +113,41 @@ public:
     void set_num_dynamic_ind(size_t num_dynamic_ind)
     {   num_dynamic_ind_ = num_dynamic_ind; }
 
+    /*!
+    Reserve memory for the rest of this recording.
+
+    \param n_op
+    is the total number of operators expected in the recording.
+
+    \param n_arg
+    is the total number of operator arguments expected in the recording.
+
+    \param n_par
+    is the total number of parameters expected in the recording.
+
+    \par
+    This does not change the recording, it only allocates memory so that
+    the corresponding vectors do not grow while the recording is made.
+    The parameter hash table has a fixed size and is not affected.
+    */
+    void reserve(size_t n_op, size_t n_arg, size_t n_par)
+    {   op_vec_.reserve(n_op);
+        arg_vec_.reserve(n_arg);
+        //
+        // pod_vector_maybe and pod_vector do not have a reserve,
+        // extend then resize keeps the elements and the new capacity
+        size_t old_size = all_par_vec_.size();
+        if( all_par_vec_.capacity() < n_par )
+        {   all_par_vec_.extend(n_par - old_size);
+            all_par_vec_.resize(old_size);
+        }
+        CPPAD_ASSERT_UNKNOWN( dyn_par_is_.size() == old_size );
+        if( dyn_par_is_.capacity() < n_par )
+        {   dyn_par_is_.extend(n_par - old_size);
+            dyn_par_is_.resize(old_size);
+        }
+    }
+
     /// Get record_compare option
     bool get_record_compare(void) const
     {   return record_compare_; }
@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_STD_SET_HPP
 # define CPPAD_LOCAL_STD_SET_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -29,9 +29,8 @@ A standard set with one element.
 template <class Scalar>
 const std::set<Scalar>& one_element_std_set(void)
 {   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
-    static std::set<Scalar> one;
-    if( one.empty() )
-        one.insert(1);
+    // initialization of a local static is thread safe
+    static const std::set<Scalar> one = { Scalar(1) };
     return one;
 }
 /*!
@@ -40,11 +39,8 @@ A standard set with a two elements.
 template <class Scalar>
 const std::set<Scalar>& two_element_std_set(void)
 {   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL;
-    static std::set<Scalar> two;
-    if( two.empty() )
-    {   two.insert(1);
-        two.insert(2);
-    }
+    // initialization of a local static is thread safe
+    static const std::set<Scalar> two = { Scalar(1), Scalar(2) };
     return two;
 }
 
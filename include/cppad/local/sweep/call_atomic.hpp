@@ -12,6 +12,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
 
+# include <limits>
 # include <cppad/local/atomic_index.hpp>
 # include <cppad/core/atomic/two/atomic.hpp>
 # include <cppad/core/atomic/three/atomic.hpp>
@@ -24,6 +25,7 @@ namespace CppAD { namespace local { namespace sweep {
 /*
 $begin atomic_forward_callback$$
 $spell
+    ptr
     Taylor
     afun
     CppAD
@@ -63,6 +65,16 @@ highest order for this forward mode calculation.
 
 $head atom_index$$
 is the index, in local::atomic_index, corresponding to this atomic function.
+It is only used to get the name of the atomic function for error messages.
+
+$head atom_type$$
+is 2, 3, or 4 for atomic_two, atomic_three, or atomic_four functions.
+
+$head atom_ptr$$
+is a pointer to the atomic function object
+(null if the atomic function has been deleted).
+The values $icode atom_type$$ and $icode atom_ptr$$ are resolved once
+for each atomic function using $code play::atom_table$$.
 
 $head call_id$$
 see the atomic_four $cref/call_id/atomic_four_call/call_id/$$ and
@@ -86,42 +98,39 @@ void call_atomic_forward(
     size_t                       order_low   ,
     size_t                       order_up    ,
     size_t                       atom_index  ,
+    size_t                       atom_type   ,
+    void*                        atom_ptr    ,
     size_t                       call_id     ,
     const vector<Base>&          taylor_x    ,
     vector<Base>&                taylor_y    )
 // END_FORWARD
 {   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
-    bool         set_null = false;
-    size_t       type     = 0;          // set to avoid warning
-    std::string* name_ptr = nullptr;
-    void*        v_ptr    = nullptr; // set to avoid warning
-    local::atomic_index<RecBase>(set_null, atom_index, type, name_ptr, v_ptr);
 # ifndef NDEBUG
-    bool ok = v_ptr != nullptr;
+    bool ok = atom_ptr != nullptr;
     if( ok )
     {
-        if( type == 2 )
+        if( atom_type == 2 )
         {   atomic_base<RecBase>* afun =
-                reinterpret_cast< atomic_base<RecBase>* >(v_ptr);
+                reinterpret_cast< atomic_base<RecBase>* >(atom_ptr);
             afun->set_old(call_id);
             vector<ad_type_enum> empty;
             ok = afun->forward(
                 order_low, order_up, empty, empty, taylor_x, taylor_y
             );
         }
-        else if( type == 3 )
-        {   CPPAD_ASSERT_UNKNOWN( type == 3 );
+        else if( atom_type == 3 )
+        {   CPPAD_ASSERT_UNKNOWN( atom_type == 3 );
             atomic_three<RecBase>* afun =
-                reinterpret_cast< atomic_three<RecBase>* >(v_ptr);
+                reinterpret_cast< atomic_three<RecBase>* >(atom_ptr);
             ok = afun->forward(
                 parameter_x, type_x,
                 need_y, order_low, order_up, taylor_x, taylor_y
             );
         }
         else
-        {   CPPAD_ASSERT_UNKNOWN( type == 4 );
+        {   CPPAD_ASSERT_UNKNOWN( atom_type == 4 );
             atomic_four<RecBase>* afun =
-                reinterpret_cast< atomic_four<RecBase>* >(v_ptr);
+                reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
             ok = afun->forward(
                 call_id, select_y, order_low, order_up, taylor_x, taylor_y
             );
@@ -129,6 +138,9 @@ void call_atomic_forward(
     }
     if( ! ok )
     {   // now take the extra time to copy the name
+        bool        set_null = false;
+        size_t      type     = 0;
+        void*       v_ptr    = nullptr;
         std::string name;
         local::atomic_index<RecBase>(set_null, atom_index, type, &name, v_ptr);
         std::string msg = name;
@@ -139,18 +151,18 @@ void call_atomic_forward(
         CPPAD_ASSERT_KNOWN(false, msg.c_str() );
     }
 # else
-    if( type == 2 )
+    if( atom_type == 2 )
     {   atomic_base<RecBase>* afun =
-            reinterpret_cast< atomic_base<RecBase>* >(v_ptr);
+            reinterpret_cast< atomic_base<RecBase>* >(atom_ptr);
         vector<ad_type_enum> empty;
         afun->set_old(call_id);
         afun->forward(
             order_low, order_up, empty, empty, taylor_x, taylor_y
         );
     }
-    else if( type == 3 )
+    else if( atom_type == 3 )
     {   atomic_three<RecBase>* afun =
-            reinterpret_cast< atomic_three<RecBase>* >(v_ptr);
+            reinterpret_cast< atomic_three<RecBase>* >(atom_ptr);
         afun->forward(
             parameter_x, type_x,
             need_y, order_low, order_up, taylor_x, taylor_y
@@ -158,7 +170,7 @@ void call_atomic_forward(
     }
     else
     {   atomic_four<RecBase>* afun =
-            reinterpret_cast< atomic_four<RecBase>* >(v_ptr);
+            reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
         afun->forward(
             call_id, select_y, order_low, order_up, taylor_x, taylor_y
         );
@@ -166,9 +178,321 @@ void call_atomic_forward(
 # endif
 }
 // ----------------------------------------------------------------------------
+/*!
+Forward mode callback to an atomic function that has not been resolved.
+
+This looks up the atom_type and atom_ptr corresponding to atom_index
+and then calls the version of call_atomic_forward above.
+It is used when a play::atom_table is not available.
+*/
+template <class Base, class RecBase>
+void call_atomic_forward(
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    size_t                       need_y      ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    size_t                       atom_index  ,
+    size_t                       call_id     ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+{   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+    bool         set_null = false;
+    size_t       type     = 0;          // set to avoid warning
+    std::string* name_ptr = nullptr;
+    void*        v_ptr    = nullptr; // set to avoid warning
+    local::atomic_index<RecBase>(set_null, atom_index, type, name_ptr, v_ptr);
+    call_atomic_forward<Base, RecBase>(
+        parameter_x, type_x, need_y, select_y, order_low, order_up,
+        atom_index, type, v_ptr, call_id, taylor_x, taylor_y
+    );
+}
+// ----------------------------------------------------------------------------
+/*!
+Forward mode callback to an atomic function using views.
+
+The atomic_four view version of forward is used if it returns true.
+Otherwise, the values are copied to and from work vectors and the
+vector version is used; see call_atomic_forward.
+
+\param atom_type
+\param atom_ptr
+are the type and pointer for the atomic function corresponding to atom_index;
+see play::atom_table.
+
+\param taylor_x
+Taylor coefficients corresponding to x (n components and order_up+1 orders).
+
+\param taylor_y
+Taylor coefficients corresponding to y (m components and order_up+1 orders).
+On input, the orders less than order_low are set.
+Upon return, the orders order_low through order_up are set.
+
+\param work_x
+\param work_y
+are work vectors used when the vector version is called.
+*/
+template <class Base, class RecBase>
+void call_atomic_forward(
+    const vector<Base>&            parameter_x ,
+    const vector<ad_type_enum>&    type_x      ,
+    size_t                         need_y      ,
+    const vector<bool>&            select_y    ,
+    size_t                         order_low   ,
+    size_t                         order_up    ,
+    size_t                         atom_index  ,
+    size_t                         atom_type   ,
+    void*                          atom_ptr    ,
+    size_t                         call_id     ,
+    const atomic_view<const Base>& taylor_x    ,
+    const atomic_view<Base>&       taylor_y    ,
+    vector<Base>&                  work_x      ,
+    vector<Base>&                  work_y      )
+{   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+    if( atom_type == 4 && atom_ptr != nullptr )
+    {   atomic_four<RecBase>* afun =
+            reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
+        bool ok = afun->forward(
+            call_id, select_y, order_low, order_up, taylor_x, taylor_y
+        );
+        if( ok )
+            return;
+    }
+    //
+    // use the vector version
+    size_t q = order_up + 1;
+    size_t n = taylor_x.n_row();
+    size_t m = taylor_y.n_row();
+    CPPAD_ASSERT_UNKNOWN( taylor_x.n_order() == q );
+    CPPAD_ASSERT_UNKNOWN( taylor_y.n_order() == q );
+    work_x.resize(n * q);
+    work_y.resize(m * q);
+    for(size_t j = 0; j < n; ++j)
+        for(size_t k = 0; k < q; ++k)
+            work_x[j * q + k] = taylor_x(j, k);
+    for(size_t i = 0; i < m; ++i)
+        for(size_t k = 0; k < order_low; ++k)
+            work_y[i * q + k] = taylor_y(i, k);
+    call_atomic_forward<Base, RecBase>(
+        parameter_x, type_x, need_y, select_y,
+        order_low, order_up, atom_index, atom_type, atom_ptr, call_id,
+        work_x, work_y
+    );
+    for(size_t i = 0; i < m; ++i)
+        for(size_t k = order_low; k < q; ++k)
+            taylor_y(i, k) = work_y[i * q + k];
+}
+// ----------------------------------------------------------------------------
+/*
+$begin atomic_forward_batch_callback$$
+$spell
+    ptr
+    Taylor
+    afun
+    CppAD
+$$
+
+$section Forward Mode Callback for a Batch of Atomic Function Calls$$
+
+$head Prototype$$
+$srcthisfile%0%// BEGIN_FORWARD_BATCH%// END_FORWARD_BATCH%1%$$
+
+$head Base$$
+Is the base type corresponding to the atomic function call.
+
+$head RecBase$$
+Is the base type corresponding to this atomic function call.
+
+$head vector$$
+is the CppAD::vector template class.
+
+$head atom_index$$
+is the index, in local::atomic_index, corresponding to this atomic function.
+It is only used to get the name of the atomic function for error messages.
+
+$head atom_ptr$$
+is a pointer to the atomic function object
+(null if the atomic function has been deleted).
+It must be an atomic_four function; see $code play::atom_table$$.
+
+$head call_id$$
+is the atomic_four $cref/call_id/atomic_four_call/call_id/$$
+for every call in the batch.
+
+$head n_call$$
+is the number of calls in the batch.
+
+$head select_y$$
+specifies which components of taylor_y are necessary (for each call).
+
+$head order_low$$
+lowest order for this forward mode calculation.
+
+$head order_up$$
+highest order for this forward mode calculation.
+
+$head taylor_x$$
+Taylor coefficients corresponding to x (for each call).
+
+$head taylor_y$$
+Taylor coefficient corresponding to y (for each call).
+
+$end
+*/
+// BEGIN_FORWARD_BATCH
+template <class Base, class RecBase>
+void call_atomic_forward_batch(
+    size_t                       atom_index  ,
+    void*                        atom_ptr    ,
+    size_t                       call_id     ,
+    size_t                       n_call      ,
+    const vector<bool>&          select_y    ,
+    size_t                       order_low   ,
+    size_t                       order_up    ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+// END_FORWARD_BATCH
+{   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+# ifndef NDEBUG
+    bool ok = atom_ptr != nullptr;
+    if( ok )
+    {   atomic_four<RecBase>* afun =
+            reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
+        ok = afun->forward_batch(
+            call_id, n_call, select_y, order_low, order_up, taylor_x, taylor_y
+        );
+    }
+    if( ! ok )
+    {   // now take the extra time to copy the name
+        bool        set_null = false;
+        size_t      type     = 0;
+        void*       v_ptr    = nullptr;
+        std::string name;
+        local::atomic_index<RecBase>(set_null, atom_index, type, &name, v_ptr);
+        std::string msg = name;
+        if( v_ptr == nullptr )
+            msg += ": this atomic function has been deleted";
+        else
+            msg += ": atomic forward_batch returned false";
+        CPPAD_ASSERT_KNOWN(false, msg.c_str() );
+    }
+# else
+    atomic_four<RecBase>* afun =
+        reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
+    afun->forward_batch(
+        call_id, n_call, select_y, order_low, order_up, taylor_x, taylor_y
+    );
+# endif
+}
+// ----------------------------------------------------------------------------
+/*!
+Collects consecutive zero order forward calls to the same atomic_four
+function so they can be evaluated using one forward_batch callback.
+
+\tparam Base
+is the base type corresponding to the atomic function calls.
+
+\tparam RecBase
+is the base type corresponding to the atomic function object.
+*/
+template <class Base, class RecBase>
+class atomic_forward_batch {
+private:
+    /// atom_index for the calls in this batch
+    size_t atom_index_;
+    /// pointer to the atomic_four object for the calls in this batch
+    void* atom_ptr_;
+    /// call_id for the calls in this batch
+    size_t call_id_;
+    /// number of calls in this batch
+    size_t n_call_;
+    /// smallest variable index for the results in this batch
+    size_t first_var_;
+    /// argument values for all the calls
+    vector<Base> taylor_x_;
+    /// result values for all the calls
+    vector<Base> taylor_y_;
+    /// select_y for all the calls
+    vector<bool> select_y_;
+    /// variable index for each result, zero for a parameter result
+    vector<size_t> index_y_;
+public:
+    /// constructor
+    atomic_forward_batch(void)
+    : atom_index_(0), atom_ptr_(nullptr),
+      call_id_(0), n_call_(0), first_var_(0)
+    { }
+    /// number of calls currently in this batch
+    size_t n_call(void) const
+    {   return n_call_; }
+    /// can a call with this atom_index and call_id be added to this batch
+    bool match(size_t atom_index, size_t call_id) const
+    {   if( n_call_ == 0 )
+            return true;
+        return atom_index == atom_index_ && call_id == call_id_;
+    }
+    /// may the variable with index i_var be a result for this batch
+    bool result(size_t i_var) const
+    {   return n_call_ > 0 && first_var_ <= i_var; }
+    /// add a call to this batch
+    void add(
+        size_t                atom_index ,
+        void*                 atom_ptr   ,
+        size_t                call_id    ,
+        const vector<Base>&   taylor_x   ,
+        const vector<bool>&   select_y   ,
+        const vector<size_t>& index_y    )
+    {   CPPAD_ASSERT_UNKNOWN( match(atom_index, call_id) );
+        if( n_call_ == 0 )
+        {   atom_index_ = atom_index;
+            atom_ptr_   = atom_ptr;
+            call_id_    = call_id;
+            first_var_  = std::numeric_limits<size_t>::max();
+        }
+        for(size_t j = 0; j < taylor_x.size(); ++j)
+            taylor_x_.push_back( taylor_x[j] );
+        for(size_t i = 0; i < index_y.size(); ++i)
+        {   select_y_.push_back( select_y[i] );
+            index_y_.push_back( index_y[i] );
+            if( index_y[i] > 0 )
+                first_var_ = std::min(first_var_, index_y[i]);
+        }
+        ++n_call_;
+    }
+    /*!
+    Evaluate the calls in this batch and remove them from the batch.
+
+    \param J
+    is the number of columns in the taylor matrix.
+
+    \param taylor
+    The zero order Taylor coefficient for the results that are variables
+    are stored in this matrix.
+    */
+    void flush(size_t J, Base* taylor)
+    {   if( n_call_ == 0 )
+            return;
+        taylor_y_.resize( index_y_.size() );
+        call_atomic_forward_batch<Base, RecBase>(
+            atom_index_, atom_ptr_, call_id_, n_call_, select_y_,
+            0, 0, taylor_x_, taylor_y_
+        );
+        for(size_t i = 0; i < index_y_.size(); ++i)
+            if( index_y_[i] > 0 )
+                taylor[ index_y_[i] * J + 0 ] = taylor_y_[i];
+        //
+        n_call_ = 0;
+        taylor_x_.resize(0);
+        select_y_.resize(0);
+        index_y_.resize(0);
+    }
+};
+// ----------------------------------------------------------------------------
 /*
 $begin atomic_reverse_callback$$
 $spell
+    ptr
     CppAD
     Taylor
     Jacobian
@@ -203,6 +527,16 @@ highest order for this reverse mode calculation.
 
 $head atom_index$$
 is the index, in local::atomic_index, corresponding to this atomic function.
+It is only used to get the name of the atomic function for error messages.
+
+$head atom_type$$
+is 2, 3, or 4 for atomic_two, atomic_three, or atomic_four functions.
+
+$head atom_ptr$$
+is a pointer to the atomic function object
+(null if the atomic function has been deleted).
+The values $icode atom_type$$ and $icode atom_ptr$$ are resolved once
+for each atomic function using $code play::atom_table$$.
 
 $head call_id$$
 see the atomic_four $cref/call_id/atomic_four_call/call_id/$$ and
@@ -230,6 +564,8 @@ void call_atomic_reverse(
     const vector<bool>&          select_x    ,
     size_t                       order_up    ,
     size_t                       atom_index  ,
+    size_t                       atom_type   ,
+    void*                        atom_ptr    ,
     size_t                       call_id     ,
     const vector<Base>&          taylor_x    ,
     const vector<Base>&          taylor_y    ,
@@ -237,35 +573,30 @@ void call_atomic_reverse(
     const vector<Base>&          partial_y   )
 // END_REVERSE
 {   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
-    bool         set_null = false;
-    size_t       type     = 0;          // set to avoid warning
-    std::string* name_ptr = nullptr;
-    void*        v_ptr    = nullptr; // set to avoid warning
-    local::atomic_index<RecBase>(set_null, atom_index, type, name_ptr, v_ptr);
 # ifndef NDEBUG
-    bool ok = v_ptr != nullptr;
+    bool ok = atom_ptr != nullptr;
     if( ok )
     {
-        if( type == 2 )
+        if( atom_type == 2 )
         {   atomic_base<RecBase>* afun =
-                reinterpret_cast< atomic_base<RecBase>* >(v_ptr);
+                reinterpret_cast< atomic_base<RecBase>* >(atom_ptr);
             afun->set_old(call_id);
             ok = afun->reverse(
                 order_up, taylor_x, taylor_y, partial_x, partial_y
             );
         }
-        else if( type == 3 )
+        else if( atom_type == 3 )
         {   atomic_three<RecBase>* afun =
-                reinterpret_cast< atomic_three<RecBase>* >(v_ptr);
+                reinterpret_cast< atomic_three<RecBase>* >(atom_ptr);
             ok = afun->reverse(
                 parameter_x, type_x,
                 order_up, taylor_x, taylor_y, partial_x, partial_y
             );
         }
         else
-        {   CPPAD_ASSERT_UNKNOWN( type == 4 );
+        {   CPPAD_ASSERT_UNKNOWN( atom_type == 4 );
             atomic_four<RecBase>* afun =
-                reinterpret_cast< atomic_four<RecBase>* >(v_ptr);
+                reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
             ok = afun->reverse(
                 call_id, select_x,
                 order_up, taylor_x, taylor_y, partial_x, partial_y
@@ -274,6 +605,9 @@ void call_atomic_reverse(
     }
     if( ! ok )
     {   // now take the extra time to copy the name
+        bool        set_null = false;
+        size_t      type     = 0;
+        void*       v_ptr    = nullptr;
         std::string name;
         local::atomic_index<RecBase>(set_null, atom_index, type, &name, v_ptr);
         std::string msg = name;
@@ -284,17 +618,17 @@ void call_atomic_reverse(
         CPPAD_ASSERT_KNOWN(false, msg.c_str() );
     }
 # else
-    if( type == 2 )
+    if( atom_type == 2 )
     {   atomic_base<RecBase>* afun =
-            reinterpret_cast< atomic_base<RecBase>* >(v_ptr);
+            reinterpret_cast< atomic_base<RecBase>* >(atom_ptr);
         afun->set_old(call_id);
         afun->reverse(
             order_up, taylor_x, taylor_y, partial_x, partial_y
         );
     }
-    else if( type == 3 )
+    else if( atom_type == 3 )
     {   atomic_three<RecBase>* afun =
-            reinterpret_cast< atomic_three<RecBase>* >(v_ptr);
+            reinterpret_cast< atomic_three<RecBase>* >(atom_ptr);
         afun->reverse(
             parameter_x, type_x,
             order_up, taylor_x, taylor_y, partial_x, partial_y
@@ -302,7 +636,7 @@ void call_atomic_reverse(
     }
     else
     {   atomic_four<RecBase>* afun =
-            reinterpret_cast< atomic_four<RecBase>* >(v_ptr);
+            reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
         afun->reverse(
             call_id, select_x,
             order_up, taylor_x, taylor_y, partial_x, partial_y
@@ -311,6 +645,97 @@ void call_atomic_reverse(
 # endif
 }
 // ----------------------------------------------------------------------------
+/*!
+Reverse mode callback to an atomic function using views.
+
+The atomic_four view version of reverse is used if it returns true.
+Otherwise, the values are copied to and from work vectors and the
+vector version is used; see call_atomic_reverse.
+
+\param atom_type
+\param atom_ptr
+are the type and pointer for the atomic function corresponding to atom_index;
+see play::atom_table.
+
+\param taylor_x
+Taylor coefficients corresponding to x (n components and order_up+1 orders).
+
+\param taylor_y
+Taylor coefficients corresponding to y (m components and order_up+1 orders).
+
+\param partial_x
+For the components of x that are selected, the partials w.r.t. the
+x Taylor coefficients are added to this view.
+
+\param partial_y
+Partials w.r.t the y Taylor coefficients.
+
+\param work_tx
+\param work_ty
+\param work_px
+\param work_py
+are work vectors used when the vector version is called.
+*/
+template <class Base, class RecBase>
+void call_atomic_reverse(
+    const vector<Base>&            parameter_x ,
+    const vector<ad_type_enum>&    type_x      ,
+    const vector<bool>&            select_x    ,
+    size_t                         order_up    ,
+    size_t                         atom_index  ,
+    size_t                         atom_type   ,
+    void*                          atom_ptr    ,
+    size_t                         call_id     ,
+    const atomic_view<const Base>& taylor_x    ,
+    const atomic_view<const Base>& taylor_y    ,
+    const atomic_view<Base>&       partial_x   ,
+    const atomic_view<const Base>& partial_y   ,
+    vector<Base>&                  work_tx     ,
+    vector<Base>&                  work_ty     ,
+    vector<Base>&                  work_px     ,
+    vector<Base>&                  work_py     )
+{   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+    if( atom_type == 4 && atom_ptr != nullptr )
+    {   atomic_four<RecBase>* afun =
+            reinterpret_cast< atomic_four<RecBase>* >(atom_ptr);
+        bool ok = afun->reverse(
+            call_id, select_x,
+            order_up, taylor_x, taylor_y, partial_x, partial_y
+        );
+        if( ok )
+            return;
+    }
+    //
+    // use the vector version
+    size_t q = order_up + 1;
+    size_t n = taylor_x.n_row();
+    size_t m = taylor_y.n_row();
+    CPPAD_ASSERT_UNKNOWN( taylor_x.n_order() == q );
+    CPPAD_ASSERT_UNKNOWN( taylor_y.n_order() == q );
+    work_tx.resize(n * q);
+    work_px.resize(n * q);
+    work_ty.resize(m * q);
+    work_py.resize(m * q);
+    for(size_t j = 0; j < n; ++j)
+        for(size_t k = 0; k < q; ++k)
+            work_tx[j * q + k] = taylor_x(j, k);
+    for(size_t i = 0; i < m; ++i)
+    {   for(size_t k = 0; k < q; ++k)
+        {   work_ty[i * q + k] = taylor_y(i, k);
+            work_py[i * q + k] = partial_y(i, k);
+        }
+    }
+    call_atomic_reverse<Base, RecBase>(
+        parameter_x, type_x, select_x, order_up,
+        atom_index, atom_type, atom_ptr, call_id,
+        work_tx, work_ty, work_px, work_py
+    );
+    for(size_t j = 0; j < n; ++j) if( select_x[j] )
+    {   for(size_t k = 0; k < q; ++k)
+            partial_x(j, k) += work_px[j * q + k];
+    }
+}
+// ----------------------------------------------------------------------------
 /*
 $begin atomic_for_jac_sparsity_callback$$
 $spell
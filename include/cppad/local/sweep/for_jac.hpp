@@ -83,6 +83,12 @@ corresponds to the set with index i in var_sparsity.
 
 \param not_used_rec_base
 Specifies RecBase for this call.
+
+\param cexp_select
+If this is not null, for each CExpOp with operator index i_op,
+(*cexp_select)[i_op] is zero (both branches), one (only if_true),
+or two (only if_false); i.e., which branch is included in the pattern.
+This is used to compute sparsity patterns that are local to a point.
 */
 
 template <class Addr, class Base, class Vector_set, class RecBase>
@@ -92,7 +98,8 @@ void for_jac(
     size_t                     n                 ,
     size_t                     numvar            ,
     Vector_set&                var_sparsity,
-    const RecBase&             not_used_rec_base
+    const RecBase&             not_used_rec_base,
+    const pod_vector<unsigned char>* cexp_select = nullptr
 )
 {
     size_t            i, j, k;
@@ -272,7 +279,9 @@ void for_jac(
 
             case CExpOp:
             forward_sparse_jacobian_cond_op(
-                dependency, i_var, arg, num_par, var_sparsity
+                dependency, i_var, arg, num_par, var_sparsity,
+                cexp_select == nullptr ?
+                    0 : size_t( (*cexp_select)[ itr.op_index() ] )
             );
             break;
             // --------------------------------------------------
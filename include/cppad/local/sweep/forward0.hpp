@@ -14,6 +14,8 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 # include <cppad/local/play/atom_op_info.hpp>
 # include <cppad/local/sweep/call_atomic.hpp>
+# include <cppad/local/live_slot.hpp>
+# include <cppad/local/memo_table.hpp>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -46,6 +48,8 @@ $codei% forward0(
     %numvar%,
     %J%,
     %taylor%,
+    %slot%,
+    %memo%,
     %cskip_op%,
     %load_op2var%,
     %compare_change_count%,
@@ -78,9 +82,10 @@ $head n$$
 is the number of independent variables on the tape.
 
 $head numvar$$
-is the total number of variables on the tape.
-This is also equal to the number of rows in the matrix taylor; i.e.,
-$icode%play%->num_var_rec()%$$.
+is the number of rows in the matrix taylor.
+If $icode slot$$ is null, this is the total number of variables on the tape;
+i.e., $icode%play%->num_var_rec()%$$.
+Otherwise it is the number of slots $icode%slot%->n_slot()%$$.
 
 $head play$$
 The information stored in play
@@ -110,6 +115,35 @@ $icode taylor [%i% * %J% + 0]%$$
 is the zero order Taylor coefficient for the variable with
 index i on the tape.
 
+$head slot$$
+If this is null, the row index in $icode taylor$$ is the variable index.
+Otherwise, the row index in $icode taylor$$ is the slot index
+that $icode slot$$ assigns to the variable; i.e.,
+the results of each operator are stored using
+$icode%slot%->op2slot()%$$ and the variable arguments are read using
+$icode%slot%->arg_slot()%$$.
+In this case,
+the $icode load_op2var$$ values are slot indices (not variable indices)
+and should not be used by the other sweeps.
+
+$subhead Range$$
+If $icode%slot%->range_op(0)%$$ is not zero,
+$icode slot$$ is a segment mapping (see $code live_slot::segment$$)
+and only the operators in the segment are evaluated.
+In this case, the zero order Taylor coefficients for the variables that
+are created before the segment must be set before the call,
+$icode cskip_op$$ is not initialized
+(so that it can contain values from previous segments),
+and there cannot be any $cref VecAD$$ vectors in the recording.
+
+$head memo$$
+If this is null, every discrete and atomic function call is evaluated.
+Otherwise, the memo is turned on and
+a discrete or atomic function call is only evaluated when its arguments
+are different from the previous evaluation at the same call site;
+see $cref/memo_pure/memo_pure/$$.
+In this case, consecutive atomic function calls are not batched.
+
 $head cskip_op$$
 Is a vector with size $icode%play%->num_op_rec()%$$.
 The input value of the elements does not matter.
@@ -161,6 +195,8 @@ void forward0(
     size_t                     numvar,
     size_t                     J,
     Base*                      taylor,
+    const live_slot*           slot,
+    memo_table<Base>*          memo,
     bool*                      cskip_op,
     pod_vector<Addr>&          load_op2var,
     size_t                     compare_change_count,
@@ -169,7 +205,8 @@ void forward0(
     const RecBase&             not_used_rec_base
 )
 {   CPPAD_ASSERT_UNKNOWN( J >= 1 );
-    CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+    CPPAD_ASSERT_UNKNOWN( slot != nullptr || play->num_var_rec() == numvar );
+    CPPAD_ASSERT_UNKNOWN( slot == nullptr || slot->n_slot() == numvar );
 
     // use p, q, r so other forward sweeps can use code defined here
     size_t p = 0;
@@ -199,9 +236,12 @@ void forward0(
             }
         }
         // includes zero order, so initialize conditional skip flags
-        num = play->num_op_rec();
-        for(i = 0; i < num; i++)
-            cskip_op[i] = false;
+        // (not done when evaluating a segment of the recording)
+        if( slot == nullptr || slot->range_op(0) == 0 )
+        {   num = play->num_op_rec();
+            for(i = 0; i < num; i++)
+                cskip_op[i] = false;
+        }
     }
 
     // information used by atomic function operators
@@ -221,6 +261,26 @@ void forward0(
     // information defined by atomic function operators
     size_t atom_index=0, atom_id=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
     enum_atom_state atom_state = start_atom; // proper initialization
+    //
+    // operator index for the first AFunOp of the current atomic function call
+    size_t atom_op_index = 0;
+    //
+    // type and pointer for the current atomic function (see play::atom_table)
+    size_t atom_type = 0;
+    void*  atom_ptr  = nullptr;
+    //
+    // consecutive calls to the same atomic_four function are evaluated
+    // together (not done when slots are reused, memo is on, or tracing)
+    atomic_forward_batch<Base, RecBase> atom_batch;
+    bool atom_batch_ok = slot == nullptr && memo == nullptr;
+    bool atom_batch_call = false; // is the current call in atom_batch
+# if CPPAD_FORWARD0_TRACE
+    atom_batch_ok = false;
+# endif
+
+    // move the memo cursor to the first call site
+    if( memo != nullptr )
+        memo->template start<RecBase>(play);
 
     // length of the parameter vector (used by CppAD assert macros)
     const size_t num_par = play->num_par_rec();
@@ -251,6 +311,27 @@ void forward0(
     itr.op_info(op, arg, i_var);
     CPPAD_ASSERT_UNKNOWN( op == BeginOp );
     //
+    // arguments for the first operator in the recording
+    const Addr* arg_begin = arg;
+    //
+    // mapping from variables to slots
+    const addr_t* op2slot  = nullptr;
+    const addr_t* arg_slot = nullptr;
+    if( slot != nullptr )
+    {   op2slot  = slot->op2slot().data();
+        arg_slot = slot->arg_slot().data();
+    }
+    //
+    // op_end: index of the operator that terminates this sweep
+    size_t op_end = play->num_op_rec();
+    if( slot != nullptr && slot->range_op(0) != 0 )
+    {   CPPAD_ASSERT_UNKNOWN( play->num_var_vecad_rec() == 0 );
+        // start just before the first operator in the segment
+        itr    = slot->range_itr(play, 0);
+        --itr;
+        op_end = slot->range_op(1);
+    }
+    //
 # if CPPAD_FORWARD0_TRACE
     std::cout << std::endl;
 # endif
@@ -263,7 +344,7 @@ void forward0(
         CPPAD_ASSERT_UNKNOWN( itr.op_index() < play->num_op_rec() );
 
         // check if we are skipping this operation
-        while( cskip_op[itr.op_index()] )
+        while( itr.op_index() < op_end && cskip_op[itr.op_index()] )
         {   switch(op)
             {
                 case AFunOp:
@@ -294,6 +375,21 @@ void forward0(
             (++itr).op_info(op, arg, i_var);
         }
 
+        // check for the end of a segment
+        if( itr.op_index() == op_end )
+            break;
+
+        // use slot indices in place of variable indices
+        if( slot != nullptr )
+        {   arg   = arg_slot + (arg - arg_begin);
+            i_var = size_t( op2slot[ itr.op_index() ] );
+        }
+
+        // an operator that is not part of an atomic function call
+        // may use the results for the current batch of calls
+        if( atom_state == start_atom && op != AFunOp )
+            atom_batch.flush(J, taylor);
+
         // action to take depends on the case
         switch( op )
         {
@@ -380,7 +476,8 @@ void forward0(
 
             case CSkipOp:
             forward_cskip_op_0(
-                i_var, arg, num_par, parameter, J, taylor, cskip_op
+                i_var, arg, num_par, parameter, J, taylor, cskip_op,
+                slot != nullptr
             );
             itr.correct_before_increment();
             break;
@@ -388,14 +485,24 @@ void forward0(
 
             case CSumOp:
             forward_csum_op(
-                0, 0, i_var, arg, num_par, parameter, J, taylor
+                0, 0, i_var, arg, num_par, parameter, J, taylor,
+                slot != nullptr
             );
             itr.correct_before_increment();
             break;
             // -------------------------------------------------
 
             case DisOp:
-            forward_dis_op<RecBase>(p, q, r, i_var, arg, J, taylor);
+            if( memo == nullptr )
+                forward_dis_op<RecBase>(p, q, r, i_var, arg, J, taylor);
+            else
+            {   const Base* x = taylor + size_t(arg[1]) * J;
+                Base*       z = taylor + i_var * J;
+                if( ! memo->find(itr.op_index(), x, z) )
+                {   forward_dis_op<RecBase>(p, q, r, i_var, arg, J, taylor);
+                    memo->store(x, z);
+                }
+            }
             break;
             // -------------------------------------------------
 
@@ -489,7 +596,8 @@ void forward0(
                 taylor,
                 vec_ad2isvar.data(),
                 vec_ad2index.data(),
-                load_op2var.data()
+                load_op2var.data(),
+                slot != nullptr
             );
             break;
             // -------------------------------------------------
@@ -504,7 +612,8 @@ void forward0(
                 taylor,
                 vec_ad2isvar.data(),
                 vec_ad2index.data(),
-                load_op2var.data()
+                load_op2var.data(),
+                slot != nullptr
             );
             break;
             // -------------------------------------------------
@@ -815,9 +924,13 @@ void forward0(
                 op, arg, atom_index, atom_id, atom_m, atom_n
             );
             if( flag )
-            {   atom_state = arg_atom;
-                atom_i     = 0;
-                atom_j     = 0;
+            {   atom_state    = arg_atom;
+                atom_i        = 0;
+                atom_j        = 0;
+                atom_op_index = itr.op_index();
+                play->atom_table().template get<RecBase>(
+                    atom_index, atom_type, atom_ptr
+                );
                 //
                 atom_par_x.resize(atom_n);
                 atom_type_x.resize(atom_n);
@@ -825,6 +938,11 @@ void forward0(
                 atom_ty.resize(atom_m);
                 atom_iy.resize(atom_m);
                 atom_sy.resize(atom_m);
+                //
+                // atom_batch_call
+                if( ! atom_batch.match(atom_index, atom_id) )
+                    atom_batch.flush(J, taylor);
+                atom_batch_call = atom_batch_ok && atom_type == 4;
             }
             else
             {   CPPAD_ASSERT_UNKNOWN( atom_i == atom_m );
@@ -834,11 +952,28 @@ void forward0(
                 for(size_t i = 0; i < atom_m; ++i)
                     atom_sy[i] = atom_iy[i] != 0;
                 //
-                // call atomic function for this operation
-                call_atomic_forward<Base, RecBase>(
-                    atom_par_x, atom_type_x, need_y, atom_sy,
-                    order_low, order_up, atom_index, atom_id, atom_tx, atom_ty
+                if( atom_batch_call )
+                {   // results are computed when the batch is flushed
+                    atom_batch.add(
+                        atom_index, atom_ptr, atom_id, atom_tx, atom_sy, atom_iy
+                    );
+                    break;
+                }
+                //
+                // use the memo for this call site
+                flag = memo != nullptr && memo->find(
+                    atom_op_index, atom_tx.data(), atom_ty.data()
                 );
+                if( ! flag )
+                {   // call atomic function for this operation
+                    call_atomic_forward<Base, RecBase>(
+                        atom_par_x, atom_type_x, need_y, atom_sy,
+                        order_low, order_up, atom_index,
+                        atom_type, atom_ptr, atom_id, atom_tx, atom_ty
+                    );
+                    if( memo != nullptr )
+                        memo->store(atom_tx.data(), atom_ty.data());
+                }
                 for(size_t i = 0; i < atom_m; ++i)
                     if( atom_iy[i] > 0 )
                         taylor[ atom_iy[i] * J + 0 ] = atom_ty[i];
@@ -876,6 +1011,10 @@ void forward0(
             CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
             CPPAD_ASSERT_UNKNOWN( atom_j < atom_n );
             //
+            // this argument may be a result for the current batch of calls
+            if( atom_batch.result( size_t(arg[0]) ) )
+                atom_batch.flush(J, taylor);
+            //
             atom_type_x[atom_j] = variable_enum;
             atom_par_x[atom_j]  = CppAD::numeric_limits<Base>::quiet_NaN();
             atom_tx[atom_j++]   = taylor[ size_t(arg[0]) * J + 0 ];
@@ -231,14 +231,22 @@ void forward1(
     // vectors used by atomic function operators
     vector<Base>         atom_par_x;  // argument parameter values
     vector<ad_type_enum> atom_type_x; // argument type
-    vector<Base>         atom_tx;     // argument vector Taylor coefficients
-    vector<Base>         atom_ty;     // result vector Taylor coefficients
+    vector<const Base*>  atom_tx;     // argument Taylor coefficient rows
+    vector<Base*>        atom_ty;     // result Taylor coefficient rows
+    vector<Base>         atom_px;     // storage for parameter argument rows
+    vector<Base>         atom_py;     // storage for parameter result rows
+    vector<Base>         atom_wx;     // work space for vector version
+    vector<Base>         atom_wy;     // work space for vector version
     vector<size_t>       atom_iy;     // variable indices for result vector
     vector<bool>         atom_sy;     // select_y for this atomic call
     //
     // information defined by atomic function operators
     size_t atom_index=0, atom_id=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
     enum_atom_state atom_state = start_atom; // proper initialization
+    //
+    // type and pointer for the current atomic function (see play::atom_table)
+    size_t atom_type = 0;
+    void*  atom_ptr  = nullptr;
 
     // length of the parameter vector (used by CppAD assert macros)
     const size_t num_par = play->num_par_rec();
@@ -403,7 +411,7 @@ void forward1(
             case CSkipOp:
             if( p == 0 )
             {   forward_cskip_op_0(
-                    i_var, arg, num_par, parameter, J, taylor, cskip_op
+                    i_var, arg, num_par, parameter, J, taylor, cskip_op, false
                 );
             }
             itr.correct_before_increment();
@@ -412,7 +420,7 @@ void forward1(
 
             case CSumOp:
             forward_csum_op(
-                p, q, i_var, arg, num_par, parameter, J, taylor
+                p, q, i_var, arg, num_par, parameter, J, taylor, false
             );
             itr.correct_before_increment();
             break;
@@ -512,7 +520,8 @@ void forward1(
                     taylor,
                     vec_ad2isvar.data(),
                     vec_ad2index.data(),
-                    load_op2var.data()
+                    load_op2var.data(),
+                    false
                 );
                 if( p < q ) forward_load_op(
                     play,
@@ -554,7 +563,8 @@ void forward1(
                     taylor,
                     vec_ad2isvar.data(),
                     vec_ad2index.data(),
-                    load_op2var.data()
+                    load_op2var.data(),
+                    false
                 );
                 if( p < q ) forward_load_op(
                     play,
@@ -901,11 +911,16 @@ void forward1(
             {   atom_state = arg_atom;
                 atom_i     = 0;
                 atom_j     = 0;
+                play->atom_table().template get<RecBase>(
+                    atom_index, atom_type, atom_ptr
+                );
                 //
                 atom_par_x.resize(atom_n);
                 atom_type_x.resize(atom_n);
-                atom_tx.resize(atom_n * atom_q1);
-                atom_ty.resize(atom_m * atom_q1);
+                atom_tx.resize(atom_n);
+                atom_ty.resize(atom_m);
+                atom_px.resize(atom_n * atom_q1);
+                atom_py.resize(atom_m * atom_q1);
                 atom_iy.resize(atom_m);
                 atom_sy.resize(atom_m);
             }
@@ -918,15 +933,15 @@ void forward1(
                     atom_sy[i] = atom_iy[i] != 0;
                 //
                 // call atomic function for this operation
+                // (results that are variables are stored directly in taylor)
                 call_atomic_forward<Base, RecBase>(
                     atom_par_x, atom_type_x, need_y, atom_sy,
-                    order_low, order_up, atom_index, atom_id, atom_tx, atom_ty
+                    order_low, order_up,
+                    atom_index, atom_type, atom_ptr, atom_id,
+                    atomic_view<const Base>(atom_tx.data(), atom_n, atom_q1),
+                    atomic_view<Base>(atom_ty.data(), atom_m, atom_q1),
+                    atom_wx, atom_wy
                 );
-                for(i = 0; i < atom_m; i++)
-                    if( atom_iy[i] > 0 )
-                        for(k = p; k <= q; k++)
-                            taylor[ atom_iy[i] * J + k ] =
-                                atom_ty[ i * atom_q1 + k ];
 # if CPPAD_FORWARD1_TRACE
                 atom_trace = true;
 # endif
@@ -946,9 +961,10 @@ void forward1(
             else
                 atom_type_x[atom_j] = constant_enum;
             atom_par_x[atom_j]            = parameter[ arg[0] ];
-            atom_tx[atom_j * atom_q1 + 0] = parameter[ arg[0]];
+            atom_px[atom_j * atom_q1 + 0] = parameter[ arg[0]];
             for(k = 1; k < atom_q1; k++)
-                atom_tx[atom_j * atom_q1 + k] = Base(0.0);
+                atom_px[atom_j * atom_q1 + k] = Base(0.0);
+            atom_tx[atom_j] = atom_px.data() + atom_j * atom_q1;
             //
             ++atom_j;
             if( atom_j == atom_n )
@@ -964,8 +980,7 @@ void forward1(
             //
             atom_type_x[atom_j] = variable_enum;
             atom_par_x[atom_j]  = CppAD::numeric_limits<Base>::quiet_NaN();
-            for(k = 0; k < atom_q1; k++)
-                atom_tx[atom_j * atom_q1 + k] = taylor[ size_t(arg[0]) * J + k];
+            atom_tx[atom_j]     = taylor + size_t(arg[0]) * J;
             //
             ++atom_j;
             if( atom_j == atom_n )
@@ -981,9 +996,10 @@ void forward1(
             CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
             //
             atom_iy[atom_i] = 0;
-            atom_ty[atom_i * atom_q1 + 0] = parameter[ arg[0]];
-            for(k = 1; k < p; k++)
-                atom_ty[atom_i * atom_q1 + k] = Base(0.0);
+            atom_py[atom_i * atom_q1 + 0] = parameter[ arg[0]];
+            for(k = 1; k < atom_q1; k++)
+                atom_py[atom_i * atom_q1 + k] = Base(0.0);
+            atom_ty[atom_i] = atom_py.data() + atom_i * atom_q1;
             //
             ++atom_i;
             if( atom_i == atom_m )
@@ -998,8 +1014,7 @@ void forward1(
             CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
             //
             atom_iy[atom_i] = i_var;
-            for(k = 0; k < p; k++)
-                atom_ty[atom_i * atom_q1 + k] = taylor[ i_var * J + k];
+            atom_ty[atom_i] = taylor + i_var * J;
             //
             ++atom_i;
             if( atom_i == atom_m )
@@ -155,6 +155,10 @@ void forward2(
     size_t atom_index=0, atom_id=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
     enum_atom_state atom_state = start_atom; // proper initialization
     //
+    // type and pointer for the current atomic function (see play::atom_table)
+    size_t atom_type = 0;
+    void*  atom_ptr  = nullptr;
+    //
     // length of the parameter vector (used by CppAD assert macros)
     const size_t num_par = play->num_par_rec();
 
@@ -540,6 +544,9 @@ void forward2(
             {   atom_state = arg_atom;
                 atom_i     = 0;
                 atom_j     = 0;
+                play->atom_table().template get<RecBase>(
+                    atom_index, atom_type, atom_ptr
+                );
                 //
                 atom_par_x.resize(atom_n);
                 atom_type_x.resize(atom_n);
@@ -593,6 +600,8 @@ void forward2(
                         order_low,
                         order_up,
                         atom_index,
+                        atom_type,
+                        atom_ptr,
                         atom_id,
                         atom_tx_one,
                         atom_ty_one
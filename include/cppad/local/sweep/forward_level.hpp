@@ -0,0 +1,355 @@
+# ifndef CPPAD_LOCAL_SWEEP_FORWARD_LEVEL_HPP
+# define CPPAD_LOCAL_SWEEP_FORWARD_LEVEL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/level_schedule.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/forward_level.hpp
+Forward mode for one operator in a level_schedule.
+*/
+
+/*!
+Compute forward mode Taylor coefficients for one operator.
+
+\tparam Base
+The type used during the forward mode computations.
+
+\param p
+is the lowest order Taylor coefficient to compute.
+
+\param q
+is the highest order Taylor coefficient to compute.
+If q is zero, the zero order operator functions are used.
+
+\param op
+is the operator; see level_schedule for the operators that are supported.
+
+\param i_var
+is the index of the primary result for this operator.
+
+\param arg
+is the argument vector for this operator.
+
+\param num_par
+is the number of parameters in the recording.
+
+\param parameter
+is the parameter vector for the recording.
+
+\param J
+is the number of Taylor coefficients (orders) stored for each variable.
+
+\param taylor
+is the Taylor coefficient matrix.
+On input, the coefficients of order less than or equal q for the
+arguments of this operator, and of order less than p for its results,
+are known. On output, the coefficients from order p to q for the results
+of this operator have been computed.
+This routine only writes the results of this operator and hence it can be
+called at the same time for other operators in the same level.
+*/
+template <class Base>
+void forward_level_op(
+    size_t        p          ,
+    size_t        q          ,
+    OpCode        op         ,
+    size_t        i_var      ,
+    const addr_t* arg        ,
+    size_t        num_par    ,
+    const Base*   parameter  ,
+    size_t        J          ,
+    Base*         taylor     )
+{   CPPAD_ASSERT_UNKNOWN( p <= q );
+    //
+    // zero order
+    if( q == 0 )
+    {   switch( op )
+        {
+            case AbsOp:
+            forward_abs_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case AcosOp:
+            forward_acos_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case AcoshOp:
+            forward_acosh_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case AddpvOp:
+            forward_addpv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case AddvvOp:
+            forward_addvv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case AsinOp:
+            forward_asin_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case AsinhOp:
+            forward_asinh_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case AtanOp:
+            forward_atan_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case AtanhOp:
+            forward_atanh_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case CExpOp:
+            forward_cond_op_0(i_var, arg, num_par, parameter, J, taylor);
+            break;
+            case CSumOp:
+            forward_csum_op(
+                0, 0, i_var, arg, num_par, parameter, J, taylor, false
+            );
+            break;
+            case CosOp:
+            forward_cos_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case CoshOp:
+            forward_cosh_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case DivpvOp:
+            forward_divpv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case DivvpOp:
+            forward_divvp_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case DivvvOp:
+            forward_divvv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case ErfOp:
+            case ErfcOp:
+            forward_erf_op_0(op, i_var, arg, parameter, J, taylor);
+            break;
+            case ExpOp:
+            forward_exp_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case Expm1Op:
+            forward_expm1_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case Log1pOp:
+            forward_log1p_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case LogOp:
+            forward_log_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case MulpvOp:
+            forward_mulpv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case MulvvOp:
+            forward_mulvv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case NegOp:
+            forward_neg_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case ParOp:
+            forward_par_op_0(i_var, arg, num_par, parameter, J, taylor);
+            break;
+            case PowpvOp:
+            forward_powpv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case PowvpOp:
+            forward_powvp_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case PowvvOp:
+            forward_powvv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case SignOp:
+            forward_sign_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case SinOp:
+            forward_sin_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case SinhOp:
+            forward_sinh_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case SqrtOp:
+            forward_sqrt_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case SubpvOp:
+            forward_subpv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case SubvpOp:
+            forward_subvp_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case SubvvOp:
+            forward_subvv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case TanOp:
+            forward_tan_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case TanhOp:
+            forward_tanh_op_0(i_var, size_t(arg[0]), J, taylor);
+            break;
+            case ZmulpvOp:
+            forward_zmulpv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case ZmulvpOp:
+            forward_zmulvp_op_0(i_var, arg, parameter, J, taylor);
+            break;
+            case ZmulvvOp:
+            forward_zmulvv_op_0(i_var, arg, parameter, J, taylor);
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+            break;
+        }
+        return;
+    }
+    //
+    // orders p through q
+    size_t k;
+    switch( op )
+    {
+        case AbsOp:
+        forward_abs_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case AcosOp:
+        forward_acos_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case AcoshOp:
+        forward_acosh_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case AddpvOp:
+        forward_addpv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case AddvvOp:
+        forward_addvv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case AsinOp:
+        forward_asin_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case AsinhOp:
+        forward_asinh_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case AtanOp:
+        forward_atan_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case AtanhOp:
+        forward_atanh_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case CExpOp:
+        forward_cond_op(p, q, i_var, arg, num_par, parameter, J, taylor);
+        break;
+        case CSumOp:
+        forward_csum_op(
+            p, q, i_var, arg, num_par, parameter, J, taylor, false
+        );
+        break;
+        case CosOp:
+        forward_cos_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case CoshOp:
+        forward_cosh_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case DivpvOp:
+        forward_divpv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case DivvpOp:
+        forward_divvp_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case DivvvOp:
+        forward_divvv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case ErfOp:
+        case ErfcOp:
+        forward_erf_op(op, p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case ExpOp:
+        forward_exp_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case Expm1Op:
+        forward_expm1_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case Log1pOp:
+        forward_log1p_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case LogOp:
+        forward_log_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case MulpvOp:
+        forward_mulpv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case MulvvOp:
+        forward_mulvv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case NegOp:
+        forward_neg_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case ParOp:
+        k = p;
+        if( k == 0 )
+        {   forward_par_op_0(i_var, arg, num_par, parameter, J, taylor);
+            ++k;
+        }
+        while( k <= q )
+            taylor[ i_var * J + k++ ] = Base(0.0);
+        break;
+        case PowpvOp:
+        forward_powpv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case PowvpOp:
+        forward_powvp_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case PowvvOp:
+        forward_powvv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case SignOp:
+        forward_sign_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case SinOp:
+        forward_sin_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case SinhOp:
+        forward_sinh_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case SqrtOp:
+        forward_sqrt_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case SubpvOp:
+        forward_subpv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case SubvpOp:
+        forward_subvp_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case SubvvOp:
+        forward_subvv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case TanOp:
+        forward_tan_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case TanhOp:
+        forward_tanh_op(p, q, i_var, size_t(arg[0]), J, taylor);
+        break;
+        case ZmulpvOp:
+        forward_zmulpv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case ZmulvpOp:
+        forward_zmulvp_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+        case ZmulvvOp:
+        forward_zmulvv_op(p, q, i_var, arg, parameter, J, taylor);
+        break;
+
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+        break;
+    }
+    return;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
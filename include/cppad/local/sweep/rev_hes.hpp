@@ -96,6 +96,12 @@ they are used for temporary work space.
 
 \param not_used_rec_base
 Specifies RecBase for this call.
+
+\param cexp_select
+If this is not null, for each CExpOp with operator index i_op,
+(*cexp_select)[i_op] is zero (both branches), one (only if_true),
+or two (only if_false); i.e., which branch is included in the pattern.
+This is used to compute sparsity patterns that are local to a point.
 */
 
 template <class Addr, class Base, class Vector_set, class RecBase>
@@ -106,7 +112,8 @@ void rev_hes(
     const Vector_set&          for_jac_sparse,
     bool*                      RevJac,
     Vector_set&                rev_hes_sparse,
-    const RecBase&             not_used_rec_base
+    const RecBase&             not_used_rec_base,
+    const pod_vector<unsigned char>* cexp_select = nullptr
 )
 {
     // length of the parameter vector (used by CppAD assert macros)
@@ -302,7 +309,9 @@ void rev_hes(
 
             case CExpOp:
             reverse_sparse_hessian_cond_op(
-                i_var, arg, num_par, RevJac, rev_hes_sparse
+                i_var, arg, num_par, RevJac, rev_hes_sparse,
+                cexp_select == nullptr ?
+                    0 : size_t( (*cexp_select)[ itr.op_index() ] )
             );
             break;
             // ---------------------------------------------------
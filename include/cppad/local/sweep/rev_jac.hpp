@@ -32,6 +32,7 @@ $spell
     optimizer
     num
     setvec
+    cexp
 $$
 
 $section Reverse Mode Jacobian Sparsity Patterns$$
@@ -43,7 +44,8 @@ $codei%local::sweep::rev_jac(
     %n%                 ,
     %numvar%            ,
     %var_sparsity%      ,
-    %not_used_rec_base
+    %not_used_rec_base% ,
+    %cexp_select%
 )%$$
 
 $head Prototype$$
@@ -112,6 +114,14 @@ input pattern.
 $head not_used_rec_base$$
 Specifies $icode RecBase$$ for this call.
 
+$head cexp_select$$
+If this is null, both branches of each conditional expression are
+included in the sparsity patterns.
+Otherwise, for each $code CExpOp$$ with operator index $icode i_op$$,
+$codei%(*%cexp_select%)[%i_op%]%$$ is zero (both branches),
+one (only $icode if_true$$), or two (only $icode if_false$$).
+This is used to compute sparsity patterns that are local to a point.
+
 $end
 */
 
@@ -126,7 +136,8 @@ void rev_jac(
     size_t                     n                  ,
     size_t                     numvar             ,
     Vector_set&                var_sparsity       ,
-    const RecBase&             not_used_rec_base  )
+    const RecBase&             not_used_rec_base  ,
+    const pod_vector<unsigned char>* cexp_select = nullptr )
 // END_PROTOTYPE
 {
     size_t            i, j, k;
@@ -309,7 +320,9 @@ void rev_jac(
 
             case CExpOp:
             reverse_sparse_jacobian_cond_op(
-                dependency, i_var, arg, num_par, var_sparsity
+                dependency, i_var, arg, num_par, var_sparsity,
+                cexp_select == nullptr ?
+                    0 : size_t( (*cexp_select)[ itr.op_index() ] )
             );
             break;
             // ---------------------------------------------------
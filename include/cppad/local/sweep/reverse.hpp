@@ -14,6 +14,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 
 # include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/local/live_slot.hpp>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -48,6 +49,8 @@ is the number of independent variables on the tape.
 is the total number of variables on the tape.
 This is also equal to the number of rows in the matrix Taylor; i.e.,
 play->num_var_rec().
+If Iterator is live_iterator, this is the number of slots
+in the corresponding segment mapping (see live_slot::segment).
 
 \param play
 The information stored in play
@@ -144,7 +147,10 @@ In the case where the index is zero,
 the instruction corresponds to a parameter (not variable).
 
 \tparam Iterator
-This is either player::const_iteratoror player::const_subgraph_iterator.
+This is either player::const_iteratoror player::const_subgraph_iterator
+or live_iterator.
+In the live_iterator case, the rows of Taylor and Partial correspond to
+slots instead of variables.
 
 \param play_itr
 On input this is either play->end(), for the entire graph,
@@ -185,7 +191,10 @@ void reverse(
 )
 {
     // check numvar argument
-    CPPAD_ASSERT_UNKNOWN( play->num_var_rec() == numvar );
+    CPPAD_ASSERT_UNKNOWN(
+        play->num_var_rec() == numvar ||
+        ( std::is_same<Iterator, live_iterator>::value )
+    );
     CPPAD_ASSERT_UNKNOWN( numvar > 0 );
 
     // length of the parameter vector (used by CppAD assert macros)
@@ -201,22 +210,33 @@ void reverse(
     vector<Base>         atom_par_x;    // argument parameter values
     vector<ad_type_enum> atom_type_x;   // argument type
     vector<bool>         atom_sx;       // slect_x for this function call
-    vector<size_t>       atom_ix;       // variable indices for argument vector
-    vector<Base>         atom_tx;       // argument vector Taylor coefficients
-    vector<Base>         atom_ty;       // result vector Taylor coefficients
-    vector<Base>         atom_px;       // partials w.r.t argument vector
-    vector<Base>         atom_py;       // partials w.r.t. result vector
+    vector<const Base*>  atom_tx;       // argument Taylor coefficient rows
+    vector<const Base*>  atom_ty;       // result Taylor coefficient rows
+    vector<Base*>        atom_px;       // argument partial rows
+    vector<const Base*>  atom_py;       // result partial rows
+    vector<Base>         atom_par_tx;   // storage for parameter argument rows
+    vector<Base>         atom_par_px;   // storage for parameter argument rows
+    vector<Base>         atom_par_ty;   // storage for parameter result rows
+    vector<Base>         atom_par_py;   // storage for parameter result rows
+    vector<Base>         atom_wtx;      // work space for vector version
+    vector<Base>         atom_wty;      // work space for vector version
+    vector<Base>         atom_wpx;      // work space for vector version
+    vector<Base>         atom_wpy;      // work space for vector version
     //
     // information defined by atomic forward
     size_t atom_index=0, atom_old=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
     enum_atom_state atom_state = end_atom; // proper initialization
+    //
+    // type and pointer for the current atomic function (see play::atom_table)
+    size_t atom_type = 0;
+    void*  atom_ptr  = nullptr;
 
     // A vector with unspecified contents declared here so that operator
     // routines do not need to re-allocate it
     vector<Base> work;
 
     // temporary indices
-    size_t j, ell;
+    size_t ell;
 
     // Initialize
 # if CPPAD_REVERSE_TRACE
@@ -253,6 +273,11 @@ void reverse(
                 }
                 break;
 
+                case CSkipOp:
+                case CSumOp:
+                play_itr.correct_after_decrement(arg);
+                break;
+
                 default:
                 break;
             }
@@ -667,15 +692,21 @@ void reverse(
             {   atom_state = ret_atom;
                 atom_i     = atom_m;
                 atom_j     = atom_n;
+                play->atom_table().template get<RecBase>(
+                    atom_index, atom_type, atom_ptr
+                );
                 //
-                atom_ix.resize(atom_n);
                 atom_par_x.resize(atom_n);
                 atom_type_x.resize(atom_n);
                 atom_sx.resize(atom_n);
-                atom_tx.resize(atom_n * atom_k1);
-                atom_px.resize(atom_n * atom_k1);
-                atom_ty.resize(atom_m * atom_k1);
-                atom_py.resize(atom_m * atom_k1);
+                atom_tx.resize(atom_n);
+                atom_px.resize(atom_n);
+                atom_ty.resize(atom_m);
+                atom_py.resize(atom_m);
+                atom_par_tx.resize(atom_n * atom_k1);
+                atom_par_px.resize(atom_n * atom_k1);
+                atom_par_ty.resize(atom_m * atom_k1);
+                atom_par_py.resize(atom_m * atom_k1);
             }
             else
             {   CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
@@ -683,23 +714,25 @@ void reverse(
                 atom_state = end_atom;
                 //
                 // call atomic function for this operation
+                // (partials for variable arguments are added to Partial)
                 call_atomic_reverse<Base, RecBase>(
                     atom_par_x,
                     atom_type_x,
                     atom_sx,
                     atom_k,
                     atom_index,
+                    atom_type,
+                    atom_ptr,
                     atom_old,
-                    atom_tx,
-                    atom_ty,
-                    atom_px,
-                    atom_py
+                    atomic_view<const Base>(atom_tx.data(), atom_n, atom_k1),
+                    atomic_view<const Base>(atom_ty.data(), atom_m, atom_k1),
+                    atomic_view<Base>(atom_px.data(), atom_n, atom_k1),
+                    atomic_view<const Base>(atom_py.data(), atom_m, atom_k1),
+                    atom_wtx,
+                    atom_wty,
+                    atom_wpx,
+                    atom_wpy
                 );
-                for(j = 0; j < atom_n; j++) if( atom_ix[j] > 0 )
-                {   for(ell = 0; ell < atom_k1; ell++)
-                        Partial[atom_ix[j] * K + ell] +=
-                            atom_px[j * atom_k1 + ell];
-                }
             }
             break;
 
@@ -712,16 +745,19 @@ void reverse(
             CPPAD_ASSERT_UNKNOWN( size_t( arg[0] ) < num_par );
             //
             --atom_j;
-            atom_ix[atom_j]               = 0;
             atom_sx[atom_j]               = false;
             if( play->dyn_par_is()[ arg[0] ] )
                 atom_type_x[atom_j]       = dynamic_enum;
             else
                 atom_type_x[atom_j]       = constant_enum;
             atom_par_x[atom_j]            = parameter[ arg[0] ];
-            atom_tx[atom_j * atom_k1 + 0] = parameter[ arg[0] ];
-            for(ell = 1; ell < atom_k1; ell++)
-                atom_tx[atom_j * atom_k1 + ell] = Base(0.);
+            for(ell = 0; ell < atom_k1; ell++)
+            {   atom_par_tx[atom_j * atom_k1 + ell] = Base(0.);
+                atom_par_px[atom_j * atom_k1 + ell] = Base(0.);
+            }
+            atom_par_tx[atom_j * atom_k1 + 0] = parameter[ arg[0] ];
+            atom_tx[atom_j] = atom_par_tx.data() + atom_j * atom_k1;
+            atom_px[atom_j] = atom_par_px.data() + atom_j * atom_k1;
             //
             if( atom_j == 0 )
                 atom_state = start_atom;
@@ -735,13 +771,11 @@ void reverse(
             CPPAD_ASSERT_UNKNOWN( atom_j <= atom_n );
             //
             --atom_j;
-            atom_ix[atom_j]     = size_t( arg[0] );
             atom_sx[atom_j]     = true;
             atom_type_x[atom_j] = variable_enum;
             atom_par_x[atom_j] = CppAD::numeric_limits<Base>::quiet_NaN();
-            for(ell = 0; ell < atom_k1; ell++)
-                atom_tx[atom_j*atom_k1 + ell] =
-                    Taylor[ size_t(arg[0]) * J + ell];
+            atom_tx[atom_j]     = Taylor  + size_t(arg[0]) * J;
+            atom_px[atom_j]     = Partial + size_t(arg[0]) * K;
             //
             if( atom_j == 0 )
                 atom_state = start_atom;
@@ -757,10 +791,12 @@ void reverse(
             //
             --atom_i;
             for(ell = 0; ell < atom_k1; ell++)
-            {   atom_py[atom_i * atom_k1 + ell] = Base(0.);
-                atom_ty[atom_i * atom_k1 + ell] = Base(0.);
+            {   atom_par_py[atom_i * atom_k1 + ell] = Base(0.);
+                atom_par_ty[atom_i * atom_k1 + ell] = Base(0.);
             }
-            atom_ty[atom_i * atom_k1 + 0] = parameter[ arg[0] ];
+            atom_par_ty[atom_i * atom_k1 + 0] = parameter[ arg[0] ];
+            atom_ty[atom_i] = atom_par_ty.data() + atom_i * atom_k1;
+            atom_py[atom_i] = atom_par_py.data() + atom_i * atom_k1;
             //
             if( atom_i == 0 )
                 atom_state = arg_atom;
@@ -774,12 +810,8 @@ void reverse(
             CPPAD_ASSERT_UNKNOWN( atom_j == atom_n );
             //
             --atom_i;
-            for(ell = 0; ell < atom_k1; ell++)
-            {   atom_py[atom_i * atom_k1 + ell] =
-                        Partial[i_var * K + ell];
-                atom_ty[atom_i * atom_k1 + ell] =
-                        Taylor[i_var * J + ell];
-            }
+            atom_ty[atom_i] = Taylor  + i_var * J;
+            atom_py[atom_i] = Partial + i_var * K;
             if( atom_i == 0 )
                 atom_state = arg_atom;
             break;
@@ -0,0 +1,289 @@
+# ifndef CPPAD_LOCAL_SWEEP_REVERSE_LEVEL_HPP
+# define CPPAD_LOCAL_SWEEP_REVERSE_LEVEL_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/level_schedule.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/reverse_level.hpp
+Reverse mode for one operator in a level_schedule.
+*/
+
+/*!
+Compute reverse mode partial derivatives for one operator.
+
+\tparam Base
+The type used during the reverse mode computations.
+
+\param d
+is the highest order Taylor coefficient that we are computing
+partial derivatives with respect to.
+
+\param op
+is the operator; see level_schedule for the operators that are supported.
+
+\param i_var
+is the index of the primary result for this operator.
+
+\param arg
+is the argument vector for this operator.
+
+\param num_par
+is the number of parameters in the recording.
+
+\param parameter
+is the parameter vector for the recording.
+
+\param J
+is the number of Taylor coefficients (orders) stored for each variable.
+
+\param taylor
+is the Taylor coefficient matrix.
+
+\param K
+is the number of partial derivatives (orders) stored for each variable.
+
+\param partial
+On input, the partials with respect to the results of this operator
+are complete. On output, the partials with respect to the arguments of
+this operator have been incremented by the contribution of this operator.
+The rows of this matrix for the arguments may be private copies that are
+only used by the calling task; see ADFun::reverse_level.
+
+\param work
+is work space for the operators that need it.
+*/
+template <class Base>
+void reverse_level_op(
+    size_t        d          ,
+    OpCode        op         ,
+    size_t        i_var      ,
+    const addr_t* arg        ,
+    size_t        num_par    ,
+    const Base*   parameter  ,
+    size_t        J          ,
+    const Base*   taylor     ,
+    size_t        K          ,
+    Base*         partial    ,
+    vector<Base>& work       )
+{   CPPAD_ASSERT_UNKNOWN( d < J );
+    CPPAD_ASSERT_UNKNOWN( d < K );
+    switch( op )
+    {
+            case AbsOp:
+            reverse_abs_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case AcosOp:
+            reverse_acos_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case AcoshOp:
+            reverse_acosh_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case AddpvOp:
+            reverse_addpv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case AddvvOp:
+            reverse_addvv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case AsinOp:
+            reverse_asin_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case AsinhOp:
+            reverse_asinh_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case AtanOp:
+            reverse_atan_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case AtanhOp:
+            reverse_atanh_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case CExpOp:
+            reverse_cond_op(
+                d, i_var, arg, num_par, parameter, J, taylor, K, partial
+            );
+            break;
+            case CSumOp:
+            reverse_csum_op(d, i_var, arg, K, partial);
+            break;
+            case CosOp:
+            reverse_cos_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case CoshOp:
+            reverse_cosh_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case DivpvOp:
+            reverse_divpv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case DivvpOp:
+            reverse_divvp_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case DivvvOp:
+            reverse_divvv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case ErfOp:
+            case ErfcOp:
+            reverse_erf_op(
+                op, d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case ExpOp:
+            reverse_exp_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case Expm1Op:
+            reverse_expm1_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case Log1pOp:
+            reverse_log1p_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case LogOp:
+            reverse_log_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case MulpvOp:
+            reverse_mulpv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case MulvvOp:
+            reverse_mulvv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case NegOp:
+            reverse_neg_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case ParOp:
+            break;
+            case PowpvOp:
+            reverse_powpv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case PowvpOp:
+            reverse_powvp_op(
+                d, i_var, arg, parameter, J, taylor, K, partial, work
+            );
+            break;
+            case PowvvOp:
+            reverse_powvv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case SignOp:
+            reverse_sign_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case SinOp:
+            reverse_sin_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case SinhOp:
+            reverse_sinh_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case SqrtOp:
+            reverse_sqrt_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case SubpvOp:
+            reverse_subpv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case SubvpOp:
+            reverse_subvp_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case SubvvOp:
+            reverse_subvv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case TanOp:
+            reverse_tan_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case TanhOp:
+            reverse_tanh_op(
+                d, i_var, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+            case ZmulpvOp:
+            reverse_zmulpv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case ZmulvpOp:
+            reverse_zmulvp_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            case ZmulvvOp:
+            reverse_zmulvv_op(
+                d, i_var, arg, parameter, J, taylor, K, partial
+            );
+            break;
+            default:
+            CPPAD_ASSERT_UNKNOWN(false);
+    }
+    return;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
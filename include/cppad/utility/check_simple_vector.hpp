@@ -1,7 +1,7 @@
 # ifndef CPPAD_UTILITY_CHECK_SIMPLE_VECTOR_HPP
 # define CPPAD_UTILITY_CHECK_SIMPLE_VECTOR_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -97,6 +97,7 @@ $end
 */
 
 # include <cstddef>
+# include <atomic>
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/local/define.hpp>
 # include <cppad/utility/thread_alloc.hpp>
@@ -120,10 +121,10 @@ namespace CppAD {
     template <class Scalar, class Vector>
     void CheckSimpleVector(const Scalar& x, const Scalar& y)
     {   CPPAD_ASSERT_FIRST_CALL_NOT_PARALLEL
-        static size_t count;
-        if( count > 0  )
+        // only the first thread to get here does the check
+        static std::atomic<bool> checked(false);
+        if( checked.exchange(true) )
             return;
-        count++;
 
         // value_type must be type of elements of Vector
         typedef typename Vector::value_type value_type;
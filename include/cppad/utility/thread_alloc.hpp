@@ -1,7 +1,7 @@
 # ifndef CPPAD_UTILITY_THREAD_ALLOC_HPP
 # define CPPAD_UTILITY_THREAD_ALLOC_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-21 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -15,6 +15,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <sstream>
 # include <limits>
 # include <memory>
+# include <atomic>
 
 
 # ifdef _MSC_VER
@@ -115,10 +116,14 @@ private:
         size_t             tc_index_;
         /// pointer to the next memory allocation with the same tc_index_
         void*              next_;
+        /// pointer to the next memory allocation in the remote list
+        /// for the thread that owns this allocation (see remote_root)
+        void*              next_remote_;
         // -----------------------------------------------------------------
         /// make default constructor private. It is only used by constructor
         /// for `root arrays below.
-        block_t(void) : extra_(0), tc_index_(0), next_(nullptr)
+        block_t(void)
+        : extra_(0), tc_index_(0), next_(nullptr), next_remote_(nullptr)
         { }
     };
 
@@ -136,6 +141,14 @@ private:
         size_t  count_inuse_;
         /// count of inuse bytes for this thread
         size_t  count_available_;
+        /// number of get_memory calls for each capacity that used
+        /// memory that was available for this thread
+        size_t  count_hit_[CPPAD_MAX_NUM_CAPACITY];
+        /// number of get_memory calls for each capacity that
+        /// used the system allocator
+        size_t  count_miss_[CPPAD_MAX_NUM_CAPACITY];
+        /// number of blocks available for this thread and each capacity
+        size_t  count_held_[CPPAD_MAX_NUM_CAPACITY];
         /// root of available list for this thread and each capacity
         block_t root_available_[CPPAD_MAX_NUM_CAPACITY];
         /*!
@@ -237,6 +250,9 @@ private:
             for(size_t c = 0; c < CPPAD_MAX_NUM_CAPACITY; c++)
             {   info->root_inuse_[c].next_       = nullptr;
                 info->root_available_[c].next_   = nullptr;
+                info->count_hit_[c]              = 0;
+                info->count_miss_[c]             = 0;
+                info->count_held_[c]             = 0;
             }
             info->count_inuse_     = 0;
             info->count_available_ = 0;
@@ -245,6 +261,26 @@ private:
     }
     // -----------------------------------------------------------------------
     /*!
+    Root of the remote list for a thread.
+
+    \param thread [in]
+    is the thread that owns the memory in this list.
+
+    \return
+    The remote list contains memory that was allocated by thread
+    and returned by a different thread during parallel execution.
+    It is linked using the next_remote_ field of each block.
+    Other threads push onto this list without a lock and only
+    the owning thread (or sequential execution) removes elements.
+    */
+    static std::atomic<void*>* remote_root(size_t thread)
+    {   // zero initialized because it has static storage duration
+        static std::atomic<void*> root[CPPAD_MAX_NUM_THREADS];
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
+        return root + thread;
+    }
+    // -----------------------------------------------------------------------
+    /*!
     Increase the number of bytes of memory that are currently in use; i.e.,
     that been obtained with get_memory and not yet returned.
 
@@ -259,7 +295,7 @@ private:
     */
     static void inc_inuse(size_t inc, size_t thread)
     {
-        CPPAD_ASSERT_UNKNOWN( thread < num_threads() );
+        CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
         CPPAD_ASSERT_UNKNOWN(
             thread == thread_num() || (! in_parallel())
         );
@@ -338,6 +374,108 @@ private:
         info->count_available_ =  info->count_available_ - dec;
     }
 
+    // -----------------------------------------------------------------------
+    /*!
+    Return a node to the pool for the thread that owns it.
+
+    \param node [in]
+    is the block_t information at the front of the memory allocation.
+
+    \param thread [in]
+    is the thread that owns the memory.
+    We must either be in sequential (not parallel) execution mode,
+    or thread must be the current thread.
+
+    \param c_index [in]
+    is the capacity index for this allocation.
+    */
+    static void return_node(block_t* node, size_t thread, size_t c_index)
+    {   size_t capacity  = capacity_info()->value[c_index];
+        CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        thread_alloc_info* info = thread_info(thread);
+# ifndef NDEBUG
+        void* v_ptr      = reinterpret_cast<void*>(node + 1);
+# ifndef CPPAD_DEBUG_AND_RELEASE
+        // remove node from inuse list
+        void* v_node         = reinterpret_cast<void*>(node);
+        block_t* inuse_root  = info->root_inuse_ + c_index;
+        block_t* previous    = inuse_root;
+        while( (previous->next_ != nullptr) & (previous->next_ != v_node) )
+            previous = reinterpret_cast<block_t*>(previous->next_);
+
+        // check that v_ptr is valid
+        if( previous->next_ != v_node )
+        {   using std::endl;
+            std::ostringstream oss;
+            oss << "return_memory: attempt to return memory not in use";
+            oss << endl;
+            oss << "v_ptr    = " << v_ptr    << endl;
+            oss << "thread   = " << thread   << endl;
+            oss << "capacity = " << capacity << endl;
+            oss << "See CPPAD_TRACE_THREAD & CPPAD_TRACE_CAPACITY in";
+            oss << endl << "# include <cppad/utility/thread_alloc.hpp>" << endl;
+            // oss.str() returns a string object with a copy of the current
+            // contents in the stream buffer.
+            std::string msg_str       = oss.str();
+            // msg_str.c_str() returns a pointer to the c-string
+            // representation of the string object's value.
+            const char* msg_char_star = msg_str.c_str();
+            CPPAD_ASSERT_KNOWN(false, msg_char_star );
+        }
+        // remove v_ptr from inuse list
+        previous->next_  = node->next_;
+# endif
+        // trace option
+        if( capacity==CPPAD_TRACE_CAPACITY && thread==CPPAD_TRACE_THREAD )
+        {   std::cout << "return_memory: v_ptr = " << v_ptr << std::endl; }
+
+# endif
+        // capacity bytes are removed from the inuse pool
+        dec_inuse(capacity, thread);
+
+        // check for case where we just return the memory to the system
+        if( ! set_get_hold_memory(false) )
+        {   ::operator delete( reinterpret_cast<void*>(node) );
+            return;
+        }
+
+        // add this node to available list for this thread and capacity
+        block_t* available_root = info->root_available_ + c_index;
+        node->next_             = available_root->next_;
+        available_root->next_   = reinterpret_cast<void*>(node);
+
+        // capacity bytes are added to the available pool
+        inc_available(capacity, thread);
+        ++info->count_held_[c_index];
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    Return the memory in the remote list for a thread to its pool.
+
+    \param thread [in]
+    is the thread that owns the memory in the remote list.
+    We must either be in sequential (not parallel) execution mode,
+    or thread must be the current thread.
+    */
+    static void drain_remote(size_t thread)
+    {   std::atomic<void*>* root = remote_root(thread);
+        if( root->load(std::memory_order_relaxed) == nullptr )
+            return;
+        CPPAD_ASSERT_UNKNOWN(
+            thread == thread_num() || (! in_parallel())
+        );
+        size_t num_cap = capacity_info()->number;
+        void* v_node   = root->exchange(nullptr, std::memory_order_acquire);
+        while( v_node != nullptr )
+        {   block_t* node  = reinterpret_cast<block_t*>(v_node);
+            v_node         = node->next_remote_;
+            size_t c_index = node->tc_index_ % num_cap;
+            CPPAD_ASSERT_UNKNOWN( node->tc_index_ / num_cap == thread );
+            return_node(node, thread, c_index);
+        }
+    }
     // ----------------------------------------------------------------------
     /*!
     Set and get the number of threads that are sharing memory.
@@ -364,14 +502,96 @@ private:
 
         return number_user;
     }
+    // -----------------------------------------------------------------------
+    /*!
+    Bit vector with one bit for each thread number used by default_thread.
+
+    \return
+    Bit j of element k is one if thread number
+    k * 8 * sizeof(size_t) + j is in use by some thread.
+    This array has (CPPAD_MAX_NUM_THREADS + 8 * sizeof(size_t) - 1)
+    / ( 8 * sizeof(size_t) ) elements.
+    */
+    static std::atomic<size_t>* default_thread_in_use(void)
+    {   const size_t n_bit  = 8 * sizeof(size_t);
+        const size_t n_word = (CPPAD_MAX_NUM_THREADS + n_bit - 1) / n_bit;
+        static std::atomic<size_t> in_use[n_word];
+        return in_use;
+    }
+    /// Releases a default thread number when the thread exits.
+    class default_thread_release {
+    private:
+        const size_t thread_;
+    public:
+        default_thread_release(size_t thread) : thread_(thread)
+        { }
+        ~default_thread_release(void)
+        {   const size_t n_bit = 8 * sizeof(size_t);
+            size_t bit = size_t(1) << (thread_ % n_bit);
+            default_thread_in_use()[thread_ / n_bit].fetch_and(
+                ~bit, std::memory_order_acq_rel
+            );
+        }
+    };
+    /*!
+    Thread number used when parallel_setup has not specified thread_num.
+
+    \return
+    The first time this routine is called by a thread, the smallest
+    thread number that is not in use by another thread is chosen.
+    Thereafter, the same value is returned for the this thread.
+    The thread number is released for use by other threads when this
+    thread exits.
+    */
+    static size_t default_thread(void)
+    {   // thread_plus_one is constant initialized so access is fast
+        static thread_local size_t thread_plus_one = 0;
+        if( thread_plus_one != 0 )
+            return thread_plus_one - 1;
+        //
+        // search for a thread number that is not in use
+        const size_t n_bit      = 8 * sizeof(size_t);
+        std::atomic<size_t>* in_use = default_thread_in_use();
+        for(size_t k = 0; k * n_bit < CPPAD_MAX_NUM_THREADS; ++k)
+        {   size_t word = in_use[k].load(std::memory_order_acquire);
+            size_t j    = 0;
+            while( j < n_bit && k * n_bit + j < CPPAD_MAX_NUM_THREADS )
+            {   size_t bit = size_t(1) << j;
+                if( word & bit )
+                    ++j;
+                else if( in_use[k].compare_exchange_weak(
+                    word, word | bit, std::memory_order_acq_rel
+                ) )
+                {   // this thread now owns thread number k * n_bit + j
+                    size_t thread   = k * n_bit + j;
+                    thread_plus_one = thread + 1;
+                    static thread_local default_thread_release release(thread);
+                    return thread;
+                }
+                // word has changed, check bit j again
+            }
+        }
+        CPPAD_ASSERT_KNOWN( false,
+            "thread_alloc: more than CPPAD_MAX_NUM_THREADS threads are using "
+            "CppAD without parallel_setup"
+        );
+        return 0;
+    }
+    // -----------------------------------------------------------------------
+    /// reference to the thread_num routine set by parallel_setup
+    /// (nullptr if default_thread is being used)
+    static size_t (*&thread_num_user_ref(void))(void)
+    {   static size_t (*thread_num_user)(void) = nullptr;
+        return thread_num_user;
+    }
     /*!
     Set and call the routine that determine the current thread number.
 
     \return
     returns value for the most recent setting for thread_num_new.
-    If set is true,
-    or the most recent setting is nullptr (its initial value),
-    the return value is zero.
+    If set is true, the return value is zero.
+    If the most recent setting is nullptr (its initial value),
+    the return value is default_thread().
     Otherwise the routine corresponding to the most recent setting
     is called and its value returned by set_get_thread_num.
 
@@ -387,7 +607,7 @@ private:
     static size_t set_get_thread_num(
         size_t (*thread_num_new)(void)  ,
         bool set = false                )
-    {   static size_t (*thread_num_user)(void) = nullptr;
+    {   size_t (*&thread_num_user)(void) = thread_num_user_ref();
 
         if( set )
         {   thread_num_user = thread_num_new;
@@ -395,7 +615,7 @@ private:
         }
 
         if( thread_num_user == nullptr )
-            return 0;
+            return default_thread();
 
         size_t thread = thread_num_user();
         CPPAD_ASSERT_KNOWN(
@@ -427,6 +647,19 @@ By default there is only one thread and all execution is in sequential mode,
 i.e., multiple threads are not sharing the same memory; i.e.
 not in parallel mode.
 
+$head Default Thread Numbers$$
+If $code parallel_setup$$ has not been called,
+or it was last called with $icode%num_threads% == 1%$$,
+the $cref/thread number/ta_thread_num/$$ is determined
+by $code thread_alloc$$ using thread local storage.
+The first time a thread calls $code thread_num$$ it is given the smallest
+thread number that is not in use by another thread
+(this is usually zero for the main thread).
+A thread's number is released for use by other threads when it exits.
+This enables threads, e.g. $code std::thread$$ objects,
+to record and use AD operations without any setup;
+see $cref/without parallel_setup/multi_thread/Without parallel_setup/$$.
+
 $head Speed$$
 It should be faster, even when $icode num_thread$$ is equal to one,
 for $code thread_alloc$$ to hold onto memory.
@@ -663,6 +896,10 @@ $codei%
     size_t %thread%
 %$$
 and is the currently executing thread number.
+If $cref/parallel_setup/ta_parallel_setup/$$ has not specified
+a $icode thread_num$$ routine, this is the
+$cref/default thread number/ta_parallel_setup/Default Thread Numbers/$$
+for the current thread.
 
 $head Example$$
 $cref thread_alloc.cpp$$
@@ -789,6 +1026,9 @@ $end
         size_t tc_index          = thread * num_cap + c_index;
         thread_alloc_info* info  = thread_info(thread);
 
+        // memory for this thread that was returned by other threads
+        drain_remote(thread);
+
 # ifndef NDEBUG
         // trace allocation
         static bool first_trace = true;
@@ -836,6 +1076,8 @@ $end
             // adjust counts
             inc_inuse(cap_bytes, thread);
             dec_available(cap_bytes, thread);
+            ++info->count_hit_[c_index];
+            --info->count_held_[c_index];
 
             // return pointer to memory, do not inclue thread_alloc information
             return v_ptr;
@@ -865,6 +1107,7 @@ $end
 
         // adjust counts
         inc_inuse(cap_bytes, thread);
+        ++info->count_miss_[c_index];
 
         return v_ptr;
     }
@@ -899,10 +1142,17 @@ obtained by a previous call to
 $cref/get_memory/ta_get_memory/$$ and not yet returned.
 
 $head Thread$$
-Either the $cref/current thread/ta_thread_num/$$ must be the same as during
-the corresponding call to $cref/get_memory/ta_get_memory/$$,
-or the current execution mode must be sequential
-(not $cref/parallel/ta_in_parallel/$$).
+The memory is returned to the pool for the thread that was
+$cref/current/ta_thread_num/$$ during the corresponding call to
+$cref/get_memory/ta_get_memory/$$.
+If the current execution mode is $cref/parallel/ta_in_parallel/$$,
+or $cref/default thread numbers/ta_parallel_setup/Default Thread Numbers/$$
+are being used, and the current thread is different,
+the memory is placed in a lock free list for the other thread.
+It is moved to the pool for that thread the next time that thread calls
+$code get_memory$$, $code inuse$$, $code available$$,
+or $code free_available$$.
+Until then, it is counted as in use by the other thread.
 
 $head NDEBUG$$
 If $code NDEBUG$$ is defined, $icode v_ptr$$ is not checked (this is faster).
@@ -926,9 +1176,9 @@ $end
     After this call, this pointer will available (and not in use).
 
     \par
-    We must either be in sequential (not parallel) execution mode,
-    or the current thread must be the same as for the corresponding call
-    to get_memory.
+    If we are in parallel execution mode and the current thread is not the
+    same as for the corresponding call to get_memory, the memory is placed
+    in the remote list for the thread that called get_memory.
     */
     static void return_memory(void* v_ptr)
     {   size_t num_cap   = capacity_info()->number;
@@ -937,68 +1187,27 @@ $end
         size_t tc_index  = node->tc_index_;
         size_t thread    = tc_index / num_cap;
         size_t c_index   = tc_index % num_cap;
-        size_t capacity  = capacity_info()->value[c_index];
 
         CPPAD_ASSERT_UNKNOWN( thread < CPPAD_MAX_NUM_THREADS );
-        CPPAD_ASSERT_KNOWN(
-            thread == thread_num() || (! in_parallel()),
-            "Attempt to return memory for a different thread "
-            "while in parallel mode"
-        );
-
-        thread_alloc_info* info = thread_info(thread);
-# ifndef NDEBUG
-# ifndef CPPAD_DEBUG_AND_RELEASE
-        // remove node from inuse list
-        void* v_node         = reinterpret_cast<void*>(node);
-        block_t* inuse_root  = info->root_inuse_ + c_index;
-        block_t* previous    = inuse_root;
-        while( (previous->next_ != nullptr) & (previous->next_ != v_node) )
-            previous = reinterpret_cast<block_t*>(previous->next_);
-
-        // check that v_ptr is valid
-        if( previous->next_ != v_node )
-        {   using std::endl;
-            std::ostringstream oss;
-            oss << "return_memory: attempt to return memory not in use";
-            oss << endl;
-            oss << "v_ptr    = " << v_ptr    << endl;
-            oss << "thread   = " << thread   << endl;
-            oss << "capacity = " << capacity << endl;
-            oss << "See CPPAD_TRACE_THREAD & CPPAD_TRACE_CAPACITY in";
-            oss << endl << "# include <cppad/utility/thread_alloc.hpp>" << endl;
-            // oss.str() returns a string object with a copy of the current
-            // contents in the stream buffer.
-            std::string msg_str       = oss.str();
-            // msg_str.c_str() returns a pointer to the c-string
-            // representation of the string object's value.
-            const char* msg_char_star = msg_str.c_str();
-            CPPAD_ASSERT_KNOWN(false, msg_char_star );
-        }
-        // remove v_ptr from inuse list
-        previous->next_  = node->next_;
-# endif
-        // trace option
-        if( capacity==CPPAD_TRACE_CAPACITY && thread==CPPAD_TRACE_THREAD )
-        {   std::cout << "return_memory: v_ptr = " << v_ptr << std::endl; }
-
-# endif
-        // capacity bytes are removed from the inuse pool
-        dec_inuse(capacity, thread);
-
-        // check for case where we just return the memory to the system
-        if( ! set_get_hold_memory(false) )
-        {   ::operator delete( reinterpret_cast<void*>(node) );
+        //
+        // other threads may be running if we are in parallel mode
+        // or if the default thread numbers are being used
+        bool other_running =
+            in_parallel() || thread_num_user_ref() == nullptr;
+        if( other_running && thread != thread_num() )
+        {   // Push this node onto the remote list for the thread that owns it.
+            // It is returned to that thread's pool by drain_remote.
+            std::atomic<void*>* root = remote_root(thread);
+            void* v_node = reinterpret_cast<void*>(node);
+            void* head   = root->load(std::memory_order_relaxed);
+            do
+                node->next_remote_ = head;
+            while( ! root->compare_exchange_weak(
+                head, v_node, std::memory_order_release, std::memory_order_relaxed
+            ) );
             return;
         }
-
-        // add this node to available list for this thread and capacity
-        block_t* available_root = info->root_available_ + c_index;
-        node->next_             = available_root->next_;
-        available_root->next_   = reinterpret_cast<void*>(node);
-
-        // capacity bytes are added to the available pool
-        inc_available(capacity, thread);
+        return_node(node, thread, c_index);
     }
 /* -----------------------------------------------------------------------
 $begin ta_free_available$$
@@ -1065,11 +1274,13 @@ $end
         size_t num_cap = capacity_info()->number;
         if( num_cap == 0 )
             return;
+        drain_remote(thread);
         const size_t*     capacity_vec  = capacity_info()->value;
         size_t c_index;
         thread_alloc_info* info = thread_info(thread);
         for(c_index = 0; c_index < num_cap; c_index++)
         {   size_t capacity = capacity_vec[c_index];
+            info->count_held_[c_index] = 0;
             block_t* available_root = info->root_available_ + c_index;
             void* v_ptr             = available_root->next_;
             while( v_ptr != nullptr )
@@ -1192,6 +1403,7 @@ $end
         CPPAD_ASSERT_UNKNOWN(
             thread == thread_num() || (! in_parallel())
         );
+        drain_remote(thread);
         thread_alloc_info* info = thread_info(thread);
         return info->count_inuse_;
     }
@@ -1246,10 +1458,171 @@ $end
         CPPAD_ASSERT_UNKNOWN(
             thread == thread_num() || (! in_parallel())
         );
+        drain_remote(thread);
         thread_alloc_info* info = thread_info(thread);
         return info->count_available_;
     }
 /* -----------------------------------------------------------------------
+$begin ta_capacity_stat$$
+$spell
+    num
+    thread_alloc
+    cap
+    const
+$$
+
+$section Memory Pool Statistics for Each Capacity$$
+
+$head Syntax$$
+$icode%num_cap% = thread_alloc::num_capacity()
+%$$
+$codei%thread_alloc::capacity_stat(
+    %thread%, %c_index%, %cap_bytes%, %num_hit%, %num_miss%, %held_bytes%
+)%$$
+
+$head Purpose$$
+The memory managed by $cref thread_alloc$$ is divided into pools
+for each thread and for a fixed set of capacities.
+These statistics can be used to see how well the pools are working;
+e.g., how often a $cref/get_memory/ta_get_memory/$$ request is satisfied
+by memory that is already held for the thread.
+
+$head num_cap$$
+This return value has prototype
+$codei%
+    size_t %num_cap%
+%$$
+and is the number of different capacities
+(the same for every thread).
+
+$head thread$$
+This argument has prototype
+$codei%
+    size_t %thread%
+%$$
+Either $cref/thread_num/ta_thread_num/$$ must be the same as $icode thread$$,
+or the current execution mode must be sequential
+(not $cref/parallel/ta_in_parallel/$$).
+
+$head c_index$$
+This argument has prototype
+$codei%
+    size_t %c_index%
+%$$
+and must be less than $icode num_cap$$.
+The capacities are in increasing order with respect to $icode c_index$$.
+
+$head cap_bytes$$
+This argument has prototype
+$codei%
+    size_t& %cap_bytes%
+%$$
+The input value does not matter.
+Upon return, it is the number of bytes for the capacity
+corresponding to $icode c_index$$.
+
+$head num_hit$$
+This argument has prototype
+$codei%
+    size_t& %num_hit%
+%$$
+The input value does not matter.
+Upon return, it is the number of calls to $code get_memory$$
+by the specified thread, with this capacity,
+that used memory that was held for the thread.
+
+$head num_miss$$
+This argument has prototype
+$codei%
+    size_t& %num_miss%
+%$$
+The input value does not matter.
+Upon return, it is the number of calls to $code get_memory$$
+by the specified thread, with this capacity,
+that required memory from the system.
+
+$head held_bytes$$
+This argument has prototype
+$codei%
+    size_t& %held_bytes%
+%$$
+The input value does not matter.
+Upon return, it is the number of bytes, with this capacity,
+that are currently $cref/available/ta_available/$$
+for use by the specified thread.
+Summing $icode held_bytes$$ over all the capacities for a thread
+gives the value of $codei%available(%thread%)%$$.
+
+$head Reset$$
+These statistics are set to zero when all the memory for the thread
+is returned to the system; i.e., when
+$cref/free_available/ta_free_available/$$ is called for the thread and
+$cref/inuse/ta_inuse/$$ is zero for the thread.
+
+$head Example$$
+$cref thread_alloc.cpp$$
+
+$end
+*/
+    /*!
+    Number of different capacities.
+
+    \return
+    number of capacities in capacity_info()->value.
+    */
+    static size_t num_capacity(void)
+    {   return capacity_info()->number; }
+    /*!
+    Memory pool statistics for one thread and capacity.
+
+    \param thread [in]
+    Thread for which we are determining the statistics.
+    We must either be in sequential (not parallel) execution mode,
+    or thread must be the current thread.
+
+    \param c_index [in]
+    Index in capacity_info()->value for the capacity.
+
+    \param cap_bytes [out]
+    number of bytes for this capacity.
+
+    \param num_hit [out]
+    number of get_memory requests that used memory held for this thread.
+
+    \param num_miss [out]
+    number of get_memory requests that used memory from the system.
+
+    \param held_bytes [out]
+    number of bytes held in the available pool for this thread and capacity.
+    */
+    static void capacity_stat(
+        size_t  thread     ,
+        size_t  c_index    ,
+        size_t& cap_bytes  ,
+        size_t& num_hit    ,
+        size_t& num_miss   ,
+        size_t& held_bytes )
+    {   CPPAD_ASSERT_KNOWN(
+            thread < CPPAD_MAX_NUM_THREADS,
+            "capacity_stat: thread >= CPPAD_MAX_NUM_THREADS"
+        );
+        CPPAD_ASSERT_KNOWN(
+            thread == thread_num() || (! in_parallel()),
+            "capacity_stat: thread is not current thread "
+            "and in parallel mode"
+        );
+        CPPAD_ASSERT_KNOWN(
+            c_index < capacity_info()->number,
+            "capacity_stat: c_index >= num_capacity()"
+        );
+        drain_remote(thread);
+        thread_alloc_info* info = thread_info(thread);
+        cap_bytes  = capacity_info()->value[c_index];
+        num_hit    = info->count_hit_[c_index];
+        num_miss   = info->count_miss_[c_index];
+        held_bytes = info->count_held_[c_index] * cap_bytes;
+    }
+/* -----------------------------------------------------------------------
 $begin ta_create_array$$
 $spell
     inuse
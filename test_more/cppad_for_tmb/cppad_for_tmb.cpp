@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -18,6 +18,9 @@ extern bool multi_atomic_two(void);
 extern bool multi_atomic_three(void);
 extern bool multi_chkpoint_one(void);
 extern bool multi_chkpoint_two(void);
+extern bool no_setup_thread(void);
+extern bool share_recording_thread(void);
+extern bool thread_alloc_remote(void);
 
 int main(void)
 {   std::string group = "test_more/cppad_for_tmb";
@@ -32,6 +35,9 @@ int main(void)
     Run( multi_atomic_three,       "multi_atomic_three"     );
     Run( multi_chkpoint_one,       "multi_chkpoint_one"     );
     Run( multi_chkpoint_two,       "multi_chkpoint_two"     );
+    Run( no_setup_thread,          "no_setup_thread"        );
+    Run( share_recording_thread,   "share_recording_thread" );
+    Run( thread_alloc_remote,      "thread_alloc_remote"    );
 
     // check for memory leak
     bool memory_ok = CppAD::thread_alloc::free_all();
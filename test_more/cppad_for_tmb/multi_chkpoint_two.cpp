@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -58,46 +58,60 @@ bool multi_chkpoint_two(void)
     long_sum_algo(ax, ay);
     CppAD::ADFun<double> fun(ax, ay);
 
-    // create chkpoint_two version of algorithm
-    const char* name      = "long_sum";
-    bool internal_bool    = false;
-    bool use_hes_sparsity = false;
-    bool use_base2ad      = false;
-    bool use_in_parallel  = true;
-    CppAD::chkpoint_two<double> chk_fun( fun, name,
-        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
-    );
     // setup for using CppAD in paralle mode
     CppAD::thread_alloc::parallel_setup(num_threads, in_parallel, thread_num);
     CppAD::thread_alloc::hold_memory(true);
     CppAD::parallel_ad<double>();
 
-    // place to hold result for each thread
-    d_vector y(num_threads);
-    for(size_t thread = 0; thread < num_threads; thread++)
-        y[thread] = 0.0;
-
-    # pragma omp parallel for
-    for(int thread = 0; thread < int(num_threads); thread++)
-    {   ad_vector au(n), av(m);
-        au[0] = 1.0;
-        CppAD::Independent(au);
-        chk_fun(au, av);
-        CppAD::ADFun<double> f(au, av);
-        //
-        d_vector x(n), v(m);
-        x[0]      = double( thread + 1 );
-        v         = f.Forward(0, x);
-        //
-        // this assigment has false sharing; i.e., will case cache resets
-        // (conversion avoids boost vector conversion warning)
-        y[size_t(thread)] = v[0];
-    }
+    // without and with the checkpoint function optimizing its recording
+    for(size_t i_opt = 0; i_opt < 2; ++i_opt)
+    {
+        // create chkpoint_two version of algorithm
+        // (all the threads share the operation sequence in chk_fun)
+        const char* name      = "long_sum";
+        bool internal_bool    = false;
+        bool use_hes_sparsity = false;
+        bool use_base2ad      = false;
+        bool use_in_parallel  = true;
+        bool use_optimize     = i_opt == 1;
+        CppAD::chkpoint_two<double> chk_fun( fun, name,
+            internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel,
+            use_optimize
+        );
+
+        // place to hold result for each thread
+        d_vector y(num_threads), dy(num_threads);
+        for(size_t thread = 0; thread < num_threads; thread++)
+        {   y[thread]  = 0.0;
+            dy[thread] = 0.0;
+        }
+
+        # pragma omp parallel for
+        for(int thread = 0; thread < int(num_threads); thread++)
+        {   ad_vector au(n), av(m);
+            au[0] = 1.0;
+            CppAD::Independent(au);
+            chk_fun(au, av);
+            CppAD::ADFun<double> f(au, av);
+            //
+            d_vector x(n), v(m), dx(n), dv(m);
+            x[0]      = double( thread + 1 );
+            v         = f.Forward(0, x);
+            dx[0]     = 1.0;
+            dv        = f.Forward(1, dx);
+            //
+            // this assigment has false sharing; i.e., will case cache resets
+            // (conversion avoids boost vector conversion warning)
+            y[size_t(thread)]  = v[0];
+            dy[size_t(thread)] = dv[0];
+        }
 
-    // check the results
-    for(size_t thread = 0; thread < num_threads; thread++)
-    {   double check = double( length_of_sum_ * (thread + 1) );
-        ok          &= check == y[thread];
+        // check the results
+        for(size_t thread = 0; thread < num_threads; thread++)
+        {   double check = double( length_of_sum_ * (thread + 1) );
+            ok          &= check == y[thread];
+            ok          &= double( length_of_sum_ ) == dy[thread];
+        }
     }
     return ok;
 }
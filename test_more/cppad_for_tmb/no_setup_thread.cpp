@@ -0,0 +1,127 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+# include <omp.h>
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::ad_type_enum ad_type_enum;
+    // --------------------------------------------------------------------
+    // atomic_square: y = x * x
+    class atomic_square : public CppAD::atomic_four<double> {
+    public:
+        atomic_square(const std::string& name) :
+        CppAD::atomic_four<double>(name)
+        { }
+    private:
+        // for_type
+        bool for_type(
+            size_t                      call_id     ,
+            const vector<ad_type_enum>& type_x      ,
+            vector<ad_type_enum>&       type_y      ) override
+        {   type_y[0] = type_x[0];
+            return true;
+        }
+        // forward
+        bool forward(
+            size_t                      call_id      ,
+            const vector<bool>&         select_y     ,
+            size_t                      order_low    ,
+            size_t                      order_up     ,
+            const vector<double>&       taylor_x     ,
+            vector<double>&             taylor_y     ) override
+        {   if( order_up > 1 )
+                return false;
+            if( order_low == 0 )
+                taylor_y[0] = taylor_x[0] * taylor_x[0];
+            if( order_up == 1 )
+                taylor_y[1] = 2.0 * taylor_x[0] * taylor_x[1];
+            return true;
+        }
+    };
+    // --------------------------------------------------------------------
+    // record and evaluate f(x) = square(x) + sin(x) using the current thread
+    bool record_and_check(size_t thread)
+    {   bool ok = true;
+        using CppAD::AD;
+        using CppAD::NearEqual;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        //
+        // asquare
+        std::string name = "square_" + CppAD::to_string(thread);
+        atomic_square asquare(name);
+        //
+        // f
+        vector< AD<double> > ax(1), ay(1), au(1);
+        ax[0] = double(thread + 1);
+        CppAD::Independent(ax);
+        asquare(ax, au);
+        ay[0] = au[0] + sin( ax[0] );
+        CppAD::ADFun<double> f(ax, ay);
+        //
+        // check zero and first order
+        vector<double> x(1), y(1), dx(1), dy(1);
+        x[0]  = double(thread) + 0.5;
+        y     = f.Forward(0, x);
+        ok   &= NearEqual(y[0], x[0] * x[0] + std::sin(x[0]), eps99, eps99);
+        dx[0] = 1.0;
+        dy    = f.Forward(1, dx);
+        ok   &= NearEqual(dy[0], 2.0 * x[0] + std::cos(x[0]), eps99, eps99);
+        //
+        return ok;
+    }
+}
+
+// record independent tapes in parallel without calling
+// thread_alloc::parallel_setup or parallel_ad
+bool no_setup_thread(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+
+    // OpenMP setup
+    size_t num_threads = 4;      // number of threads
+    omp_set_dynamic(0);          // turn off dynamic thread adjustment
+    omp_set_num_threads( int(num_threads) );  // set number of OMP threads
+
+    // undo any previous call to parallel_setup
+    thread_alloc::parallel_setup(1, nullptr, nullptr);
+    //
+    // each thread records and uses its own tape
+    std::vector<int>    thread_ok(num_threads, 0);
+    std::vector<size_t> thread_number(num_threads, 0);
+    # pragma omp parallel
+    {   size_t index = static_cast<size_t>( omp_get_thread_num() );
+        size_t thread         = thread_alloc::thread_num();
+        thread_number[index]  = thread;
+        thread_ok[index]      = int( record_and_check(thread) );
+        //
+        // thread_alloc does not know that this is parallel mode
+        thread_ok[index]     &= int( ! thread_alloc::in_parallel() );
+    }
+    //
+    // each thread had a different thread number and its checks passed
+    for(size_t index = 0; index < num_threads; ++index)
+    {   ok &= thread_ok[index] != 0;
+        ok &= thread_number[index] < CPPAD_MAX_NUM_THREADS;
+        for(size_t other = 0; other < index; ++other)
+            ok &= thread_number[index] != thread_number[other];
+    }
+    //
+    // free memory held by the other threads
+    for(size_t index = 0; index < num_threads; ++index)
+    {   size_t thread = thread_number[index];
+        ok &= thread_alloc::inuse(thread) == 0;
+        thread_alloc::free_available(thread);
+    }
+    //
+    return ok;
+}
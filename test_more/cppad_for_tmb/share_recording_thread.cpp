@@ -0,0 +1,171 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+# include <omp.h>
+
+namespace {
+    using CppAD::vector;
+    typedef CppAD::sparse_rc< vector<size_t> >          sparsity;
+    typedef CppAD::sparse_rcv< vector<size_t>, vector<double> > sparse_matrix;
+    //
+    // inform CppAD if we are in parallel mode
+    bool in_parallel(void)
+    {   return omp_in_parallel() != 0; }
+    //
+    // inform CppAD of the current thread number
+    size_t thread_num(void)
+    {   return static_cast<size_t>( omp_get_thread_num() ); }
+    //
+    // evaluate using a context that shares the operation sequence in f
+    // f(x) = [ x_0 * x_1 , sin(x_1) * x_2 ]
+    bool evaluate(const CppAD::ADFun<double>& f, size_t thread)
+    {   bool ok = true;
+        using CppAD::NearEqual;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        //
+        // g
+        CppAD::ADFun<double> g;
+        g.share_recording(f);
+        ok &= g.size_order() == 0;
+        //
+        // x
+        size_t n = 3, m = 2;
+        vector<double> x(n);
+        for(size_t j = 0; j < n; ++j)
+            x[j] = double(thread + j + 1);
+        //
+        // Forward
+        vector<double> y = g.Forward(0, x);
+        ok &= NearEqual(y[0], x[0] * x[1],             eps99, eps99);
+        ok &= NearEqual(y[1], std::sin(x[1]) * x[2],   eps99, eps99);
+        //
+        // Reverse
+        vector<double> w(m), dw(n);
+        w[0] = 0.0;
+        w[1] = 1.0;
+        dw   = g.Reverse(1, w);
+        ok  &= NearEqual(dw[0], 0.0,                   eps99, eps99);
+        ok  &= NearEqual(dw[1], std::cos(x[1]) * x[2], eps99, eps99);
+        ok  &= NearEqual(dw[2], std::sin(x[1]),        eps99, eps99);
+        //
+        // sparse_jac_for
+        sparsity pattern_in(n, n, n);
+        for(size_t k = 0; k < n; ++k)
+            pattern_in.set(k, k, k);
+        bool transpose     = false;
+        bool dependency    = false;
+        bool internal_bool = false;
+        sparsity jac_pattern;
+        g.for_jac_sparsity(
+            pattern_in, transpose, dependency, internal_bool, jac_pattern
+        );
+        ok &= jac_pattern.nnz() == 4;
+        sparse_matrix subset( jac_pattern );
+        CppAD::sparse_jac_work jac_work;
+        size_t group_max = n;
+        g.sparse_jac_for(group_max, x, subset, jac_pattern, "cppad", jac_work);
+        const vector<size_t>& row( subset.row() );
+        const vector<size_t>& col( subset.col() );
+        const vector<double>& val( subset.val() );
+        for(size_t k = 0; k < subset.nnz(); ++k)
+        {   double check = 0.0;
+            if( row[k] == 0 && col[k] == 0 )
+                check = x[1];
+            else if( row[k] == 0 && col[k] == 1 )
+                check = x[0];
+            else if( row[k] == 1 && col[k] == 1 )
+                check = std::cos(x[1]) * x[2];
+            else if( row[k] == 1 && col[k] == 2 )
+                check = std::sin(x[1]);
+            ok &= NearEqual(val[k], check, eps99, eps99);
+        }
+        //
+        // sparse_hes
+        vector<bool> select_domain(n), select_range(m);
+        for(size_t j = 0; j < n; ++j)
+            select_domain[j] = true;
+        for(size_t i = 0; i < m; ++i)
+            select_range[i] = true;
+        sparsity hes_pattern;
+        g.for_hes_sparsity(
+            select_domain, select_range, internal_bool, hes_pattern
+        );
+        sparse_matrix hes_subset( hes_pattern );
+        CppAD::sparse_hes_work hes_work;
+        vector<double> r(m);
+        r[0] = 1.0;
+        r[1] = 1.0;
+        g.sparse_hes(x, r, hes_subset, hes_pattern, "cppad.symmetric", hes_work);
+        const vector<size_t>& hrow( hes_subset.row() );
+        const vector<size_t>& hcol( hes_subset.col() );
+        const vector<double>& hval( hes_subset.val() );
+        for(size_t k = 0; k < hes_subset.nnz(); ++k)
+        {   size_t i = std::min(hrow[k], hcol[k]);
+            size_t j = std::max(hrow[k], hcol[k]);
+            double check = 0.0;
+            if( i == 0 && j == 1 )
+                check = 1.0;
+            else if( i == 1 && j == 1 )
+                check = - std::sin(x[1]) * x[2];
+            else if( i == 1 && j == 2 )
+                check = std::cos(x[1]);
+            ok &= NearEqual(hval[k], check, eps99, eps99);
+        }
+        //
+        return ok;
+    }
+}
+
+// evaluate one function in parallel using contexts that share its recording
+bool share_recording_thread(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+    using CppAD::AD;
+
+    // OpenMP setup
+    size_t num_threads = 4;      // number of threads
+    omp_set_dynamic(0);          // turn off dynamic thread adjustment
+    omp_set_num_threads( int(num_threads) );  // set number of OMP threads
+
+    // setup for using CppAD in paralle mode
+    thread_alloc::parallel_setup(num_threads, in_parallel, thread_num);
+    thread_alloc::hold_memory(true);
+    CppAD::parallel_ad<double>();
+
+    // f(x) = [ x_0 * x_1 , sin(x_1) * x_2 ]
+    size_t n = 3, m = 2;
+    vector< AD<double> > ax(n), ay(m);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = sin( ax[1] ) * ax[2];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // initialize statics (e.g. CheckSimpleVector) in sequential mode
+    ok &= evaluate(f, 0);
+    //
+    // each thread uses its own context
+    std::vector<int> thread_ok(num_threads, 0);
+    # pragma omp parallel
+    {   size_t thread     = thread_alloc::thread_num();
+        thread_ok[thread] = int( evaluate(f, thread) );
+    }
+    for(size_t thread = 0; thread < num_threads; ++thread)
+        ok &= thread_ok[thread] != 0;
+    //
+    // free memory for the other threads
+    for(size_t thread = 1; thread < num_threads; ++thread)
+        thread_alloc::free_available(thread);
+    //
+    return ok;
+}
@@ -0,0 +1,132 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+# include <omp.h>
+
+namespace {
+    // inform CppAD if we are in parallel mode
+    bool in_parallel(void)
+    {   return omp_in_parallel() != 0; }
+    //
+    // inform CppAD of the current thread number
+    size_t thread_num(void)
+    {   return static_cast<size_t>( omp_get_thread_num() ); }
+}
+
+// memory returned by a thread that is not the owner while in parallel mode
+bool thread_alloc_remote(void)
+{   bool ok = true;
+    using CppAD::thread_alloc;
+
+    // OpenMP setup
+    size_t num_threads = 4;      // number of threads
+    omp_set_dynamic(0);          // turn off dynamic thread adjustment
+    omp_set_num_threads( int(num_threads) );  // set number of OMP threads
+
+    // setup for using CppAD in paralle mode
+    thread_alloc::parallel_setup(num_threads, in_parallel, thread_num);
+    thread_alloc::hold_memory(true);
+
+    // capacity index corresponding to this memory request
+    size_t min_bytes = 100 * sizeof(double);
+    size_t num_cap   = thread_alloc::num_capacity();
+    size_t c_index   = 0;
+    size_t c_bytes, num_hit, num_miss, held_bytes;
+    thread_alloc::capacity_stat(
+        0, c_index, c_bytes, num_hit, num_miss, held_bytes
+    );
+    while( c_bytes < min_bytes )
+    {   ++c_index;
+        ok &= c_index < num_cap;
+        if( ! ok )
+            return ok;
+        thread_alloc::capacity_stat(
+            0, c_index, c_bytes, num_hit, num_miss, held_bytes
+        );
+    }
+    //
+    // statistics before this test
+    std::vector<size_t> hit_before(num_threads), miss_before(num_threads);
+    std::vector<size_t> held_before(num_threads);
+    for(size_t thread = 0; thread < num_threads; ++thread)
+    {   thread_alloc::capacity_stat(
+            thread, c_index, c_bytes, num_hit, num_miss, held_bytes
+        );
+        hit_before[thread]  = num_hit;
+        miss_before[thread] = num_miss;
+        held_before[thread] = held_bytes;
+    }
+    //
+    // memory allocated by each thread
+    std::vector<void*>  v_ptr(num_threads, nullptr);
+    std::vector<size_t> cap_bytes(num_threads, 0);
+    int num_team = 0;
+    # pragma omp parallel
+    {   size_t thread = thread_alloc::thread_num();
+        # pragma omp single
+        num_team = omp_get_num_threads();
+        //
+        v_ptr[thread] = thread_alloc::get_memory(min_bytes, cap_bytes[thread]);
+    }
+    size_t num_used = size_t(num_team);
+    ok &= 0 < num_used && num_used <= num_threads;
+    //
+    // each thread returns the memory for the next thread
+    # pragma omp parallel
+    {   size_t thread = thread_alloc::thread_num();
+        size_t other  = (thread + 1) % num_used;
+        thread_alloc::return_memory( v_ptr[other] );
+    }
+    //
+    // the memory is back in the pool for the thread that allocated it
+    for(size_t thread = 0; thread < num_used; ++thread)
+    {   ok &= cap_bytes[thread] == c_bytes;
+        thread_alloc::capacity_stat(
+            thread, c_index, c_bytes, num_hit, num_miss, held_bytes
+        );
+        if( held_before[thread] == 0 )
+            ok &= held_bytes == c_bytes;
+        else
+            ok &= held_bytes == held_before[thread];
+    }
+    //
+    // each thread gets the same amount of memory again
+    # pragma omp parallel
+    {   size_t thread = thread_alloc::thread_num();
+        v_ptr[thread] = thread_alloc::get_memory(min_bytes, cap_bytes[thread]);
+        thread_alloc::return_memory( v_ptr[thread] );
+    }
+    //
+    // first request was a miss unless memory was already held,
+    // second request was a hit
+    for(size_t thread = 0; thread < num_used; ++thread)
+    {   thread_alloc::capacity_stat(
+            thread, c_index, c_bytes, num_hit, num_miss, held_bytes
+        );
+        if( held_before[thread] == 0 )
+        {   ok &= num_miss == miss_before[thread] + 1;
+            ok &= num_hit  == hit_before[thread] + 1;
+            ok &= held_bytes == c_bytes;
+        }
+        else
+        {   ok &= num_miss == miss_before[thread];
+            ok &= num_hit  == hit_before[thread] + 2;
+            ok &= held_bytes == held_before[thread];
+        }
+    }
+    //
+    // free the memory for the other threads
+    for(size_t thread = 1; thread < num_threads; ++thread)
+        thread_alloc::free_available(thread);
+    //
+    return ok;
+}
@@ -0,0 +1,101 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+Test atomic_four mat_mul with matrices that span more than one block
+of base_mat_mul and with second order reverse mode.
+*/
+# include <cppad/cppad.hpp>
+# include <cppad/example/atomic_four/mat_mul/mat_mul.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+// ---------------------------------------------------------------------------
+// compare the atomic matrix multiply with one recorded using AD operations
+bool compare(size_t n_left, size_t n_middle, size_t n_right)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // afun
+    CppAD::atomic_mat_mul<double> afun("atomic_mat_mul");
+    //
+    // nx, ny, offset
+    size_t nx     = n_middle * (n_left + n_right);
+    size_t ny     = n_left * n_right;
+    size_t offset = n_left * n_middle;
+    //
+    // ax
+    vector< AD<double> > ax(nx), ay(ny);
+    for(size_t j = 0; j < nx; ++j)
+        ax[j] = 1.0;
+    //
+    // f
+    CppAD::Independent(ax);
+    size_t call_id = afun.set(n_left, n_middle, n_right);
+    afun(call_id, ax, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g
+    CppAD::Independent(ax);
+    for(size_t i = 0; i < n_left; ++i)
+    {   for(size_t j = 0; j < n_right; ++j)
+        {   AD<double> sum = 0.0;
+            for(size_t k = 0; k < n_middle; ++k)
+                sum += ax[i * n_middle + k] * ax[offset + k * n_right + j];
+            ay[i * n_right + j] = sum;
+        }
+    }
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // x, x1
+    vector<double> x(nx), x1(nx);
+    for(size_t j = 0; j < nx; ++j)
+    {   x[j]  = double(j % 7) / 7.0 - 0.5;
+        x1[j] = double(j % 5) / 5.0;
+    }
+    //
+    // zero order forward
+    vector<double> fy = f.Forward(0, x);
+    vector<double> gy = g.Forward(0, x);
+    for(size_t i = 0; i < ny; ++i)
+        ok &= NearEqual(fy[i], gy[i], eps99, eps99);
+    //
+    // first order forward
+    fy = f.Forward(1, x1);
+    gy = g.Forward(1, x1);
+    for(size_t i = 0; i < ny; ++i)
+        ok &= NearEqual(fy[i], gy[i], eps99, eps99);
+    //
+    // second order reverse
+    vector<double> w(2 * ny);
+    for(size_t i = 0; i < 2 * ny; ++i)
+        w[i] = double(i % 3) - 1.0;
+    vector<double> fdw = f.Reverse(2, w);
+    vector<double> gdw = g.Reverse(2, w);
+    for(size_t j = 0; j < 2 * nx; ++j)
+        ok &= NearEqual(fdw[j], gdw[j], eps99, eps99);
+    //
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+
+bool atomic_four_mat_mul(void)
+{   bool ok = true;
+    // one block
+    ok &= compare(3, 2, 4);
+    // more than one block for the middle and right indices
+    ok &= compare(5, 70, 130);
+    // matrix times vector
+    ok &= compare(7, 150, 1);
+    return ok;
+}
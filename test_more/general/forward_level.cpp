@@ -0,0 +1,274 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+// ---------------------------------------------------------------------------
+// runner that executes the tasks in reverse order
+class reverse_runner : public CppAD::level_runner {
+public:
+    size_t n_run;
+    reverse_runner(void) : n_run(0)
+    { }
+    void run(size_t n_task, const CppAD::level_task& task) override
+    {   ++n_run;
+        for(size_t k = n_task; k > 0; --k)
+            task(k - 1);
+    }
+};
+// ---------------------------------------------------------------------------
+// check that forward_level agrees with Forward for orders zero through two
+// and that Reverse and reverse_level agree after forward_level
+bool check_level(
+    CppAD::ADFun<double>&        f        ,
+    const CppAD::vector<double>& x        ,
+    bool                         parallel )
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    size_t n = f.Domain();
+    size_t m = f.Range();
+    CppAD::ADFun<double> g;
+    g = f;
+    //
+    reverse_runner runner;
+    size_t min_width = 1;
+    //
+    // order zero, one, two
+    CppAD::vector<double> xq(n), y, check;
+    for(size_t q = 0; q < 3; ++q)
+    {   for(size_t j = 0; j < n; ++j)
+        {   if( q == 0 )
+                xq[j] = x[j];
+            else
+                xq[j] = double(j + q) / double(n + 1);
+        }
+        y     = f.forward_level(q, xq, runner, min_width);
+        check = g.Forward(q, xq);
+        for(size_t i = 0; i < m; ++i)
+            ok &= NearEqual(y[i], check[i], eps99, eps99);
+    }
+    ok &= f.size_order() == 3;
+    //
+    // reverse mode using the Taylor coefficients from forward_level
+    CppAD::vector<double> w(m * 3), dw, check_dw;
+    for(size_t k = 0; k < m * 3; ++k)
+        w[k] = double(k + 1) / double(m);
+    dw       = f.Reverse(3, w);
+    check_dw = g.Reverse(3, w);
+    for(size_t k = 0; k < n * 3; ++k)
+        ok &= NearEqual(dw[k], check_dw[k], eps99, eps99);
+    //
+    // reverse_level with weights for all orders and for the highest order
+    size_t n_part = 3;
+    dw = f.reverse_level(3, w, runner, min_width, n_part);
+    for(size_t k = 0; k < n * 3; ++k)
+        ok &= NearEqual(dw[k], check_dw[k], eps99, eps99);
+    CppAD::vector<double> w1(m);
+    for(size_t i = 0; i < m; ++i)
+        w1[i] = w[i * 3];
+    dw       = f.reverse_level(2, w1, runner, min_width, n_part);
+    check_dw = g.Reverse(2, w1);
+    for(size_t k = 0; k < n * 2; ++k)
+        ok &= NearEqual(dw[k], check_dw[k], eps99, eps99);
+    //
+    // orders zero through two in one call
+    CppAD::vector<double> xp(n * 3);
+    for(size_t j = 0; j < n; ++j)
+        for(size_t k = 0; k < 3; ++k)
+            xp[3 * j + k] = double(j + k + 1) / 3.0;
+    y     = f.forward_level(2, xp, runner, min_width);
+    check = g.Forward(2, xp);
+    for(size_t k = 0; k < m * 3; ++k)
+        ok &= NearEqual(y[k], check[k], eps99, eps99);
+    //
+    if( parallel )
+        ok &= 0 < runner.n_run && 0 < f.size_level();
+    else
+        ok &= runner.n_run == 0;
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// many of the operators that are supported
+bool supported_op(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 3;
+    CppAD::vector< AD<double> > ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = 0.5;
+    Independent(ax);
+    //
+    AD<double> a0 = ax[0], a1 = ax[1], a2 = ax[2];
+    CppAD::vector< AD<double> > ay(12);
+    ay[0]  = pow(a0, a1) + pow(a0, 2.5) + pow(2.5, a1);
+    ay[1]  = erf(a0) * erfc(a1) - atan(a2) / asin(a0);
+    ay[2]  = acos(a0) + acosh(1.0 + a1) + asinh(a2) - atanh(a0);
+    ay[3]  = sin(a0) * cos(a1) + sinh(a2) - cosh(a0) / tan(a1);
+    ay[4]  = tanh(a2) + exp(a0) - expm1(a1) + log(a2) * log1p(a0);
+    ay[5]  = sqrt(a1) + fabs(a2 - 1.0) + sign(a0 - 1.0) * a1;
+    ay[6]  = - a0 + 2.0 * a1 - a2 / 3.0 + 4.0 / a0 - (5.0 - a1);
+    ay[7]  = azmul(a0, a1) + azmul(2.0, a1) + azmul(a0, 3.0);
+    ay[8]  = CondExpLt(a0, a1, a0 * a2, a1 / a2);
+    ay[9]  = CondExpGe(a2, AD<double>(1.0), exp(a0), AD<double>(2.0));
+    ay[10] = 7.0;
+    ay[11] = a0;
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector<double> x(n);
+    x[0] = 0.25;
+    x[1] = 0.75;
+    x[2] = 1.25;
+    ok &= check_level(f, x, true);
+    //
+    // after optimize, the sums are cumulative summation operators
+    f.optimize("no_conditional_skip");
+    ok &= check_level(f, x, true);
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// dynamic parameters
+bool dynamic(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n), ap(1), ay(2);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    ap[0] = 2.0;
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    Independent(ax, abort_op_index, record_compare, ap);
+    ay[0] = ap[0] * sin(ax[0]) + ax[1] / ap[0];
+    ay[1] = exp(ap[0]) + ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector<double> p(1), x(n);
+    p[0] = 3.0;
+    f.new_dynamic(p);
+    x[0] = 0.25;
+    x[1] = 0.75;
+    ok &= check_level(f, x, true);
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// comparison operators
+bool compare(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n), ay(2);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    Independent(ax);
+    if( ax[0] < ax[1] )
+        ay[0] = ax[0] * ax[1];
+    else
+        ay[0] = ax[0] / ax[1];
+    ay[1] = ax[0] - ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // the comparison is not checked by forward_level
+    CppAD::vector<double> x(n);
+    x[0] = 2.0;
+    x[1] = 1.0;
+    f.compare_change_count(0);
+    ok &= check_level(f, x, true);
+    ok &= f.compare_change_number() == 0;
+    //
+    // zero order uses Forward so that the comparison is checked
+    reverse_runner runner;
+    f.compare_change_count(1);
+    f.forward_level(0, x, runner, 1);
+    ok &= runner.n_run == 0;
+    ok &= f.compare_change_number() == 1;
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// VecAD operators are not supported
+bool vec_ad(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n), ay(1);
+    ax[0] = 0.0;
+    ax[1] = 1.0;
+    Independent(ax);
+    CppAD::VecAD<double> av(2);
+    av[ AD<double>(0) ] = sin( ax[1] );
+    av[ AD<double>(1) ] = cos( ax[1] );
+    ay[0] = av[ ax[0] ] * ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector<double> x(n);
+    x[0] = 1.0;
+    x[1] = 2.0;
+    ok &= check_level(f, x, false);
+    ok &= f.size_level() == 0;
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// changing the operation sequence redoes the level schedule
+bool change_recording(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n), ay(2);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    Independent(ax);
+    ay[0] = exp( sin( ax[0] ) );
+    ay[1] = exp( cos( ax[1] ) );
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector<double> x(n);
+    x[0] = 1.0;
+    x[1] = 2.0;
+    ok &= check_level(f, x, true);
+    size_t n_level = f.size_level();
+    //
+    // copy includes the level schedule
+    CppAD::ADFun<double> g;
+    g   = f;
+    ok &= g.size_level() == n_level;
+    //
+    Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    ay[1] = ax[0] + ax[1];
+    f.Dependent(ax, ay);
+    ok &= f.size_level() == 0;
+    ok &= check_level(f, x, true);
+    ok &= f.size_level() < n_level;
+    //
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+
+bool forward_level(void)
+{   bool ok = true;
+    ok     &= supported_op();
+    ok     &= dynamic();
+    ok     &= compare();
+    ok     &= vec_ad();
+    ok     &= change_recording();
+    return ok;
+}
@@ -0,0 +1,259 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+// ---------------------------------------------------------------------------
+// check that forward_live agrees with Forward(0, x), and reverse_live agrees
+// with Reverse(1, w), for each x in x_list
+bool check_live(
+    CppAD::ADFun<double>&                 f      ,
+    const CppAD::vector< CppAD::vector<double> >& x_list )
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    for(size_t k = 0; k < x_list.size(); ++k)
+    {   CppAD::vector<double> y      = f.Forward(0, x_list[k]);
+        CppAD::vector<double> y_live = f.forward_live(x_list[k]);
+        ok &= y.size() == y_live.size();
+        for(size_t i = 0; i < y.size(); ++i)
+            ok &= NearEqual(y_live[i], y[i], eps99, eps99);
+        ok &= f.size_order() == 0;
+        //
+        // reverse_live does not support VecAD vectors
+        if( f.size_VecAD() == 0 )
+        {   size_t m = f.Range();
+            CppAD::vector<double> w(m);
+            for(size_t i = 0; i < m; ++i)
+                w[i] = double(i + 1) / double(m);
+            f.Forward(0, x_list[k]);
+            CppAD::vector<double> dw      = f.Reverse(1, w);
+            CppAD::vector<double> dw_live = f.reverse_live(x_list[k], w);
+            ok &= dw.size() == dw_live.size();
+            for(size_t j = 0; j < dw.size(); ++j)
+                ok &= NearEqual(dw_live[j], dw[j], eps99, eps99);
+            ok &= f.size_order() == 0;
+        }
+    }
+    ok &= 0 < f.size_live();
+    ok &= f.size_live() <= f.size_var();
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// operators with multiple results, parameter results, and dependent
+// variables that are independent variables, repeated, or never used
+bool multiple_result(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 3;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    ax[2] = 2.5; // not used
+    Independent(ax);
+    //
+    AD<double> au = pow(ax[0], ax[1]);
+    AD<double> av = erf(au) * atan(ax[1]);
+    AD<double> aw = sin(av) + cos(au) + tanh(ax[0] * ax[1]);
+    //
+    CppAD::vector< AD<double> > ay(6);
+    ay[0] = aw;
+    ay[1] = av;
+    ay[2] = ax[0];
+    ay[3] = aw;
+    ay[4] = 3.0;
+    ay[5] = ax[0] * ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector< CppAD::vector<double> > x_list(2);
+    for(size_t k = 0; k < x_list.size(); ++k)
+    {   x_list[k].resize(n);
+        for(size_t j = 0; j < n; ++j)
+            x_list[k][j] = double(j + k + 1) / 4.0;
+    }
+    ok &= check_live(f, x_list);
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// conditional skip and cumulative summation operators
+bool optimized(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    Independent(ax);
+    //
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < 10; ++k)
+        asum += exp( ax[0] * double(k) ) - ax[1] + double(k);
+    AD<double> aprod = 1.0;
+    for(size_t k = 0; k < 10; ++k)
+        aprod *= ax[1] + double(k);
+    //
+    CppAD::vector< AD<double> > ay(1);
+    ay[0] = CondExpLt(ax[0], ax[1], asum, aprod);
+    CppAD::ADFun<double> f(ax, ay);
+    f.optimize();
+    //
+    CppAD::vector< CppAD::vector<double> > x_list(3);
+    for(size_t k = 0; k < x_list.size(); ++k)
+        x_list[k].resize(n);
+    x_list[0][0] = 0.1; x_list[0][1] = 0.2; // if true case
+    x_list[1][0] = 0.3; x_list[1][1] = 0.2; // if false case
+    x_list[2][0] = 0.1; x_list[2][1] = 0.4; // if true case
+    ok &= check_live(f, x_list);
+    //
+    // the false case is skipped during zero order forward
+    f.forward_live(x_list[0]);
+    ok &= f.number_skip() > 0;
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// VecAD vectors store and load variables
+bool vec_ad(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.0;
+    ax[1] = 1.0;
+    Independent(ax);
+    //
+    size_t n_vec = 4;
+    CppAD::VecAD<double> av(n_vec);
+    av[ AD<double>(0) ] = 2.0;
+    for(size_t k = 1; k < n_vec; ++k)
+    {   AD<double> aindex = double(k);
+        av[aindex] = sin( ax[1] * double(k) );
+    }
+    // variable index and variable value
+    av[ ax[0] ] = cos( ax[1] );
+    //
+    CppAD::vector< AD<double> > ay(n_vec);
+    for(size_t k = 0; k < n_vec; ++k)
+    {   // lots of temporaries between store and load
+        AD<double> at = ax[1];
+        for(size_t ell = 0; ell < 5; ++ell)
+            at = exp(at) / (1.0 + exp(at));
+        AD<double> aindex = double(k);
+        ay[k] = av[aindex] + at;
+    }
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector< CppAD::vector<double> > x_list(n_vec);
+    for(size_t k = 0; k < n_vec; ++k)
+    {   x_list[k].resize(n);
+        x_list[k][0] = double(k);
+        x_list[k][1] = double(k + 1) / 3.0;
+    }
+    ok &= check_live(f, x_list);
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// atomic function calls
+bool atomic(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // g(u) = [ u_0 * u_1, sin(u_0), u_1 ]
+    CppAD::vector< AD<double> > au(2), av(3);
+    au[0] = 1.0;
+    au[1] = 2.0;
+    Independent(au);
+    av[0] = au[0] * au[1];
+    av[1] = sin(au[0]);
+    av[2] = au[1];
+    CppAD::ADFun<double> g(au, av);
+    CppAD::chkpoint_two<double> chk_g(g, "g", false, false, false, false);
+    //
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    Independent(ax);
+    //
+    CppAD::vector< AD<double> > ay(2);
+    ay[0] = 0.0;
+    ay[1] = 0.0;
+    for(size_t k = 0; k < 4; ++k)
+    {   au[0] = ax[0] + double(k);
+        au[1] = cos( ax[1] * double(k) );
+        chk_g(au, av);
+        // the result av[1] is not used
+        ay[0] += av[0] * av[2];
+        ay[1] += av[2] / ( 1.0 + av[0] * av[0] );
+    }
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector< CppAD::vector<double> > x_list(2);
+    for(size_t k = 0; k < x_list.size(); ++k)
+    {   x_list[k].resize(n);
+        x_list[k][0] = double(k) - 0.5;
+        x_list[k][1] = double(k) + 0.5;
+    }
+    ok &= check_live(f, x_list);
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// changing the operation sequence redoes the liveness analysis
+bool change_recording(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    size_t n = 1;
+    CppAD::vector< AD<double> > ax(n), ay(1);
+    ax[0] = 0.5;
+    Independent(ax);
+    ay[0] = exp( sin( ax[0] ) );
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector<double> x(n), y(1);
+    x[0] = 1.0;
+    y    = f.forward_live(x);
+    ok  &= y[0] == std::exp( std::sin( x[0] ) );
+    ok  &= f.size_live() > 0;
+    //
+    // copy includes the liveness analysis
+    CppAD::ADFun<double> g;
+    g   = f;
+    ok &= g.size_live() == f.size_live();
+    //
+    Independent(ax);
+    ay[0] = ax[0] * ax[0] + 1.0;
+    f.Dependent(ax, ay);
+    ok &= f.size_live() == 0;
+    y   = f.forward_live(x);
+    ok &= y[0] == x[0] * x[0] + 1.0;
+    //
+    y   = g.forward_live(x);
+    ok &= y[0] == std::exp( std::sin( x[0] ) );
+    //
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+
+bool forward_live(void)
+{   bool ok = true;
+    ok     &= multiple_result();
+    ok     &= optimized();
+    ok     &= vec_ad();
+    ok     &= atomic();
+    ok     &= change_recording();
+    return ok;
+}
@@ -74,6 +74,7 @@ extern bool assign(void);
 extern bool atan(void);
 extern bool atan2(void);
 extern bool atanh(void);
+extern bool atomic_four_mat_mul(void);
 extern bool atomic_three(void);
 extern bool azmul(void);
 extern bool base2ad(void);
@@ -98,6 +99,8 @@ extern bool fabs(void);
 extern bool for_sparse_hes(void);
 extern bool for_sparse_jac(void);
 extern bool forward_dir(void);
+extern bool forward_level(void);
+extern bool forward_live(void);
 extern bool forward_order(void);
 extern bool hes_sparsity(void);
 extern bool ipopt_solve(void);
@@ -106,6 +109,8 @@ extern bool json_graph(void);
 extern bool log(void);
 extern bool log10(void);
 extern bool log1p(void);
+extern bool long_tape(void);
+extern bool memo_pure(void);
 extern bool mul_cond_rev(void);
 extern bool mul_cskip(void);
 extern bool mul_level(void);
@@ -118,6 +123,7 @@ extern bool parameter(void);
 extern bool print_for(void);
 extern bool rev_sparse_jac(void);
 extern bool reverse(void);
+extern bool slice(void);
 extern bool sparse_hessian(void);
 extern bool sparse_jac_work(void);
 extern bool sparse_jacobian(void);
@@ -130,6 +136,7 @@ extern bool subgraph_hes2jac(void);
 extern bool tan(void);
 extern bool test_vector(void);
 extern bool to_string(void);
+extern bool var_level(void);
 // END_SORT_THIS_LINE_MINUS_1
 
 // tests in local subdirectory
@@ -197,6 +204,7 @@ int main(void)
     Run( atan,            "atan"           );
     Run( atan2,           "atan2"          );
     Run( atanh,           "atanh"          );
+    Run( atomic_four_mat_mul, "atomic_four_mat_mul" );
     Run( atomic_three,    "atomic_three"   );
     Run( azmul,           "azmul"          );
     Run( base2ad,         "base2ad"        );
@@ -217,6 +225,8 @@ int main(void)
     Run( for_sparse_hes,  "for_sparse_hes" );
     Run( for_sparse_jac,  "for_sparse_jac" );
     Run( forward_dir,     "forward_dir"    );
+    Run( forward_level,   "forward_level"  );
+    Run( forward_live,    "forward_live"   );
     Run( forward_order,   "forward_order"  );
     Run( hes_sparsity,    "hes_sparsity"   );
     Run( jacobian,        "jacobian"       );
@@ -224,6 +234,8 @@ int main(void)
     Run( log,             "log"            );
     Run( log10,           "log10"          );
     Run( log1p,           "log1p"          );
+    Run( long_tape,       "long_tape"      );
+    Run( memo_pure,       "memo_pure"      );
     Run( mul_cond_rev,    "mul_cond_rev"   );
     Run( mul_cskip,       "Mul_cskip"      );
     Run( mul_level,       "mul_level"      );
@@ -236,6 +248,7 @@ int main(void)
     Run( print_for,       "print_for"      );
     Run( rev_sparse_jac,  "rev_sparse_jac" );
     Run( reverse,         "reverse"        );
+    Run( slice,           "slice"          );
     Run( sparse_hessian,  "sparse_hessian" );
     Run( sparse_jac_work, "sparse_jac_work");
     Run( sparse_jacobian, "sparse_jacobian");
@@ -247,6 +260,7 @@ int main(void)
     Run( subgraph_hes2jac, "subgraph_hes2jac" );
     Run( tan,             "tan"            );
     Run( to_string,       "to_string"      );
+    Run( var_level,       "var_level"      );
     // END_SORT_THIS_LINE_MINUS_1
 #if CPPAD_HAS_ADOLC
     Run( base_adolc,      "base_adolc"     );
@@ -0,0 +1,86 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+Test a recording that has more operators and arguments than fit in
+one chunk of the recorder (see pod_chunk_vector).
+*/
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+// ---------------------------------------------------------------------------
+// f(x) = sum_i sin( x_0 * x_1 + i ) with VecAD operations mixed in
+bool long_sum(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    //
+    // number of terms in the sum
+    // (each term has four operators, so there are several chunks)
+    size_t n_term = 100000;
+    //
+    // f
+    vector< AD<double> > ax(2), ay(1);
+    ax[0] = 0.5;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    //
+    // reserve more than one chunk for the operators and arguments
+    AD<double>::record_reserve(4 * n_term, 8 * n_term, 10);
+    CppAD::VecAD<double> av(2);
+    AD<double> azero = 0.0;
+    ay[0] = 0.0;
+    for(size_t i = 0; i < n_term; ++i)
+    {   av[azero] = sin( ax[0] * ax[1] + double(i) );
+        ay[0]    += av[azero];
+    }
+    CppAD::ADFun<double> f(ax, ay);
+    ok &= f.size_op() > 4 * n_term;
+    //
+    // check zero and first order
+    vector<double> x(2), y(1), w(1), dw(2);
+    x[0] = 0.25;
+    x[1] = 3.0;
+    double sum = 0.0, dsum = 0.0;
+    for(size_t i = 0; i < n_term; ++i)
+    {   sum  += std::sin( x[0] * x[1] + double(i) );
+        dsum += std::cos( x[0] * x[1] + double(i) );
+    }
+    //
+    // Use relative error with respect to the number of terms
+    double eps = double(n_term) * eps99;
+    y = f.Forward(0, x);
+    ok &= NearEqual(y[0], sum, eps, eps);
+    w[0] = 1.0;
+    dw   = f.Reverse(1, w);
+    ok  &= NearEqual(dw[0], dsum * x[1], eps, eps);
+    ok  &= NearEqual(dw[1], dsum * x[0], eps, eps);
+    //
+    // optimize re-records the operation sequence and uses
+    // cumulative summation operators
+    f.optimize();
+    y = f.Forward(0, x);
+    ok &= NearEqual(y[0], sum, eps, eps);
+    dw   = f.Reverse(1, w);
+    ok  &= NearEqual(dw[0], dsum * x[1], eps, eps);
+    ok  &= NearEqual(dw[1], dsum * x[0], eps, eps);
+    //
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+
+bool long_tape(void)
+{   bool ok = true;
+    ok     &= long_sum();
+    return ok;
+}
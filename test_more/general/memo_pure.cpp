@@ -0,0 +1,225 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+// ---------------------------------------------------------------------------
+// number of times each of the functions below has been evaluated
+size_t n_sign_eval = 0;
+size_t n_mul_eval  = 0;
+//
+// memo_sign
+double memo_sign(const double& x)
+{   ++n_sign_eval;
+    if( x < 0.0 )
+        return -1.0;
+    return 1.0;
+}
+CPPAD_DISCRETE_FUNCTION(double, memo_sign)
+//
+// atomic_memo_mul: y_0 = x_0 * x_1
+class atomic_memo_mul : public CppAD::atomic_four<double> {
+public:
+    atomic_memo_mul(void) : CppAD::atomic_four<double>("atomic_memo_mul")
+    { }
+private:
+    bool for_type(
+        size_t                                     call_id     ,
+        const CppAD::vector<CppAD::ad_type_enum>&  type_x      ,
+        CppAD::vector<CppAD::ad_type_enum>&        type_y      ) override
+    {   type_y[0] = std::max(type_x[0], type_x[1]);
+        return true;
+    }
+    bool forward(
+        size_t                              call_id      ,
+        const CppAD::vector<bool>&          select_y     ,
+        size_t                              order_low    ,
+        size_t                              order_up     ,
+        const CppAD::vector<double>&        taylor_x     ,
+        CppAD::vector<double>&              taylor_y     ) override
+    {   if( order_up != 0 )
+            return false;
+        ++n_mul_eval;
+        taylor_y[0] = taylor_x[0] * taylor_x[1];
+        return true;
+    }
+    bool rev_depend(
+        size_t                                     call_id     ,
+        CppAD::vector<bool>&                       depend_x    ,
+        const CppAD::vector<bool>&                 depend_y    ) override
+    {   depend_x[0] = depend_y[0];
+        depend_x[1] = depend_y[0];
+        return true;
+    }
+};
+// ---------------------------------------------------------------------------
+// calls that are skipped by conditional expressions
+bool conditional_skip(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f(x) = x_0 < 0 ? sign(x_1) : x_1 * x_2
+    atomic_memo_mul afun;
+    CPPAD_TESTVECTOR( AD<double> ) ax(3), ay(1), au(2), av(1);
+    for(size_t j = 0; j < 3; ++j)
+        ax[j] = 1.0;
+    CppAD::Independent(ax);
+    au[0] = ax[1];
+    au[1] = ax[2];
+    afun(au, av);
+    AD<double> zero(0.0);
+    ay[0] = CppAD::CondExpLt(ax[0], zero, memo_sign(ax[1]), av[0]);
+    CppAD::ADFun<double> f(ax, ay);
+    f.optimize();
+    f.memo_pure(true);
+    //
+    // check values and number of evaluations for a sequence of x
+    double x_list[][3] = {
+        {-1.0, 2.0, 3.0}, // sign is a miss
+        {-1.0, 2.0, 4.0}, // sign is a hit
+        { 1.0, 2.0, 4.0}, // mul is a miss
+        { 1.0, 2.0, 4.0}, // mul is a hit
+        {-1.0, 2.0, 4.0}, // sign is a hit
+        {-1.0,-2.0, 4.0}, // sign is a miss
+        { 1.0,-2.0, 4.0}  // mul is a miss
+    };
+    n_sign_eval = 0;
+    n_mul_eval  = 0;
+    CPPAD_TESTVECTOR(double) x(3), y(1);
+    size_t n_x = sizeof(x_list) / sizeof(x_list[0]);
+    for(size_t k = 0; k < n_x; ++k)
+    {   for(size_t j = 0; j < 3; ++j)
+            x[j] = x_list[k][j];
+        y = f.Forward(0, x);
+        double check = x[1] * x[2];
+        if( x[0] < 0.0 )
+            check = x[1] < 0.0 ? -1.0 : 1.0;
+        ok &= y[0] == check;
+    }
+    // each call site is evaluated at most once per distinct argument value;
+    // calls that are not skipped are counted as hits or misses
+    ok &= n_sign_eval <= 2;
+    ok &= n_mul_eval  <= 3;
+    ok &= f.memo_pure_miss() == n_sign_eval + n_mul_eval;
+    ok &= n_x <= f.memo_pure_hit() + f.memo_pure_miss();
+    //
+    // forward_live uses the same memo
+    size_t n_hit = f.memo_pure_hit();
+    y   = f.forward_live(x);
+    ok &= y[0] == x[1] * x[2];
+    ok &= n_hit < f.memo_pure_hit();
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// atomic function with a dynamic parameter argument
+bool dynamic_argument(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f(x; p) = p_0 * x_0
+    atomic_memo_mul afun;
+    CPPAD_TESTVECTOR( AD<double> ) ap(1), ax(1), ay(1), au(2);
+    ap[0] = 2.0;
+    ax[0] = 3.0;
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    CppAD::Independent(ax, abort_op_index, record_compare, ap);
+    au[0] = ap[0];
+    au[1] = ax[0];
+    afun(au, ay);
+    CppAD::ADFun<double> f(ax, ay);
+    f.memo_pure(true);
+    //
+    CPPAD_TESTVECTOR(double) p(1), x(1), y(1);
+    p[0] = 2.0;
+    x[0] = 3.0;
+    n_mul_eval = 0;
+    y   = f.Forward(0, x);
+    ok &= y[0] == p[0] * x[0];
+    y   = f.Forward(0, x);
+    ok &= y[0] == p[0] * x[0];
+    ok &= n_mul_eval == 1;
+    ok &= f.memo_pure_hit()  == 1;
+    ok &= f.memo_pure_miss() == 1;
+    //
+    // a change in the dynamic parameter is a change in the argument
+    p[0] = 5.0;
+    f.new_dynamic(p);
+    y   = f.Forward(0, x);
+    ok &= y[0] == p[0] * x[0];
+    ok &= n_mul_eval == 2;
+    ok &= f.memo_pure_hit()  == 1;
+    ok &= f.memo_pure_miss() == 2;
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// changing and copying the operation sequence
+bool change_recording(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    CPPAD_TESTVECTOR( AD<double> ) ax(1), ay(1);
+    ax[0] = 1.0;
+    CppAD::Independent(ax);
+    ay[0] = memo_sign( ax[0] ) + ax[0];
+    CppAD::ADFun<double> f(ax, ay);
+    f.memo_pure(true);
+    //
+    CPPAD_TESTVECTOR(double) x(1), y(1);
+    x[0] = -3.0;
+    y    = f.Forward(0, x);
+    y    = f.Forward(0, x);
+    ok  &= y[0] == -4.0;
+    ok  &= f.memo_pure_hit()  == 1;
+    ok  &= f.memo_pure_miss() == 1;
+    //
+    // assignment copies the memo
+    CppAD::ADFun<double> g;
+    g    = f;
+    ok  &= g.memo_pure();
+    y    = g.Forward(0, x);
+    ok  &= y[0] == -4.0;
+    ok  &= g.memo_pure_hit()  == 2;
+    ok  &= g.memo_pure_miss() == 1;
+    //
+    // optimize forgets the memo but memo_pure stays on
+    f.optimize();
+    ok  &= f.memo_pure();
+    ok  &= f.memo_pure_hit()  == 0;
+    ok  &= f.memo_pure_miss() == 0;
+    y    = f.Forward(0, x);
+    ok  &= y[0] == -4.0;
+    ok  &= f.memo_pure_miss() == 1;
+    //
+    // a new recording with no discrete or atomic functions
+    CppAD::Independent(ax);
+    ay[0] = 2.0 * ax[0];
+    f.Dependent(ax, ay);
+    ok  &= f.memo_pure();
+    y    = f.Forward(0, x);
+    ok  &= y[0] == -6.0;
+    ok  &= f.memo_pure_hit()  == 0;
+    ok  &= f.memo_pure_miss() == 0;
+    //
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+
+bool memo_pure(void)
+{   bool ok = true;
+    ok     &= conditional_skip();
+    ok     &= dynamic_argument();
+    ok     &= change_recording();
+    return ok;
+}
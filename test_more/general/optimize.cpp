@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -176,6 +176,14 @@ namespace {
 
         // check that the limit was exceeded
         ok &= f.exceed_collision_limit();
+        //
+        // check the corresponding statistics
+        const CppAD::optimize_stat_t& stat( f.optimize_stat() );
+        ok &= 0 < stat.n_limit;
+        ok &= stat.max_collision == 1;
+        ok &= stat.n_limit <= stat.n_collision;
+        ok &= stat.n_match + stat.n_limit <= stat.n_lookup;
+        ok &= f.size_op() <= stat.n_hash_code;
 
         return ok;
     }
@@ -0,0 +1,121 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+// ---------------------------------------------------------------------------
+void myhandler(
+    bool known       ,
+    int  line        ,
+    const char *file ,
+    const char *exp  ,
+    const char *msg  )
+{   // error handler must not return, so throw an exception
+    throw msg;
+}
+// ---------------------------------------------------------------------------
+// VecAD vector with a constant index and variable values
+bool vec_ad_constant_index(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f(x) = [ v[1] * x_1 , x_2 ] where v[1] = x_0
+    size_t n = 3;
+    CppAD::vector< AD<double> > ax(n), ay(2);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(2);
+    AD<double> zero(0.0), one(1.0);
+    av[zero] = 10.0;
+    av[one]  = ax[0];
+    ay[0]    = av[one] * ax[1];
+    ay[1]    = ax[2];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // g(u) = u_0 * u_1
+    CppAD::vector<bool> select_domain(n), select_range(2);
+    select_domain[0] = true;
+    select_domain[1] = true;
+    select_domain[2] = false;
+    select_range[0]  = true;
+    select_range[1]  = false;
+    CppAD::vector<double> x(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 1);
+    CppAD::ADFun<double> g = f.slice(select_domain, select_range, x, false);
+    //
+    CppAD::vector<double> u(2), v(1);
+    u[0] = 3.0;
+    u[1] = 4.0;
+    v    = g.Forward(0, u);
+    ok  &= v[0] == u[0] * u[1];
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// VecAD vector with a variable index is an error
+bool vec_ad_variable_index(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f(x) = v[x_0] * x_1 where v = [ 10 , 20 ]
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n), ay(1);
+    ax[0] = 0.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(2);
+    AD<double> zero(0.0), one(1.0);
+    av[zero] = 10.0;
+    av[one]  = 20.0;
+    ay[0]    = av[ ax[0] ] * ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::vector<bool> select_domain(n), select_range(1);
+    select_domain[0] = true;
+    select_domain[1] = true;
+    select_range[0]  = true;
+    CppAD::vector<double> x(n);
+    x[0] = 0.0;
+    x[1] = 2.0;
+# ifndef NDEBUG
+    // replace the default CppAD error handler
+    CppAD::ErrorHandler info(myhandler);
+    //
+    // use try / catch because error handler throws an exception
+    try {
+        // set ok to false unless catch block is executed
+        ok = false;
+        //
+        // the value of g would not depend on the index v[x_0]
+        CppAD::ADFun<double> g = f.slice(
+            select_domain, select_range, x, false
+        );
+    }
+    catch (const char* msg)
+    {   std::string check =
+            "slice: f has a VecAD index that is a variable "
+            "or dynamic parameter";
+        ok = msg == check;
+    }
+# endif
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+
+bool slice(void)
+{   bool ok = true;
+    ok     &= vec_ad_constant_index();
+    ok     &= vec_ad_variable_index();
+    return ok;
+}
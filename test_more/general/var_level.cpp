@@ -0,0 +1,146 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-22 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/cppad.hpp>
+
+namespace { // BEGIN_EMPTY_NAMESPACE
+// ---------------------------------------------------------------------------
+// a load from a VecAD vector comes after the previous store
+bool vecad_order(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    //
+    vector< AD<double> > ax(1), ay(1);
+    ax[0] = 1.0;
+    CppAD::Independent(ax);
+    CppAD::VecAD<double> av(2);
+    AD<double> azero = 0.0;
+    av[azero] = ax[0];      // store at level 1
+    ay[0]     = av[azero];  // load at level 2
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    vector<size_t> level;
+    size_t num_level = f.var_level(level);
+    ok &= num_level == 3;
+    ok &= level[ f.size_var() - 1 ] == 2;
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// cumulative summation operator created by the optimizer
+bool csum_op(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    //
+    size_t n = 4;
+    vector< AD<double> > ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j);
+    CppAD::Independent(ax);
+    ay[0] = 0.0;
+    for(size_t j = 0; j < n; ++j)
+        ay[0] += ax[j];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    vector<size_t> level;
+    size_t num_level = f.var_level(level);
+    ok &= num_level == n;
+    //
+    // the optimized tape uses one cumulative summation
+    f.optimize();
+    num_level = f.var_level(level);
+    ok &= num_level == 2;
+    ok &= level.size() == f.size_var();
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// results of an atomic function call have the same level
+bool atomic_call(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    //
+    // g(u) = [ u_0 * u_1 , u_0 + u_1 ]
+    vector< AD<double> > au(2), av(2);
+    au[0] = 1.0;
+    au[1] = 2.0;
+    CppAD::Independent(au);
+    av[0] = au[0] * au[1];
+    av[1] = au[0] + au[1];
+    CppAD::ADFun<double> g(au, av);
+    bool internal_bool    = false;
+    bool use_hes_sparsity = false;
+    bool use_base2ad      = false;
+    bool use_in_parallel  = false;
+    CppAD::chkpoint_two<double> chk_g(g, "g",
+        internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
+    );
+    //
+    // f(x) = g(x_0 * x_0, x_1)_0 + g(x_0 * x_0, x_1)_1
+    vector< AD<double> > ax(2), aw(2), ay(1);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    au[0] = ax[0] * ax[0];  // level 1
+    au[1] = ax[1];          // level 0
+    chk_g(au, aw);          // level 2
+    ay[0] = aw[0] + aw[1];  // level 3
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    vector<size_t> level;
+    size_t num_level = f.var_level(level);
+    ok &= num_level == 4;
+    //
+    // the two results of the call
+    size_t count = 0;
+    for(size_t i = 0; i < level.size(); ++i)
+        if( level[i] == 2 )
+            ++count;
+    ok &= count == 2;
+    //
+    return ok;
+}
+// ---------------------------------------------------------------------------
+// conditional skip operator created by the optimizer
+bool cskip_op(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    //
+    vector< AD<double> > ax(2), ay(1);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    CppAD::Independent(ax);
+    ay[0] = CppAD::CondExpLt(ax[0], ax[1], sin(ax[0]), cos(ax[1]) );
+    CppAD::ADFun<double> f(ax, ay);
+    f.optimize();
+    //
+    // sin and cos are at level 1, the conditional expression at level 2
+    vector<size_t> level;
+    size_t num_level = f.var_level(level);
+    ok &= num_level == 3;
+    ok &= level[ f.size_var() - 1 ] == 2;
+    //
+    return ok;
+}
+} // END_EMPTY_NAMESPACE
+
+bool var_level(void)
+{   bool ok = true;
+    ok     &= vecad_order();
+    ok     &= csum_op();
+    ok     &= atomic_call();
+    ok     &= cskip_op();
+    return ok;
+}